@@ -0,0 +1,320 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#include "CoinUtilsConfig.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+#define COIN_ARRAY_FILE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#endif
+
+#include "CoinArrayFile.hpp"
+
+namespace {
+const char fileMagic[8] = { 'C', 'o', 'i', 'n', 'A', 'r', 'r', 'F' };
+const CoinInt64 fileFormatVersion = 1;
+const CoinInt64 fileByteOrder = 0x0102030405060708LL;
+// sections (and table) start on multiples of this
+const CoinInt64 fileAlignment = 64;
+
+typedef struct {
+  char magic[8];
+  CoinInt64 formatVersion;
+  CoinInt64 byteOrder;
+  CoinInt64 kind;
+  CoinInt64 kindVersion;
+  CoinInt64 numberSections;
+  CoinInt64 fileLength;
+  CoinInt64 tableChecksum;
+  CoinInt64 headerChecksum;
+  // pad to 128 bytes
+  CoinInt64 spare[7];
+} CoinArrayFileHeader;
+
+typedef struct {
+  CoinInt64 id;
+  CoinInt64 elementSize;
+  CoinInt64 numberElements;
+  CoinInt64 offset;
+  CoinInt64 checksum;
+} CoinArrayFileSection;
+
+inline CoinInt64 alignUp(CoinInt64 offset)
+{
+  return ((offset + fileAlignment - 1) / fileAlignment) * fileAlignment;
+}
+
+/* Fletcher-64 checksum on 32 bit words (last word padded with zeros).
+   Sums are reduced every 1024 words so they can not overflow. */
+CoinInt64 checksum(const void *data, CoinInt64 length)
+{
+  const unsigned char *bytes = reinterpret_cast< const unsigned char * >(data);
+  const CoinUInt64 modulus = 0xffffffffULL;
+  CoinUInt64 sum1 = 0;
+  CoinUInt64 sum2 = 0;
+  CoinInt64 numberWords = length / 4;
+  CoinInt64 i = 0;
+  while (i < numberWords) {
+    CoinInt64 end = i + 1024;
+    if (end > numberWords)
+      end = numberWords;
+    for (; i < end; i++) {
+      unsigned int word;
+      memcpy(&word, bytes + 4 * i, 4);
+      sum1 += word;
+      sum2 += sum1;
+    }
+    sum1 %= modulus;
+    sum2 %= modulus;
+  }
+  if (length & 3) {
+    unsigned int word = 0;
+    memcpy(&word, bytes + 4 * numberWords, length & 3);
+    sum1 = (sum1 + word) % modulus;
+    sum2 = (sum2 + sum1) % modulus;
+  }
+  return static_cast< CoinInt64 >((sum2 << 32) | sum1);
+}
+}
+
+//#############################################################################
+// Writer
+//#############################################################################
+
+CoinArrayFileWriter::CoinArrayFileWriter(int kind, int kindVersion)
+  : kind_(kind)
+  , kindVersion_(kindVersion)
+{
+}
+
+CoinArrayFileWriter::~CoinArrayFileWriter()
+{
+}
+
+// Adds a section
+void CoinArrayFileWriter::addSection(int id, const void *array, int elementSize,
+  CoinBigIndex numberElements)
+{
+  Section section;
+  section.id = id;
+  section.elementSize = elementSize;
+  section.numberElements = array ? numberElements : 0;
+  section.array = array;
+  sections_.push_back(section);
+}
+
+// Writes file - returns 0 if okay
+int CoinArrayFileWriter::write(const char *fileName) const
+{
+  int numberSections = static_cast< int >(sections_.size());
+  std::vector< CoinArrayFileSection > table(numberSections);
+  CoinInt64 offset = alignUp(sizeof(CoinArrayFileHeader)
+    + numberSections * sizeof(CoinArrayFileSection));
+  for (int i = 0; i < numberSections; i++) {
+    const Section &section = sections_[i];
+    CoinInt64 length = static_cast< CoinInt64 >(section.elementSize)
+      * section.numberElements;
+    table[i].id = section.id;
+    table[i].elementSize = section.elementSize;
+    table[i].numberElements = section.numberElements;
+    table[i].offset = offset;
+    table[i].checksum = checksum(section.array, length);
+    offset = alignUp(offset + length);
+  }
+  CoinArrayFileHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, fileMagic, sizeof(fileMagic));
+  header.formatVersion = fileFormatVersion;
+  header.byteOrder = fileByteOrder;
+  header.kind = kind_;
+  header.kindVersion = kindVersion_;
+  header.numberSections = numberSections;
+  header.fileLength = offset;
+  header.tableChecksum = checksum(numberSections ? &table[0] : NULL,
+    numberSections * sizeof(CoinArrayFileSection));
+  header.headerChecksum = checksum(&header, sizeof(header));
+  FILE *fp = fopen(fileName, "wb");
+  if (!fp)
+    return 1;
+  bool good = fwrite(&header, sizeof(header), 1, fp) == 1;
+  if (good && numberSections)
+    good = fwrite(&table[0], sizeof(CoinArrayFileSection), numberSections, fp)
+      == static_cast< size_t >(numberSections);
+  CoinInt64 position = sizeof(header) + numberSections * sizeof(CoinArrayFileSection);
+  char zeros[fileAlignment];
+  memset(zeros, 0, sizeof(zeros));
+  for (int i = 0; i < numberSections && good; i++) {
+    const Section &section = sections_[i];
+    size_t length = static_cast< size_t >(section.elementSize)
+      * section.numberElements;
+    size_t pad = static_cast< size_t >(table[i].offset - position);
+    if (pad)
+      good = fwrite(zeros, 1, pad, fp) == pad;
+    if (good && length)
+      good = fwrite(section.array, 1, length, fp) == length;
+    position = table[i].offset + length;
+  }
+  if (good && position < header.fileLength) {
+    size_t pad = static_cast< size_t >(header.fileLength - position);
+    good = fwrite(zeros, 1, pad, fp) == pad;
+  }
+  if (fclose(fp))
+    good = false;
+  return good ? 0 : 1;
+}
+
+//#############################################################################
+// Reader
+//#############################################################################
+
+CoinArrayFileReader::CoinArrayFileReader()
+  : data_(NULL)
+  , length_(0)
+  , buffer_(NULL)
+  , mapped_(false)
+  , kind_(0)
+  , kindVersion_(0)
+  , numberSections_(0)
+{
+}
+
+CoinArrayFileReader::~CoinArrayFileReader()
+{
+  close();
+}
+
+// Frees file
+void CoinArrayFileReader::close()
+{
+#ifdef COIN_ARRAY_FILE_MMAP
+  if (mapped_)
+    munmap(const_cast< char * >(data_), static_cast< size_t >(length_));
+#endif
+  delete[] buffer_;
+  data_ = NULL;
+  length_ = 0;
+  buffer_ = NULL;
+  mapped_ = false;
+  kind_ = 0;
+  kindVersion_ = 0;
+  numberSections_ = 0;
+}
+
+// Opens file and checks it
+int CoinArrayFileReader::open(const char *fileName, bool checkSums)
+{
+  close();
+#ifdef COIN_ARRAY_FILE_MMAP
+  int fd = ::open(fileName, O_RDONLY);
+  if (fd >= 0) {
+    struct stat status;
+    if (!fstat(fd, &status) && status.st_size > 0) {
+      void *memory = mmap(NULL, static_cast< size_t >(status.st_size),
+        PROT_READ, MAP_PRIVATE, fd, 0);
+      if (memory != MAP_FAILED) {
+        data_ = reinterpret_cast< const char * >(memory);
+        length_ = status.st_size;
+        mapped_ = true;
+      }
+    }
+    ::close(fd);
+  }
+#endif
+  if (!data_) {
+    // read whole file keeping sections aligned
+    FILE *fp = fopen(fileName, "rb");
+    if (!fp)
+      return 1;
+    if (fseek(fp, 0, SEEK_END)) {
+      fclose(fp);
+      return 1;
+    }
+    long length = ftell(fp);
+    rewind(fp);
+    if (length <= 0) {
+      fclose(fp);
+      return length ? 1 : 2;
+    }
+    buffer_ = new char[length + fileAlignment];
+    char *start = buffer_;
+    start += (fileAlignment - reinterpret_cast< CoinIntPtr >(start) % fileAlignment) % fileAlignment;
+    bool good = fread(start, 1, length, fp) == static_cast< size_t >(length);
+    fclose(fp);
+    if (!good) {
+      close();
+      return 1;
+    }
+    data_ = start;
+    length_ = length;
+  }
+  // header
+  if (length_ < static_cast< CoinInt64 >(sizeof(CoinArrayFileHeader))) {
+    close();
+    return 2;
+  }
+  CoinArrayFileHeader header;
+  memcpy(&header, data_, sizeof(header));
+  if (memcmp(header.magic, fileMagic, sizeof(fileMagic))
+    || header.byteOrder != fileByteOrder
+    || header.formatVersion != fileFormatVersion
+    || header.fileLength != length_ || header.numberSections < 0
+    || static_cast< CoinInt64 >(sizeof(header) + header.numberSections * sizeof(CoinArrayFileSection)) > length_) {
+    close();
+    return 2;
+  }
+  CoinInt64 headerChecksum = header.headerChecksum;
+  header.headerChecksum = 0;
+  if (checksum(&header, sizeof(header)) != headerChecksum) {
+    close();
+    return 3;
+  }
+  numberSections_ = static_cast< int >(header.numberSections);
+  const CoinArrayFileSection *table = reinterpret_cast< const CoinArrayFileSection * >(data_ + sizeof(header));
+  if (checksum(table, numberSections_ * sizeof(CoinArrayFileSection)) != header.tableChecksum) {
+    close();
+    return 3;
+  }
+  for (int i = 0; i < numberSections_; i++) {
+    if (table[i].elementSize <= 0 || table[i].numberElements < 0
+      || table[i].offset < 0 || table[i].offset % fileAlignment
+      || table[i].numberElements > (length_ - table[i].offset) / table[i].elementSize) {
+      close();
+      return 2;
+    }
+    if (checkSums && checksum(data_ + table[i].offset, table[i].elementSize * table[i].numberElements) != table[i].checksum) {
+      close();
+      return 3;
+    }
+  }
+  kind_ = static_cast< int >(header.kind);
+  kindVersion_ = static_cast< int >(header.kindVersion);
+  return 0;
+}
+
+// Returns section with id
+const void *CoinArrayFileReader::section(int id, int elementSize,
+  CoinBigIndex &numberElements) const
+{
+  numberElements = 0;
+  const CoinArrayFileSection *table = reinterpret_cast< const CoinArrayFileSection * >(data_ + sizeof(CoinArrayFileHeader));
+  for (int i = 0; i < numberSections_; i++) {
+    if (table[i].id == id) {
+      if (table[i].elementSize != elementSize)
+        return NULL;
+      numberElements = static_cast< CoinBigIndex >(table[i].numberElements);
+      return data_ + table[i].offset;
+    }
+  }
+  return NULL;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,175 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifndef CoinArrayFile_H
+#define CoinArrayFile_H
+
+#include <cstring>
+#include <vector>
+
+#include "CoinTypes.h"
+
+/** Binary files made up of arrays.
+
+    This is used to save factorizations so that they can be read back
+    without refactorizing.  A file has a header, a table of sections
+    and then the sections.  Each section is one array and has an id,
+    an element size and a number of elements.  The header records
+    which class wrote the file (kind) and a version for that class.
+
+    All numbers are stored as on the machine which wrote the file.  The
+    header has a byte order marker so a file from a machine with
+    different byte order is rejected rather than misread.  The header,
+    the table and each section have their own checksum.
+
+    Sections start on 64 byte boundaries.  When possible the reader
+    maps the file into memory (mmap) so arrays can be used in place
+    with no parsing - only the checksums need a pass over the data.
+    Otherwise the file is read into memory with the same layout.
+*/
+
+/// Kinds of file
+enum CoinArrayFileKind {
+  CoinArrayFileFactorization = 1,
+  CoinArrayFileOslFactorization = 2,
+  CoinArrayFileSimpFactorization = 3
+};
+
+/** Writes a CoinArrayFile.
+    Sections are just remembered (not copied) until write is called. */
+class COINUTILSLIB_EXPORT CoinArrayFileWriter {
+
+public:
+  /**@name Constructor and destructor */
+  //@{
+  /// Constructor - kind and version of data
+  CoinArrayFileWriter(int kind, int kindVersion);
+  /// Destructor
+  ~CoinArrayFileWriter();
+  //@}
+
+  /**@name Adding sections and writing */
+  //@{
+  /// Adds a section (array must exist until write)
+  void addSection(int id, const void *array, int elementSize,
+    CoinBigIndex numberElements);
+  /// Adds an array as a section
+  template < class T >
+  inline void addArray(int id, const T *array, CoinBigIndex numberElements)
+  {
+    addSection(id, array, static_cast< int >(sizeof(T)), numberElements);
+  }
+  /// Writes file - returns 0 if okay, 1 if could not write
+  int write(const char *fileName) const;
+  //@}
+
+private:
+  /// Not allowed
+  CoinArrayFileWriter(const CoinArrayFileWriter &);
+  CoinArrayFileWriter &operator=(const CoinArrayFileWriter &);
+
+  /// One section
+  struct Section {
+    int id;
+    int elementSize;
+    CoinBigIndex numberElements;
+    const void *array;
+  };
+  /// Kind of data
+  int kind_;
+  /// Version of kind
+  int kindVersion_;
+  /// Sections
+  std::vector< Section > sections_;
+};
+
+/** Reads a CoinArrayFile.
+    Arrays returned point into the mapped (or read) file so are only
+    valid while the reader exists. */
+class COINUTILSLIB_EXPORT CoinArrayFileReader {
+
+public:
+  /**@name Constructor and destructor */
+  //@{
+  /// Default constructor
+  CoinArrayFileReader();
+  /// Destructor (unmaps file)
+  ~CoinArrayFileReader();
+  //@}
+
+  /**@name Reading */
+  //@{
+  /** Opens file and checks header, table and (if checkSums)
+      checksums of all sections.
+      Returns 0 if okay, 1 if could not open or read, 2 if not a valid
+      file (or from a different type of machine), 3 if a checksum is
+      wrong */
+  int open(const char *fileName, bool checkSums = true);
+  /// Frees file
+  void close();
+  /// Kind of data (0 if not open)
+  inline int kind() const
+  {
+    return kind_;
+  }
+  /// Version of kind
+  inline int kindVersion() const
+  {
+    return kindVersion_;
+  }
+  /// True if file was mapped into memory rather than read
+  inline bool mapped() const
+  {
+    return mapped_;
+  }
+  /** Returns section with id, or NULL if there is no such section
+      or it has a different element size */
+  const void *section(int id, int elementSize,
+    CoinBigIndex &numberElements) const;
+  /// Returns section with id as array (or NULL)
+  template < class T >
+  inline const T *array(int id, CoinBigIndex &numberElements) const
+  {
+    return reinterpret_cast< const T * >(section(id,
+      static_cast< int >(sizeof(T)), numberElements));
+  }
+  /** Copies section with id into array if it has exactly
+      numberElements elements.  Returns true if okay */
+  template < class T >
+  inline bool copyArray(int id, T *to, CoinBigIndex numberElements) const
+  {
+    CoinBigIndex n;
+    const T *from = array< T >(id, n);
+    if (!from || n != numberElements)
+      return false;
+    if (n)
+      memcpy(to, from, n * sizeof(T));
+    return true;
+  }
+  //@}
+
+private:
+  /// Not allowed
+  CoinArrayFileReader(const CoinArrayFileReader &);
+  CoinArrayFileReader &operator=(const CoinArrayFileReader &);
+
+  /// Start of file in memory
+  const char *data_;
+  /// Length of file
+  CoinInt64 length_;
+  /// Memory to free if not mapped
+  char *buffer_;
+  /// True if mapped
+  bool mapped_;
+  /// Kind of data
+  int kind_;
+  /// Version of kind
+  int kindVersion_;
+  /// Number of sections
+  int numberSections_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,290 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#include "CoinUtilsConfig.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "CoinCompactPackedMatrix.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+
+namespace {
+// Whether value is exactly a 16 bit integer (not -0.0)
+inline bool isInt16(double value)
+{
+  return value >= -32768.0 && value <= 32767.0
+    && value == static_cast< double >(static_cast< short >(value))
+    && (value != 0.0 || !std::signbit(value));
+}
+
+// Whether value is exactly a float (NaN is not)
+inline bool isFloat(double value)
+{
+  return value == static_cast< double >(static_cast< float >(value));
+}
+
+// Narrowest exact storage of elements of major vectors
+int narrowest(const CoinPackedMatrix &matrix)
+{
+  int storage = CoinCompactPackedMatrix::storeInt16;
+  const CoinBigIndex *start = matrix.getVectorStarts();
+  const int *length = matrix.getVectorLengths();
+  const double *element = matrix.getElements();
+  for (int i = 0; i < matrix.getMajorDim(); i++) {
+    for (CoinBigIndex j = start[i]; j < start[i] + length[i]; j++) {
+      double value = element[j];
+      if (storage == CoinCompactPackedMatrix::storeInt16 && !isInt16(value))
+        storage = CoinCompactPackedMatrix::storeFloat;
+      if (storage == CoinCompactPackedMatrix::storeFloat && !isFloat(value))
+        return CoinCompactPackedMatrix::storeDouble;
+    }
+  }
+  return storage;
+}
+
+// Copies elements without gaps as type T
+template < class T >
+void copyElements(const CoinPackedMatrix &matrix, T *to)
+{
+  const CoinBigIndex *start = matrix.getVectorStarts();
+  const int *length = matrix.getVectorLengths();
+  const double *element = matrix.getElements();
+  CoinBigIndex put = 0;
+  for (int i = 0; i < matrix.getMajorDim(); i++) {
+    for (CoinBigIndex j = start[i]; j < start[i] + length[i]; j++)
+      to[put++] = static_cast< T >(element[j]);
+  }
+}
+
+// As CoinPackedMatrix::timesMajor with elements of type T
+template < class T >
+void timesMajorT(int majorDim, int minorDim, const CoinBigIndex *COIN_RESTRICT start,
+  const int *COIN_RESTRICT index, const T *COIN_RESTRICT element,
+  const double *COIN_RESTRICT x, double *COIN_RESTRICT y)
+{
+  memset(y, 0, minorDim * sizeof(double));
+  for (int i = majorDim - 1; i >= 0; --i) {
+    const double x_i = x[i];
+    if (x_i != 0.0) {
+      const CoinBigIndex last = start[i + 1];
+      for (CoinBigIndex j = start[i]; j < last; ++j)
+        y[index[j]] += x_i * static_cast< double >(element[j]);
+    }
+  }
+}
+
+// As CoinPackedMatrix::timesMinor with elements of type T
+template < class T >
+void timesMinorT(int majorDim, const CoinBigIndex *COIN_RESTRICT start,
+  const int *COIN_RESTRICT index, const T *COIN_RESTRICT element,
+  const double *COIN_RESTRICT x, double *COIN_RESTRICT y)
+{
+  for (int i = majorDim - 1; i >= 0; --i) {
+    double y_i = 0;
+    const CoinBigIndex last = start[i + 1];
+    for (CoinBigIndex j = start[i]; j < last; ++j)
+      y_i += x[index[j]] * static_cast< double >(element[j]);
+    y[i] = y_i;
+  }
+}
+}
+
+// Default constructor
+CoinCompactPackedMatrix::CoinCompactPackedMatrix()
+  : colOrdered_(true)
+  , storage_(storeInt16)
+  , fellBack_(false)
+  , majorDim_(0)
+  , minorDim_(0)
+  , start_(NULL)
+  , index_(NULL)
+  , element_(NULL)
+{
+  gutsOfDestructor();
+}
+// Constructor from a CoinPackedMatrix
+CoinCompactPackedMatrix::CoinCompactPackedMatrix(const CoinPackedMatrix &matrix,
+  int storage)
+  : colOrdered_(true)
+  , storage_(storeInt16)
+  , fellBack_(false)
+  , majorDim_(0)
+  , minorDim_(0)
+  , start_(NULL)
+  , index_(NULL)
+  , element_(NULL)
+{
+  copyOf(matrix, storage);
+}
+// Copy constructor
+CoinCompactPackedMatrix::CoinCompactPackedMatrix(const CoinCompactPackedMatrix &rhs)
+  : colOrdered_(true)
+  , storage_(storeInt16)
+  , fellBack_(false)
+  , majorDim_(0)
+  , minorDim_(0)
+  , start_(NULL)
+  , index_(NULL)
+  , element_(NULL)
+{
+  gutsOfCopy(rhs);
+}
+// = copy
+CoinCompactPackedMatrix &
+CoinCompactPackedMatrix::operator=(const CoinCompactPackedMatrix &rhs)
+{
+  if (this != &rhs)
+    gutsOfCopy(rhs);
+  return *this;
+}
+// Destructor
+CoinCompactPackedMatrix::~CoinCompactPackedMatrix()
+{
+  delete[] start_;
+  delete[] index_;
+  delete[] static_cast< char * >(element_);
+}
+// Frees arrays and sets to empty
+void CoinCompactPackedMatrix::gutsOfDestructor()
+{
+  delete[] start_;
+  delete[] index_;
+  delete[] static_cast< char * >(element_);
+  majorDim_ = 0;
+  minorDim_ = 0;
+  // so getNumElements works when empty
+  start_ = new CoinBigIndex[1];
+  start_[0] = 0;
+  index_ = NULL;
+  element_ = NULL;
+  fellBack_ = false;
+}
+// Copies arrays of rhs
+void CoinCompactPackedMatrix::gutsOfCopy(const CoinCompactPackedMatrix &rhs)
+{
+  gutsOfDestructor();
+  colOrdered_ = rhs.colOrdered_;
+  storage_ = rhs.storage_;
+  fellBack_ = rhs.fellBack_;
+  majorDim_ = rhs.majorDim_;
+  minorDim_ = rhs.minorDim_;
+  delete[] start_;
+  start_ = CoinCopyOfArray(rhs.start_, majorDim_ + 1);
+  CoinBigIndex size = start_[majorDim_];
+  index_ = CoinCopyOfArray(rhs.index_, size);
+  size_t bytes = size * static_cast< size_t >(elementSize());
+  char *element = new char[bytes];
+  if (bytes)
+    memcpy(element, rhs.element_, bytes);
+  element_ = element;
+}
+// Narrowest storage which holds all elements of matrix exactly
+int CoinCompactPackedMatrix::exactStorage(const CoinPackedMatrix &matrix)
+{
+  return narrowest(matrix);
+}
+// Bytes per element
+int CoinCompactPackedMatrix::elementSize() const
+{
+  if (storage_ == storeInt16)
+    return static_cast< int >(sizeof(short));
+  else if (storage_ == storeFloat)
+    return static_cast< int >(sizeof(float));
+  else
+    return static_cast< int >(sizeof(double));
+}
+// Rebuilds from a CoinPackedMatrix
+int CoinCompactPackedMatrix::copyOf(const CoinPackedMatrix &matrix, int storage)
+{
+  gutsOfDestructor();
+  colOrdered_ = matrix.isColOrdered();
+  majorDim_ = matrix.getMajorDim();
+  minorDim_ = matrix.getMinorDim();
+  int exact = narrowest(matrix);
+  storage_ = CoinMax(storage, exact);
+  fellBack_ = storage >= 0 && storage < exact;
+  const CoinBigIndex *start = matrix.getVectorStarts();
+  const int *length = matrix.getVectorLengths();
+  const int *index = matrix.getIndices();
+  delete[] start_;
+  start_ = new CoinBigIndex[majorDim_ + 1];
+  start_[0] = 0;
+  for (int i = 0; i < majorDim_; i++)
+    start_[i + 1] = start_[i] + length[i];
+  CoinBigIndex size = start_[majorDim_];
+  index_ = new int[size];
+  for (int i = 0; i < majorDim_; i++)
+    CoinMemcpyN(index + start[i], length[i], index_ + start_[i]);
+  char *element = new char[size * static_cast< size_t >(elementSize())];
+  if (storage_ == storeInt16)
+    copyElements(matrix, reinterpret_cast< short * >(element));
+  else if (storage_ == storeFloat)
+    copyElements(matrix, reinterpret_cast< float * >(element));
+  else
+    copyElements(matrix, reinterpret_cast< double * >(element));
+  element_ = element;
+  return storage_;
+}
+// Puts elements (widened to double) into elements
+void CoinCompactPackedMatrix::getElements(double *elements) const
+{
+  CoinBigIndex size = start_[majorDim_];
+  if (storage_ == storeInt16) {
+    const short *element = static_cast< const short * >(element_);
+    for (CoinBigIndex j = 0; j < size; j++)
+      elements[j] = element[j];
+  } else if (storage_ == storeFloat) {
+    const float *element = static_cast< const float * >(element_);
+    for (CoinBigIndex j = 0; j < size; j++)
+      elements[j] = element[j];
+  } else {
+    CoinMemcpyN(static_cast< const double * >(element_), size, elements);
+  }
+}
+// As CoinPackedMatrix::timesMajor
+void CoinCompactPackedMatrix::timesMajor(const double *x, double *y) const
+{
+  if (storage_ == storeInt16)
+    timesMajorT(majorDim_, minorDim_, start_, index_,
+      static_cast< const short * >(element_), x, y);
+  else if (storage_ == storeFloat)
+    timesMajorT(majorDim_, minorDim_, start_, index_,
+      static_cast< const float * >(element_), x, y);
+  else
+    timesMajorT(majorDim_, minorDim_, start_, index_,
+      static_cast< const double * >(element_), x, y);
+}
+// As CoinPackedMatrix::timesMinor
+void CoinCompactPackedMatrix::timesMinor(const double *x, double *y) const
+{
+  if (storage_ == storeInt16)
+    timesMinorT(majorDim_, start_, index_,
+      static_cast< const short * >(element_), x, y);
+  else if (storage_ == storeFloat)
+    timesMinorT(majorDim_, start_, index_,
+      static_cast< const float * >(element_), x, y);
+  else
+    timesMinorT(majorDim_, start_, index_,
+      static_cast< const double * >(element_), x, y);
+}
+// Return A * x in y
+void CoinCompactPackedMatrix::times(const double *x, double *y) const
+{
+  if (colOrdered_)
+    timesMajor(x, y);
+  else
+    timesMinor(x, y);
+}
+// Return x * A in y
+void CoinCompactPackedMatrix::transposeTimes(const double *x, double *y) const
+{
+  if (colOrdered_)
+    timesMinor(x, y);
+  else
+    timesMajor(x, y);
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,174 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifndef CoinCompactPackedMatrix_H
+#define CoinCompactPackedMatrix_H
+
+#include "CoinUtilsConfig.h"
+#include "CoinTypes.h"
+
+class CoinPackedMatrix;
+
+/** Read only copy of a CoinPackedMatrix with narrow elements.
+
+    Elements are stored as 16 bit integers or as floats when every
+    element of the matrix is exactly representable that way, and are
+    widened to double as they are used in times and transposeTimes.
+    That halves or more the memory for elements and the bandwidth
+    needed to stream them, and as widening is exact the products are
+    exactly the same as those of the CoinPackedMatrix.
+
+    The storage asked for is checked against every element.  If it
+    would lose anything the next wider storage which is exact is used
+    instead (double in the worst case) and fellBack() is true.  The
+    default is to use the narrowest exact storage.
+
+    Vectors are stored without gaps.  Changes to the CoinPackedMatrix
+    afterwards are not seen - build again with copyOf.
+*/
+class COINUTILSLIB_EXPORT CoinCompactPackedMatrix {
+
+public:
+  /// How elements are stored
+  enum Storage {
+    /// Narrowest exact (only as argument)
+    storeNarrowest = -1,
+    /// 16 bit integers
+    storeInt16 = 0,
+    /// float
+    storeFloat = 1,
+    /// double
+    storeDouble = 2
+  };
+
+  /**@name Constructors, destructor and copying */
+  //@{
+  /// Default constructor (empty matrix)
+  CoinCompactPackedMatrix();
+  /** Constructor from a CoinPackedMatrix with elements stored as
+      storage if that is exact */
+  CoinCompactPackedMatrix(const CoinPackedMatrix &matrix,
+    int storage = storeNarrowest);
+  /// Copy constructor
+  CoinCompactPackedMatrix(const CoinCompactPackedMatrix &rhs);
+  /// = copy
+  CoinCompactPackedMatrix &operator=(const CoinCompactPackedMatrix &rhs);
+  /// Destructor
+  ~CoinCompactPackedMatrix();
+  /** Rebuilds from a CoinPackedMatrix.  Returns storage used which is
+      wider than asked for if that would not be exact */
+  int copyOf(const CoinPackedMatrix &matrix, int storage = storeNarrowest);
+  //@}
+
+  /**@name Gets */
+  //@{
+  /// Narrowest storage which holds all elements of matrix exactly
+  static int exactStorage(const CoinPackedMatrix &matrix);
+  /// Storage used
+  inline int storage() const
+  {
+    return storage_;
+  }
+  /// Whether storage asked for was not exact so a wider one is used
+  inline bool fellBack() const
+  {
+    return fellBack_;
+  }
+  /// Bytes per element
+  int elementSize() const;
+  /// Whether the matrix this was built from was column ordered
+  inline bool isColOrdered() const
+  {
+    return colOrdered_;
+  }
+  /// Number of major vectors
+  inline int getMajorDim() const
+  {
+    return majorDim_;
+  }
+  /// Number of minor vectors
+  inline int getMinorDim() const
+  {
+    return minorDim_;
+  }
+  /// Number of rows
+  inline int getNumRows() const
+  {
+    return colOrdered_ ? minorDim_ : majorDim_;
+  }
+  /// Number of columns
+  inline int getNumCols() const
+  {
+    return colOrdered_ ? majorDim_ : minorDim_;
+  }
+  /// Number of elements
+  inline CoinBigIndex getNumElements() const
+  {
+    return start_[majorDim_];
+  }
+  /// Starts of major vectors (majorDim+1)
+  inline const CoinBigIndex *getVectorStarts() const
+  {
+    return start_;
+  }
+  /// Minor indices
+  inline const int *getIndices() const
+  {
+    return index_;
+  }
+  /// Puts elements (widened to double) into elements
+  void getElements(double *elements) const;
+  //@}
+
+  /**@name Matrix times vector */
+  //@{
+  /** Return <code>A * x</code> in <code>y</code> (as
+      CoinPackedMatrix::times).
+      @pre <code>x</code> must be of size <code>numColumns()</code>
+      @pre <code>y</code> must be of size <code>numRows()</code> */
+  void times(const double *x, double *y) const;
+  /** Return <code>x * A</code> in <code>y</code> (as
+      CoinPackedMatrix::transposeTimes).
+      @pre <code>x</code> must be of size <code>numRows()</code>
+      @pre <code>y</code> must be of size <code>numColumns()</code> */
+  void transposeTimes(const double *x, double *y) const;
+  //@}
+
+private:
+  /**@name Private methods */
+  //@{
+  /// Frees arrays and sets to empty
+  void gutsOfDestructor();
+  /// Copies arrays of rhs
+  void gutsOfCopy(const CoinCompactPackedMatrix &rhs);
+  /// As CoinPackedMatrix::timesMajor
+  void timesMajor(const double *x, double *y) const;
+  /// As CoinPackedMatrix::timesMinor
+  void timesMinor(const double *x, double *y) const;
+  //@}
+
+  /**@name Data */
+  //@{
+  /// Whether built from column ordered matrix
+  bool colOrdered_;
+  /// Storage used
+  int storage_;
+  /// Whether wider storage than asked for was used
+  bool fellBack_;
+  /// Number of major vectors
+  int majorDim_;
+  /// Number of minor vectors
+  int minorDim_;
+  /// Starts of major vectors
+  CoinBigIndex *start_;
+  /// Minor indices
+  int *index_;
+  /// Elements (short, float or double as storage_)
+  void *element_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
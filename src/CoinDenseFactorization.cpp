@@ -13,10 +13,14 @@
 #include "CoinHelperFunctions.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinFinite.hpp"
+#include "CoinFactorizationStatistics.hpp"
 #if COIN_BIG_DOUBLE == 1
 #undef COIN_FACTORIZATION_DENSE_CODE
 #endif
-#ifdef COIN_FACTORIZATION_DENSE_CODE
+#if COIN_FACTORIZATION_DENSE_CODE == 4
+// built in
+#include "CoinDenseLU.hpp"
+#elif defined(COIN_FACTORIZATION_DENSE_CODE)
 // using simple lapack interface
 extern "C" {
   /** LAPACK Fortran subroutine DGETRF. */
@@ -189,13 +193,19 @@ void CoinDenseFactorization::preProcess()
 //Does factorization
 int CoinDenseFactorization::factor()
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::factorizePhase);
   numberPivots_ = 0;
   status_ = 0;
 #ifdef COIN_FACTORIZATION_DENSE_CODE
   if (numberRows_ == numberColumns_ && (solveMode_ % 10) != 0) {
+#if COIN_FACTORIZATION_DENSE_CODE == 4
+    int info = CoinDenseLUFactor(numberRows_, elements_, numberRows_, pivotRow_);
+#else
     int info;
     COINUTILS_LAPACK_FUNC(dgetrf,DGETRF)(&numberRows_,&numberRows_,
                                     elements_,&numberRows_,pivotRow_,&info);
+#endif
     // need to check size of pivots
     if (!info) {
       // OK
@@ -213,6 +223,8 @@ int CoinDenseFactorization::factor()
       if (smallest<1.0e-8)
 	printf("small el %g\n",smallest);
 #endif
+      if (statistics_)
+        statistics_->addFactorization(numberRows_, numberElements(), 0);
       return 0;
     } else {
       solveMode_ = 10 * (solveMode_ / 10);
@@ -282,6 +294,8 @@ int CoinDenseFactorization::factor()
     int k = pivotRow_[j + numberRows_];
     pivotRow_[k] = j;
   }
+  if (statistics_ && !status_)
+    statistics_->addFactorization(numberRows_, numberElements(), 0);
   return status_;
 }
 // Makes a non-singular basis by replacing variables
@@ -359,6 +373,8 @@ int CoinDenseFactorization::replaceColumn(CoinIndexedVector *regionSparse,
   bool /*checkBeforeModifying*/,
   double /*acceptablePivot*/)
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::replaceColumnPhase);
   if (numberPivots_ == maximumPivots_)
     return 3;
   CoinFactorizationDouble2 *elements = elements_ + numberRows_ * (numberColumns_ + numberPivots_);
@@ -423,14 +439,28 @@ int CoinDenseFactorization::replaceColumn(CoinIndexedVector *regionSparse,
   }
 #endif
   numberPivots_++;
+  if (statistics_)
+    statistics_->setUpdateElements(numberPivots_ * numberRows_);
   return 0;
 }
+/* Updates one column (FTRAN) from regionSparse2
+   number returned is negative if no room */
+int CoinDenseFactorization::updateColumnFT(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2,
+  bool)
+{
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::ftranFTPhase);
+  return updateColumn(regionSparse, regionSparse2);
+}
 /* This version has same effect as above with FTUpdate==false
    so number returned is always >=0 */
 int CoinDenseFactorization::updateColumn(CoinIndexedVector *regionSparse,
   CoinIndexedVector *regionSparse2,
   bool noPermute) const
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::ftranPhase);
   assert(numberRows_ == numberColumns_);
   double *region2 = regionSparse2->denseVector();
   int *regionIndex = regionSparse2->getIndices();
@@ -509,12 +539,16 @@ int CoinDenseFactorization::updateColumn(CoinIndexedVector *regionSparse,
     }
 #ifdef COIN_FACTORIZATION_DENSE_CODE
   } else {
+#if COIN_FACTORIZATION_DENSE_CODE == 4
+    CoinDenseLUSolve(false, numberRows_, elements_, numberRows_, pivotRow_, region);
+#else
     char trans = 'N';
     int ione = 1;
     int info;
     COINUTILS_LAPACK_FUNC(dgetrs,DGETRS)(&trans,&numberRows_,&ione,
                      elements_,&numberRows_,pivotRow_,region,&numberRows_,
                      &info,1);
+#endif
   }
 #endif
   // now updates
@@ -619,6 +653,8 @@ int CoinDenseFactorization::updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
   CoinIndexedVector *regionSparse3,
   bool /*noPermute*/)
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::ftranTwoPhase);
 #ifdef COIN_FACTORIZATION_DENSE_CODE
 #if 0
   CoinIndexedVector s2(*regionSparse2);
@@ -670,11 +706,17 @@ int CoinDenseFactorization::updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
     }
     int i;
     CoinFactorizationDouble2 *elements = elements_;
+#if COIN_FACTORIZATION_DENSE_CODE == 4
+    CoinDenseLUSolve(false, numberRows_, elements_, numberRows_, pivotRow_, workArea_);
+    CoinDenseLUSolve(false, numberRows_, elements_, numberRows_, pivotRow_,
+      workArea_ + numberRows_);
+#else
     char trans = 'N';
     int itwo = 2;
     int info;
     COINUTILS_LAPACK_FUNC(dgetrs,DGETRS)(&trans,&numberRows_,&itwo,elements_,
                      &numberRows_,pivotRow_,workArea_,&numberRows_,&info,1);
+#endif
     // now updates
     elements = elements_ + numberRows_ * numberRows_;
     for (i = 0; i < numberPivots_; i++) {
@@ -758,6 +800,8 @@ int CoinDenseFactorization::updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
 int CoinDenseFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
   CoinIndexedVector *regionSparse2) const
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::btranPhase);
   assert(numberRows_ == numberColumns_);
   double *region2 = regionSparse2->denseVector();
   int *regionIndex = regionSparse2->getIndices();
@@ -847,11 +891,15 @@ int CoinDenseFactorization::updateColumnTranspose(CoinIndexedVector *regionSpars
     }
 #ifdef COIN_FACTORIZATION_DENSE_CODE
   } else {
+#if COIN_FACTORIZATION_DENSE_CODE == 4
+    CoinDenseLUSolve(true, numberRows_, elements_, numberRows_, pivotRow_, region);
+#else
     char trans = 'T';
     int ione = 1;
     int info;
     COINUTILS_LAPACK_FUNC(dgetrs,DGETRS)(&trans,&numberRows_,&ione,elements_,
                      &numberRows_,pivotRow_,region,&numberRows_,&info,1);
+#endif
   }
 #endif
   // permute back and get nonzeros
@@ -925,6 +973,7 @@ CoinOtherFactorization::CoinOtherFactorization()
   , numberPivots_(0)
   , status_(-1)
   , solveMode_(0)
+  , statistics_(NULL)
 {
 }
 // Copy constructor
@@ -945,6 +994,7 @@ CoinOtherFactorization::CoinOtherFactorization(const CoinOtherFactorization &oth
   , numberPivots_(other.numberPivots_)
   , status_(other.status_)
   , solveMode_(other.solveMode_)
+  , statistics_(NULL)
 {
 }
 // Destructor
@@ -1056,6 +1106,55 @@ bool CoinOtherFactorization::wantsTableauColumn() const
 void CoinOtherFactorization::setUsefulInformation(const int *, int)
 {
 }
+// Saves factors - not supported unless overridden
+int CoinOtherFactorization::saveFactors(const char *) const
+{
+  return -1;
+}
+// Restores factors - not supported unless overridden
+int CoinOtherFactorization::restoreFactors(const char *)
+{
+  return -1;
+}
+// Puts scalars of base class in arrays
+void CoinOtherFactorization::getBaseScalars(int *integers, double *doubles) const
+{
+  integers[0] = factorElements_;
+  integers[1] = numberRows_;
+  integers[2] = numberColumns_;
+  integers[3] = numberGoodU_;
+  integers[4] = maximumPivots_;
+  integers[5] = numberPivots_;
+  integers[6] = status_;
+  integers[7] = maximumRows_;
+  integers[8] = maximumSpace_;
+  integers[9] = solveMode_;
+  doubles[0] = pivotTolerance_;
+  doubles[1] = zeroTolerance_;
+  doubles[2] = slackValue_;
+  doubles[3] = relaxCheck_;
+}
+// Sets scalars of base class from arrays
+void CoinOtherFactorization::setBaseScalars(const int *integers,
+  const double *doubles)
+{
+  factorElements_ = integers[0];
+  numberRows_ = integers[1];
+  numberColumns_ = integers[2];
+  numberGoodU_ = integers[3];
+  maximumPivots_ = integers[4];
+  numberPivots_ = integers[5];
+  status_ = integers[6];
+  maximumRows_ = integers[7];
+  maximumSpace_ = integers[8];
+  solveMode_ = integers[9];
+  pivotTolerance_ = doubles[0];
+  zeroTolerance_ = doubles[1];
+#ifndef COIN_FAST_CODE
+  slackValue_ = doubles[2];
+#endif
+  relaxCheck_ = doubles[3];
+}
 
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
 */
@@ -19,6 +19,7 @@
 #undef COIN_FACTORIZATION_DENSE_CODE
 #endif
 class CoinPackedMatrix;
+class CoinFactorizationStatistics;
 /// Abstract base class which also has some scalars so can be used from Dense or Simp
 class COINUTILSLIB_EXPORT CoinOtherFactorization {
 
@@ -159,6 +160,26 @@ public:
   virtual void setUsefulInformation(const int *info, int whereFrom);
   /// Get rid of all memory
   virtual void clearArrays() {}
+  /** Saves factors in binary form (see CoinArrayFile.hpp) so they can
+      be restored without factorizing.
+      Returns 0 if okay, 1 if could not write, -1 if not supported
+      or not factorized */
+  virtual int saveFactors(const char *file) const;
+  /** Restores factors saved by saveFactors.
+      Returns 0 if okay, 1 if could not read, 2 if not a valid file,
+      3 if a checksum is wrong, -1 if not supported */
+  virtual int restoreFactors(const char *file);
+  /** Attaches timers and counters (see CoinFactorizationStatistics).
+      Not owned - NULL detaches.  Copies are not attached */
+  inline void setStatistics(CoinFactorizationStatistics *statistics)
+  {
+    statistics_ = statistics;
+  }
+  /// Attached timers and counters (NULL if none)
+  inline CoinFactorizationStatistics *statistics() const
+  {
+    return statistics_;
+  }
   //@}
   /**@name virtual general stuff such as permutation */
   //@{
@@ -244,6 +265,19 @@ public:
 
   ////////////////// data //////////////////
 protected:
+  /**@name Used by saveFactors and restoreFactors */
+  //@{
+  /// Number of integers and doubles in base class scalars
+  enum {
+    numberSavedBaseIntegers = 10,
+    numberSavedBaseDoubles = 4
+  };
+  /// Puts scalars of base class in arrays
+  void getBaseScalars(int *integers, double *doubles) const;
+  /// Sets scalars of base class from arrays
+  void setBaseScalars(const int *integers, const double *doubles);
+  //@}
+
   /**@name data */
   //@{
   /// Pivot tolerance
@@ -292,6 +326,8 @@ protected:
       if 8 set then has iterated
   */
   int solveMode_;
+  /// Timers and counters if attached (not owned)
+  CoinFactorizationStatistics *statistics_;
   //@}
 };
 /** This deals with Factorization and Updates
@@ -379,12 +415,9 @@ public:
       regionSparse starts as zero and is zero at end.
       Note - if regionSparse2 packed on input - will be packed on output
   */
-  virtual inline int updateColumnFT(CoinIndexedVector *regionSparse,
+  virtual int updateColumnFT(CoinIndexedVector *regionSparse,
     CoinIndexedVector *regionSparse2,
-    bool = false)
-  {
-    return updateColumn(regionSparse, regionSparse2);
-  }
+    bool = false);
   /** This version has same effect as above with FTUpdate==false
       so number returned is always >=0 */
   virtual int updateColumn(CoinIndexedVector *regionSparse,
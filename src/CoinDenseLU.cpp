@@ -0,0 +1,270 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#include "CoinUtilsConfig.h"
+
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+
+#include "CoinDenseLU.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinThreadPool.hpp"
+
+// Number of columns in a panel
+#define COIN_DENSE_BLOCK 32
+// Number of rows done at a time when updating trailing matrix
+#define COIN_DENSE_ROW_BLOCK 512
+// Only use threads if trailing update has this many elements
+#define COIN_DENSE_THREAD_WORK 65536
+
+namespace {
+// Factorizes columns j0 to j1-1 (rows j0 to n-1) - returns info
+int factorPanel(int n, double *COIN_RESTRICT a, int lda, int *COIN_RESTRICT ipiv,
+  int j0, int j1)
+{
+  int info = 0;
+  for (int j = j0; j < j1; j++) {
+    double *COIN_RESTRICT column = a + j * lda;
+    // find pivot
+    int pivotRow = j;
+    double largest = fabs(column[j]);
+    for (int i = j + 1; i < n; i++) {
+      double value = fabs(column[i]);
+      if (value > largest) {
+        largest = value;
+        pivotRow = i;
+      }
+    }
+    ipiv[j] = pivotRow + 1;
+    if (largest == 0.0) {
+      // singular - carry on as LAPACK does
+      if (!info)
+        info = j + 1;
+      continue;
+    }
+    if (pivotRow != j) {
+      // swap in panel only (rest done later)
+      double *COIN_RESTRICT columnA = a + j0 * lda;
+      for (int k = j0; k < j1; k++) {
+        double value = columnA[j];
+        columnA[j] = columnA[pivotRow];
+        columnA[pivotRow] = value;
+        columnA += lda;
+      }
+    }
+    double pivotValue = column[j];
+    if (fabs(pivotValue) >= DBL_MIN) {
+      double multiplier = 1.0 / pivotValue;
+      for (int i = j + 1; i < n; i++)
+        column[i] *= multiplier;
+    } else {
+      for (int i = j + 1; i < n; i++)
+        column[i] /= pivotValue;
+    }
+    // update rest of panel
+    for (int k = j + 1; k < j1; k++) {
+      double *COIN_RESTRICT columnK = a + k * lda;
+      double value = columnK[j];
+      if (value) {
+        for (int i = j + 1; i < n; i++)
+          columnK[i] -= value * column[i];
+      }
+    }
+  }
+  return info;
+}
+
+/* Updates columns kStart to kEnd-1 after panel j0 to j1-1.
+   Does row swaps, solve with unit lower triangle of panel and
+   then subtracts L21*U12 a block of rows at a time */
+void updateTrailing(int n, double *COIN_RESTRICT a, int lda,
+  const int *COIN_RESTRICT ipiv, int j0, int j1, int kStart, int kEnd)
+{
+  for (int k = kStart; k < kEnd; k++) {
+    double *COIN_RESTRICT columnK = a + k * lda;
+    for (int j = j0; j < j1; j++) {
+      int pivotRow = ipiv[j] - 1;
+      if (pivotRow != j) {
+        double value = columnK[j];
+        columnK[j] = columnK[pivotRow];
+        columnK[pivotRow] = value;
+      }
+    }
+    for (int j = j0; j < j1; j++) {
+      double value = columnK[j];
+      if (value) {
+        const double *COIN_RESTRICT columnJ = a + j * lda;
+        for (int i = j + 1; i < j1; i++)
+          columnK[i] -= value * columnJ[i];
+      }
+    }
+  }
+  for (int iStart = j1; iStart < n; iStart += COIN_DENSE_ROW_BLOCK) {
+    int iEnd = CoinMin(iStart + COIN_DENSE_ROW_BLOCK, n);
+    for (int k = kStart; k < kEnd; k++) {
+      double *COIN_RESTRICT columnK = a + k * lda;
+      int j = j0;
+      // four panel columns at a time
+      for (; j + 3 < j1; j += 4) {
+        double value0 = columnK[j];
+        double value1 = columnK[j + 1];
+        double value2 = columnK[j + 2];
+        double value3 = columnK[j + 3];
+        if (!value0 && !value1 && !value2 && !value3)
+          continue;
+        const double *COIN_RESTRICT column0 = a + j * lda;
+        const double *COIN_RESTRICT column1 = column0 + lda;
+        const double *COIN_RESTRICT column2 = column1 + lda;
+        const double *COIN_RESTRICT column3 = column2 + lda;
+        for (int i = iStart; i < iEnd; i++)
+          columnK[i] -= (value0 * column0[i] + value1 * column1[i])
+            + (value2 * column2[i] + value3 * column3[i]);
+      }
+      for (; j < j1; j++) {
+        double value = columnK[j];
+        if (value) {
+          const double *COIN_RESTRICT columnJ = a + j * lda;
+          for (int i = iStart; i < iEnd; i++)
+            columnK[i] -= value * columnJ[i];
+        }
+      }
+    }
+  }
+}
+
+typedef struct {
+  double *a;
+  const int *ipiv;
+  int n;
+  int lda;
+  int j0;
+  int j1;
+  int numberTasks;
+} CoinDenseUpdateInfo;
+
+void updateTrailingTask(void *info, int which)
+{
+  CoinDenseUpdateInfo *update = reinterpret_cast< CoinDenseUpdateInfo * >(info);
+  int numberColumns = update->n - update->j1;
+  int kStart = update->j1 + (which * numberColumns) / update->numberTasks;
+  int kEnd = update->j1 + ((which + 1) * numberColumns) / update->numberTasks;
+  updateTrailing(update->n, update->a, update->lda, update->ipiv,
+    update->j0, update->j1, kStart, kEnd);
+}
+}
+
+// Factorizes n by n matrix a as P*L*U (like dgetrf)
+int CoinDenseLUFactor(int n, double *a, int lda, int *ipiv,
+  CoinThreadPool *pool)
+{
+  assert(lda >= n);
+  int info = 0;
+  for (int j0 = 0; j0 < n; j0 += COIN_DENSE_BLOCK) {
+    int j1 = CoinMin(j0 + COIN_DENSE_BLOCK, n);
+    int infoPanel = factorPanel(n, a, lda, ipiv, j0, j1);
+    if (infoPanel && !info)
+      info = infoPanel;
+    // row swaps to left of panel
+    for (int j = j0; j < j1; j++) {
+      int pivotRow = ipiv[j] - 1;
+      if (pivotRow != j) {
+        double *COIN_RESTRICT columnK = a;
+        for (int k = 0; k < j0; k++) {
+          double value = columnK[j];
+          columnK[j] = columnK[pivotRow];
+          columnK[pivotRow] = value;
+          columnK += lda;
+        }
+      }
+    }
+    int numberColumns = n - j1;
+    if (!numberColumns)
+      break;
+    int numberTasks = 1;
+    if (pool && static_cast< double >(numberColumns) * (n - j0) > COIN_DENSE_THREAD_WORK)
+      numberTasks = CoinMin(pool->numberThreads(),
+        (numberColumns + COIN_DENSE_BLOCK - 1) / COIN_DENSE_BLOCK);
+    if (numberTasks > 1) {
+      CoinDenseUpdateInfo update;
+      update.a = a;
+      update.ipiv = ipiv;
+      update.n = n;
+      update.lda = lda;
+      update.j0 = j0;
+      update.j1 = j1;
+      update.numberTasks = numberTasks;
+      pool->run(numberTasks, updateTrailingTask, &update);
+    } else {
+      updateTrailing(n, a, lda, ipiv, j0, j1, j1, n);
+    }
+  }
+  return info;
+}
+
+// Solves A*x=b or A'*x=b using factors (like dgetrs)
+void CoinDenseLUSolve(bool transpose, int n, const double *a, int lda,
+  const int *ipiv, double *b)
+{
+  double *COIN_RESTRICT region = b;
+  if (!transpose) {
+    for (int i = 0; i < n; i++) {
+      int pivotRow = ipiv[i] - 1;
+      if (pivotRow != i) {
+        double value = region[i];
+        region[i] = region[pivotRow];
+        region[pivotRow] = value;
+      }
+    }
+    // L
+    const double *COIN_RESTRICT column = a;
+    for (int j = 0; j < n; j++) {
+      double value = region[j];
+      if (value) {
+        for (int i = j + 1; i < n; i++)
+          region[i] -= value * column[i];
+      }
+      column += lda;
+    }
+    // U
+    for (int j = n - 1; j >= 0; j--) {
+      column = a + j * lda;
+      double value = region[j];
+      if (value) {
+        value /= column[j];
+        region[j] = value;
+        for (int i = 0; i < j; i++)
+          region[i] -= value * column[i];
+      }
+    }
+  } else {
+    // U transpose
+    const double *COIN_RESTRICT column = a;
+    for (int j = 0; j < n; j++) {
+      double value = region[j];
+      for (int i = 0; i < j; i++)
+        value -= column[i] * region[i];
+      region[j] = value / column[j];
+      column += lda;
+    }
+    // L transpose
+    for (int j = n - 2; j >= 0; j--) {
+      column = a + j * lda;
+      double value = region[j];
+      for (int i = j + 1; i < n; i++)
+        value -= column[i] * region[i];
+      region[j] = value;
+    }
+    for (int i = n - 1; i >= 0; i--) {
+      int pivotRow = ipiv[i] - 1;
+      if (pivotRow != i) {
+        double value = region[i];
+        region[i] = region[pivotRow];
+        region[pivotRow] = value;
+      }
+    }
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
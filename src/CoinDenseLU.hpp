@@ -0,0 +1,51 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifndef CoinDenseLU_H
+#define CoinDenseLU_H
+
+#include <cstddef>
+
+#include "CoinUtilsConfig.h"
+
+class CoinThreadPool;
+
+/** Dense LU factorization with partial pivoting.
+
+    These are built in replacements for the LAPACK routines dgetrf and
+    dgetrs (one right hand side) as used by the dense part of
+    CoinFactorization and by CoinDenseFactorization.  Storage is the
+    same as LAPACK - a is column major with leading dimension lda and
+    ipiv holds pivot rows counting from 1 - so results can be used
+    interchangeably.
+
+    The factorization works on blocks of columns.  A narrow panel is
+    factorized and then the rest of the matrix is updated a block of
+    rows at a time so that the panel stays in cache.  Inner loops are
+    simple unit stride loops which the compiler can vectorize.  If a
+    thread pool is passed the update of the trailing columns is shared
+    out among threads.  Each column is always updated in the same order
+    so the result does not depend on the number of threads.
+*/
+
+/**@name Dense LU */
+//@{
+/** Factorizes the n by n matrix a as P*L*U (like dgetrf).
+    Returns 0 if okay, or i+1 if U(i,i) is exactly zero (the
+    factorization is still completed as in LAPACK). */
+COINUTILSLIB_EXPORT
+int CoinDenseLUFactor(int n, double *a, int lda, int *ipiv,
+  CoinThreadPool *pool = NULL);
+/** Solves A*x=b (or A'*x=b if transpose) using factors from
+    CoinDenseLUFactor (like dgetrs with one right hand side).
+    b is overwritten by x.  Zeros in b are skipped in the forward
+    solve so sparse right hand sides are cheaper. */
+COINUTILSLIB_EXPORT
+void CoinDenseLUSolve(bool transpose, int n, const double *a, int lda,
+  const int *ipiv, double *b);
+//@}
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -22,6 +22,10 @@
 #include "CoinIndexedVector.hpp"
 
 class CoinPackedMatrix;
+class CoinThreadPool;
+class CoinFactorizationView;
+class CoinFactorizationPivotBatch;
+class CoinFactorizationStatistics;
 /** This deals with Factorization and Updates
 
     This class started with a parallel simplex code I was writing in the
@@ -48,6 +52,7 @@ class CoinPackedMatrix;
 
 class COINUTILSLIB_EXPORT CoinFactorization {
   friend void CoinFactorizationUnitTest(const std::string &mpsDir);
+  friend class CoinFactorizationView;
 
 public:
   /**@name Constructors and destructor and copy */
@@ -71,6 +76,14 @@ public:
   */
   int restoreFactorization(const char *file, bool factor = false);
 #endif
+  /** Saves factors in binary form (see CoinArrayFile.hpp) so they can
+      be restored without factorizing.  May be called after updates.
+      Returns 0 if okay, 1 if could not write, -1 if not factorized */
+  int saveFactors(const char *file) const;
+  /** Restores factors saved by saveFactors.
+      Returns 0 if okay, 1 if could not read, 2 if not a valid file
+      (factorization is then empty), 3 if a checksum is wrong */
+  int restoreFactors(const char *file);
   /// Debug - sort so can compare
   void sort() const;
   /// = copy
@@ -304,7 +317,9 @@ public:
   {
     return denseThreshold_;
   }
-  /// Sets dense threshold
+  /** Sets dense threshold.
+      Without LAPACK the default is 0 (no dense part) - setting a value
+      (e.g. 71) switches on the built in dense LU */
   inline void setDenseThreshold(int value)
   {
     denseThreshold_ = value;
@@ -620,6 +635,48 @@ public:
     CoinIndexedVector *regionSparse2) const;
   /// Part of twocolumnsTranspose
   void updateOneColumnTranspose(CoinIndexedVector *regionWork, int &statistics) const;
+  /** Updates several columns (FTRAN) at once.
+      regionSparse2[i] is updated using work region regionSparse[i]
+      exactly as updateColumn(regionSparse[i],regionSparse2[i]) would.
+      If numberThreads() > 1 the columns are shared out among threads
+      which all use this factorization - each thread has its own
+      sparse work area.  In that case sparsity statistics are not
+      collected for these columns.
+      Returns total number of elements in updated columns */
+  int updateColumns(int numberColumns,
+    CoinIndexedVector **regionSparse,
+    CoinIndexedVector **regionSparse2) const;
+  /** Updates several columns (BTRAN) at once - see updateColumns */
+  int updateColumnsTranspose(int numberColumns,
+    CoinIndexedVector **regionSparse,
+    CoinIndexedVector **regionSparse2) const;
+  /// Number of threads used by updateColumns and updateColumnsTranspose
+  inline int numberThreads() const
+  {
+    return numberThreads_;
+  }
+  /** Sets number of threads for updateColumns etc.
+      Only has effect if CoinUtils was built with threads */
+  void setNumberThreads(int value);
+  /// Maximum number of pivots chosen at once in sparse part of factorize
+  inline int pivotBatch() const
+  {
+    return pivotBatch_;
+  }
+  /** Sets maximum number of pivots chosen at once in sparse part of
+      factorize (0 or 1 - one at a time as normal).
+      When normal search finds a pivot which is not a singleton more
+      candidates from the count lists are looked at.  Those with cost
+      not much worse and whose rows and columns do not meet those of
+      pivots already chosen are eliminated together.  Looking at
+      candidates and eliminating are shared among threads if
+      numberThreads() > 1.  Choice of pivots does not depend on number
+      of threads so factors are the same for any number of threads
+      (but not the same as one at a time). */
+  inline void setPivotBatch(int value)
+  {
+    pivotBatch_ = value;
+  }
   /** Updates two columns (BTRAN) from regionSparse2 and 3
       regionSparse starts as zero and is zero at end 
       Note - if regionSparse2 packed on input - will be packed on output - same for 3
@@ -707,9 +764,30 @@ public:
   /// 1 bit - tolerances etc, 2 more, 4 dummy arrays
   void gutsOfInitialize(int type);
   void gutsOfCopy(const CoinFactorization &other);
+  /// Copies scalars (sizes, counts and tolerances)
+  void gutsOfCopyScalars(const CoinFactorization &other);
+  /** Sets up to solve with factors of other without copying them -
+      only a sparse work area is allocated.  Used by CoinFactorizationView.
+      other must not change while this uses it */
+  void shareFactors(const CoinFactorization &other);
+  /** Copies everything a Forrest-Tomlin update can change (U, R and
+      permutations) from other so updates leave shared factors alone.
+      L and dense part stay shared */
+  void copyUpdates(const CoinFactorization &other);
 
   /// Reset all sparsity etc statistics
   void resetStatistics();
+  /** Attaches timers and counters (see CoinFactorizationStatistics).
+      Not owned - NULL detaches.  Copies are not attached */
+  inline void setStatistics(CoinFactorizationStatistics *statistics)
+  {
+    statistics_ = statistics;
+  }
+  /// Attached timers and counters (NULL if none)
+  inline CoinFactorizationStatistics *statistics() const
+  {
+    return statistics_;
+  }
 
   //@}
 
@@ -737,6 +815,22 @@ protected:
   /** Does sparse phase of factorization (for larger problems)
       return code is <0 error, 0= finished */
   int factorSparseLarge();
+  /** Eliminates a batch of pivots starting with pivotRow,pivotColumn
+      (see setPivotBatch).  minimumCost is cost of first pivot.
+      Returns number of pivots done (0 if first pivot should be done
+      as normal) or -99 if not enough memory */
+  int pivotInBatch(CoinFactorizationPivotBatch &batch, int count,
+    int pivotRow, int pivotColumn, double minimumCost);
+  /** Eliminates one pivot of batch.  As pivot() but all space is
+      already there and linked lists are done afterwards, so pivots with
+      disjoint rows and columns can be done at same time.
+      iTask says which work areas to use */
+  void pivotDisjoint(CoinFactorizationPivotBatch &batch, int which,
+    int iTask);
+  /// Looks at candidates for batch (task for threads)
+  static void pivotCandidatesTask(void *info, int which);
+  /// Eliminates pivots of batch (task for threads)
+  static void pivotDisjointTask(void *info, int which);
   /** Does dense phase of factorization
       return code is <0 error, 0= finished */
   int factorDense();
@@ -832,6 +926,34 @@ protected:
   /// Sets up all array pointers
   void setupPointers();
 
+  /// Sparse work area for this thread (one per thread in updateColumns)
+  inline int *sparseWorkArea() const
+  {
+    if (numberBatchThreads_)
+      return threadSparseArea();
+    return sparseArray_;
+  }
+  /// Sparse work area for this thread when doing updateColumns
+  int *threadSparseArea() const;
+  /// Where this thread counts solve paths (NULL if none)
+  inline CoinFactorizationStatistics *solveStatistics() const
+  {
+    if (numberBatchThreads_)
+      return threadSolveStatistics();
+    return statistics_;
+  }
+  /// Where this thread counts solve paths when doing updateColumns
+  CoinFactorizationStatistics *threadSolveStatistics() const;
+  /// Size of a sparse work area (0 if not sparse)
+  int sparseAreaSize() const;
+  /// Gets sparse work areas (and threads) for updateColumns
+  void startBatch() const;
+  /// Does updateColumns (or updateColumnsTranspose if transpose)
+  int updateColumnsBatch(int numberColumns,
+    CoinIndexedVector **regionSparse,
+    CoinIndexedVector **regionSparse2,
+    bool transpose) const;
+
   /// Updates part of column (FTRANL)
   void updateColumnL(CoinIndexedVector *region, int *COIN_RESTRICT indexIn) const;
   /// Updates part of column (FTRANL) when densish
@@ -840,6 +962,13 @@ protected:
   void updateColumnLSparse(CoinIndexedVector *region, int *COIN_RESTRICT indexIn) const;
   /// Updates part of column (FTRANL) when sparsish
   void updateColumnLSparsish(CoinIndexedVector *region, int *COIN_RESTRICT indexIn) const;
+  /** Symbolic reach in L of indexIn (FTRANL).  Pivots are left in order
+      on list part of sparse work area.  Returns size of reach or -1 if
+      more than maximumReach (work area is then left clean) */
+  int reachL(const int *COIN_RESTRICT indexIn, int number, int maximumReach) const;
+  /// Updates part of column (FTRANL) using reach from reachL
+  void updateColumnLReach(CoinIndexedVector *region, int *COIN_RESTRICT indexIn,
+    int numberReach) const;
 
   /// Updates part of column (FTRANR) without FT update
   void updateColumnR(CoinIndexedVector *region) const;
@@ -856,6 +985,14 @@ protected:
   /// Updates part of column (FTRANU) when sparsish
   void updateColumnUSparsish(CoinIndexedVector *regionSparse,
     int *COIN_RESTRICT indexIn) const;
+  /** Symbolic reach in U of indexIn (FTRANU) - as reachL but slacks
+      are kept separately (numberSlacks of them at end of stack part).
+      Returns number of non slacks or -1 if too big */
+  int reachU(const int *COIN_RESTRICT indexIn, int number, int maximumReach,
+    int &numberSlacks) const;
+  /// Updates part of column (FTRANU) using reach from reachU
+  void updateColumnUReach(CoinIndexedVector *regionSparse, int numberReach,
+    int numberSlacks) const;
   /// Updates part of column (FTRANU)
   int updateColumnUDensish(double *COIN_RESTRICT region,
     int *COIN_RESTRICT regionIndex) const;
@@ -890,6 +1027,12 @@ protected:
   /** Updates part of column transpose (BTRANU) when sparse,
       assumes index is sorted i.e. region is correct */
   void updateColumnTransposeUSparse(CoinIndexedVector *region) const;
+  /** Symbolic reach in row copy of U of region (BTRANU).  Pivots are
+      left in order on list part of sparse work area.  Returns size of
+      reach or -1 if more than maximumReach (work area is then left clean) */
+  int reachTransposeU(const CoinIndexedVector *region, int maximumReach) const;
+  /// Updates part of column transpose (BTRANU) using reach from reachTransposeU
+  void updateColumnTransposeUReach(CoinIndexedVector *region, int numberReach) const;
   /** Updates part of column transpose (BTRANU) by column
       assumes index is sorted i.e. region is correct */
   void updateColumnTransposeUByColumn(CoinIndexedVector *region,
@@ -912,6 +1055,10 @@ protected:
   void updateColumnTransposeLSparsish(CoinIndexedVector *region) const;
   /// Updates part of column transpose (BTRANL) when sparse (by Row)
   void updateColumnTransposeLSparse(CoinIndexedVector *region) const;
+  /// Symbolic reach in row copy of L of region (BTRANL) - see reachTransposeU
+  int reachTransposeL(const CoinIndexedVector *region, int maximumReach) const;
+  /// Updates part of column transpose (BTRANL) using reach from reachTransposeL
+  void updateColumnTransposeLReach(CoinIndexedVector *region, int numberReach) const;
 
 public:
   /** Replaces one Column to basis for PFI
@@ -1660,6 +1807,8 @@ protected:
 #else
 #define collectStatistics_ 1
 #endif
+  /// Timers and counters if attached (not owned)
+  CoinFactorizationStatistics *statistics_;
 
   /// Below this use sparse technology - if 0 then no L row copy
   int sparseThreshold_;
@@ -1678,6 +1827,26 @@ protected:
 
   /// Sparse regions
   mutable CoinIntArrayWithLength sparse_;
+  /// Number of threads for updateColumns etc
+  int numberThreads_;
+  /// Threads for updateColumns etc (created when needed)
+  mutable CoinThreadPool *threadPool_;
+  /// Sparse regions for threads other than first
+  mutable int *threadSparse_;
+  /// Size of one sparse region in threadSparse_
+  mutable int threadSparseSize_;
+  /// Number of sparse regions in threadSparse_
+  mutable int numberThreadSparse_;
+  /** Solve paths counted by each thread while updateColumns is
+      running (NULL if no statistics attached) */
+  mutable CoinFactorizationStatistics *threadStatistics_;
+  /// Number of threads if batched update running (0 if not)
+  mutable int numberBatchThreads_;
+  /// Maximum number of pivots chosen at once (see setPivotBatch)
+  int pivotBatch_;
+  /** Factorization whose L and dense part are used (see shareFactors).
+      NULL if this owns all its factors */
+  const CoinFactorization *sharedFactors_;
 #if ABOCA_LITE_FACTORIZATION
   /// Offset to second version of sparse
   int sparseOffset_;
@@ -1777,6 +1946,14 @@ protected:
 #define COIN_FACTORIZATION_DENSE_CODE 1
 #endif
 #endif
+/* 4 is built in blocked LU (CoinDenseLU).  If no LAPACK it is compiled
+   in but dense part is off unless setDenseThreshold is used (so default
+   is as before).  -DCOIN_FACTORIZATION_DENSE_CODE=4 uses it instead of
+   LAPACK with normal threshold */
+#ifndef COIN_FACTORIZATION_DENSE_CODE
+#define COIN_FACTORIZATION_DENSE_CODE 4
+#define COIN_FACTORIZATION_DENSE_OPTIONAL
+#endif
 #ifdef COIN_FACTORIZATION_DENSE_CODE
 /* Type of Fortran integer translated into C */
 #ifndef ipfint
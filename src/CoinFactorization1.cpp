@@ -16,6 +16,8 @@
 #include "CoinPackedMatrix.hpp"
 #include "CoinFinite.hpp"
 #include "CoinTime.hpp"
+#include "CoinThreadPool.hpp"
+#include "CoinFactorizationStatistics.hpp"
 #include <stdio.h>
 /*
   Somehow with some BLAS we get multithreaded by default
@@ -33,6 +35,16 @@ void openblas_set_num_threads(int num_threads);
 CoinFactorization::CoinFactorization()
 {
   persistenceFlag_ = 0;
+  numberThreads_ = 1;
+  threadPool_ = NULL;
+  threadSparse_ = NULL;
+  threadSparseSize_ = 0;
+  numberThreadSparse_ = 0;
+  threadStatistics_ = NULL;
+  numberBatchThreads_ = 0;
+  pivotBatch_ = 0;
+  statistics_ = NULL;
+  sharedFactors_ = NULL;
   gutsOfInitialize(7);
 }
 
@@ -40,6 +52,16 @@ CoinFactorization::CoinFactorization()
 CoinFactorization::CoinFactorization(const CoinFactorization &other)
 {
   persistenceFlag_ = 0;
+  numberThreads_ = other.numberThreads_;
+  threadPool_ = NULL;
+  threadSparse_ = NULL;
+  threadSparseSize_ = 0;
+  numberThreadSparse_ = 0;
+  threadStatistics_ = NULL;
+  numberBatchThreads_ = 0;
+  pivotBatch_ = other.pivotBatch_;
+  statistics_ = NULL;
+  sharedFactors_ = NULL;
   gutsOfInitialize(3);
   persistenceFlag_ = other.persistenceFlag_;
   gutsOfCopy(other);
@@ -50,7 +72,10 @@ CoinFactorization::CoinFactorization(const CoinFactorization &other)
 void CoinFactorization::gutsOfDestructor(int type)
 {
   delete[] denseArea_;
-  delete[] densePermute_;
+  // dense part of shared factors is not ours
+  if (!sharedFactors_)
+    delete[] densePermute_;
+  sharedFactors_ = NULL;
   if (type == 2) {
     elementU_.switchOff();
     startRowU_.switchOff();
@@ -217,7 +242,7 @@ void CoinFactorization::gutsOfInitialize(int type)
     maximumPivots_ = 200;
     numberTrials_ = 4;
     relaxCheck_ = 1.0;
-#if COIN_FACTORIZATION_DENSE_CODE
+#if COIN_FACTORIZATION_DENSE_CODE && !defined(COIN_FACTORIZATION_DENSE_OPTIONAL)
     denseThreshold_ = 31;
     denseThreshold_ = 71;
 #else
@@ -546,6 +571,8 @@ int CoinFactorization::factorizePart2(int permutation[], int exactNumberElements
 CoinFactorization::~CoinFactorization()
 {
   gutsOfDestructor(2);
+  delete threadPool_;
+  delete[] threadSparse_;
 }
 
 //  show_self.  Debug show object
@@ -1044,6 +1071,8 @@ int endLengthU2 = 0;
 //Does most of factorization
 int CoinFactorization::factor()
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::factorizePhase);
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   int nUse = numberUpdate + numberUpdateTranspose + numberUpdateFT + 2 * numberUpdateTwoFT + numberReplace;
   double dUse = timeInUpdate + timeInUpdateTranspose + timeInUpdateFT + timeInUpdateTwoFT + timeInReplace;
@@ -1179,8 +1208,12 @@ int CoinFactorization::factor()
     if (numberCompressions_ > 10) {
       areaFactor_ *= 1.1;
     }
+    int numberCompressions = numberCompressions_;
     numberCompressions_ = 0;
     cleanup();
+    if (statistics_)
+      statistics_->addFactorization(numberDense_, totalElements_,
+        numberCompressions);
   }
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   timeInFactorize = CoinCpuTime() - timeStart;
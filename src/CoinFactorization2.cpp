@@ -12,7 +12,9 @@
 #include "CoinFactorization.hpp"
 #include "CoinIndexedVector.hpp"
 #include "CoinHelperFunctions.hpp"
+#include "CoinSort.hpp"
 #include "CoinFinite.hpp"
+#include "CoinThreadPool.hpp"
 #if COIN_FACTORIZATION_DENSE_CODE == 1
 // using simple lapack interface
 
@@ -33,6 +35,9 @@ int clapack_dgetrf(const enum CBLAS_ORDER Order, const int M, const int N, doubl
 #elif COIN_FACTORIZATION_DENSE_CODE == 3
 // Intel compiler
 #include "mkl_lapacke.h"
+#elif COIN_FACTORIZATION_DENSE_CODE == 4
+// built in
+#include "CoinDenseLU.hpp"
 #endif
 #ifndef NDEBUG
 static std::atomic<int> counter1(0);
@@ -54,7 +59,8 @@ int CoinFactorization::factorSparse()
 #define SMALL_UNSET (SMALL_SET + 1)
 #define LARGE_SET COIN_INT_MAX - 10
 #define LARGE_UNSET (LARGE_SET + 1)
-  if (larger < LARGELIMIT)
+  // batches of pivots are only done by large code
+  if (larger < LARGELIMIT && pivotBatch_ <= 1)
     returnCode = factorSparseSmall();
   else
     returnCode = factorSparseLarge();
@@ -618,6 +624,16 @@ int CoinFactorization::factorDense()
 #elif COIN_FACTORIZATION_DENSE_CODE == 3
     status = LAPACKE_dgetrf(LAPACK_COL_MAJOR, numberDense_, numberDense_,
       denseAreaAddress_, numberDense_, densePermute_);
+#elif COIN_FACTORIZATION_DENSE_CODE == 4
+    CoinThreadPool *pool = NULL;
+    if (numberThreads_ > 1 && CoinThreadPool::threadsAvailable()) {
+      if (!threadPool_)
+        threadPool_ = new CoinThreadPool(numberThreads_);
+      pool = threadPool_;
+    }
+    if (CoinDenseLUFactor(numberDense_, denseAreaAddress_, numberDense_,
+          densePermute_, pool))
+      status = -1;
 #endif
     return status;
   }
@@ -1049,6 +1065,168 @@ int CoinFactorization::restoreFactorization(const char *file, bool factorIt)
   return 0;
 }
 #endif
+/* Work areas for choosing and eliminating a batch of pivots.
+   Each task has its own markRow, work and bit areas (at most one task
+   per thread).  Task 0 uses markRow and work of factorization. */
+class CoinFactorizationPivotBatch {
+
+public:
+  CoinFactorizationPivotBatch(CoinFactorization *factorization,
+    int numberRows, int numberColumns, int maximumPivots,
+    CoinThreadPool *pool, int *markRow, CoinFactorizationDouble *work)
+    : factorization_(factorization)
+    , pool_(pool)
+    , numberThreads_(pool ? pool->numberThreads() : 1)
+    , maximumPivots_(maximumPivots)
+    , numberWanted_(maximumPivots)
+    , maximumCandidates_(candidatesPerPivot * maximumPivots)
+    , numberCandidates_(0)
+    , stamp_(0)
+    , numberPivots_(0)
+  {
+    markRow_ = new int *[numberThreads_];
+    work_ = new CoinFactorizationDouble *[numberThreads_];
+    workArea2_ = new unsigned int *[numberThreads_];
+    markRow_[0] = markRow;
+    work_[0] = work;
+    for (int i = 1; i < numberThreads_; i++) {
+      markRow_[i] = new int[numberRows];
+      CoinFillN(markRow_[i], numberRows, LARGE_UNSET);
+      work_[i] = new CoinFactorizationDouble[numberRows];
+      CoinZeroN(work_[i], numberRows);
+    }
+    workSize_ = 1000;
+    for (int i = 0; i < numberThreads_; i++)
+      workArea2_[i] = new unsigned int[workSize_];
+    rowStamp_ = new int[numberRows];
+    CoinZeroN(rowStamp_, numberRows);
+    columnStamp_ = new int[numberColumns];
+    CoinZeroN(columnStamp_, numberColumns);
+    candidate_ = new int[maximumCandidates_];
+    candidateCount_ = new int[maximumCandidates_];
+    candidateRow_ = new int[maximumCandidates_];
+    candidateColumn_ = new int[maximumCandidates_];
+    candidateCost_ = new double[maximumCandidates_];
+    pivotRow_ = new int[maximumPivots];
+    pivotColumn_ = new int[maximumPivots];
+    startL_ = new int[maximumPivots];
+    increment2_ = new int[maximumPivots];
+    added_ = new int[maximumPivots];
+    startSaved_ = new int[maximumPivots + 1];
+    // columns of pivot rows are disjoint so this is enough
+    savedColumns_ = new int[numberColumns];
+  }
+  ~CoinFactorizationPivotBatch()
+  {
+    for (int i = 1; i < numberThreads_; i++) {
+      delete[] markRow_[i];
+      delete[] work_[i];
+    }
+    for (int i = 0; i < numberThreads_; i++)
+      delete[] workArea2_[i];
+    delete[] markRow_;
+    delete[] work_;
+    delete[] workArea2_;
+    delete[] rowStamp_;
+    delete[] columnStamp_;
+    delete[] candidate_;
+    delete[] candidateCount_;
+    delete[] candidateRow_;
+    delete[] candidateColumn_;
+    delete[] candidateCost_;
+    delete[] pivotRow_;
+    delete[] pivotColumn_;
+    delete[] startL_;
+    delete[] increment2_;
+    delete[] added_;
+    delete[] startSaved_;
+    delete[] savedColumns_;
+  }
+  /// Makes sure bit areas are big enough
+  void checkWorkSize(int size)
+  {
+    if (size > workSize_) {
+      workSize_ = size;
+      for (int i = 0; i < numberThreads_; i++) {
+        delete[] workArea2_[i];
+        workArea2_[i] = new unsigned int[workSize_];
+      }
+    }
+  }
+  /// New set of marks (so stamps need not be cleared)
+  void newStamp(int numberRows, int numberColumns)
+  {
+    stamp_++;
+    if (stamp_ == COIN_INT_MAX) {
+      CoinZeroN(rowStamp_, numberRows);
+      CoinZeroN(columnStamp_, numberColumns);
+      stamp_ = 1;
+    }
+  }
+  /// Runs task over numberTasks (by threads if there is a pool)
+  void run(int numberTasks, CoinThreadPool::CoinThreadTask task)
+  {
+    numberTasks_ = CoinMin(numberTasks, numberThreads_);
+    if (numberTasks_ > 1) {
+      pool_->run(numberTasks_, task, this);
+    } else {
+      numberTasks_ = 1;
+      task(this, 0);
+    }
+  }
+
+  // Candidates looked at for each pivot wanted
+  enum { candidatesPerPivot = 2 };
+
+  CoinFactorization *factorization_;
+  CoinThreadPool *pool_;
+  int numberThreads_;
+  int numberTasks_;
+  // per thread areas
+  int **markRow_;
+  CoinFactorizationDouble **work_;
+  unsigned int **workArea2_;
+  int workSize_;
+  // maximum and current target for size of batch
+  int maximumPivots_;
+  int numberWanted_;
+  // candidates (row, or numberRows+column as in count lists)
+  int maximumCandidates_;
+  int numberCandidates_;
+  int *candidate_;
+  int *candidateCount_;
+  // best pivot in each candidate (row -1 if none) and its cost
+  int *candidateRow_;
+  int *candidateColumn_;
+  double *candidateCost_;
+  // rows and columns touched by chosen pivots have current stamp
+  int stamp_;
+  int *rowStamp_;
+  int *columnStamp_;
+  // chosen pivots
+  int numberPivots_;
+  int *pivotRow_;
+  int *pivotColumn_;
+  // first pivot is numberGoodU_ of this
+  int firstGoodU_;
+  // where each pivot column goes in L
+  int *startL_;
+  // size of bit area for each column in pivot row
+  int *increment2_;
+  // change in number of elements
+  int *added_;
+  // other columns in each pivot row
+  int *startSaved_;
+  int *savedColumns_;
+
+private:
+  CoinFactorizationPivotBatch(const CoinFactorizationPivotBatch &);
+  CoinFactorizationPivotBatch &operator=(const CoinFactorizationPivotBatch &);
+};
+namespace {
+// Pivots in batch may have cost up to this multiple of best
+const double batchCostMultiplier = 4.0;
+}
 //  factorSparse.  Does sparse phase of factorization
 //return code is <0 error, 0= finished
 int CoinFactorization::factorSparseLarge()
@@ -1138,6 +1316,17 @@ int CoinFactorization::factorSparseLarge()
   int numberRows = numberRows_;
   // Put column singletons first - (if false)
   separateLinks(1, (biasLU_ > 1));
+  CoinFactorizationPivotBatch *batch = NULL;
+  if (pivotBatch_ > 1) {
+    CoinThreadPool *pool = NULL;
+    if (numberThreads_ > 1 && CoinThreadPool::threadsAvailable()) {
+      if (!threadPool_)
+        threadPool_ = new CoinThreadPool(numberThreads_);
+      pool = threadPool_;
+    }
+    batch = new CoinFactorizationPivotBatch(this, numberRows_, numberColumns_,
+      pivotBatch_, pool, markRow, workArea);
+  }
 #ifndef NDEBUG
   int counter2 = 0;
 #endif
@@ -1318,8 +1507,17 @@ int CoinFactorization::factorSparseLarge()
         }
       }
     } /* endwhile */
+    int numberBatch = 0;
+    if (iPivotRow >= 0 && batch) {
+      numberBatch = pivotInBatch(*batch, count, iPivotRow, iPivotColumn,
+        minimumCost);
+      if (numberBatch < 0) {
+        status = -99;
+        break;
+      }
+    }
     if (iPivotRow >= 0) {
-      if (iPivotRow >= 0) {
+      if (!numberBatch) {
         int numberDoRow = numberInRow[iPivotRow] - 1;
         int numberDoColumn = numberInColumn[iPivotColumn] - 1;
 
@@ -1481,10 +1679,527 @@ int CoinFactorization::factorSparseLarge()
       count++;
     }
   } /* endwhile */
+  delete batch;
   workArea_.conditionalDelete();
   workArea2_.conditionalDelete();
   return status;
 }
+// Looks at candidates for batch (every numberTasks'th one)
+void CoinFactorization::pivotCandidatesTask(void *info, int which)
+{
+  CoinFactorizationPivotBatch *batch = reinterpret_cast< CoinFactorizationPivotBatch * >(info);
+  const CoinFactorization *factorization = batch->factorization_;
+  const int *COIN_RESTRICT indexRow = factorization->indexRowUArray_;
+  const int *COIN_RESTRICT indexColumn = factorization->indexColumnUArray_;
+  const CoinFactorizationDouble *COIN_RESTRICT element = factorization->elementUArray_;
+  const int *COIN_RESTRICT numberInRow = factorization->numberInRowArray_;
+  const int *COIN_RESTRICT numberInColumn = factorization->numberInColumnArray_;
+  const int *COIN_RESTRICT startRow = factorization->startRowUArray_;
+  const int *COIN_RESTRICT startColumn = factorization->startColumnUArray_;
+  int numberRows = factorization->numberRows_;
+  double pivotTolerance = factorization->pivotTolerance_;
+  for (int iCandidate = which; iCandidate < batch->numberCandidates_;
+       iCandidate += batch->numberTasks_) {
+    int look = batch->candidate_[iCandidate];
+    int count = batch->candidateCount_[iCandidate];
+    double minimumCost = COIN_DBL_MAX;
+    int iPivotRow = -1;
+    int iPivotColumn = -1;
+    // as in factorSparseLarge but best in this row or column
+    if (look < numberRows) {
+      int iRow = look;
+      int start = startRow[iRow];
+      int end = start + count;
+      for (int i = start; i < end; i++) {
+        int iColumn = indexColumn[i];
+        double cost = (count - 1) * numberInColumn[iColumn];
+        if (cost < minimumCost) {
+          int where = startColumn[iColumn];
+          double minimumValue = fabs(element[where]) * pivotTolerance;
+          while (indexRow[where] != iRow)
+            where++;
+          if (fabs(element[where]) >= minimumValue) {
+            minimumCost = cost;
+            iPivotRow = iRow;
+            iPivotColumn = iColumn;
+          }
+        }
+      }
+    } else {
+      int iColumn = look - numberRows;
+      int start = startColumn[iColumn];
+      int end = start + numberInColumn[iColumn];
+      double minimumValue = fabs(element[start]) * pivotTolerance;
+      for (int i = start; i < end; i++) {
+        if (fabs(element[i]) >= minimumValue) {
+          int iRow = indexRow[i];
+          double cost = (count - 1) * numberInRow[iRow];
+          if (cost < minimumCost) {
+            minimumCost = cost;
+            iPivotRow = iRow;
+            iPivotColumn = iColumn;
+          }
+        }
+      }
+    }
+    batch->candidateRow_[iCandidate] = iPivotRow;
+    batch->candidateColumn_[iCandidate] = iPivotColumn;
+    batch->candidateCost_[iCandidate] = minimumCost;
+  }
+}
+/* Eliminates every numberTasks'th pivot of batch.
+   Each task uses its own work areas */
+void CoinFactorization::pivotDisjointTask(void *info, int which)
+{
+  CoinFactorizationPivotBatch *batch = reinterpret_cast< CoinFactorizationPivotBatch * >(info);
+  for (int i = which; i < batch->numberPivots_; i += batch->numberTasks_)
+    batch->factorization_->pivotDisjoint(*batch, i, which);
+}
+/* Chooses and eliminates a batch of pivots.
+   Pivots are chosen so that no row or column is touched by more than
+   one.  So if rows and columns have enough space (this is got first)
+   and linked lists are left until afterwards they can be eliminated in
+   any order or at same time.  Choice only depends on lists and counts
+   so is same for any number of threads. */
+int CoinFactorization::pivotInBatch(CoinFactorizationPivotBatch &batch,
+  int count, int pivotRow, int pivotColumn, double minimumCost)
+{
+  int *COIN_RESTRICT indexRow = indexRowUArray_;
+  int *COIN_RESTRICT indexColumn = indexColumnUArray_;
+  int *COIN_RESTRICT numberInRow = numberInRowArray_;
+  int *COIN_RESTRICT numberInColumn = numberInColumnArray_;
+  int *COIN_RESTRICT numberInColumnPlus = numberInColumnPlusArray_;
+  int *COIN_RESTRICT startRow = startRowUArray_;
+  int *COIN_RESTRICT startColumn = startColumnUArray_;
+  int *COIN_RESTRICT nextRow = nextRowArray_;
+  int *COIN_RESTRICT lastRow = lastRowArray_;
+  int *COIN_RESTRICT nextColumn = nextColumnArray_;
+  int *COIN_RESTRICT nextCount = nextCountArray_;
+  int *COIN_RESTRICT firstCount = firstCountArray_;
+  int *COIN_RESTRICT rowStamp = batch.rowStamp_;
+  int *COIN_RESTRICT columnStamp = batch.columnStamp_;
+  // only if first pivot would go to pivot()
+  if (numberInRow[pivotRow] < 2 || numberInColumn[pivotColumn] < 3
+    || minimumCost == COIN_DBL_MAX)
+    return 0;
+  batch.newStamp(numberRows_, numberColumns_);
+  int stamp = batch.stamp_;
+  batch.numberPivots_ = 0;
+  // get candidates
+  double maximumCost = batchCostMultiplier * minimumCost;
+  int maximumCandidates = CoinMin(batch.maximumCandidates_,
+    CoinFactorizationPivotBatch::candidatesPerPivot * batch.numberWanted_);
+  int numberCandidates = 0;
+  for (int iCount = count; iCount <= biggerDimension_; iCount++) {
+    // other count in a candidate is at least two
+    if (2.0 * (iCount - 1) > maximumCost || numberCandidates == maximumCandidates)
+      break;
+    for (int look = firstCount[iCount]; look >= 0; look = nextCount[look]) {
+      if (look == pivotRow || look == pivotColumn + numberRows_)
+        continue;
+      batch.candidate_[numberCandidates] = look;
+      batch.candidateCount_[numberCandidates++] = iCount;
+      if (numberCandidates == maximumCandidates)
+        break;
+    }
+  }
+  batch.numberCandidates_ = numberCandidates;
+  if (!numberCandidates)
+    return 0;
+  batch.run(numberCandidates / 16 + 1, pivotCandidatesTask);
+  // sort by cost (ties by position so same every time)
+  int *order = batch.candidateCount_;
+  double *cost = batch.candidateCost_;
+  int numberSort = 0;
+  for (int i = 0; i < numberCandidates; i++) {
+    if (batch.candidateRow_[i] >= 0 && cost[i] <= maximumCost) {
+      cost[numberSort] = cost[i] * numberCandidates + i;
+      order[numberSort++] = i;
+    }
+  }
+  CoinSort_2(cost, cost + numberSort, order);
+  // choose - first pivot is always used
+  for (int iSort = -1; iSort < numberSort; iSort++) {
+    int iRow;
+    int iColumn;
+    if (iSort < 0) {
+      iRow = pivotRow;
+      iColumn = pivotColumn;
+    } else {
+      iRow = batch.candidateRow_[order[iSort]];
+      iColumn = batch.candidateColumn_[order[iSort]];
+      if (numberInRow[iRow] < 2 || numberInColumn[iColumn] < 3)
+        continue;
+      bool good = true;
+      int start = startColumn[iColumn];
+      int end = start + numberInColumn[iColumn];
+      for (int i = start; i < end; i++) {
+        if (rowStamp[indexRow[i]] == stamp) {
+          good = false;
+          break;
+        }
+      }
+      if (!good)
+        continue;
+      start = startRow[iRow];
+      end = start + numberInRow[iRow];
+      for (int i = start; i < end; i++) {
+        if (columnStamp[indexColumn[i]] == stamp) {
+          good = false;
+          break;
+        }
+      }
+      if (!good)
+        continue;
+    }
+    int start = startColumn[iColumn];
+    int end = start + numberInColumn[iColumn];
+    for (int i = start; i < end; i++)
+      rowStamp[indexRow[i]] = stamp;
+    start = startRow[iRow];
+    end = start + numberInRow[iRow];
+    for (int i = start; i < end; i++)
+      columnStamp[indexColumn[i]] = stamp;
+    batch.pivotRow_[batch.numberPivots_] = iRow;
+    batch.pivotColumn_[batch.numberPivots_++] = iColumn;
+    if (batch.numberPivots_ == batch.numberWanted_)
+      break;
+  }
+  int numberPivots = batch.numberPivots_;
+  // aim for twice as many next time
+  batch.numberWanted_ = CoinMax(2, CoinMin(batch.maximumPivots_, 2 * numberPivots));
+  if (numberPivots < 2)
+    return 0;
+  // get space (and save other columns in pivot rows)
+  int lengthL = lengthL_;
+  int maximumSize = 0;
+  int numberSaved = 0;
+  for (int iPass = 0; iPass < 2; iPass++) {
+    int numberCompressions = numberCompressions_;
+    lengthL = lengthL_;
+    numberSaved = 0;
+    for (int iPivot = 0; iPivot < numberPivots; iPivot++) {
+      int iRow = batch.pivotRow_[iPivot];
+      int iColumn = batch.pivotColumn_[iPivot];
+      int numberDoRow = numberInRow[iRow] - 1;
+      int numberDoColumn = numberInColumn[iColumn] - 1;
+      batch.startSaved_[iPivot] = numberSaved;
+      int start = startRow[iRow];
+      int end = start + numberDoRow + 1;
+      for (int i = start; i < end; i++) {
+        int jColumn = indexColumn[i];
+        if (jColumn != iColumn)
+          batch.savedColumns_[numberSaved++] = jColumn;
+      }
+      for (int i = batch.startSaved_[iPivot]; i < numberSaved; i++) {
+        int jColumn = batch.savedColumns_[i];
+        int next = nextColumn[jColumn];
+        int space = startColumn[next] - numberInColumnPlus[next]
+          - (startColumn[jColumn] + numberInColumn[jColumn]);
+        if (space < numberDoColumn && !getColumnSpace(jColumn, numberDoColumn))
+          return -99;
+      }
+      start = startColumn[iColumn];
+      end = start + numberDoColumn + 1;
+      for (int i = start; i < end; i++) {
+        int jRow = indexRow[i];
+        if (jRow != iRow) {
+          int space = startRow[nextRow[jRow]] - startRow[jRow];
+          if (space < numberInRow[jRow] + numberDoRow
+            && !getRowSpace(jRow, numberDoRow))
+            return -99;
+        }
+      }
+      batch.startL_[iPivot] = lengthL;
+      lengthL += numberDoColumn;
+      //need to adjust more for cache and SMP
+      //allow at least 4 extra
+      int increment = numberDoColumn + 1 + 4;
+      if (increment & 15) {
+        increment = increment & (~15);
+        increment += 16;
+      }
+      int increment2 = (increment + COINFACTORIZATION_BITS_PER_INT - 1) >> COINFACTORIZATION_SHIFT_PER_INT;
+      batch.increment2_[iPivot] = increment2;
+      maximumSize = CoinMax(maximumSize, increment2 * numberDoRow);
+    }
+    batch.startSaved_[numberPivots] = numberSaved;
+    if (numberCompressions == numberCompressions_)
+      break;
+    else if (iPass)
+      return 0; // space got earlier may have gone
+  }
+  if (lengthL > lengthAreaL_)
+    return 0; // let normal code say no room
+  batch.checkWorkSize(maximumSize);
+  // pivot rows out of row order, L starts and counts
+  int *COIN_RESTRICT startColumnL = startColumnLArray_;
+  batch.firstGoodU_ = numberGoodU_;
+  for (int iPivot = 0; iPivot < numberPivots; iPivot++) {
+    int iRow = batch.pivotRow_[iPivot];
+    int iColumn = batch.pivotColumn_[iPivot];
+    int next = nextRow[iRow];
+    int last = lastRow[iRow];
+    nextRow[last] = next;
+    lastRow[next] = last;
+    nextRow[iRow] = numberGoodU_ + iPivot; //use for permute
+    lastRow[iRow] = -2;
+    startColumnL[numberGoodL_ + iPivot] = batch.startL_[iPivot];
+    totalElements_ -= numberInRow[iRow] + numberInColumn[iColumn] - 1;
+  }
+  numberGoodL_ += numberPivots;
+  startColumnL[numberGoodL_] = lengthL;
+  lengthL_ = lengthL;
+  batch.run(numberPivots, pivotDisjointTask);
+  // now linked lists in order pivot() would have done them
+  int *COIN_RESTRICT pivotColumnArray = pivotColumnArray_;
+  int *COIN_RESTRICT indexRowL = indexRowLArray_;
+  for (int iPivot = 0; iPivot < numberPivots; iPivot++) {
+    int iRow = batch.pivotRow_[iPivot];
+    int iColumn = batch.pivotColumn_[iPivot];
+    for (int i = batch.startSaved_[iPivot]; i < batch.startSaved_[iPivot + 1]; i++) {
+      int jColumn = batch.savedColumns_[i];
+      if (nextCount[jColumn + numberRows_] != -2) {
+        deleteLink(jColumn + numberRows_);
+        addLink(jColumn + numberRows_, numberInColumn[jColumn]);
+      }
+    }
+    for (int i = startColumnL[numberGoodL_ - numberPivots + iPivot];
+         i < startColumnL[numberGoodL_ - numberPivots + iPivot + 1]; i++) {
+      int jRow = indexRowL[i];
+      deleteLink(jRow);
+      addLink(jRow, numberInRow[jRow]);
+    }
+    deleteLink(iRow);
+    deleteLink(iColumn + numberRows_);
+    totalElements_ += batch.added_[iPivot];
+    assert(nextRow[iRow] == numberGoodU_);
+    pivotColumnArray[numberGoodU_] = iColumn;
+    numberGoodU_++;
+  }
+  return numberPivots;
+}
+/* Eliminates one pivot of batch.  This is pivot() without getting
+   space, linked lists or moving pivot row out of row order - all done
+   by pivotInBatch */
+void CoinFactorization::pivotDisjoint(CoinFactorizationPivotBatch &batch,
+  int which, int iTask)
+{
+  int *COIN_RESTRICT indexColumnU = indexColumnUArray_;
+  int *COIN_RESTRICT startColumnU = startColumnUArray_;
+  int *COIN_RESTRICT numberInColumn = numberInColumnArray_;
+  int *COIN_RESTRICT numberInColumnPlus = numberInColumnPlusArray_;
+  CoinFactorizationDouble *COIN_RESTRICT elementU = elementUArray_;
+  int *COIN_RESTRICT indexRowU = indexRowUArray_;
+  int *COIN_RESTRICT startRowU = startRowUArray_;
+  int *COIN_RESTRICT numberInRow = numberInRowArray_;
+  CoinFactorizationDouble *COIN_RESTRICT elementL = elementLArray_;
+  int *COIN_RESTRICT indexRowL = indexRowLArray_;
+  int *COIN_RESTRICT markRow = batch.markRow_[iTask];
+  CoinFactorizationDouble *COIN_RESTRICT work = batch.work_[iTask];
+  unsigned int *COIN_RESTRICT workArea2 = batch.workArea2_[iTask];
+  const int largeInteger = LARGE_SET;
+  int pivotRow = batch.pivotRow_[which];
+  int pivotColumn = batch.pivotColumn_[which];
+  const int *COIN_RESTRICT saveColumn = batch.savedColumns_ + batch.startSaved_[which];
+  int numberInPivotRow = batch.startSaved_[which + 1] - batch.startSaved_[which];
+  int increment2 = batch.increment2_[which];
+  int startColumn = startColumnU[pivotColumn];
+  int numberInPivotColumn = numberInColumn[pivotColumn] - 1;
+  int endColumn = startColumn + numberInPivotColumn + 1;
+  numberInRow[pivotRow] = 0;
+  //store column in L and take column out of rows
+  int lSave = batch.startL_[which];
+  int l = lSave;
+  CoinFactorizationDouble pivotElement = 0.0;
+  for (int i = startColumn; i < endColumn; i++) {
+    int iRow = indexRowU[i];
+    if (iRow != pivotRow) {
+      indexRowL[l] = iRow;
+      elementL[l] = elementU[i];
+      markRow[iRow] = l - lSave;
+      l++;
+      //take out of row list
+      int start = startRowU[iRow];
+      int end = start + numberInRow[iRow];
+      int where = start;
+      while (indexColumnU[where] != pivotColumn) {
+        where++;
+      } /* endwhile */
+      assert(where < end);
+      indexColumnU[where] = indexColumnU[end - 1];
+      numberInRow[iRow]--;
+    } else {
+      pivotElement = elementU[i];
+    }
+  }
+  CoinFactorizationDouble pivotMultiplier = 1.0 / pivotElement;
+  pivotRegionArray_[batch.firstGoodU_ + which] = pivotMultiplier;
+  markRow[pivotRow] = largeInteger;
+  numberInColumn[pivotColumn] = 0;
+  int *COIN_RESTRICT indexL = &indexRowL[lSave];
+  CoinFactorizationDouble *COIN_RESTRICT multipliersL = &elementL[lSave];
+  for (int j = 0; j < numberInPivotColumn; j++) {
+    multipliersL[j] *= pivotMultiplier;
+  }
+  //zero out fill
+  for (int iErase = 0; iErase < increment2 * numberInPivotRow; iErase++) {
+    workArea2[iErase] = 0;
+  }
+  int added = numberInPivotRow * numberInPivotColumn;
+  unsigned int *COIN_RESTRICT temp2 = workArea2;
+  double tolerance = zeroTolerance_;
+  //pack down and move to work
+  for (int jColumn = 0; jColumn < numberInPivotRow; jColumn++) {
+    int iColumn = saveColumn[jColumn];
+    int startColumn = startColumnU[iColumn];
+    int endColumn = startColumn + numberInColumn[iColumn];
+    int iRow = indexRowU[startColumn];
+    CoinFactorizationDouble value = elementU[startColumn];
+    double largest;
+    int put = startColumn;
+    int positionLargest = -1;
+    CoinFactorizationDouble thisPivotValue = 0.0;
+
+    //compress column and find largest not updated
+    bool checkLargest;
+    int mark = markRow[iRow];
+
+    if (mark == largeInteger + 1) {
+      largest = fabs(value);
+      positionLargest = put;
+      put++;
+      checkLargest = false;
+    } else {
+      //need to find largest
+      largest = 0.0;
+      checkLargest = true;
+      if (mark != largeInteger) {
+        //will be updated
+        work[mark] = value;
+        int word = mark >> COINFACTORIZATION_SHIFT_PER_INT;
+        int bit = mark & COINFACTORIZATION_MASK_PER_INT;
+
+        temp2[word] = temp2[word] | (1 << bit); //say already in counts
+        added--;
+      } else {
+        thisPivotValue = value;
+      }
+    }
+    for (int i = startColumn + 1; i < endColumn; i++) {
+      iRow = indexRowU[i];
+      value = elementU[i];
+      int mark = markRow[iRow];
+
+      if (mark == largeInteger + 1) {
+        //keep
+        indexRowU[put] = iRow;
+        elementU[put] = value;
+        if (checkLargest) {
+          double absValue = fabs(value);
+
+          if (absValue > largest) {
+            largest = absValue;
+            positionLargest = put;
+          }
+        }
+        put++;
+      } else if (mark != largeInteger) {
+        //will be updated
+        work[mark] = value;
+        int word = mark >> COINFACTORIZATION_SHIFT_PER_INT;
+        int bit = mark & COINFACTORIZATION_MASK_PER_INT;
+
+        temp2[word] = temp2[word] | (1 << bit); //say already in counts
+        added--;
+      } else {
+        thisPivotValue = value;
+      }
+    }
+    //slot in pivot
+    elementU[put] = elementU[startColumn];
+    indexRowU[put] = indexRowU[startColumn];
+    if (positionLargest == startColumn) {
+      positionLargest = put; //follow if was largest
+    }
+    put++;
+    elementU[startColumn] = thisPivotValue;
+    indexRowU[startColumn] = pivotRow;
+    //clean up counts
+    startColumn++;
+    numberInColumn[iColumn] = put - startColumn;
+    numberInColumnPlus[iColumn]++;
+    startColumnU[iColumn]++;
+    //space was got by pivotInBatch
+    for (int j = 0; j < numberInPivotColumn; j++) {
+      value = work[j] - thisPivotValue * multipliersL[j];
+      double absValue = fabs(value);
+
+      if (absValue > tolerance) {
+        work[j] = 0.0;
+        assert(put < lengthAreaU_);
+        elementU[put] = value;
+        indexRowU[put] = indexL[j];
+        if (absValue > largest) {
+          largest = absValue;
+          positionLargest = put;
+        }
+        put++;
+      } else {
+        work[j] = 0.0;
+        added--;
+        int word = j >> COINFACTORIZATION_SHIFT_PER_INT;
+        int bit = j & COINFACTORIZATION_MASK_PER_INT;
+
+        if (temp2[word] & (1 << bit)) {
+          //take out of row list
+          iRow = indexL[j];
+          int start = startRowU[iRow];
+          int end = start + numberInRow[iRow];
+          int where = start;
+
+          while (indexColumnU[where] != iColumn) {
+            where++;
+          } /* endwhile */
+          assert(where < end);
+          indexColumnU[where] = indexColumnU[end - 1];
+          numberInRow[iRow]--;
+        } else {
+          //make sure won't be added
+          temp2[word] = temp2[word] | (1 << bit); //say already in counts
+        }
+      }
+    }
+    numberInColumn[iColumn] = put - startColumn;
+    //move largest
+    if (positionLargest >= 0) {
+      value = elementU[positionLargest];
+      iRow = indexRowU[positionLargest];
+      elementU[positionLargest] = elementU[startColumn];
+      indexRowU[positionLargest] = indexRowU[startColumn];
+      elementU[startColumn] = value;
+      indexRowU[startColumn] = iRow;
+    }
+    temp2 += increment2;
+  }
+  // add fill to rows
+  for (int i = 0; i < numberInPivotColumn; i++) {
+    int iRow = indexL[i];
+    const unsigned int *COIN_RESTRICT putThis = workArea2 + (i >> COINFACTORIZATION_SHIFT_PER_INT);
+    int bit = i & COINFACTORIZATION_MASK_PER_INT;
+    int start = startRowU[iRow];
+    int end = start + numberInRow[iRow];
+    for (int jColumn = 0; jColumn < numberInPivotRow; jColumn++) {
+      if (!((*putThis >> bit) & 1))
+        indexColumnU[end++] = saveColumn[jColumn];
+      putThis += increment2;
+    }
+    markRow[iRow] = largeInteger + 1;
+    numberInRow[iRow] = end - start;
+  }
+  markRow[pivotRow] = largeInteger + 1;
+  batch.added_[which] = added;
+}
 
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
 */
@@ -16,6 +16,8 @@
 #include "CoinIndexedVector.hpp"
 #include "CoinHelperFunctions.hpp"
 #include "CoinTime.hpp"
+#include "CoinThreadPool.hpp"
+#include "CoinFactorizationStatistics.hpp"
 #include <stdio.h>
 #include <iostream>
 #if COIN_FACTORIZATION_DENSE_CODE == 1
@@ -44,6 +46,9 @@ int clapack_dgetrs(const enum CBLAS_ORDER Order,
 #elif COIN_FACTORIZATION_DENSE_CODE == 3
 // Intel compiler
 #include "mkl_lapacke.h"
+#elif COIN_FACTORIZATION_DENSE_CODE == 4
+// built in
+#include "CoinDenseLU.hpp"
 #endif
 // For semi-sparse
 #define BITS_PER_CHECK 8
@@ -94,6 +99,9 @@ int CoinFactorization::updateColumn(CoinIndexedVector *regionSparse,
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   double startTimeX = CoinCpuTime();
 #endif
+  // not collected while threads are using factorization
+  CoinFactorizationStatisticsTimer timer(numberBatchThreads_ ? NULL : statistics_,
+    CoinFactorizationStatistics::ftranPhase);
   //permute and move indices into index array
   int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
   int numberNonZero;
@@ -136,19 +144,19 @@ int CoinFactorization::updateColumn(CoinIndexedVector *regionSparse,
     numberNonZero = regionSparse->getNumElements();
   }
 #endif
-  if (collectStatistics_) {
+  if (collectStatistics_ && !numberBatchThreads_) {
     numberFtranCounts_++;
     ftranCountInput_ += numberNonZero;
   }
 
   //  ******* L
   updateColumnL(regionSparse, regionIndex);
-  if (collectStatistics_)
+  if (collectStatistics_ && !numberBatchThreads_)
     ftranCountAfterL_ += regionSparse->getNumElements();
   //permute extra
   //row bits here
   updateColumnR(regionSparse);
-  if (collectStatistics_)
+  if (collectStatistics_ && !numberBatchThreads_)
     ftranCountAfterR_ += regionSparse->getNumElements();
 
   //update counts
@@ -258,6 +266,18 @@ void CoinFactorization::updateColumnL(CoinIndexedVector *regionSparse,
     } else {
       goSparse = 0;
     }
+    CoinFactorizationStatistics *statistics = solveStatistics();
+    double startTime = statistics ? statistics->startSolve() : 0.0;
+    int numberReach = -1;
+    if (goSparse < 2 && sparseThreshold_ > 0 && number < sparseThreshold_
+      && (numberL_ << 2) > number) {
+      // guess may be wrong - see what is actually reached
+      numberReach = reachL(regionIndex, number, sparseThreshold_);
+      if (numberReach >= 0)
+        goSparse = 2;
+      else if (statistics)
+        statistics->addReachAbandoned(0);
+    }
     switch (goSparse) {
     case 0: // densish
       updateColumnLDensish(regionSparse, regionIndex);
@@ -266,9 +286,13 @@ void CoinFactorization::updateColumnL(CoinIndexedVector *regionSparse,
       updateColumnLSparsish(regionSparse, regionIndex);
       break;
     case 2: // sparse
-      updateColumnLSparse(regionSparse, regionIndex);
+      if (numberReach < 0)
+        numberReach = reachL(regionIndex, number, COIN_INT_MAX);
+      updateColumnLReach(regionSparse, regionIndex, numberReach);
       break;
     }
+    if (statistics)
+      statistics->addSolveMode(0, goSparse, numberReach, startTime);
   }
 #ifdef COIN_FACTORIZATION_DENSE_CODE
   if (numberDense_) {
@@ -303,6 +327,9 @@ void CoinFactorization::updateColumnL(CoinIndexedVector *regionSparse,
       LAPACKE_dgetrs(LAPACK_COL_MAJOR,'N',numberDense_,1,
                      denseAreaAddress_,numberDense_,densePermute_,
                      region+lastSparse,numberDense_);
+#elif COIN_FACTORIZATION_DENSE_CODE == 4
+      CoinDenseLUSolve(false, numberDense_, denseAreaAddress_, numberDense_,
+        densePermute_, region + lastSparse);
 #endif
       for (int i = lastSparse; i < numberRows_; i++) {
         double value = region[i];
@@ -407,7 +434,7 @@ void CoinFactorization::updateColumnLSparsish(CoinIndexedVector *regionSparse,
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
   assert(!sparseOffset);
 #endif
-  CoinCheckZero *COIN_RESTRICT mark = reinterpret_cast< CoinCheckZero * >(sparseArray_ + (2 + nInBig) * maximumRowsExtra_ + sparseOffset);
+  CoinCheckZero *COIN_RESTRICT mark = reinterpret_cast< CoinCheckZero * >(sparseWorkArea() + (2 + nInBig) * maximumRowsExtra_ + sparseOffset);
   int smallestIndex = numberRowsExtra_;
   // do easy ones
   for (int k = 0; k < number; k++) {
@@ -531,25 +558,20 @@ void CoinFactorization::updateColumnLSparse(CoinIndexedVector *regionSparse,
   int *COIN_RESTRICT regionIndex)
   const
 {
-  double *COIN_RESTRICT region = regionSparse->denseVector();
-  int number = regionSparse->getNumElements();
-  int numberNonZero;
-  double tolerance = zeroTolerance_;
-
-  numberNonZero = 0;
-
+  int numberReach = reachL(regionIndex, regionSparse->getNumElements(),
+    COIN_INT_MAX);
+  updateColumnLReach(regionSparse, regionIndex, numberReach);
+}
+/* Symbolic reach in L (depth first search).  Pivots end up on list
+   part of sparse work area in reverse topological order */
+int CoinFactorization::reachL(const int *COIN_RESTRICT indexIn, int number,
+  int maximumReach) const
+{
   const int *startColumn = startColumnLArray_;
   const int *indexRow = indexRowLArray_;
-  const CoinFactorizationDouble *COIN_RESTRICT element = elementLArray_;
   // use sparse_ as temporary area
   // mark known to be zero
-#if ABOCA_LITE_FACTORIZATION == 0
-#define sparseOffset 0
-#else
-  int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
-  assert(!sparseOffset);
-#endif
-  int *COIN_RESTRICT stack = sparseArray_ + sparseOffset; /* pivot */
+  int *COIN_RESTRICT stack = sparseWorkArea(); /* pivot */
   int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
   int *COIN_RESTRICT next = reinterpret_cast< int * >(list + maximumRowsExtra_); /* jnext */
   char *COIN_RESTRICT mark = reinterpret_cast< char * >(next + maximumRowsExtra_);
@@ -561,7 +583,7 @@ void CoinFactorization::updateColumnLSparse(CoinIndexedVector *regionSparse,
 #endif
   nList = 0;
   for (int k = 0; k < number; k++) {
-    int kPivot = regionIndex[k];
+    int kPivot = indexIn[k];
     if (kPivot >= baseL_) {
       assert(kPivot < numberRowsExtra_);
       //if (kPivot>=numberRowsExtra_) abort();
@@ -591,6 +613,14 @@ void CoinFactorization::updateColumnLSparse(CoinIndexedVector *regionSparse,
             /* finished so mark */
             list[nList++] = kPivot;
             mark[kPivot] = 1;
+            if (nList > maximumReach) {
+              // too big - clean up and give up
+              for (int i = 0; i < nList; i++)
+                mark[list[i]] = 0;
+              for (int i = 0; i <= nStack; i++)
+                mark[stack[i]] = 0;
+              return -1;
+            }
             --nStack;
             if (nStack >= 0) {
               kPivot = stack[nStack];
@@ -600,12 +630,30 @@ void CoinFactorization::updateColumnLSparse(CoinIndexedVector *regionSparse,
           }
         }
       }
-    } else {
-      // just put on list
-      regionIndex[numberNonZero++] = kPivot;
     }
   }
-  for (int i = nList - 1; i >= 0; i--) {
+  return nList;
+}
+// Updates part of column (FTRANL) using reach from reachL
+void CoinFactorization::updateColumnLReach(CoinIndexedVector *regionSparse,
+  int *COIN_RESTRICT regionIndex, int numberReach) const
+{
+  double *COIN_RESTRICT region = regionSparse->denseVector();
+  int number = regionSparse->getNumElements();
+  double tolerance = zeroTolerance_;
+  const int *startColumn = startColumnLArray_;
+  const int *indexRow = indexRowLArray_;
+  const CoinFactorizationDouble *COIN_RESTRICT element = elementLArray_;
+  const int *COIN_RESTRICT list = sparseWorkArea() + maximumRowsExtra_;
+  char *COIN_RESTRICT mark = reinterpret_cast< char * >(sparseWorkArea() + 3 * maximumRowsExtra_);
+  int numberNonZero = 0;
+  // ones before L just stay
+  for (int k = 0; k < number; k++) {
+    int kPivot = regionIndex[k];
+    if (kPivot < baseL_)
+      regionIndex[numberNonZero++] = kPivot;
+  }
+  for (int i = numberReach - 1; i >= 0; i--) {
     int iPivot = list[i];
     mark[iPivot] = 0;
     CoinFactorizationDouble pivotValue = region[iPivot];
@@ -636,6 +684,8 @@ int CoinFactorization::updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   double startTimeX = CoinCpuTime();
 #endif
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::ftranTwoPhase);
 #if 1
   //#ifdef NDEBUG
   //#undef NDEBUG
@@ -1041,6 +1091,18 @@ void CoinFactorization::updateColumnU(CoinIndexedVector *regionSparse,
   } else {
     goSparse = 0;
   }
+  CoinFactorizationStatistics *statistics = solveStatistics();
+  double startTime = statistics ? statistics->startSolve() : 0.0;
+  int numberReach = -1;
+  int numberSlacks = 0;
+  if (goSparse < 2 && sparseThreshold_ > 0 && numberNonZero < sparseThreshold_) {
+    // guess may be wrong - see what is actually reached
+    numberReach = reachU(indexIn, numberNonZero, sparseThreshold_, numberSlacks);
+    if (numberReach >= 0)
+      goSparse = 2;
+    else if (statistics)
+      statistics->addReachAbandoned(1);
+  }
 #ifdef COIN_FACTORIZATION_DIAGNOSE
   numberTimesX++;
   if (!goSparse) {
@@ -1075,10 +1137,14 @@ void CoinFactorization::updateColumnU(CoinIndexedVector *regionSparse,
     updateColumnUSparsish(regionSparse, indexIn);
     break;
   case 2: // sparse
-    updateColumnUSparse(regionSparse, indexIn);
+    if (numberReach < 0)
+      numberReach = reachU(indexIn, numberNonZero, COIN_INT_MAX, numberSlacks);
+    updateColumnUReach(regionSparse, numberReach, numberSlacks);
     break;
   }
-  if (collectStatistics_) {
+  if (statistics)
+    statistics->addSolveMode(1, goSparse, numberReach + numberSlacks, startTime);
+  if (collectStatistics_ && !numberBatchThreads_) {
     ftranCountAfterU_ += regionSparse->getNumElements();
 #ifdef CLP_FACTORIZATION_INSTRUMENT
     int numberNonZero = regionSparse->getNumElements();
@@ -1225,23 +1291,22 @@ int CoinFactorization::updateColumnUDensish(double *COIN_RESTRICT region,
 void CoinFactorization::updateColumnUSparse(CoinIndexedVector *regionSparse,
   int *COIN_RESTRICT indexIn) const
 {
-  int numberNonZero = regionSparse->getNumElements();
-  int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
-  double *COIN_RESTRICT region = regionSparse->denseVector();
-  double tolerance = zeroTolerance_;
+  int numberSlacks;
+  int numberReach = reachU(indexIn, regionSparse->getNumElements(),
+    COIN_INT_MAX, numberSlacks);
+  updateColumnUReach(regionSparse, numberReach, numberSlacks);
+}
+/* Symbolic reach in U (depth first search).  Non slack pivots end up on
+   list part of sparse work area in reverse topological order and slacks
+   at end of stack part */
+int CoinFactorization::reachU(const int *COIN_RESTRICT indexIn, int number,
+  int maximumReach, int &numberSlacks) const
+{
   const int *startColumn = startColumnUArray_;
   const int *indexRow = indexRowUArray_;
-  const CoinFactorizationDouble *COIN_RESTRICT element = elementUArray_;
-  const CoinFactorizationDouble *COIN_RESTRICT pivotRegion = pivotRegionArray_;
   // use sparse_ as temporary area
   // mark known to be zero
-#if ABOCA_LITE_FACTORIZATION == 0
-#define sparseOffset 0
-#else
-  int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
-  assert(!sparseOffset);
-#endif
-  int *COIN_RESTRICT stack = sparseArray_ + sparseOffset; /* pivot */
+  int *COIN_RESTRICT stack = sparseWorkArea(); /* pivot */
   int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
   int *COIN_RESTRICT next = reinterpret_cast< int * >(list + maximumRowsExtra_); /* jnext */
   char *COIN_RESTRICT mark = reinterpret_cast< char * >(next + maximumRowsExtra_);
@@ -1257,7 +1322,7 @@ void CoinFactorization::updateColumnUSparse(CoinIndexedVector *regionSparse,
 
   const int *numberInColumn = numberInColumnArray_;
   int nList = 0;
-  for (int i = 0; i < numberNonZero; i++) {
+  for (int i = 0; i < number; i++) {
     int kPivot = indexIn[i];
     stack[0] = kPivot;
     int j = startColumn[kPivot] + numberInColumn[kPivot] - 1;
@@ -1305,30 +1370,42 @@ void CoinFactorization::updateColumnUSparse(CoinIndexedVector *regionSparse,
             *put = kPivot;
           }
         }
+        if (nList + (putLast - put) > maximumReach) {
+          // too big - clean up and give up
+          for (int k = 0; k < nList; k++)
+            mark[list[k]] = 0;
+          for (; put < putLast; put++)
+            mark[*put] = 0;
+          for (int k = 0; k < nStack; k++)
+            mark[stack[k]] = 0;
+          numberSlacks = 0;
+          return -1;
+        }
       }
     }
   }
-#if 0
-  {
-    std::sort(list,list+nList);
-    int i;
-    int last;
-    last =-1;
-    for (i=0;i<nList;i++) {
-      int k = list[i];
-      assert (k>last);
-      last=k;
-    }
-    std::sort(put,putLast);
-    int n = putLast-put;
-    last =-1;
-    for (i=0;i<n;i++) {
-      int k = put[i];
-      assert (k>last);
-      last=k;
-    }
-  }
-#endif
+  numberSlacks = static_cast< int >(putLast - put);
+  return nList;
+}
+// Updates part of column (FTRANU) using reach from reachU
+void CoinFactorization::updateColumnUReach(CoinIndexedVector *regionSparse,
+  int numberReach, int numberSlacks) const
+{
+  int numberNonZero;
+  int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
+  double *COIN_RESTRICT region = regionSparse->denseVector();
+  double tolerance = zeroTolerance_;
+  const int *startColumn = startColumnUArray_;
+  const int *indexRow = indexRowUArray_;
+  const CoinFactorizationDouble *COIN_RESTRICT element = elementUArray_;
+  const CoinFactorizationDouble *COIN_RESTRICT pivotRegion = pivotRegionArray_;
+  const int *numberInColumn = numberInColumnArray_;
+  int *COIN_RESTRICT stack = sparseWorkArea();
+  const int *COIN_RESTRICT list = stack + maximumRowsExtra_;
+  char *COIN_RESTRICT mark = reinterpret_cast< char * >(stack + 3 * maximumRowsExtra_);
+  int nList = numberReach;
+  const int *COIN_RESTRICT putLast = stack + maximumRowsExtra_;
+  const int *COIN_RESTRICT put = putLast - numberSlacks;
   numberNonZero = 0;
   for (int i = nList - 1; i >= 0; i--) {
     int iPivot = list[i];
@@ -1406,7 +1483,7 @@ void CoinFactorization::updateColumnUSparsish(CoinIndexedVector *regionSparse,
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
   assert(!sparseOffset);
 #endif
-  int *COIN_RESTRICT stack = sparseArray_ + sparseOffset; /* pivot */
+  int *COIN_RESTRICT stack = sparseWorkArea() + sparseOffset; /* pivot */
   int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
   int *COIN_RESTRICT next = reinterpret_cast< int * >(list + maximumRowsExtra_); /* jnext */
   CoinCheckZero *COIN_RESTRICT mark = reinterpret_cast< CoinCheckZero * >(next + maximumRowsExtra_);
@@ -1695,7 +1772,7 @@ void CoinFactorization::updateColumnR(CoinIndexedVector *regionSparse) const
   // third
   methodTime[2] = sizeR + numberPivots_ * startDot + numberNonZero * final;
   // switch off if necessary
-  if (!numberInColumnPlus_.array()) {
+  if (!numberInColumnPlusArray_) {
     methodTime[0] = 1.0e100;
     methodTime[1] = 1.0e100;
   } else if (!sparseArray_) {
@@ -1725,7 +1802,7 @@ void CoinFactorization::updateColumnR(CoinIndexedVector *regionSparse) const
       int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
       assert(!sparseOffset);
 #endif
-    int *COIN_RESTRICT stack = sparseArray_ + sparseOffset; /* pivot */
+    int *COIN_RESTRICT stack = sparseWorkArea() + sparseOffset; /* pivot */
     int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
     int *COIN_RESTRICT next = (int *)(list + maximumRowsExtra_); /* jnext */
     char *COIN_RESTRICT mark = (char *)(next + maximumRowsExtra_);
@@ -1830,7 +1907,7 @@ void CoinFactorization::updateColumnR(CoinIndexedVector *regionSparse) const
     int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
     assert(!sparseOffset);
 #endif
-    int *COIN_RESTRICT stack = sparseArray_ + sparseOffset; /* pivot */
+    int *COIN_RESTRICT stack = sparseWorkArea() + sparseOffset; /* pivot */
     int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
     int *COIN_RESTRICT next = reinterpret_cast< int * >(list + maximumRowsExtra_); /* jnext */
     char *COIN_RESTRICT mark = reinterpret_cast< char * >(next + maximumRowsExtra_);
@@ -2015,7 +2092,7 @@ void CoinFactorization::updateColumnRFT(CoinIndexedVector *regionSparse,
     // third
     methodTime[2] = sizeR + numberPivots_ * startDot + numberNonZero * final;
     // switch off if necessary
-    if (!numberInColumnPlus_.array()) {
+    if (!numberInColumnPlusArray_) {
       methodTime[0] = 1.0e100;
       methodTime[1] = 1.0e100;
     } else if (!sparseArray_) {
@@ -2044,7 +2121,7 @@ void CoinFactorization::updateColumnRFT(CoinIndexedVector *regionSparse,
       int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
       assert(!sparseOffset);
 #endif
-      int *COIN_RESTRICT stack = sparseArray_ + sparseOffset; /* pivot */
+      int *COIN_RESTRICT stack = sparseWorkArea() + sparseOffset; /* pivot */
       int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
       int *COIN_RESTRICT next = reinterpret_cast< int * >(list + maximumRowsExtra_); /* jnext */
       char *COIN_RESTRICT mark = reinterpret_cast< char * >(next + maximumRowsExtra_);
@@ -2252,6 +2329,8 @@ int CoinFactorization::updateColumnFT(CoinIndexedVector *regionSparse,
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   double startTimeX = CoinCpuTime();
 #endif
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::ftranFTPhase);
   //permute and move indices into index array
   int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
   int numberNonZero = regionSparse2->getNumElements();
@@ -2363,5 +2442,164 @@ int CoinFactorization::updateColumnFT(CoinIndexedVector *regionSparse,
     return -regionSparse2->getNumElements();
 }
 
+// Sets number of threads for updateColumns etc
+void CoinFactorization::setNumberThreads(int value)
+{
+  numberThreads_ = CoinMax(value, 1);
+  if (threadPool_ && threadPool_->numberThreads() != numberThreads_) {
+    delete threadPool_;
+    threadPool_ = NULL;
+  }
+}
+// Sparse work area for this thread when doing updateColumns
+int *CoinFactorization::threadSparseArea() const
+{
+  int which = CoinThreadPool::threadIndex();
+  if (which > 0 && which <= numberThreadSparse_)
+    return threadSparse_ + (which - 1) * threadSparseSize_;
+  else
+    return sparseArray_;
+}
+// Where this thread counts solve paths when doing updateColumns
+CoinFactorizationStatistics *CoinFactorization::threadSolveStatistics() const
+{
+  if (threadStatistics_)
+    return threadStatistics_ + CoinThreadPool::threadIndex();
+  else
+    return NULL;
+}
+// Size of a sparse work area (0 if not sparse)
+int CoinFactorization::sparseAreaSize() const
+{
+  int size = 0;
+  if (sparseArray_) {
+    // same layout as sparse_ (see goSparse)
+    int nRowIndex = (maximumRowsExtra_ + CoinSizeofAsInt(int) - 1) / CoinSizeofAsInt(char);
+    int nInBig = static_cast< int >(sizeof(int) / sizeof(int));
+    assert(nInBig >= 1);
+    size = (2 + nInBig) * maximumRowsExtra_ + nRowIndex;
+#if ABOCA_LITE_FACTORIZATION
+    size *= 2;
+#endif
+  }
+  return size;
+}
+// Gets sparse work areas (and threads) for updateColumns
+void CoinFactorization::startBatch() const
+{
+  if (!threadPool_)
+    threadPool_ = new CoinThreadPool(numberThreads_);
+  int numberNeeded = threadPool_->numberThreads() - 1;
+  int sizeNeeded = sparseAreaSize();
+  if (!sizeNeeded)
+    numberNeeded = 0;
+  if (numberNeeded != numberThreadSparse_ || sizeNeeded != threadSparseSize_) {
+    delete[] threadSparse_;
+    threadSparse_ = NULL;
+    if (numberNeeded) {
+      // mark part must be zero - may as well clear it all
+      threadSparse_ = new int[numberNeeded * sizeNeeded];
+      CoinZeroN(threadSparse_, numberNeeded * sizeNeeded);
+    }
+    numberThreadSparse_ = numberNeeded;
+    threadSparseSize_ = sizeNeeded;
+  }
+}
+namespace {
+typedef struct {
+  const CoinFactorization *factorization;
+  CoinIndexedVector **regionSparse;
+  CoinIndexedVector **regionSparse2;
+  int *numberElements;
+  int numberColumns;
+  int numberTasks;
+  bool transpose;
+} CoinUpdateColumnsInfo;
+void updateColumnsTask(void *info, int which)
+{
+  CoinUpdateColumnsInfo *update = reinterpret_cast< CoinUpdateColumnsInfo * >(info);
+  const CoinFactorization *factorization = update->factorization;
+  int n = 0;
+  for (int i = which; i < update->numberColumns; i += update->numberTasks) {
+    if (update->transpose)
+      n += factorization->updateColumnTranspose(update->regionSparse[i],
+        update->regionSparse2[i]);
+    else
+      n += factorization->updateColumn(update->regionSparse[i],
+        update->regionSparse2[i]);
+  }
+  update->numberElements[which] = n;
+}
+}
+/* Updates several columns (FTRAN) at once.
+   Each column is done exactly as in updateColumn.  With threads each
+   thread takes every numberThreads'th column and uses its own sparse
+   work area. */
+int CoinFactorization::updateColumns(int numberColumns,
+  CoinIndexedVector **regionSparse,
+  CoinIndexedVector **regionSparse2) const
+{
+  return updateColumnsBatch(numberColumns, regionSparse, regionSparse2, false);
+}
+// Updates several columns (BTRAN) at once
+int CoinFactorization::updateColumnsTranspose(int numberColumns,
+  CoinIndexedVector **regionSparse,
+  CoinIndexedVector **regionSparse2) const
+{
+  return updateColumnsBatch(numberColumns, regionSparse, regionSparse2, true);
+}
+// Does updateColumns or updateColumnsTranspose
+int CoinFactorization::updateColumnsBatch(int numberColumns,
+  CoinIndexedVector **regionSparse,
+  CoinIndexedVector **regionSparse2,
+  bool transpose) const
+{
+  int numberElements = 0;
+  if (numberThreads_ <= 1 || numberColumns < 2 || numberBatchThreads_
+    || !CoinThreadPool::threadsAvailable()) {
+    for (int i = 0; i < numberColumns; i++) {
+      if (transpose)
+        numberElements += updateColumnTranspose(regionSparse[i], regionSparse2[i]);
+      else
+        numberElements += updateColumn(regionSparse[i], regionSparse2[i]);
+    }
+    return numberElements;
+  }
+  // whole batch timed here - threads only count solve paths
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    transpose ? CoinFactorizationStatistics::btranPhase
+              : CoinFactorizationStatistics::ftranPhase,
+    numberColumns);
+  startBatch();
+  int numberTasks = CoinMin(threadPool_->numberThreads(), numberColumns);
+  int *counts = new int[numberTasks];
+  CoinUpdateColumnsInfo info;
+  info.factorization = this;
+  info.regionSparse = regionSparse;
+  info.regionSparse2 = regionSparse2;
+  info.numberElements = counts;
+  info.numberColumns = numberColumns;
+  info.numberTasks = numberTasks;
+  info.transpose = transpose;
+  numberBatchThreads_ = threadPool_->numberThreads();
+  if (statistics_) {
+    threadStatistics_ = new CoinFactorizationStatistics[numberBatchThreads_];
+    for (int i = 0; i < numberBatchThreads_; i++)
+      threadStatistics_[i].setTimeSolves(statistics_->timeSolves());
+  }
+  threadPool_->run(numberTasks, updateColumnsTask, &info);
+  if (threadStatistics_) {
+    for (int i = 0; i < numberBatchThreads_; i++)
+      statistics_->add(threadStatistics_[i]);
+    delete[] threadStatistics_;
+    threadStatistics_ = NULL;
+  }
+  numberBatchThreads_ = 0;
+  for (int i = 0; i < numberTasks; i++)
+    numberElements += counts[i];
+  delete[] counts;
+  return numberElements;
+}
+
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
 */
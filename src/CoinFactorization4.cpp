@@ -16,6 +16,9 @@
 #include "CoinIndexedVector.hpp"
 #include "CoinHelperFunctions.hpp"
 #include "CoinTime.hpp"
+#include "CoinThreadPool.hpp"
+#include "CoinFactorizationStatistics.hpp"
+#include "CoinArrayFile.hpp"
 #include <stdio.h>
 #include <iostream>
 #if COIN_FACTORIZATION_DENSE_CODE == 1
@@ -44,6 +47,9 @@ int clapack_dgetrs(const enum CBLAS_ORDER Order,
 #elif COIN_FACTORIZATION_DENSE_CODE == 3
 // Intel compiler
 #include "mkl_lapacke.h"
+#elif COIN_FACTORIZATION_DENSE_CODE == 4
+// built in
+#include "CoinDenseLU.hpp"
 #endif
 // For semi-sparse
 #define BITS_PER_CHECK 8
@@ -292,6 +298,8 @@ int CoinFactorization::replaceColumn(CoinIndexedVector *regionSparse,
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   double startTimeX = CoinCpuTime();
 #endif
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::replaceColumnPhase);
   assert(numberU_ <= numberRowsExtra_);
   int *COIN_RESTRICT startColumnU = startColumnUArray_;
   int *COIN_RESTRICT startColumn;
@@ -733,6 +741,8 @@ int CoinFactorization::replaceColumn(CoinIndexedVector *regionSparse,
   currentLengthR = lengthR_;
   currentLengthU = lengthU_;
 #endif
+  if (statistics_)
+    statistics_->setUpdateElements(lengthR_);
   return status;
 }
 #if ABOCA_LITE_FACTORIZATION
@@ -1197,6 +1207,9 @@ int CoinFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   double startTimeX = CoinCpuTime();
 #endif
+  // not collected while threads are using factorization
+  CoinFactorizationStatisticsTimer timer(numberBatchThreads_ ? NULL : statistics_,
+    CoinFactorizationStatistics::btranPhase);
   //zero region
   regionSparse->clear();
   double *COIN_RESTRICT region = regionSparse->denseVector();
@@ -1228,7 +1241,7 @@ int CoinFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
     }
   }
   regionSparse->setNumElements(numberNonZero);
-  if (collectStatistics_) {
+  if (collectStatistics_ && !numberBatchThreads_) {
     numberBtranCounts_++;
     btranCountInput_ += static_cast< double >(numberNonZero);
   }
@@ -1248,7 +1261,7 @@ int CoinFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
     region[iRow] *= pivotRegion[iRow];
   }
   updateColumnTransposeU(regionSparse, smallestIndex);
-  if (collectStatistics_)
+  if (collectStatistics_ && !numberBatchThreads_)
     btranCountAfterU_ += static_cast< double >(regionSparse->getNumElements());
   //permute extra
   //row bits here
@@ -1256,7 +1269,7 @@ int CoinFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
   //  ******* L
   updateColumnTransposeL(regionSparse);
   numberNonZero = regionSparse->getNumElements();
-  if (collectStatistics_) {
+  if (collectStatistics_ && !numberBatchThreads_) {
     btranCountAfterL_ += static_cast< double >(numberNonZero);
 #ifdef CLP_FACTORIZATION_INSTRUMENT
     scaledLengthDense += numberDense_ * numberNonZero;
@@ -1748,7 +1761,7 @@ void CoinFactorization::updateColumnTransposeUSparsish(CoinIndexedVector *region
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
   assert(!sparseOffset);
 #endif
-  CoinCheckZero *COIN_RESTRICT mark = reinterpret_cast< CoinCheckZero * >(sparseArray_ + (2 + nInBig) * maximumRowsExtra_ + sparseOffset);
+  CoinCheckZero *COIN_RESTRICT mark = reinterpret_cast< CoinCheckZero * >(sparseWorkArea() + (2 + nInBig) * maximumRowsExtra_ + sparseOffset);
 
   for (int i = 0; i < numberNonZero; i++) {
     int iPivot = regionIndex[i];
@@ -1832,18 +1845,18 @@ void CoinFactorization::updateColumnTransposeUSparsish(CoinIndexedVector *region
 void CoinFactorization::updateColumnTransposeUSparse(
   CoinIndexedVector *regionSparse) const
 {
-  double *COIN_RESTRICT region = regionSparse->denseVector();
+  int numberReach = reachTransposeU(regionSparse, COIN_INT_MAX);
+  updateColumnTransposeUReach(regionSparse, numberReach);
+}
+/* Symbolic reach in row copy of U (depth first search).  Pivots end up
+   on list part of sparse work area in reverse topological order */
+int CoinFactorization::reachTransposeU(const CoinIndexedVector *regionSparse,
+  int maximumReach) const
+{
   int numberNonZero = regionSparse->getNumElements();
-  double tolerance = zeroTolerance_;
-
-  int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
+  const int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
   const int *startRow = startRowUArray_;
-
-  const int *convertRowToColumn = convertRowToColumnUArray_;
   const int *indexColumn = indexColumnUArray_;
-
-  const CoinFactorizationDouble *COIN_RESTRICT element = elementUArray_;
-
   const int *numberInRow = numberInRowArray_;
 
   // use sparse_ as temporary area
@@ -1853,7 +1866,7 @@ void CoinFactorization::updateColumnTransposeUSparse(
 #else
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
 #endif
-  int *COIN_RESTRICT stack = sparseArray_ + sparseOffset; /* pivot */
+  int *COIN_RESTRICT stack = sparseWorkArea() + sparseOffset; /* pivot */
   int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
   int *COIN_RESTRICT next = reinterpret_cast< int * >(list + maximumRowsExtra_); /* jnext */
   char *COIN_RESTRICT mark = reinterpret_cast< char * >(next + maximumRowsExtra_);
@@ -1862,18 +1875,6 @@ void CoinFactorization::updateColumnTransposeUSparse(
   for (int i = 0; i < maximumRowsExtra_; i++) {
     assert(!mark[i]);
   }
-#endif
-#if 0
-  {
-    int i;
-    for (i=0;i<numberRowsExtra_;i++) {
-      int krs = startRow[i];
-      int kre = krs + numberInRow[i];
-      int k;
-      for (k=krs;k<kre;k++)
-	assert (indexColumn[k]>i);
-    }
-  }
 #endif
   nList = 0;
   for (int k = 0; k < numberNonZero; k++) {
@@ -1902,12 +1903,45 @@ void CoinFactorization::updateColumnTransposeUSparse(
           // finished
           list[nList++] = kPivot;
           mark[kPivot] = 1;
+          if (nList > maximumReach) {
+            // too big - clean up and give up
+            for (int i = 0; i < nList; i++)
+              mark[list[i]] = 0;
+            for (int i = 0; i < nStack; i++)
+              mark[stack[i]] = 0;
+            return -1;
+          }
         }
       }
     }
   }
-  numberNonZero = 0;
-  for (int i = nList - 1; i >= 0; i--) {
+  return nList;
+}
+// Updates part of column transpose (BTRANU) using reach from reachTransposeU
+void CoinFactorization::updateColumnTransposeUReach(CoinIndexedVector *regionSparse,
+  int numberReach) const
+{
+  double *COIN_RESTRICT region = regionSparse->denseVector();
+  double tolerance = zeroTolerance_;
+
+  int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
+  const int *startRow = startRowUArray_;
+
+  const int *convertRowToColumn = convertRowToColumnUArray_;
+  const int *indexColumn = indexColumnUArray_;
+
+  const CoinFactorizationDouble *COIN_RESTRICT element = elementUArray_;
+
+  const int *numberInRow = numberInRowArray_;
+#if ABOCA_LITE_FACTORIZATION == 0
+#define sparseOffset 0
+#else
+  int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
+#endif
+  const int *COIN_RESTRICT list = sparseWorkArea() + sparseOffset + maximumRowsExtra_;
+  char *COIN_RESTRICT mark = reinterpret_cast< char * >(sparseWorkArea() + sparseOffset + 3 * maximumRowsExtra_);
+  int numberNonZero = 0;
+  for (int i = numberReach - 1; i >= 0; i--) {
     int iPivot = list[i];
     mark[iPivot] = 0;
     CoinFactorizationDouble pivotValue = region[iPivot];
@@ -1964,6 +1998,17 @@ void CoinFactorization::updateColumnTransposeU(CoinIndexedVector *regionSparse,
   } else {
     goSparse = 0;
   }
+  CoinFactorizationStatistics *statistics = solveStatistics();
+  double startTime = statistics ? statistics->startSolve() : 0.0;
+  int numberReach = -1;
+  if (goSparse < 2 && sparseThreshold_ > 0 && number < sparseThreshold_) {
+    // guess may be wrong - see what is actually reached
+    numberReach = reachTransposeU(regionSparse, sparseThreshold_);
+    if (numberReach >= 0)
+      goSparse = 2;
+    else if (statistics)
+      statistics->addReachAbandoned(2);
+  }
   switch (goSparse) {
   case 0: // densish
     updateColumnTransposeUDensish(regionSparse, smallestIndex);
@@ -1972,9 +2017,13 @@ void CoinFactorization::updateColumnTransposeU(CoinIndexedVector *regionSparse,
     updateColumnTransposeUSparsish(regionSparse, smallestIndex);
     break;
   case 2: // sparse
-    updateColumnTransposeUSparse(regionSparse);
+    if (numberReach < 0)
+      numberReach = reachTransposeU(regionSparse, COIN_INT_MAX);
+    updateColumnTransposeUReach(regionSparse, numberReach);
     break;
   }
+  if (statistics)
+    statistics->addSolveMode(2, goSparse, numberReach, startTime);
 }
 
 /*  updateColumnTransposeLDensish.
@@ -2115,7 +2164,7 @@ void CoinFactorization::updateColumnTransposeLSparsish(CoinIndexedVector *region
 #else
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
 #endif
-  CoinCheckZero *COIN_RESTRICT mark = reinterpret_cast< CoinCheckZero * >(sparseArray_ + (2 + nInBig) * maximumRowsExtra_ + sparseOffset);
+  CoinCheckZero *COIN_RESTRICT mark = reinterpret_cast< CoinCheckZero * >(sparseWorkArea() + (2 + nInBig) * maximumRowsExtra_ + sparseOffset);
   for (int i = 0; i < numberNonZero; i++) {
     int iPivot = regionIndex[i];
     int iWord = iPivot >> CHECK_SHIFT;
@@ -2195,13 +2244,19 @@ void CoinFactorization::updateColumnTransposeLSparsish(CoinIndexedVector *region
     Updates part of column transpose (BTRANL) sparse */
 void CoinFactorization::updateColumnTransposeLSparse(CoinIndexedVector *regionSparse) const
 {
-  double *COIN_RESTRICT region = regionSparse->denseVector();
-  int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
-  int numberNonZero = regionSparse->getNumElements();
-  double tolerance = zeroTolerance_;
+  int numberReach = reachTransposeL(regionSparse, COIN_INT_MAX);
+  updateColumnTransposeLReach(regionSparse, numberReach);
+}
+/* Symbolic reach in row copy of L (depth first search).  Pivots end up
+   on list part of sparse work area in reverse topological order */
+int CoinFactorization::reachTransposeL(const CoinIndexedVector *regionSparse,
+  int maximumReach) const
+{
+  const double *COIN_RESTRICT region = regionSparse->denseVector();
+  const int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
+  int number = regionSparse->getNumElements();
 
   // use row copy of L
-  const CoinFactorizationDouble *COIN_RESTRICT element = elementByRowLArray_;
   const int *startRow = startRowLArray_;
   const int *column = indexColumnLArray_;
   // use sparse_ as temporary area
@@ -2211,14 +2266,13 @@ void CoinFactorization::updateColumnTransposeLSparse(CoinIndexedVector *regionSp
 #else
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
 #endif
-  int *COIN_RESTRICT stack = sparseArray_ + sparseOffset; /* pivot */
+  int *COIN_RESTRICT stack = sparseWorkArea() + sparseOffset; /* pivot */
   int *COIN_RESTRICT list = stack + maximumRowsExtra_; /* final list */
   int *COIN_RESTRICT next = reinterpret_cast< int * >(list + maximumRowsExtra_); /* jnext */
   char *COIN_RESTRICT mark = reinterpret_cast< char * >(next + maximumRowsExtra_);
   int nList;
-  int number = numberNonZero;
 #ifdef COIN_DEBUG
-  for (i = 0; i < maximumRowsExtra_; i++) {
+  for (int i = 0; i < maximumRowsExtra_; i++) {
     assert(!mark[i]);
   }
 #endif
@@ -2247,6 +2301,14 @@ void CoinFactorization::updateColumnTransposeLSparse(CoinIndexedVector *regionSp
           /* finished so mark */
           list[nList++] = kPivot;
           mark[kPivot] = 1;
+          if (nList > maximumReach) {
+            // too big - clean up and give up
+            for (int i = 0; i < nList; i++)
+              mark[list[i]] = 0;
+            for (int i = 0; i <= nStack; i++)
+              mark[stack[i]] = 0;
+            return -1;
+          }
           --nStack;
           if (nStack >= 0) {
             kPivot = stack[nStack];
@@ -2256,8 +2318,29 @@ void CoinFactorization::updateColumnTransposeLSparse(CoinIndexedVector *regionSp
       }
     }
   }
-  numberNonZero = 0;
-  for (int i = nList - 1; i >= 0; i--) {
+  return nList;
+}
+// Updates part of column transpose (BTRANL) using reach from reachTransposeL
+void CoinFactorization::updateColumnTransposeLReach(CoinIndexedVector *regionSparse,
+  int numberReach) const
+{
+  double *COIN_RESTRICT region = regionSparse->denseVector();
+  int *COIN_RESTRICT regionIndex = regionSparse->getIndices();
+  double tolerance = zeroTolerance_;
+
+  // use row copy of L
+  const CoinFactorizationDouble *COIN_RESTRICT element = elementByRowLArray_;
+  const int *startRow = startRowLArray_;
+  const int *column = indexColumnLArray_;
+#if ABOCA_LITE_FACTORIZATION == 0
+#define sparseOffset 0
+#else
+  int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
+#endif
+  const int *COIN_RESTRICT list = sparseWorkArea() + sparseOffset + maximumRowsExtra_;
+  char *COIN_RESTRICT mark = reinterpret_cast< char * >(sparseWorkArea() + sparseOffset + 3 * maximumRowsExtra_);
+  int numberNonZero = 0;
+  for (int i = numberReach - 1; i >= 0; i--) {
     int iPivot = list[i];
     mark[iPivot] = 0;
     CoinFactorizationDouble pivotValue = region[iPivot];
@@ -2305,6 +2388,8 @@ void CoinFactorization::updateColumnTransposeL(CoinIndexedVector *regionSparse)
   } else {
     goSparse = -1;
   }
+  // whether index list is correct (so reach can be tried)
+  bool indicesValid = true;
 #ifdef COIN_FACTORIZATION_DENSE_CODE
   if (numberDense_) {
     //take off list
@@ -2357,10 +2442,15 @@ void CoinFactorization::updateColumnTransposeL(CoinIndexedVector *regionSparse)
       LAPACKE_dgetrs(LAPACK_COL_MAJOR,'T',numberDense_,1,
                      denseAreaAddress_,numberDense_,densePermute_,
                      region+lastSparse,numberDense_);
+#elif COIN_FACTORIZATION_DENSE_CODE == 4
+      CoinDenseLUSolve(true, numberDense_, denseAreaAddress_, numberDense_,
+        densePermute_, region + lastSparse);
 #endif
       //and scan again
       if (goSparse > 0 || !numberL_)
         regionSparse->scan(lastSparse, numberRows_, zeroTolerance_);
+      else
+        indicesValid = false;
     }
     if (!numberL_) {
       // could be odd combination of sparse/dense
@@ -2374,6 +2464,19 @@ void CoinFactorization::updateColumnTransposeL(CoinIndexedVector *regionSparse)
 #endif
   if (goSparse > 0 && regionSparse->getNumElements() > numberRows_)
     goSparse = 0;
+  CoinFactorizationStatistics *statistics = solveStatistics();
+  double startTime = statistics ? statistics->startSolve() : 0.0;
+  int numberReach = -1;
+  number = regionSparse->getNumElements();
+  if (goSparse >= 0 && goSparse < 2 && number < sparseThreshold_
+    && indicesValid) {
+    // guess may be wrong - see what is actually reached
+    numberReach = reachTransposeL(regionSparse, sparseThreshold_);
+    if (numberReach >= 0)
+      goSparse = 2;
+    else if (statistics)
+      statistics->addReachAbandoned(3);
+  }
   switch (goSparse) {
   case -1: // No row copy
     updateColumnTransposeLDensish(regionSparse);
@@ -2385,9 +2488,14 @@ void CoinFactorization::updateColumnTransposeL(CoinIndexedVector *regionSparse)
     updateColumnTransposeLSparsish(regionSparse);
     break;
   case 2: // sparse
-    updateColumnTransposeLSparse(regionSparse);
+    if (numberReach < 0)
+      numberReach = reachTransposeL(regionSparse, COIN_INT_MAX);
+    updateColumnTransposeLReach(regionSparse, numberReach);
     break;
   }
+  // no row copy counts as densish
+  if (statistics)
+    statistics->addSolveMode(3, CoinMax(goSparse, 0), numberReach, startTime);
 }
 #if COIN_ONE_ETA_COPY
 /* Combines BtranU and delete elements
@@ -2561,7 +2669,7 @@ void CoinFactorization::updateColumnTransposeRSparse(CoinIndexedVector *regionSp
 #else
   int sparseOffset = ((regionSparse->capacity() & 0x80000000) != 0) ? sparseOffset_ : 0;
 #endif
-  int *COIN_RESTRICT spare = sparseArray_ + sparseOffset;
+  int *COIN_RESTRICT spare = sparseWorkArea() + sparseOffset;
   for (int i = 0; i < numberNonZero; i++) {
     spare[regionIndex[i]] = i;
   }
@@ -2609,13 +2717,13 @@ void CoinFactorization::updateColumnTransposeR(CoinIndexedVector *regionSparse)
   if (numberNonZero) {
     if (numberNonZero < (sparseThreshold_ << 2) || (!numberL_ && sparseArray_)) {
       updateColumnTransposeRSparse(regionSparse);
-      if (collectStatistics_)
+      if (collectStatistics_ && !numberBatchThreads_)
         btranCountAfterR_ += regionSparse->getNumElements();
     } else {
       updateColumnTransposeRDensish(regionSparse);
       // we have lost indices
       // make sure won't try and go sparse again
-      if (collectStatistics_)
+      if (collectStatistics_ && !numberBatchThreads_)
         btranCountAfterR_ += std::min((numberNonZero << 1), numberRows_);
       regionSparse->setNumElements(numberRows_ + 1);
     }
@@ -3343,6 +3451,8 @@ CoinFactorization &CoinFactorization::operator=(const CoinFactorization &other)
     gutsOfDestructor(2);
     gutsOfInitialize(3);
     persistenceFlag_ = other.persistenceFlag_;
+    setNumberThreads(other.numberThreads_);
+    pivotBatch_ = other.pivotBatch_;
     gutsOfCopy(other);
     setupPointers();
   }
@@ -3350,6 +3460,8 @@ CoinFactorization &CoinFactorization::operator=(const CoinFactorization &other)
 }
 void CoinFactorization::gutsOfCopy(const CoinFactorization &other)
 {
+  // factors which are shared can not be copied this way
+  assert(!other.sharedFactors_);
   int lengthU = other.lengthAreaU_ + EXTRA_U_SPACE;
   elementU_.allocate(other.elementU_, lengthU * CoinSizeofAsInt(CoinFactorizationDouble));
   indexRowU_.allocate(other.indexRowU_, lengthU * CoinSizeofAsInt(int));
@@ -3391,68 +3503,9 @@ void CoinFactorization::gutsOfCopy(const CoinFactorization &other)
     indexColumnL_.allocate(other.indexColumnL_, other.lengthAreaL_);
     startRowL_.allocate(other.startRowL_, other.numberRows_ + 1);
   }
-  numberTrials_ = other.numberTrials_;
-  biggerDimension_ = other.biggerDimension_;
-  relaxCheck_ = other.relaxCheck_;
-  numberSlacks_ = other.numberSlacks_;
-  numberU_ = other.numberU_;
-  maximumU_ = other.maximumU_;
-  lengthU_ = other.lengthU_;
-  lengthAreaU_ = other.lengthAreaU_;
-  numberL_ = other.numberL_;
-  baseL_ = other.baseL_;
-  lengthL_ = other.lengthL_;
-  lengthAreaL_ = other.lengthAreaL_;
-  numberR_ = other.numberR_;
-  lengthR_ = other.lengthR_;
-  lengthAreaR_ = other.lengthAreaR_;
-  pivotTolerance_ = other.pivotTolerance_;
-  zeroTolerance_ = other.zeroTolerance_;
-#ifndef COIN_FAST_CODE
-  slackValue_ = other.slackValue_;
-#endif
-  areaFactor_ = other.areaFactor_;
-  numberRows_ = other.numberRows_;
-  numberRowsExtra_ = other.numberRowsExtra_;
-  maximumRowsExtra_ = other.maximumRowsExtra_;
-  numberColumns_ = other.numberColumns_;
-  numberColumnsExtra_ = other.numberColumnsExtra_;
-  maximumColumnsExtra_ = other.maximumColumnsExtra_;
-  maximumPivots_ = other.maximumPivots_;
-  numberGoodU_ = other.numberGoodU_;
-  numberGoodL_ = other.numberGoodL_;
-  numberPivots_ = other.numberPivots_;
-  messageLevel_ = other.messageLevel_;
-  totalElements_ = other.totalElements_;
-  factorElements_ = other.factorElements_;
-  status_ = other.status_;
-  doForrestTomlin_ = other.doForrestTomlin_;
-#if 0
-  collectStatistics_=other.collectStatistics_;
-#endif
-  ftranCountInput_ = other.ftranCountInput_;
-  ftranCountAfterL_ = other.ftranCountAfterL_;
-  ftranCountAfterR_ = other.ftranCountAfterR_;
-  ftranCountAfterU_ = other.ftranCountAfterU_;
-  btranCountInput_ = other.btranCountInput_;
-  btranCountAfterU_ = other.btranCountAfterU_;
-  btranCountAfterR_ = other.btranCountAfterR_;
-  btranCountAfterL_ = other.btranCountAfterL_;
-  numberFtranCounts_ = other.numberFtranCounts_;
-  numberBtranCounts_ = other.numberBtranCounts_;
-  ftranAverageAfterL_ = other.ftranAverageAfterL_;
-  ftranAverageAfterR_ = other.ftranAverageAfterR_;
-  ftranAverageAfterU_ = other.ftranAverageAfterU_;
-  btranAverageAfterU_ = other.btranAverageAfterU_;
-  btranAverageAfterR_ = other.btranAverageAfterR_;
-  btranAverageAfterL_ = other.btranAverageAfterL_;
-  biasLU_ = other.biasLU_;
-  sparseThreshold_ = other.sparseThreshold_;
-  sparseThreshold2_ = other.sparseThreshold2_;
+  gutsOfCopyScalars(other);
   int space = lengthAreaL_ - lengthL_;
 
-  numberDense_ = other.numberDense_;
-  denseThreshold_ = other.denseThreshold_;
   if (numberDense_) {
     denseArea_ = new double[numberDense_ * numberDense_];
     denseAreaAddress_ = denseArea_;
@@ -3551,6 +3604,525 @@ void CoinFactorization::gutsOfCopy(const CoinFactorization &other)
     goSparse();
   }
 }
+// Copies scalars (sizes, counts and tolerances)
+void CoinFactorization::gutsOfCopyScalars(const CoinFactorization &other)
+{
+  numberTrials_ = other.numberTrials_;
+  biggerDimension_ = other.biggerDimension_;
+  relaxCheck_ = other.relaxCheck_;
+  numberSlacks_ = other.numberSlacks_;
+  numberU_ = other.numberU_;
+  maximumU_ = other.maximumU_;
+  lengthU_ = other.lengthU_;
+  lengthAreaU_ = other.lengthAreaU_;
+  numberL_ = other.numberL_;
+  baseL_ = other.baseL_;
+  lengthL_ = other.lengthL_;
+  lengthAreaL_ = other.lengthAreaL_;
+  numberR_ = other.numberR_;
+  lengthR_ = other.lengthR_;
+  lengthAreaR_ = other.lengthAreaR_;
+  pivotTolerance_ = other.pivotTolerance_;
+  zeroTolerance_ = other.zeroTolerance_;
+#ifndef COIN_FAST_CODE
+  slackValue_ = other.slackValue_;
+#endif
+  areaFactor_ = other.areaFactor_;
+  numberRows_ = other.numberRows_;
+  numberRowsExtra_ = other.numberRowsExtra_;
+  maximumRowsExtra_ = other.maximumRowsExtra_;
+  numberColumns_ = other.numberColumns_;
+  numberColumnsExtra_ = other.numberColumnsExtra_;
+  maximumColumnsExtra_ = other.maximumColumnsExtra_;
+  maximumPivots_ = other.maximumPivots_;
+  numberGoodU_ = other.numberGoodU_;
+  numberGoodL_ = other.numberGoodL_;
+  numberPivots_ = other.numberPivots_;
+  messageLevel_ = other.messageLevel_;
+  totalElements_ = other.totalElements_;
+  factorElements_ = other.factorElements_;
+  status_ = other.status_;
+  doForrestTomlin_ = other.doForrestTomlin_;
+#if 0
+  collectStatistics_=other.collectStatistics_;
+#endif
+  ftranCountInput_ = other.ftranCountInput_;
+  ftranCountAfterL_ = other.ftranCountAfterL_;
+  ftranCountAfterR_ = other.ftranCountAfterR_;
+  ftranCountAfterU_ = other.ftranCountAfterU_;
+  btranCountInput_ = other.btranCountInput_;
+  btranCountAfterU_ = other.btranCountAfterU_;
+  btranCountAfterR_ = other.btranCountAfterR_;
+  btranCountAfterL_ = other.btranCountAfterL_;
+  numberFtranCounts_ = other.numberFtranCounts_;
+  numberBtranCounts_ = other.numberBtranCounts_;
+  ftranAverageAfterL_ = other.ftranAverageAfterL_;
+  ftranAverageAfterR_ = other.ftranAverageAfterR_;
+  ftranAverageAfterU_ = other.ftranAverageAfterU_;
+  btranAverageAfterU_ = other.btranAverageAfterU_;
+  btranAverageAfterR_ = other.btranAverageAfterR_;
+  btranAverageAfterL_ = other.btranAverageAfterL_;
+  biasLU_ = other.biasLU_;
+  sparseThreshold_ = other.sparseThreshold_;
+  sparseThreshold2_ = other.sparseThreshold2_;
+  numberDense_ = other.numberDense_;
+  denseThreshold_ = other.denseThreshold_;
+#if ABOCA_LITE_FACTORIZATION
+  sparseOffset_ = other.sparseOffset_;
+#endif
+}
+/* Sets up to solve with factors of other without copying them.
+   Arrays are those of other - only sparse work area is our own */
+void CoinFactorization::shareFactors(const CoinFactorization &other)
+{
+  gutsOfDestructor();
+  gutsOfInitialize(2);
+  gutsOfCopyScalars(other);
+  sharedFactors_ = other.sharedFactors_ ? other.sharedFactors_ : &other;
+  elementR_ = other.elementR_;
+  indexRowR_ = other.indexRowR_;
+  denseAreaAddress_ = other.denseAreaAddress_;
+  densePermute_ = other.densePermute_;
+  pivotColumnArray_ = other.pivotColumnArray_;
+  permuteArray_ = other.permuteArray_;
+  permuteBackArray_ = other.permuteBackArray_;
+  pivotColumnBackArray_ = other.pivotColumnBackArray_;
+  startRowUArray_ = other.startRowUArray_;
+  numberInRowArray_ = other.numberInRowArray_;
+  numberInColumnArray_ = other.numberInColumnArray_;
+  numberInColumnPlusArray_ = other.numberInColumnPlusArray_;
+  nextColumnArray_ = other.nextColumnArray_;
+  lastColumnArray_ = other.lastColumnArray_;
+  nextRowArray_ = other.nextRowArray_;
+  lastRowArray_ = other.lastRowArray_;
+  indexColumnUArray_ = other.indexColumnUArray_;
+  pivotRegionArray_ = other.pivotRegionArray_;
+  elementUArray_ = other.elementUArray_;
+  indexRowUArray_ = other.indexRowUArray_;
+  startColumnUArray_ = other.startColumnUArray_;
+  convertRowToColumnUArray_ = other.convertRowToColumnUArray_;
+  elementLArray_ = other.elementLArray_;
+  indexRowLArray_ = other.indexRowLArray_;
+  startColumnLArray_ = other.startColumnLArray_;
+  startColumnRArray_ = other.startColumnRArray_;
+  startRowLArray_ = other.startRowLArray_;
+  indexColumnLArray_ = other.indexColumnLArray_;
+  elementByRowLArray_ = other.elementByRowLArray_;
+  // only used by factorize
+  firstCountArray_ = NULL;
+  nextCountArray_ = NULL;
+  lastCountArray_ = NULL;
+  saveColumnArray_ = NULL;
+  markRowArray_ = NULL;
+  pivotRowLArray_ = NULL;
+  workAreaArray_ = NULL;
+  workArea2Array_ = NULL;
+  // own sparse work area (mark part must be zero)
+  int size = other.sparseAreaSize();
+  if (size) {
+    sparse_.conditionalNew(size);
+    CoinZeroN(sparse_.array(), size);
+  }
+  sparseArray_ = sparse_.array();
+}
+/* Copies everything a Forrest-Tomlin update can change from other.
+   As in gutsOfCopy there is no row copy of R */
+void CoinFactorization::copyUpdates(const CoinFactorization &other)
+{
+  assert(sharedFactors_ && other.doForrestTomlin_);
+  gutsOfCopyScalars(other);
+  int lengthU = lengthAreaU_ + EXTRA_U_SPACE;
+  elementU_.conditionalNew(lengthU);
+  indexRowU_.conditionalNew(lengthU);
+  indexColumnU_.conditionalNew(lengthU);
+  startColumnU_.conditionalNew(maximumColumnsExtra_ + 1);
+  numberInColumn_.conditionalNew(maximumColumnsExtra_ + 1);
+  pivotColumn_.conditionalNew(maximumColumnsExtra_ + 1);
+  nextColumn_.conditionalNew(maximumColumnsExtra_ + 1);
+  lastColumn_.conditionalNew(maximumColumnsExtra_ + 1);
+  pivotRegion_.conditionalNew(maximumRowsExtra_ + 1);
+  permuteBack_.conditionalNew(maximumRowsExtra_ + 1);
+  permute_.conditionalNew(maximumRowsExtra_ + 1);
+  pivotColumnBack_.conditionalNew(maximumRowsExtra_ + 1);
+  nextRow_.conditionalNew(maximumRowsExtra_ + 1);
+  lastRow_.conditionalNew(maximumRowsExtra_ + 1);
+  startColumnR_.conditionalNew(maximumPivots_ + 1);
+  const int *convertUOther = other.convertRowToColumnUArray_;
+  if (convertUOther) {
+    convertRowToColumnU_.conditionalNew(lengthU);
+    startRowU_.conditionalNew(maximumRowsExtra_ + 1);
+    numberInRow_.conditionalNew(maximumRowsExtra_ + 1);
+  }
+  // R goes where it would be after L
+  int space = lengthAreaL_ - lengthL_;
+  elementL_.conditionalNew(space);
+  indexRowL_.conditionalNew(space);
+  if (numberRowsExtra_) {
+    if (convertUOther) {
+      CoinMemcpyN(other.startRowUArray_, numberRowsExtra_ + 1, startRowU_.array());
+      CoinMemcpyN(other.numberInRowArray_, numberRowsExtra_ + 1, numberInRow_.array());
+      startRowU_.array()[maximumRowsExtra_] = other.startRowUArray_[maximumRowsExtra_];
+    }
+    CoinMemcpyN(other.pivotRegionArray_, numberRowsExtra_, pivotRegion_.array());
+    CoinMemcpyN(other.permuteBackArray_, numberRowsExtra_ + 1, permuteBack_.array());
+    CoinMemcpyN(other.permuteArray_, numberRowsExtra_ + 1, permute_.array());
+    CoinMemcpyN(other.pivotColumnBackArray_, numberRowsExtra_ + 1, pivotColumnBack_.array());
+    CoinMemcpyN(other.startColumnUArray_, numberRowsExtra_ + 1, startColumnU_.array());
+    CoinMemcpyN(other.numberInColumnArray_, numberRowsExtra_ + 1, numberInColumn_.array());
+    CoinMemcpyN(other.pivotColumnArray_, numberRowsExtra_ + 1, pivotColumn_.array());
+    CoinMemcpyN(other.nextColumnArray_, numberRowsExtra_ + 1, nextColumn_.array());
+    CoinMemcpyN(other.lastColumnArray_, numberRowsExtra_ + 1, lastColumn_.array());
+    CoinMemcpyN(other.startColumnRArray_, numberRowsExtra_ - numberColumns_ + 1,
+      startColumnR_.array());
+    //extra one at end
+    startColumnU_.array()[maximumColumnsExtra_] = other.startColumnUArray_[maximumColumnsExtra_];
+    nextColumn_.array()[maximumColumnsExtra_] = other.nextColumnArray_[maximumColumnsExtra_];
+    lastColumn_.array()[maximumColumnsExtra_] = other.lastColumnArray_[maximumColumnsExtra_];
+    CoinMemcpyN(other.nextRowArray_, numberRowsExtra_ + 1, nextRow_.array());
+    CoinMemcpyN(other.lastRowArray_, numberRowsExtra_ + 1, lastRow_.array());
+    nextRow_.array()[maximumRowsExtra_] = other.nextRowArray_[maximumRowsExtra_];
+    lastRow_.array()[maximumRowsExtra_] = other.lastRowArray_[maximumRowsExtra_];
+  }
+  CoinMemcpyN(other.elementR_, lengthR_, elementL_.array());
+  CoinMemcpyN(other.indexRowR_, lengthR_, indexRowL_.array());
+  CoinMemcpyN(other.elementUArray_, maximumU_, elementU_.array());
+  const int *startColumnU = startColumnU_.array();
+  const int *numberInColumn = numberInColumn_.array();
+  int *COIN_RESTRICT indexRowU = indexRowU_.array();
+  for (int iRow = 0; iRow < numberRowsExtra_; iRow++) {
+    int start = startColumnU[iRow];
+    CoinMemcpyN(other.indexRowUArray_ + start, numberInColumn[iRow], indexRowU + start);
+  }
+  if (convertUOther) {
+    int *COIN_RESTRICT convertU = convertRowToColumnU_.array();
+    int *COIN_RESTRICT indexColumnU = indexColumnU_.array();
+    const int *startRowU = startRowU_.array();
+    const int *numberInRow = numberInRow_.array();
+    for (int iRow = 0; iRow < numberRowsExtra_; iRow++) {
+      int start = startRowU[iRow];
+      int numberIn = numberInRow[iRow];
+      CoinMemcpyN(other.indexColumnUArray_ + start, numberIn, indexColumnU + start);
+      CoinMemcpyN(convertUOther + start, numberIn, convertU + start);
+    }
+  }
+  pivotColumnArray_ = pivotColumn_.array();
+  permuteArray_ = permute_.array();
+  permuteBackArray_ = permuteBack_.array();
+  pivotColumnBackArray_ = pivotColumnBack_.array();
+  startRowUArray_ = startRowU_.array();
+  numberInRowArray_ = numberInRow_.array();
+  numberInColumnArray_ = numberInColumn_.array();
+  numberInColumnPlusArray_ = NULL;
+  nextColumnArray_ = nextColumn_.array();
+  lastColumnArray_ = lastColumn_.array();
+  nextRowArray_ = nextRow_.array();
+  lastRowArray_ = lastRow_.array();
+  indexColumnUArray_ = indexColumnU_.array();
+  pivotRegionArray_ = pivotRegion_.array();
+  elementUArray_ = elementU_.array();
+  indexRowUArray_ = indexRowU_.array();
+  startColumnUArray_ = startColumnU_.array();
+  convertRowToColumnUArray_ = convertRowToColumnU_.array();
+  startColumnRArray_ = startColumnR_.array();
+  lengthAreaR_ = space;
+  elementR_ = elementL_.array();
+  indexRowR_ = indexRowL_.array();
+}
+namespace {
+// Version of saved factors - change if layout changes
+const int savedFactorsVersion = 1;
+// Sections in saved factors
+enum {
+  savedIntegers = 1,
+  savedDoubles,
+  savedElementU,
+  savedIndexRowU,
+  savedIndexColumnU,
+  savedConvertRowToColumnU,
+  savedStartRowU,
+  savedNumberInRow,
+  savedPivotRegion,
+  savedPermuteBack,
+  savedPermute,
+  savedPivotColumnBack,
+  savedFirstCount,
+  savedStartColumnU,
+  savedNumberInColumn,
+  savedPivotColumn,
+  savedNextColumn,
+  savedLastColumn,
+  savedNextRow,
+  savedLastRow,
+  savedStartColumnR,
+  savedStartColumnL,
+  savedElementL,
+  savedIndexRowL,
+  savedDenseArea,
+  savedDensePermute
+};
+// Number of integers and doubles saved
+const int numberSavedIntegers = 43;
+const int numberSavedDoubles = 11;
+}
+/* Saves factors (after factorize and any updates) in binary form.
+   Layout follows gutsOfCopy */
+int CoinFactorization::saveFactors(const char *fileName) const
+{
+  if (status_ || numberBatchThreads_ > 0)
+    return -1;
+  const int *convertRowToColumnU = convertRowToColumnU_.array();
+  const int *startRowU = startRowU_.array();
+  const int *numberInRow = numberInRow_.array();
+  // extent of row copy of U
+  int lengthRowU = 0;
+  if (convertRowToColumnU) {
+    for (int iRow = 0; iRow < numberRowsExtra_; iRow++)
+      lengthRowU = std::max(lengthRowU, startRowU[iRow] + numberInRow[iRow]);
+  }
+  bool haveExtra = numberRowsExtra_ != 0;
+  int integers[numberSavedIntegers] = {
+    numberTrials_, biggerDimension_, numberSlacks_, numberU_, maximumU_,
+    lengthU_, lengthAreaU_, numberL_, baseL_, lengthL_, lengthAreaL_,
+    numberR_, lengthR_, lengthAreaR_, numberRows_, numberRowsExtra_,
+    maximumRowsExtra_, numberColumns_, numberColumnsExtra_,
+    maximumColumnsExtra_, maximumPivots_, numberGoodU_, numberGoodL_,
+    numberPivots_, messageLevel_, totalElements_, factorElements_, status_,
+    doForrestTomlin_ ? 1 : 0, biasLU_, sparseThreshold_, sparseThreshold2_,
+    numberDense_, denseThreshold_,
+    numberInColumnPlus_.array() ? 1 : 0, convertRowToColumnU ? 1 : 0,
+    lengthRowU,
+    // extra one at end
+    (haveExtra && convertRowToColumnU) ? startRowU[maximumRowsExtra_] : 0,
+    haveExtra ? startColumnU_.array()[maximumColumnsExtra_] : 0,
+    haveExtra ? nextColumn_.array()[maximumColumnsExtra_] : 0,
+    haveExtra ? lastColumn_.array()[maximumColumnsExtra_] : 0,
+    haveExtra ? nextRow_.array()[maximumRowsExtra_] : 0,
+    haveExtra ? lastRow_.array()[maximumRowsExtra_] : 0
+  };
+  double doubles[numberSavedDoubles] = {
+    relaxCheck_, pivotTolerance_, zeroTolerance_, slackValue_, areaFactor_,
+    ftranAverageAfterL_, ftranAverageAfterR_, ftranAverageAfterU_,
+    btranAverageAfterU_, btranAverageAfterR_, btranAverageAfterL_
+  };
+  int numberExtra = haveExtra ? numberRowsExtra_ + 1 : 0;
+  CoinArrayFileWriter file(CoinArrayFileFactorization, savedFactorsVersion);
+  file.addArray(savedIntegers, integers, numberSavedIntegers);
+  file.addArray(savedDoubles, doubles, numberSavedDoubles);
+  file.addArray(savedElementU, elementU_.array(), maximumU_);
+  file.addArray(savedIndexRowU, indexRowU_.array(), maximumU_);
+  if (convertRowToColumnU) {
+    file.addArray(savedIndexColumnU, indexColumnU_.array(), lengthRowU);
+    file.addArray(savedConvertRowToColumnU, convertRowToColumnU, lengthRowU);
+    file.addArray(savedStartRowU, startRowU, numberExtra);
+    file.addArray(savedNumberInRow, numberInRow, numberExtra);
+  }
+  file.addArray(savedPivotRegion, pivotRegion_.array(),
+    haveExtra ? numberRowsExtra_ : 0);
+  file.addArray(savedPermuteBack, permuteBack_.array(), numberExtra);
+  file.addArray(savedPermute, permute_.array(), numberExtra);
+  file.addArray(savedPivotColumnBack, pivotColumnBack_.array(), numberExtra);
+  file.addArray(savedFirstCount, firstCount_.array(), numberExtra);
+  file.addArray(savedStartColumnU, startColumnU_.array(), numberExtra);
+  file.addArray(savedNumberInColumn, numberInColumn_.array(), numberExtra);
+  file.addArray(savedPivotColumn, pivotColumn_.array(), numberExtra);
+  file.addArray(savedNextColumn, nextColumn_.array(), numberExtra);
+  file.addArray(savedLastColumn, lastColumn_.array(), numberExtra);
+  file.addArray(savedNextRow, nextRow_.array(), numberExtra);
+  file.addArray(savedLastRow, lastRow_.array(), numberExtra);
+  file.addArray(savedStartColumnR, startColumnR_.array(),
+    haveExtra ? numberRowsExtra_ - numberColumns_ + 1 : 0);
+  file.addArray(savedStartColumnL, startColumnL_.array(),
+    numberRows_ ? numberRows_ + 1 : 0);
+  // R is after L
+  file.addArray(savedElementL, elementL_.array(), lengthL_ + lengthR_);
+  file.addArray(savedIndexRowL, indexRowL_.array(), lengthL_ + lengthR_);
+  if (numberDense_) {
+    file.addArray(savedDenseArea, denseAreaAddress_, numberDense_ * numberDense_);
+    file.addArray(savedDensePermute, densePermute_, numberDense_);
+  }
+  return file.write(fileName);
+}
+/* Restores factors saved by saveFactors.
+   Sizes are as in gutsOfCopy */
+int CoinFactorization::restoreFactors(const char *fileName)
+{
+  if (numberBatchThreads_)
+    return -1;
+  CoinArrayFileReader file;
+  int returnCode = file.open(fileName);
+  if (returnCode)
+    return returnCode;
+  if (file.kind() != CoinArrayFileFactorization
+    || file.kindVersion() != savedFactorsVersion)
+    return 2;
+  CoinBigIndex n;
+  const int *integers = file.array< int >(savedIntegers, n);
+  if (!integers || n != numberSavedIntegers)
+    return 2;
+  const double *doubles = file.array< double >(savedDoubles, n);
+  if (!doubles || n != numberSavedDoubles)
+    return 2;
+  int persistenceFlag = persistenceFlag_;
+  gutsOfDestructor(2);
+  gutsOfInitialize(3);
+  persistenceFlag_ = persistenceFlag;
+  const int *next = integers;
+  numberTrials_ = *next++;
+  biggerDimension_ = *next++;
+  numberSlacks_ = *next++;
+  numberU_ = *next++;
+  maximumU_ = *next++;
+  lengthU_ = *next++;
+  lengthAreaU_ = *next++;
+  numberL_ = *next++;
+  baseL_ = *next++;
+  lengthL_ = *next++;
+  lengthAreaL_ = *next++;
+  numberR_ = *next++;
+  lengthR_ = *next++;
+  lengthAreaR_ = *next++;
+  numberRows_ = *next++;
+  numberRowsExtra_ = *next++;
+  maximumRowsExtra_ = *next++;
+  numberColumns_ = *next++;
+  numberColumnsExtra_ = *next++;
+  maximumColumnsExtra_ = *next++;
+  maximumPivots_ = *next++;
+  numberGoodU_ = *next++;
+  numberGoodL_ = *next++;
+  numberPivots_ = *next++;
+  messageLevel_ = *next++;
+  totalElements_ = *next++;
+  factorElements_ = *next++;
+  status_ = *next++;
+  doForrestTomlin_ = *next++ != 0;
+  biasLU_ = *next++;
+  sparseThreshold_ = *next++;
+  sparseThreshold2_ = *next++;
+  numberDense_ = *next++;
+  denseThreshold_ = *next++;
+  bool havePlus = *next++ != 0;
+  bool haveRowCopy = *next++ != 0;
+  int lengthRowU = *next++;
+  relaxCheck_ = doubles[0];
+  pivotTolerance_ = doubles[1];
+  zeroTolerance_ = doubles[2];
+#ifndef COIN_FAST_CODE
+  slackValue_ = doubles[3];
+#endif
+  areaFactor_ = doubles[4];
+  ftranAverageAfterL_ = doubles[5];
+  ftranAverageAfterR_ = doubles[6];
+  ftranAverageAfterU_ = doubles[7];
+  btranAverageAfterU_ = doubles[8];
+  btranAverageAfterR_ = doubles[9];
+  btranAverageAfterL_ = doubles[10];
+  bool good = numberRowsExtra_ >= 0 && numberRowsExtra_ <= maximumRowsExtra_
+    && numberRowsExtra_ <= maximumColumnsExtra_ && numberRows_ >= 0
+    && numberColumns_ >= 0 && numberColumns_ <= numberRowsExtra_
+    // R starts must fit in startColumnR_
+    && numberRowsExtra_ - numberColumns_ <= maximumPivots_ && maximumU_ >= 0
+    && maximumU_ <= lengthAreaU_ + EXTRA_U_SPACE && lengthRowU >= 0
+    && lengthRowU <= lengthAreaU_ + EXTRA_U_SPACE && lengthL_ >= 0
+    && lengthR_ >= 0 && lengthL_ + lengthR_ <= lengthAreaL_
+    && numberDense_ >= 0 && numberDense_ <= numberRows_;
+  if (good) {
+    // allocate as gutsOfCopy
+    int lengthU = lengthAreaU_ + EXTRA_U_SPACE;
+    elementU_.conditionalNew(lengthU);
+    indexRowU_.conditionalNew(lengthU);
+    elementL_.conditionalNew(lengthAreaL_);
+    indexRowL_.conditionalNew(lengthAreaL_);
+    startColumnL_.conditionalNew(numberRows_ + 1);
+    int extraSpace;
+    if (havePlus) {
+      extraSpace = maximumPivots_ + 1 + maximumColumnsExtra_ + 1;
+    } else {
+      extraSpace = maximumPivots_ + 1;
+    }
+    startColumnR_.conditionalNew(extraSpace);
+    pivotRegion_.conditionalNew(maximumRowsExtra_ + 1);
+    permuteBack_.conditionalNew(maximumRowsExtra_ + 1);
+    permute_.conditionalNew(maximumRowsExtra_ + 1);
+    pivotColumnBack_.conditionalNew(maximumRowsExtra_ + 1);
+    firstCount_.conditionalNew(maximumRowsExtra_ + 1);
+    startColumnU_.conditionalNew(maximumColumnsExtra_ + 1);
+    numberInColumn_.conditionalNew(maximumColumnsExtra_ + 1);
+    pivotColumn_.conditionalNew(maximumColumnsExtra_ + 1);
+    nextColumn_.conditionalNew(maximumColumnsExtra_ + 1);
+    lastColumn_.conditionalNew(maximumColumnsExtra_ + 1);
+    indexColumnU_.conditionalNew(lengthU);
+    nextRow_.conditionalNew(maximumRowsExtra_ + 1);
+    lastRow_.conditionalNew(maximumRowsExtra_ + 1);
+#if COIN_ONE_ETA_COPY
+    if (haveRowCopy) {
+#endif
+      convertRowToColumnU_.conditionalNew(lengthU);
+      startRowU_.conditionalNew(maximumRowsExtra_ + 1);
+      numberInRow_.conditionalNew(maximumRowsExtra_ + 1);
+#if COIN_ONE_ETA_COPY
+    }
+#endif
+    int numberExtra = numberRowsExtra_ ? numberRowsExtra_ + 1 : 0;
+    good = file.copyArray(savedElementU, elementU_.array(), maximumU_)
+      && file.copyArray(savedIndexRowU, indexRowU_.array(), maximumU_)
+      && file.copyArray(savedPivotRegion, pivotRegion_.array(), numberRowsExtra_)
+      && file.copyArray(savedPermuteBack, permuteBack_.array(), numberExtra)
+      && file.copyArray(savedPermute, permute_.array(), numberExtra)
+      && file.copyArray(savedPivotColumnBack, pivotColumnBack_.array(), numberExtra)
+      && file.copyArray(savedFirstCount, firstCount_.array(), numberExtra)
+      && file.copyArray(savedStartColumnU, startColumnU_.array(), numberExtra)
+      && file.copyArray(savedNumberInColumn, numberInColumn_.array(), numberExtra)
+      && file.copyArray(savedPivotColumn, pivotColumn_.array(), numberExtra)
+      && file.copyArray(savedNextColumn, nextColumn_.array(), numberExtra)
+      && file.copyArray(savedLastColumn, lastColumn_.array(), numberExtra)
+      && file.copyArray(savedNextRow, nextRow_.array(), numberExtra)
+      && file.copyArray(savedLastRow, lastRow_.array(), numberExtra)
+      && file.copyArray(savedStartColumnR, startColumnR_.array(),
+        numberRowsExtra_ ? numberRowsExtra_ - numberColumns_ + 1 : 0)
+      && file.copyArray(savedStartColumnL, startColumnL_.array(),
+        numberRows_ ? numberRows_ + 1 : 0)
+      && file.copyArray(savedElementL, elementL_.array(), lengthL_ + lengthR_)
+      && file.copyArray(savedIndexRowL, indexRowL_.array(), lengthL_ + lengthR_);
+    if (good && haveRowCopy) {
+      good = file.copyArray(savedIndexColumnU, indexColumnU_.array(), lengthRowU)
+        && file.copyArray(savedConvertRowToColumnU, convertRowToColumnU_.array(), lengthRowU)
+        && file.copyArray(savedStartRowU, startRowU_.array(), numberExtra)
+        && file.copyArray(savedNumberInRow, numberInRow_.array(), numberExtra);
+    }
+    if (good && numberDense_) {
+      denseArea_ = new double[numberDense_ * numberDense_];
+      denseAreaAddress_ = denseArea_;
+      densePermute_ = new int[numberDense_];
+      good = file.copyArray(savedDenseArea, denseAreaAddress_, numberDense_ * numberDense_)
+        && file.copyArray(savedDensePermute, densePermute_, numberDense_);
+    }
+  }
+  if (!good) {
+    gutsOfDestructor(2);
+    gutsOfInitialize(3);
+    persistenceFlag_ = persistenceFlag;
+    return 2;
+  }
+  if (numberRowsExtra_) {
+    //extra one at end
+    if (haveRowCopy)
+      startRowU_.array()[maximumRowsExtra_] = next[0];
+    startColumnU_.array()[maximumColumnsExtra_] = next[1];
+    nextColumn_.array()[maximumColumnsExtra_] = next[2];
+    lastColumn_.array()[maximumColumnsExtra_] = next[3];
+    nextRow_.array()[maximumRowsExtra_] = next[4];
+    lastRow_.array()[maximumRowsExtra_] = next[5];
+  }
+  lengthAreaR_ = lengthAreaL_ - lengthL_;
+  elementR_ = elementL_.array() + lengthL_;
+  indexRowR_ = indexRowL_.array() + lengthL_;
+  setupPointers();
+  if (sparseThreshold_) {
+    goSparse();
+  }
+  return 0;
+}
 // See if worth going sparse
 void CoinFactorization::checkSparse()
 {
@@ -0,0 +1,438 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#include "CoinUtilsConfig.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CoinFactorizationEngine.hpp"
+#include "CoinDenseFactorization.hpp"
+#ifdef COINUTILS_BIGINDEX_IS_INT
+#include "CoinOslFactorization.hpp"
+#include "CoinSimpFactorization.hpp"
+#endif
+#include "CoinPackedMatrix.hpp"
+
+//#############################################################################
+// Registry
+//#############################################################################
+
+namespace {
+CoinFactorizationEngine *createCoin()
+{
+  return new CoinFactorizationEngineCoin();
+}
+CoinFactorizationEngine *createDense()
+{
+  return new CoinFactorizationEngineOther("dense", new CoinDenseFactorization());
+}
+#ifdef COINUTILS_BIGINDEX_IS_INT
+CoinFactorizationEngine *createSimp()
+{
+  return new CoinFactorizationEngineOther("simp", new CoinSimpFactorization());
+}
+CoinFactorizationEngine *createOsl()
+{
+  return new CoinFactorizationEngineOther("osl", new CoinOslFactorization());
+}
+#endif
+
+typedef struct {
+  std::string name;
+  CoinFactorizationEngineCreator creator;
+} EngineEntry;
+
+// Registry with built in engines
+std::vector< EngineEntry > &registry()
+{
+  static std::vector< EngineEntry > engines;
+  if (engines.empty()) {
+    EngineEntry entry;
+    entry.name = "coin";
+    entry.creator = createCoin;
+    engines.push_back(entry);
+    entry.name = "dense";
+    entry.creator = createDense;
+    engines.push_back(entry);
+#ifdef COINUTILS_BIGINDEX_IS_INT
+    entry.name = "simp";
+    entry.creator = createSimp;
+    engines.push_back(entry);
+    entry.name = "osl";
+    entry.creator = createOsl;
+    engines.push_back(entry);
+#endif
+  }
+  return engines;
+}
+}
+
+CoinFactorizationEngine::CoinFactorizationEngine()
+  : numberFactorizations_(0)
+  , numberUpdates_(0)
+{
+}
+
+CoinFactorizationEngine::~CoinFactorizationEngine()
+{
+}
+
+// Creates engine with given name
+CoinFactorizationEngine *CoinFactorizationEngine::create(const char *name)
+{
+  std::vector< EngineEntry > &engines = registry();
+  for (size_t i = 0; i < engines.size(); i++) {
+    if (engines[i].name == name)
+      return engines[i].creator();
+  }
+  return NULL;
+}
+
+// Number of engines in registry
+int CoinFactorizationEngine::numberEngines()
+{
+  return static_cast< int >(registry().size());
+}
+
+// Name of engine in registry
+const char *CoinFactorizationEngine::engineName(int which)
+{
+  std::vector< EngineEntry > &engines = registry();
+  if (which < 0 || which >= static_cast< int >(engines.size()))
+    return NULL;
+  return engines[which].name.c_str();
+}
+
+// Adds engine to registry
+void CoinFactorizationEngine::addEngine(const char *name,
+  CoinFactorizationEngineCreator creator)
+{
+  std::vector< EngineEntry > &engines = registry();
+  for (size_t i = 0; i < engines.size(); i++) {
+    if (engines[i].name == name) {
+      engines[i].creator = creator;
+      return;
+    }
+  }
+  EngineEntry entry;
+  entry.name = name;
+  entry.creator = creator;
+  engines.push_back(entry);
+}
+
+//#############################################################################
+// CoinFactorization
+//#############################################################################
+
+CoinFactorizationEngineCoin::CoinFactorizationEngineCoin()
+  : CoinFactorizationEngine()
+{
+}
+
+CoinFactorizationEngineCoin::~CoinFactorizationEngineCoin()
+{
+}
+
+CoinFactorizationEngine *CoinFactorizationEngineCoin::clone() const
+{
+  return new CoinFactorizationEngineCoin(*this);
+}
+
+int CoinFactorizationEngineCoin::factorize(const CoinPackedMatrix &matrix,
+  int rowIsBasic[], int columnIsBasic[])
+{
+  numberFactorizations_++;
+  return factorization_.factorize(matrix, rowIsBasic, columnIsBasic);
+}
+
+int CoinFactorizationEngineCoin::replaceColumn(CoinIndexedVector *regionSparse,
+  CoinIndexedVector * /*tableauColumn*/, int pivotRow, double pivotCheck,
+  bool checkBeforeModifying, double acceptablePivot)
+{
+  // updated column was saved by updateColumnFT
+  int returnCode = factorization_.replaceColumn(regionSparse, pivotRow,
+    pivotCheck, checkBeforeModifying, acceptablePivot);
+  if (returnCode < 2)
+    numberUpdates_++;
+  return returnCode;
+}
+
+int CoinFactorizationEngineCoin::updateColumnFT(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2)
+{
+  return factorization_.updateColumnFT(regionSparse, regionSparse2);
+}
+
+int CoinFactorizationEngineCoin::updateColumn(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2) const
+{
+  return factorization_.updateColumn(regionSparse, regionSparse2);
+}
+
+int CoinFactorizationEngineCoin::updateColumnTranspose(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2) const
+{
+  return factorization_.updateColumnTranspose(regionSparse, regionSparse2);
+}
+
+const char *CoinFactorizationEngineCoin::name() const
+{
+  return "coin";
+}
+
+int CoinFactorizationEngineCoin::status() const
+{
+  return factorization_.status();
+}
+
+int CoinFactorizationEngineCoin::numberRows() const
+{
+  return factorization_.numberRows();
+}
+
+int CoinFactorizationEngineCoin::numberElements() const
+{
+  return factorization_.numberElementsL() + factorization_.numberElementsU()
+    + factorization_.numberElementsR();
+}
+
+int CoinFactorizationEngineCoin::pivots() const
+{
+  return factorization_.pivots();
+}
+
+int CoinFactorizationEngineCoin::maximumPivots() const
+{
+  return factorization_.maximumPivots();
+}
+
+void CoinFactorizationEngineCoin::maximumPivots(int value)
+{
+  factorization_.maximumPivots(value);
+}
+
+//#############################################################################
+// CoinOtherFactorization
+//#############################################################################
+
+CoinFactorizationEngineOther::CoinFactorizationEngineOther(const char *name,
+  CoinOtherFactorization *factorization)
+  : CoinFactorizationEngine()
+  , name_(name)
+  , factorization_(factorization)
+{
+}
+
+CoinFactorizationEngineOther::CoinFactorizationEngineOther(const CoinFactorizationEngineOther &rhs)
+  : CoinFactorizationEngine(rhs)
+  , name_(rhs.name_)
+  , factorization_(rhs.factorization_->clone())
+{
+}
+
+CoinFactorizationEngineOther::~CoinFactorizationEngineOther()
+{
+  delete factorization_;
+}
+
+CoinFactorizationEngine *CoinFactorizationEngineOther::clone() const
+{
+  return new CoinFactorizationEngineOther(*this);
+}
+
+/* Puts basis in factorization areas (slacks first) and factorizes.
+   This is as CoinOslFactorization::factorize but only uses
+   CoinOtherFactorization methods. */
+int CoinFactorizationEngineOther::factorize(const CoinPackedMatrix &matrix,
+  int rowIsBasic[], int columnIsBasic[])
+{
+  numberFactorizations_++;
+  int numberRows = matrix.getNumRows();
+  int numberColumns = matrix.getNumCols();
+  const int *row = matrix.getIndices();
+  const CoinBigIndex *columnStart = matrix.getVectorStarts();
+  const int *columnLength = matrix.getVectorLengths();
+  const double *element = matrix.getElements();
+  // sequence of each basic variable (slacks are numberColumns+row)
+  std::vector< int > sequence;
+  sequence.reserve(numberRows);
+  CoinBigIndex numberElements = 0;
+  for (int i = 0; i < numberRows; i++) {
+    if (rowIsBasic[i] >= 0)
+      sequence.push_back(i + numberColumns);
+  }
+  int numberRowBasic = static_cast< int >(sequence.size());
+  for (int i = 0; i < numberColumns; i++) {
+    if (columnIsBasic[i] >= 0) {
+      sequence.push_back(i);
+      numberElements += columnLength[i];
+    }
+  }
+  if (static_cast< int >(sequence.size()) > numberRows) {
+    factorization_->setStatus(-2);
+    return -2; // too many in basis
+  }
+  int numberBasic = static_cast< int >(sequence.size());
+  numberElements = 3 * numberRows + 3 * numberElements + 20000;
+  factorization_->setUsefulInformation(&numberRows, 0);
+  factorization_->getAreas(numberRows, numberRows, numberElements,
+    2 * numberElements);
+  double *elementU = factorization_->elements();
+  int *indexRowU = factorization_->indices();
+  int *startColumnU = factorization_->starts();
+  int *numberInRow = factorization_->numberInRow();
+  int *numberInColumn = factorization_->numberInColumn();
+  CoinZeroN(numberInRow, numberRows);
+  CoinZeroN(numberInColumn, numberRows);
+  for (int i = 0; i < numberRowBasic; i++) {
+    int iRow = sequence[i] - numberColumns;
+    indexRowU[i] = iRow;
+    startColumnU[i] = i;
+    elementU[i] = -1.0;
+    numberInRow[iRow] = 1;
+    numberInColumn[i] = 1;
+  }
+  startColumnU[numberRowBasic] = numberRowBasic;
+  numberElements = numberRowBasic;
+  for (int i = numberRowBasic; i < numberBasic; i++) {
+    int iColumn = sequence[i];
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      int iRow = row[j];
+      numberInRow[iRow]++;
+      indexRowU[numberElements] = iRow;
+      elementU[numberElements++] = element[j];
+    }
+    numberInColumn[i] = columnLength[iColumn];
+    startColumnU[i + 1] = static_cast< int >(numberElements);
+  }
+  for (int i = numberBasic; i < numberRows; i++)
+    startColumnU[i + 1] = static_cast< int >(numberElements);
+  factorization_->preProcess();
+  factorization_->factor();
+  int status = factorization_->status();
+  if (status == 0) {
+    std::vector< int > pivotVariable(numberRows);
+    factorization_->postProcess(&sequence[0], &pivotVariable[0]);
+    for (int i = 0; i < numberRows; i++) {
+      int iPivot = pivotVariable[i];
+      if (iPivot < numberColumns)
+        columnIsBasic[iPivot] = i;
+      else
+        rowIsBasic[iPivot - numberColumns] = i;
+    }
+  }
+  return status;
+}
+
+int CoinFactorizationEngineOther::replaceColumn(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *tableauColumn, int pivotRow, double pivotCheck,
+  bool checkBeforeModifying, double acceptablePivot)
+{
+  CoinIndexedVector *region = factorization_->wantsTableauColumn()
+    ? tableauColumn
+    : regionSparse;
+  int returnCode = factorization_->replaceColumn(region, pivotRow,
+    pivotCheck, checkBeforeModifying, acceptablePivot);
+  if (returnCode < 2)
+    numberUpdates_++;
+  return returnCode;
+}
+
+/* CoinOslFactorization needs a packed region for the FT update, so an
+   unpacked region is packed first and unpacked afterwards (using
+   regionSparse as work as it is zero on entry and exit) */
+int CoinFactorizationEngineOther::updateColumnFT(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2)
+{
+  if (regionSparse2->packedMode())
+    return factorization_->updateColumnFT(regionSparse, regionSparse2);
+  double *work = regionSparse->denseVector();
+  double *region2 = regionSparse2->denseVector();
+  int *regionIndex2 = regionSparse2->getIndices();
+  int numberNonZero = regionSparse2->getNumElements();
+  for (int j = 0; j < numberNonZero; j++) {
+    int iRow = regionIndex2[j];
+    work[j] = region2[iRow];
+    region2[iRow] = 0.0;
+  }
+  for (int j = 0; j < numberNonZero; j++) {
+    region2[j] = work[j];
+    work[j] = 0.0;
+  }
+  regionSparse2->setPackedMode(true);
+  int returnCode = factorization_->updateColumnFT(regionSparse, regionSparse2);
+  numberNonZero = regionSparse2->getNumElements();
+  for (int j = 0; j < numberNonZero; j++) {
+    work[j] = region2[j];
+    region2[j] = 0.0;
+  }
+  for (int j = 0; j < numberNonZero; j++) {
+    region2[regionIndex2[j]] = work[j];
+    work[j] = 0.0;
+  }
+  regionSparse2->setPackedMode(false);
+  return returnCode;
+}
+
+int CoinFactorizationEngineOther::updateColumn(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2) const
+{
+  return factorization_->updateColumn(regionSparse, regionSparse2);
+}
+
+int CoinFactorizationEngineOther::updateColumnTranspose(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2) const
+{
+  return factorization_->updateColumnTranspose(regionSparse, regionSparse2);
+}
+
+const char *CoinFactorizationEngineOther::name() const
+{
+  return name_;
+}
+
+int CoinFactorizationEngineOther::status() const
+{
+  return factorization_->status();
+}
+
+int CoinFactorizationEngineOther::numberRows() const
+{
+  return factorization_->numberRows();
+}
+
+/* numberElements of CoinOslFactorization and CoinSimpFactorization is
+   the dense size so ask them for elements actually held */
+int CoinFactorizationEngineOther::numberElements() const
+{
+#ifdef COINUTILS_BIGINDEX_IS_INT
+  const CoinOslFactorization *osl = dynamic_cast< const CoinOslFactorization * >(factorization_);
+  if (osl)
+    return osl->numberFactorElements();
+  const CoinSimpFactorization *simp = dynamic_cast< const CoinSimpFactorization * >(factorization_);
+  if (simp)
+    return simp->numberFactorElements();
+#endif
+  return factorization_->numberElements();
+}
+
+int CoinFactorizationEngineOther::pivots() const
+{
+  return factorization_->pivots();
+}
+
+int CoinFactorizationEngineOther::maximumPivots() const
+{
+  return factorization_->maximumPivots();
+}
+
+void CoinFactorizationEngineOther::maximumPivots(int value)
+{
+  factorization_->maximumPivots(value);
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,259 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifndef CoinFactorizationEngine_H
+#define CoinFactorizationEngine_H
+
+#include "CoinFactorization.hpp"
+
+class CoinOtherFactorization;
+class CoinFactorizationEngine;
+
+/// Function which creates an engine (see CoinFactorizationEngine::addEngine)
+typedef CoinFactorizationEngine *(*CoinFactorizationEngineCreator)();
+
+/** Abstract interface to factorizations.
+
+    CoinFactorization and the classes derived from CoinOtherFactorization
+    (Dense, Simp and Osl) do the same job but are driven differently.
+    An engine wraps one of them so a solver can pick a factorization at
+    run time by name.
+
+    Numbering is as for CoinFactorization.  After factorize basic
+    variables in rowIsBasic and columnIsBasic have their position in the
+    basis.  Updated columns from FTRAN are indexed by position, and the
+    region given to BTRAN is indexed by position.  Slacks have value -1.0.
+    Regions should have room for number of rows plus maximumPivots
+    plus one (updates may add rows and Osl looks one past end).
+
+    Engines are found by name in a registry.  The built in engines are
+    "coin" (CoinFactorization), "dense" (CoinDenseFactorization) and,
+    when CoinBigIndex is int, "simp" (CoinSimpFactorization) and "osl"
+    (CoinOslFactorization).  More can be added with addEngine.
+*/
+class COINUTILSLIB_EXPORT CoinFactorizationEngine {
+
+public:
+  /**@name Constructors and destructor and copy */
+  //@{
+  /// Default constructor
+  CoinFactorizationEngine();
+  /// Destructor
+  virtual ~CoinFactorizationEngine();
+  /// Clone
+  virtual CoinFactorizationEngine *clone() const = 0;
+  //@}
+
+  /**@name Factorization and updates */
+  //@{
+  /** Factorizes basis.  Arrays have non negative value to say basic.
+      If status is okay, basic variables have position in basis.
+      If singular "coin" marks variables thrown out with -1 (others
+      leave arrays alone).
+      Returns 0 okay, -1 singular, -2 too many in basis, -99 memory */
+  virtual int factorize(const CoinPackedMatrix &matrix,
+    int rowIsBasic[], int columnIsBasic[])
+    = 0;
+  /** Replaces one column in basis.
+      Must follow updateColumnFT on incoming column.  regionSparse is
+      work region passed to updateColumnFT and tableauColumn is updated
+      column (engines use whichever they need).
+      Returns 0=OK, 1=Probably OK, 2=singular, 3=no room,
+      5=too many updates */
+  virtual int replaceColumn(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *tableauColumn, int pivotRow, double pivotCheck,
+    bool checkBeforeModifying = false, double acceptablePivot = 1.0e-8)
+    = 0;
+  /** Updates one column (FTRAN) from regionSparse2 saving what is
+      needed for replaceColumn.  regionSparse starts as zero and is zero
+      at end.  Number returned is negative if no room */
+  virtual int updateColumnFT(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2)
+    = 0;
+  /// Updates one column (FTRAN) from regionSparse2
+  virtual int updateColumn(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2) const = 0;
+  /// Updates one column (BTRAN) from regionSparse2
+  virtual int updateColumnTranspose(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2) const = 0;
+  //@}
+
+  /**@name Statistics */
+  //@{
+  /// Name of engine
+  virtual const char *name() const = 0;
+  /// Status of last factorize (0 okay)
+  virtual int status() const = 0;
+  /// Number of rows in last factorize
+  virtual int numberRows() const = 0;
+  /// Number of elements in factors (including updates)
+  virtual int numberElements() const = 0;
+  /// Number of updates since factorize
+  virtual int pivots() const = 0;
+  /// Maximum number of updates before refactorization needed
+  virtual int maximumPivots() const = 0;
+  /// Sets maximum number of updates
+  virtual void maximumPivots(int value) = 0;
+  /// Number of factorizations done by this engine
+  inline int numberFactorizations() const
+  {
+    return numberFactorizations_;
+  }
+  /// Number of successful replaceColumns done by this engine
+  inline int numberUpdates() const
+  {
+    return numberUpdates_;
+  }
+  //@}
+
+  /**@name Registry */
+  //@{
+  /// Creates engine with given name (NULL if no such engine)
+  static CoinFactorizationEngine *create(const char *name);
+  /// Number of engines in registry
+  static int numberEngines();
+  /// Name of engine in registry
+  static const char *engineName(int which);
+  /** Adds engine to registry (replacing any with same name).
+      Not thread safe so should be done before engines are created */
+  static void addEngine(const char *name, CoinFactorizationEngineCreator creator);
+  //@}
+
+protected:
+  /**@name Counts kept by derived classes */
+  //@{
+  /// Number of factorizations
+  int numberFactorizations_;
+  /// Number of successful replaceColumns
+  int numberUpdates_;
+  //@}
+};
+
+/// Engine using CoinFactorization
+class COINUTILSLIB_EXPORT CoinFactorizationEngineCoin : public CoinFactorizationEngine {
+
+public:
+  /**@name Constructors and destructor and copy */
+  //@{
+  /// Default constructor
+  CoinFactorizationEngineCoin();
+  /// Destructor
+  virtual ~CoinFactorizationEngineCoin();
+  /// Clone
+  virtual CoinFactorizationEngine *clone() const;
+  //@}
+
+  /**@name Factorization and updates (see CoinFactorizationEngine) */
+  //@{
+  virtual int factorize(const CoinPackedMatrix &matrix,
+    int rowIsBasic[], int columnIsBasic[]);
+  virtual int replaceColumn(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *tableauColumn, int pivotRow, double pivotCheck,
+    bool checkBeforeModifying = false, double acceptablePivot = 1.0e-8);
+  virtual int updateColumnFT(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2);
+  virtual int updateColumn(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2) const;
+  virtual int updateColumnTranspose(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2) const;
+  //@}
+
+  /**@name Statistics (see CoinFactorizationEngine) */
+  //@{
+  virtual const char *name() const;
+  virtual int status() const;
+  virtual int numberRows() const;
+  virtual int numberElements() const;
+  virtual int pivots() const;
+  virtual int maximumPivots() const;
+  virtual void maximumPivots(int value);
+  //@}
+
+  /**@name Factorization used */
+  //@{
+  /// Factorization (e.g. to set thresholds or threads)
+  inline CoinFactorization &factorization()
+  {
+    return factorization_;
+  }
+  inline const CoinFactorization &factorization() const
+  {
+    return factorization_;
+  }
+  //@}
+
+private:
+  /// Factorization
+  CoinFactorization factorization_;
+};
+
+/// Engine using a class derived from CoinOtherFactorization
+class COINUTILSLIB_EXPORT CoinFactorizationEngineOther : public CoinFactorizationEngine {
+
+public:
+  /**@name Constructors and destructor and copy */
+  //@{
+  /// Constructor - takes ownership of factorization
+  CoinFactorizationEngineOther(const char *name,
+    CoinOtherFactorization *factorization);
+  /// Copy constructor
+  CoinFactorizationEngineOther(const CoinFactorizationEngineOther &rhs);
+  /// Destructor
+  virtual ~CoinFactorizationEngineOther();
+  /// Clone
+  virtual CoinFactorizationEngine *clone() const;
+  //@}
+
+  /**@name Factorization and updates (see CoinFactorizationEngine) */
+  //@{
+  virtual int factorize(const CoinPackedMatrix &matrix,
+    int rowIsBasic[], int columnIsBasic[]);
+  virtual int replaceColumn(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *tableauColumn, int pivotRow, double pivotCheck,
+    bool checkBeforeModifying = false, double acceptablePivot = 1.0e-8);
+  virtual int updateColumnFT(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2);
+  virtual int updateColumn(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2) const;
+  virtual int updateColumnTranspose(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2) const;
+  //@}
+
+  /**@name Statistics (see CoinFactorizationEngine) */
+  //@{
+  virtual const char *name() const;
+  virtual int status() const;
+  virtual int numberRows() const;
+  virtual int numberElements() const;
+  virtual int pivots() const;
+  virtual int maximumPivots() const;
+  virtual void maximumPivots(int value);
+  //@}
+
+  /**@name Factorization used */
+  //@{
+  /// Factorization (e.g. to set tolerances)
+  inline CoinOtherFactorization *factorization()
+  {
+    return factorization_;
+  }
+  inline const CoinOtherFactorization *factorization() const
+  {
+    return factorization_;
+  }
+  //@}
+
+private:
+  /// Not allowed
+  CoinFactorizationEngineOther &operator=(const CoinFactorizationEngineOther &);
+
+  /// Name
+  const char *name_;
+  /// Factorization
+  CoinOtherFactorization *factorization_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,211 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#include "CoinUtilsConfig.h"
+
+#include <cstring>
+
+#include "CoinFactorizationStatistics.hpp"
+#include "CoinHelperFunctions.hpp"
+
+namespace {
+const char *phaseName[CoinFactorizationStatistics::numberPhases] = {
+  "factorize", "replaceColumn", "ftran", "ftranFT", "ftranTwo", "btran"
+};
+const char *partName[4] = { "ftranL", "ftranU", "btranU", "btranL" };
+const char *modeName[3] = { "densish", "sparsish", "reach" };
+}
+
+// Default constructor
+CoinFactorizationStatistics::CoinFactorizationStatistics(const char *name)
+  : name_(name ? name : "")
+  , timeSolves_(false)
+{
+  reset();
+}
+// Copy constructor
+CoinFactorizationStatistics::CoinFactorizationStatistics(const CoinFactorizationStatistics &other)
+  : timeSolves_(false)
+{
+  reset();
+  *this = other;
+}
+// = copy
+CoinFactorizationStatistics &
+CoinFactorizationStatistics::operator=(const CoinFactorizationStatistics &other)
+{
+  if (this != &other) {
+    name_ = other.name_;
+    timeSolves_ = other.timeSolves_;
+    reset();
+    add(other);
+    currentUpdateElements_ = other.currentUpdateElements_;
+  }
+  return *this;
+}
+// Destructor
+CoinFactorizationStatistics::~CoinFactorizationStatistics()
+{
+}
+// Zeroes everything but name and timeSolves
+void CoinFactorizationStatistics::reset()
+{
+  depth_ = 0;
+  CoinZeroN(numberCalls_, static_cast< int >(numberPhases));
+  CoinZeroN(time_, static_cast< int >(numberPhases));
+  CoinZeroN(&numberSolveMode_[0][0], 12);
+  CoinZeroN(numberReachAbandoned_, 4);
+  CoinZeroN(totalReach_, 4);
+  CoinZeroN(&timeSolveMode_[0][0], 12);
+  numberDenseFactorizations_ = 0.0;
+  totalDense_ = 0.0;
+  numberCompressions_ = 0.0;
+  totalFactorElements_ = 0.0;
+  currentUpdateElements_ = 0;
+  maximumUpdateElements_ = 0;
+  totalUpdateElements_ = 0.0;
+  numberUpdateCycles_ = 0.0;
+}
+// Adds in statistics of other
+void CoinFactorizationStatistics::add(const CoinFactorizationStatistics &other)
+{
+  for (int i = 0; i < numberPhases; i++) {
+    numberCalls_[i] += other.numberCalls_[i];
+    time_[i] += other.time_[i];
+  }
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 3; j++) {
+      numberSolveMode_[i][j] += other.numberSolveMode_[i][j];
+      timeSolveMode_[i][j] += other.timeSolveMode_[i][j];
+    }
+    numberReachAbandoned_[i] += other.numberReachAbandoned_[i];
+    totalReach_[i] += other.totalReach_[i];
+  }
+  numberDenseFactorizations_ += other.numberDenseFactorizations_;
+  totalDense_ += other.totalDense_;
+  numberCompressions_ += other.numberCompressions_;
+  totalFactorElements_ += other.totalFactorElements_;
+  maximumUpdateElements_ = CoinMax(maximumUpdateElements_,
+    other.maximumUpdateElements_);
+  totalUpdateElements_ += other.totalUpdateElements_;
+  numberUpdateCycles_ += other.numberUpdateCycles_;
+}
+// A factorization was done
+void CoinFactorizationStatistics::addFactorization(int numberDense,
+  int numberElements, int numberCompressions)
+{
+  if (numberDense) {
+    numberDenseFactorizations_++;
+    totalDense_ += numberDense;
+  }
+  numberCompressions_ += numberCompressions;
+  totalFactorElements_ += numberElements;
+  // end of update cycle (first factorization has none)
+  if (numberCalls_[factorizePhase] > 0.0) {
+    totalUpdateElements_ += currentUpdateElements_;
+    numberUpdateCycles_++;
+  }
+  currentUpdateElements_ = 0;
+}
+// Prints as a JSON object
+void CoinFactorizationStatistics::printJson(FILE *fp, bool oneLine) const
+{
+  // breaks before members and before members of phases and solveModes
+  const char *next = oneLine ? " " : "\n  ";
+  const char *nextInner = oneLine ? " " : "\n    ";
+  fprintf(fp, "{%s\"name\": \"", next);
+  // escape just what could break JSON
+  for (const char *c = name_.c_str(); *c; c++) {
+    if (*c == '"' || *c == '\\')
+      fputc('\\', fp);
+    if (static_cast< unsigned char >(*c) >= ' ')
+      fputc(*c, fp);
+  }
+  fprintf(fp, "\",%s\"phases\": {", next);
+  for (int i = 0; i < numberPhases; i++)
+    fprintf(fp, "%s\"%s\": {\"calls\": %.0f, \"seconds\": %.9g}%s",
+      nextInner, phaseName[i], numberCalls_[i], time_[i],
+      i < numberPhases - 1 ? "," : "");
+  fprintf(fp, "%s},%s\"solveModes\": {", next, next);
+  for (int i = 0; i < 4; i++) {
+    fprintf(fp, "%s\"%s\": {", nextInner, partName[i]);
+    for (int j = 0; j < 3; j++)
+      fprintf(fp, "\"%s\": %.0f, \"%sSeconds\": %.9g, ", modeName[j],
+        numberSolveMode_[i][j], modeName[j], timeSolveMode_[i][j]);
+    fprintf(fp, "\"reachAbandoned\": %.0f, \"totalReach\": %.0f}%s",
+      numberReachAbandoned_[i], totalReach_[i], i < 3 ? "," : "");
+  }
+  fprintf(fp, "%s},%s\"denseFactorizations\": %.0f,", next, next,
+    numberDenseFactorizations_);
+  fprintf(fp, "%s\"totalDense\": %.0f,", next, totalDense_);
+  fprintf(fp, "%s\"compressions\": %.0f,", next, numberCompressions_);
+  fprintf(fp, "%s\"factorElements\": %.0f,", next, totalFactorElements_);
+  fprintf(fp, "%s\"updateElements\": %d,", next, currentUpdateElements_);
+  fprintf(fp, "%s\"maximumUpdateElements\": %d,", next, maximumUpdateElements_);
+  fprintf(fp, "%s\"totalUpdateElements\": %.0f,", next, totalUpdateElements_);
+  fprintf(fp, "%s\"updateCycles\": %.0f%s}\n", next, numberUpdateCycles_,
+    oneLine ? " " : "\n");
+}
+// Prints as a line of comma separated values
+void CoinFactorizationStatistics::printCsv(FILE *fp, bool header) const
+{
+  if (header) {
+    fprintf(fp, "name");
+    for (int i = 0; i < numberPhases; i++)
+      fprintf(fp, ",%sCalls,%sSeconds", phaseName[i], phaseName[i]);
+    for (int i = 0; i < 4; i++) {
+      for (int j = 0; j < 3; j++)
+        fprintf(fp, ",%s%s,%s%sSeconds", partName[i], modeName[j],
+          partName[i], modeName[j]);
+      fprintf(fp, ",%sReachAbandoned,%sTotalReach", partName[i], partName[i]);
+    }
+    fprintf(fp, ",denseFactorizations,totalDense,compressions,factorElements"
+                ",updateElements,maximumUpdateElements,totalUpdateElements"
+                ",updateCycles\n");
+  }
+  // names with commas or quotes are quoted
+  if (strpbrk(name_.c_str(), ",\"\n")) {
+    fputc('"', fp);
+    for (const char *c = name_.c_str(); *c; c++) {
+      if (*c == '"')
+        fputc('"', fp);
+      fputc(*c, fp);
+    }
+    fputc('"', fp);
+  } else {
+    fprintf(fp, "%s", name_.c_str());
+  }
+  for (int i = 0; i < numberPhases; i++)
+    fprintf(fp, ",%.0f,%.9g", numberCalls_[i], time_[i]);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 3; j++)
+      fprintf(fp, ",%.0f,%.9g", numberSolveMode_[i][j], timeSolveMode_[i][j]);
+    fprintf(fp, ",%.0f,%.0f", numberReachAbandoned_[i], totalReach_[i]);
+  }
+  fprintf(fp, ",%.0f,%.0f,%.0f,%.0f,%d,%d,%.0f,%.0f\n",
+    numberDenseFactorizations_, totalDense_, numberCompressions_,
+    totalFactorElements_, currentUpdateElements_, maximumUpdateElements_,
+    totalUpdateElements_, numberUpdateCycles_);
+}
+// Writes JSON (one object per line) or CSV to file
+int CoinFactorizationStatistics::writeFile(const char *fileName, bool append) const
+{
+  FILE *fp = fopen(fileName, append ? "a" : "w");
+  if (!fp)
+    return 1;
+  size_t length = strlen(fileName);
+  if ((length > 5 && !strcmp(fileName + length - 5, ".json"))
+    || (length > 6 && !strcmp(fileName + length - 6, ".jsonl"))) {
+    // JSON Lines so appended objects can still be read
+    printJson(fp, true);
+  } else {
+    // header only if file is empty
+    fseek(fp, 0, SEEK_END);
+    printCsv(fp, ftell(fp) == 0);
+  }
+  fclose(fp);
+  return 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
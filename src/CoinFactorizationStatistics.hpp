@@ -0,0 +1,303 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifndef CoinFactorizationStatistics_H
+#define CoinFactorizationStatistics_H
+
+#include "CoinUtilsConfig.h"
+
+#include <cstdio>
+#include <string>
+
+#include "CoinTime.hpp"
+
+/** Timers and counters for a factorization.
+
+    An object of this class can be attached to a CoinFactorization or to
+    any CoinOtherFactorization with setStatistics().  While attached it
+    accumulates the number of calls and the wall clock time spent in
+    factorizing, replacing columns, FTRAN and BTRAN, which paths the
+    L and U parts of FTRAN and BTRAN took (CoinFactorization only), how
+    many factorizations had a dense part, how many compressions were
+    needed and how the update (R or eta) file grew between
+    factorizations.
+
+    Nothing is collected when no object is attached - the cost is then
+    a test of a null pointer per call.  The factorization does not own
+    the object and copies or clones of the factorization are not
+    attached to it.
+
+    It is not thread safe.  Calls done by the threads of
+    CoinFactorization::updateColumns are timed as one batch by the
+    calling thread and their solve paths are added in when the batch
+    ends.  Solves done by views are not collected.  For factorizations
+    in different threads use one object each and add() them together
+    afterwards.
+*/
+class COINUTILSLIB_EXPORT CoinFactorizationStatistics {
+
+public:
+  /// Timed phases
+  enum Phase {
+    factorizePhase = 0,
+    replaceColumnPhase,
+    ftranPhase,
+    ftranFTPhase,
+    ftranTwoPhase,
+    btranPhase,
+    numberPhases
+  };
+  /**@name Constructors and destructor */
+  //@{
+  /// Default constructor (name is used in output)
+  CoinFactorizationStatistics(const char *name = NULL);
+  /// Copy constructor
+  CoinFactorizationStatistics(const CoinFactorizationStatistics &other);
+  /// = copy
+  CoinFactorizationStatistics &operator=(const CoinFactorizationStatistics &other);
+  /// Destructor
+  ~CoinFactorizationStatistics();
+  //@}
+
+  /**@name Gets and sets */
+  //@{
+  /// Name used in output
+  inline const std::string &name() const
+  {
+    return name_;
+  }
+  /// Set name used in output
+  inline void setName(const char *name)
+  {
+    name_ = name ? name : "";
+  }
+  /// Number of calls of a phase
+  inline double numberCalls(int phase) const
+  {
+    return numberCalls_[phase];
+  }
+  /// Seconds spent in a phase
+  inline double time(int phase) const
+  {
+    return time_[phase];
+  }
+  /** Number of times L [0] and U [1] parts of FTRAN and U [2] and
+      L [3] parts of BTRAN were done densish [0], sparsish [1] and by
+      symbolic reach [2] */
+  inline double numberSolveMode(int part, int mode) const
+  {
+    return numberSolveMode_[part][mode];
+  }
+  /// Number of times symbolic reach was tried and was too big (parts as above)
+  inline double numberReachAbandoned(int part) const
+  {
+    return numberReachAbandoned_[part];
+  }
+  /// Total size of symbolic reaches used (parts as above)
+  inline double totalReach(int part) const
+  {
+    return totalReach_[part];
+  }
+  /// Seconds in each part and mode as numberSolveMode (only if timeSolves())
+  inline double timeSolveMode(int part, int mode) const
+  {
+    return timeSolveMode_[part][mode];
+  }
+  /// Whether L and U parts of FTRAN and BTRAN are timed
+  inline bool timeSolves() const
+  {
+    return timeSolves_;
+  }
+  /// Switch timing of L and U parts of FTRAN and BTRAN on or off
+  inline void setTimeSolves(bool yesNo)
+  {
+    timeSolves_ = yesNo;
+  }
+  /// Number of factorizations which had a dense part
+  inline double numberDenseFactorizations() const
+  {
+    return numberDenseFactorizations_;
+  }
+  /// Total size of dense parts
+  inline double totalDense() const
+  {
+    return totalDense_;
+  }
+  /// Total compressions done while factorizing
+  inline double numberCompressions() const
+  {
+    return numberCompressions_;
+  }
+  /// Total elements in factorizations just after factorizing
+  inline double totalFactorElements() const
+  {
+    return totalFactorElements_;
+  }
+  /// Elements in update file now
+  inline int currentUpdateElements() const
+  {
+    return currentUpdateElements_;
+  }
+  /// Largest number of elements in update file
+  inline int maximumUpdateElements() const
+  {
+    return maximumUpdateElements_;
+  }
+  /// Total elements in update file when refactorized
+  inline double totalUpdateElements() const
+  {
+    return totalUpdateElements_;
+  }
+  /// Number of update files ended by refactorizing
+  inline double numberUpdateCycles() const
+  {
+    return numberUpdateCycles_;
+  }
+  //@}
+
+  /**@name Collecting (called by factorizations) */
+  //@{
+  /** Start of a phase.  Returns start time or 0.0 if nested inside
+      another phase (so e.g. an updateColumn done inside replaceColumn
+      is not counted twice) */
+  inline double startPhase()
+  {
+    return depth_++ ? 0.0 : CoinGetTimeOfDay();
+  }
+  /// End of a phase started at startTime (count calls in one go)
+  inline void endPhase(int phase, double startTime, int count = 1)
+  {
+    if (!--depth_) {
+      numberCalls_[phase] += count;
+      time_[phase] += CoinGetTimeOfDay() - startTime;
+    }
+  }
+  /// Start of a part of FTRAN or BTRAN (returns 0.0 if not timed)
+  inline double startSolve() const
+  {
+    return timeSolves_ ? CoinGetTimeOfDay() : 0.0;
+  }
+  /** Part of FTRAN or BTRAN (see numberSolveMode) started at startTime
+      was done in mode - numberReach is size of reach if mode 2 */
+  inline void addSolveMode(int part, int mode, int numberReach,
+    double startTime)
+  {
+    numberSolveMode_[part][mode]++;
+    if (mode == 2)
+      totalReach_[part] += numberReach;
+    if (timeSolves_)
+      timeSolveMode_[part][mode] += CoinGetTimeOfDay() - startTime;
+  }
+  /// Symbolic reach of part was too big
+  inline void addReachAbandoned(int part)
+  {
+    numberReachAbandoned_[part]++;
+  }
+  /** A factorization was done - numberDense is size of dense part,
+      numberElements size of factorization.  Ends update cycle */
+  void addFactorization(int numberDense, int numberElements,
+    int numberCompressions);
+  /// Update file now has numberElements
+  inline void setUpdateElements(int numberElements)
+  {
+    currentUpdateElements_ = numberElements;
+    if (numberElements > maximumUpdateElements_)
+      maximumUpdateElements_ = numberElements;
+  }
+  //@}
+
+  /**@name Other */
+  //@{
+  /// Zeroes everything but name and timeSolves
+  void reset();
+  /// Adds in statistics of other (e.g. from another thread)
+  void add(const CoinFactorizationStatistics &other);
+  /// Prints as a JSON object (all on one line if oneLine)
+  void printJson(FILE *fp = stdout, bool oneLine = false) const;
+  /// Prints as a line of comma separated values (optionally header line first)
+  void printCsv(FILE *fp = stdout, bool header = true) const;
+  /** Writes JSON (if name ends in .json or .jsonl) or CSV to file.
+      JSON is written as JSON Lines - one object per line - so a file
+      appended to is a sequence of objects, not one JSON document.  CSV
+      has a header line if the file was empty.
+      Returns 0 if okay, 1 if could not open */
+  int writeFile(const char *fileName, bool append = false) const;
+  //@}
+
+private:
+  /// Name
+  std::string name_;
+  /// Nesting of phases
+  int depth_;
+  /// Calls of each phase
+  double numberCalls_[numberPhases];
+  /// Seconds in each phase
+  double time_[numberPhases];
+  /// FTRAN and BTRAN solve modes as CoinFactorization
+  double numberSolveMode_[4][3];
+  /// Symbolic reaches which were too big
+  double numberReachAbandoned_[4];
+  /// Total size of symbolic reaches
+  double totalReach_[4];
+  /// Seconds in each solve mode
+  double timeSolveMode_[4][3];
+  /// Time L and U parts of FTRAN and BTRAN
+  bool timeSolves_;
+  /// Factorizations with dense part
+  double numberDenseFactorizations_;
+  /// Total size of dense parts
+  double totalDense_;
+  /// Compressions
+  double numberCompressions_;
+  /// Elements just after factorizing
+  double totalFactorElements_;
+  /// Elements in update file now
+  int currentUpdateElements_;
+  /// Largest update file
+  int maximumUpdateElements_;
+  /// Total update elements at refactorization
+  double totalUpdateElements_;
+  /// Number of update cycles
+  double numberUpdateCycles_;
+};
+
+/** Times a phase from construction to destruction so every return of
+    a factorization method is covered.  Does nothing if statistics is NULL.
+*/
+class CoinFactorizationStatisticsTimer {
+
+public:
+  /// Starts timing (count is number of calls phase counts as)
+  inline CoinFactorizationStatisticsTimer(CoinFactorizationStatistics *statistics,
+    int phase, int count = 1)
+    : statistics_(statistics)
+    , phase_(phase)
+    , count_(count)
+    , startTime_(statistics ? statistics->startPhase() : 0.0)
+  {
+  }
+  /// Stops timing
+  inline ~CoinFactorizationStatisticsTimer()
+  {
+    if (statistics_)
+      statistics_->endPhase(phase_, startTime_, count_);
+  }
+
+private:
+  /// Not copyable
+  CoinFactorizationStatisticsTimer(const CoinFactorizationStatisticsTimer &);
+  CoinFactorizationStatisticsTimer &operator=(const CoinFactorizationStatisticsTimer &);
+  /// Statistics (or NULL)
+  CoinFactorizationStatistics *statistics_;
+  /// Phase
+  int phase_;
+  /// Calls to count
+  int count_;
+  /// Start time
+  double startTime_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,96 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#include "CoinUtilsConfig.h"
+
+#include <cassert>
+
+#include "CoinFactorizationView.hpp"
+
+//#############################################################################
+// Constructors / Destructor / Assignment
+//#############################################################################
+
+CoinFactorizationView::CoinFactorizationView(const CoinFactorization &factorization)
+  : factorization_(&factorization)
+{
+  updates_.shareFactors(factorization);
+}
+
+CoinFactorizationView::CoinFactorizationView(const CoinFactorizationView &rhs)
+  : factorization_(rhs.factorization_)
+{
+  if (!rhs.updates_.sharedFactors_) {
+    // full copy (see copyUpdates)
+    updates_ = rhs.updates_;
+  } else {
+    updates_.shareFactors(*factorization_);
+    if (rhs.ownUpdates())
+      updates_.copyUpdates(rhs.updates_);
+  }
+}
+
+CoinFactorizationView &
+CoinFactorizationView::operator=(const CoinFactorizationView &rhs)
+{
+  if (this != &rhs) {
+    factorization_ = rhs.factorization_;
+    if (!rhs.updates_.sharedFactors_) {
+      updates_ = rhs.updates_;
+    } else {
+      updates_.shareFactors(*factorization_);
+      if (rhs.ownUpdates())
+        updates_.copyUpdates(rhs.updates_);
+    }
+  }
+  return *this;
+}
+
+CoinFactorizationView::~CoinFactorizationView()
+{
+}
+
+//#############################################################################
+// Updates
+//#############################################################################
+
+// Copies what updates change (if not already done)
+void CoinFactorizationView::copyUpdates()
+{
+  if (!ownUpdates()) {
+    if (factorization_->forrestTomlin()) {
+      updates_.copyUpdates(*factorization_);
+    } else {
+      // product form updates go in L so nothing can be shared
+      updates_ = *factorization_;
+    }
+  }
+}
+
+// Updates incoming column (FTRAN) and keeps partial update
+int CoinFactorizationView::updateColumnFT(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2)
+{
+  // partial update goes in U
+  copyUpdates();
+  return updates_.updateColumnFT(regionSparse, regionSparse2);
+}
+
+/* Replaces one column in basis
+   returns 0=OK, 1=Probably OK, 2=singular, 3=no room, 5=too many updates */
+int CoinFactorizationView::replaceColumn(CoinIndexedVector *regionSparse,
+  int pivotRow, double pivotCheck, bool checkBeforeModifying)
+{
+  copyUpdates();
+  return updates_.replaceColumn(regionSparse, pivotRow, pivotCheck,
+    checkBeforeModifying);
+}
+
+// Throws away all updates
+void CoinFactorizationView::clearUpdates()
+{
+  updates_.shareFactors(*factorization_);
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,123 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifndef CoinFactorizationView_H
+#define CoinFactorizationView_H
+
+#include "CoinFactorization.hpp"
+
+/** Per thread updates on top of a shared CoinFactorization.
+
+    Several threads (e.g. strong branching) often start from the same
+    basis.  Rather than each copying the factorization, each can have a
+    view.  The factorization itself is never modified by a view.
+
+    All state of a view is in the view object - a sparse work area and
+    its own Forrest-Tomlin updates - so a view can be used by any thread
+    (but by one thread at a time) and no locks are needed.  Until the
+    first update a view uses all the factors of the shared
+    factorization.  The first update copies what updates change (U, R
+    and permutations).  L and the dense part stay shared.
+
+    Views must be finished with before the factorization is changed.
+    Row numbering is as for CoinFactorization (updated columns are in
+    pivot order).
+*/
+class COINUTILSLIB_EXPORT CoinFactorizationView {
+
+public:
+  /**@name Constructors and destructor and copy */
+  //@{
+  /// Constructor - factorization must not change while view is used
+  CoinFactorizationView(const CoinFactorization &factorization);
+  /// Copy constructor (copies updates)
+  CoinFactorizationView(const CoinFactorizationView &rhs);
+  /// Assignment operator
+  CoinFactorizationView &operator=(const CoinFactorizationView &rhs);
+  /// Destructor
+  ~CoinFactorizationView();
+  //@}
+
+  /**@name Updates */
+  //@{
+  /** Updates one column (FTRAN) from regionSparse2 as
+      CoinFactorization::updateColumn.
+      regionSparse starts as zero and is zero at end.
+      Returns number of elements in updated column */
+  inline int updateColumn(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2,
+    bool noPermute = false) const
+  {
+    return updates_.updateColumn(regionSparse, regionSparse2, noPermute);
+  }
+  /** Updates one column (BTRAN) from regionSparse2 as
+      CoinFactorization::updateColumnTranspose.
+      regionSparse starts as zero and is zero at end.
+      Returns number of elements in updated column */
+  inline int updateColumnTranspose(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2) const
+  {
+    return updates_.updateColumnTranspose(regionSparse, regionSparse2);
+  }
+  /** Updates incoming column (FTRAN) as CoinFactorization::updateColumnFT
+      and keeps partial update for replaceColumn.
+      Number returned is negative if no room */
+  int updateColumnFT(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2);
+  /** Replaces one column in basis as CoinFactorization::replaceColumn
+      (updateColumnFT must have been done on incoming column).
+      regionSparse is a work region (zero at start and end).
+      Returns 0=OK, 1=Probably OK, 2=singular, 3=no room, 5=too many updates */
+  int replaceColumn(CoinIndexedVector *regionSparse,
+    int pivotRow, double pivotCheck,
+    bool checkBeforeModifying = false);
+  /// Throws away all updates so view is back to factorization
+  void clearUpdates();
+  //@}
+
+  /**@name Gets */
+  //@{
+  /// Factorization being viewed
+  inline const CoinFactorization &factorization() const
+  {
+    return *factorization_;
+  }
+  /// Number of updates done by this view
+  inline int numberPivots() const
+  {
+    return updates_.pivots() - factorization_->pivots();
+  }
+  /// Maximum number of updates allowed (as factorization)
+  inline int maximumPivots() const
+  {
+    return factorization_->maximumPivots() - factorization_->pivots();
+  }
+  /// True if view has own copy of what updates change
+  inline bool ownUpdates() const
+  {
+    return updates_.elementUArray_ != factorization_->elementUArray_;
+  }
+  //@}
+
+private:
+  /**@name Private methods */
+  //@{
+  /// Copies what updates change (if not already done)
+  void copyUpdates();
+  //@}
+
+  /**@name Private member data */
+  //@{
+  /// Factorization being viewed
+  const CoinFactorization *factorization_;
+  /** Factors as seen by this view - L and dense part are those of
+      factorization_.  U, R and permutations are as well until the
+      first update.  Also has sparse work area of this view */
+  CoinFactorization updates_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
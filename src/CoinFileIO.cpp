@@ -99,6 +99,152 @@ char *CoinPlainFileInput::gets(char *buffer, int size)
 #endif
 }
 
+// ------ Input for memory mapped plain text ------
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define COIN_FILE_MAP
+#endif
+
+// This reads plain text files through one read only mapping of the
+// whole file (or text already in memory) so lines can be looked at
+// where they are
+class CoinMappedFileInput : public CoinFileInput {
+public:
+#ifdef COIN_FILE_MAP
+  CoinMappedFileInput(const std::string &fileName)
+    : CoinFileInput(fileName)
+    , data_(NULL)
+    , size_(0)
+    , position_(0)
+    , owner_(true)
+  {
+    readType_ = "plain";
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+      throw CoinError("Could not open file for reading!",
+        "CoinMappedFileInput",
+        "CoinMappedFileInput");
+    struct stat status;
+    bool good = !fstat(fd, &status) && S_ISREG(status.st_mode);
+    if (good && status.st_size > 0) {
+      size_ = static_cast< size_t >(status.st_size);
+      void *data = mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data != MAP_FAILED) {
+        data_ = static_cast< const char * >(data);
+#ifdef MADV_SEQUENTIAL
+        madvise(data, size_, MADV_SEQUENTIAL);
+#endif
+      } else {
+        good = false;
+      }
+    }
+    close(fd);
+    if (!good)
+      throw CoinError("Could not map file!",
+        "CoinMappedFileInput",
+        "CoinMappedFileInput");
+  }
+#endif
+
+  // Text in memory (not freed)
+  CoinMappedFileInput(const char *data, size_t size)
+    : CoinFileInput("memory")
+    , data_(data)
+    , size_(size)
+    , position_(0)
+    , owner_(false)
+  {
+    readType_ = "plain";
+  }
+
+  virtual ~CoinMappedFileInput()
+  {
+#ifdef COIN_FILE_MAP
+    if (data_ && owner_)
+      munmap(const_cast< char * >(data_), size_);
+#endif
+  }
+
+  virtual int read(void *buffer, int size)
+  {
+    size_t count = CoinMin(static_cast< size_t >(size), size_ - position_);
+    memcpy(buffer, data_ + position_, count);
+    position_ += count;
+    return static_cast< int >(count);
+  }
+
+  virtual char *gets(char *buffer, int size)
+  {
+    if (size <= 1)
+      return size == 1 ? (buffer[0] = '\0', buffer) : 0;
+    int length;
+    const char *line = nextLine(length, size - 1);
+    if (!line)
+      return 0;
+    memcpy(buffer, line, length);
+    // put back newline as fgets does
+    if (length < size - 1 && line + length < data_ + size_)
+      buffer[length++] = '\n';
+    buffer[length] = '\0';
+    return buffer;
+  }
+
+  virtual bool mapped() const
+  {
+    return true;
+  }
+
+  virtual const char *nextLine(int &length, int maximumLength)
+  {
+    if (position_ >= size_) {
+      length = 0;
+      return 0;
+    }
+    const char *line = data_ + position_;
+    size_t left = CoinMin(size_ - position_,
+      static_cast< size_t >(maximumLength));
+    const char *newline = static_cast< const char * >(memchr(line, '\n', left));
+    if (newline) {
+      length = static_cast< int >(newline - line);
+      position_ += length + 1;
+    } else {
+      length = static_cast< int >(left);
+      position_ += length;
+    }
+    return line;
+  }
+
+  virtual const char *mappedData(size_t &size) const
+  {
+    size = size_;
+    return data_;
+  }
+
+  virtual size_t mappedPosition() const
+  {
+    return position_;
+  }
+
+  virtual void setMappedPosition(size_t position)
+  {
+    position_ = CoinMin(position, size_);
+  }
+
+private:
+  /// Start of mapping
+  const char *data_;
+  /// Size of file
+  size_t size_;
+  /// Where next read starts
+  size_t position_;
+  /// Whether data_ was mapped here
+  bool owner_;
+};
+
 // ------ helper class supporting buffered gets -------
 
 // This is a CoinFileInput class to handle cases, where the gets method
@@ -383,6 +529,23 @@ CoinFileInput *CoinFileInput::create(const std::string &fileName)
   return new CoinPlainFileInput(fileName);
 }
 
+CoinFileInput *CoinFileInput::createMapped(const std::string &fileName)
+{
+  CoinFileInput *input = create(fileName);
+#ifdef COIN_FILE_MAP
+  if (fileName != "stdin" && input->getReadType() == "plain") {
+    try {
+      CoinFileInput *mapped = new CoinMappedFileInput(fileName);
+      delete input;
+      input = mapped;
+    } catch (CoinError &) {
+      // not a regular file or could not map - keep stream
+    }
+  }
+#endif
+  return input;
+}
+
 CoinFileInput::CoinFileInput(const std::string &fileName)
   : CoinFileIOBase(fileName)
 {
@@ -392,6 +555,37 @@ CoinFileInput::~CoinFileInput()
 {
 }
 
+bool CoinFileInput::mapped() const
+{
+  return false;
+}
+
+const char *CoinFileInput::nextLine(int &length, int)
+{
+  length = 0;
+  return 0;
+}
+
+const char *CoinFileInput::mappedData(size_t &size) const
+{
+  size = 0;
+  return 0;
+}
+
+size_t CoinFileInput::mappedPosition() const
+{
+  return 0;
+}
+
+void CoinFileInput::setMappedPosition(size_t)
+{
+}
+
+CoinFileInput *CoinFileInput::createFromMemory(const char *data, size_t size)
+{
+  return new CoinMappedFileInput(data, size);
+}
+
 // ------------------------------------------------------
 //   Some subclasses of CoinFileOutput
 //   for plain text and compressed files
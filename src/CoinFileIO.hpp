@@ -56,6 +56,19 @@ public:
   /// @param fileName The file that should be read.
   static CoinFileInput *create(const std::string &fileName);
 
+  /// As create but a plain file (not stdin) is memory mapped where the
+  /// system allows it, so mapped() is true and nextLine can be used.
+  /// Compressed files (and plain ones which can not be mapped) are read
+  /// as by create.
+  /// @param fileName The file that should be read.
+  static CoinFileInput *createMapped(const std::string &fileName);
+
+  /// Creates a CoinFileInput reading size characters of text at data,
+  /// which must stay valid (and is not freed).  mapped() is true.
+  /// @param data Start of text.
+  /// @param size Number of characters.
+  static CoinFileInput *createFromMemory(const char *data, size_t size);
+
   /// Constructor (don't use this, use the create method instead).
   /// @param fileName The name of the file used by this object.
   CoinFileInput(const std::string &fileName);
@@ -79,6 +92,33 @@ public:
   /// @param size The size of the buffer in characters.
   /// @return buffer on success, or 0 if no characters have been read.
   virtual char *gets(char *buffer, int size) = 0;
+
+  /// Whether the whole file is in memory so nextLine can be used.
+  /// The default implementation returns false.
+  virtual bool mapped() const;
+
+  /// Returns the next line without copying it (only if mapped()).
+  /// The line is not terminated with '\0' and stays valid until the
+  /// object is destroyed.  As with gets a line of more than maximumLength
+  /// characters is returned in pieces.
+  /// @param length Set to number of characters before newline (or end
+  ///        of file or maximumLength).
+  /// @param maximumLength Most characters to return.
+  /// @return start of line, or 0 at end of file.  The default
+  ///         implementation always returns 0.
+  virtual const char *nextLine(int &length, int maximumLength);
+
+  /// Whole file in memory (only if mapped()).
+  /// @param size Set to size of file.
+  /// @return start of file.  The default implementation returns 0.
+  virtual const char *mappedData(size_t &size) const;
+
+  /// Offset in mappedData of next character to be read (only if mapped()).
+  virtual size_t mappedPosition() const;
+
+  /// Sets offset in mappedData of next character to be read (only if
+  /// mapped()).  The default implementation does nothing.
+  virtual void setMappedPosition(size_t position);
 };
 
 /// This reads plain text files
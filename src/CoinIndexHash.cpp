@@ -0,0 +1,173 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#include "CoinUtilsConfig.h"
+
+#include <cassert>
+
+#include "CoinIndexHash.hpp"
+#include "CoinHelperFunctions.hpp"
+
+// Default constructor
+CoinIndexHash::CoinIndexHash()
+  : keys_(NULL)
+  , values_(NULL)
+  , numberSlots_(0)
+  , shift_(32)
+  , number_(0)
+  , minimum_(0)
+  , maximum_(0)
+{
+}
+// Copy constructor
+CoinIndexHash::CoinIndexHash(const CoinIndexHash &rhs)
+  : keys_(CoinCopyOfArray(rhs.keys_, rhs.numberSlots_))
+  , values_(CoinCopyOfArray(rhs.values_, rhs.numberSlots_))
+  , numberSlots_(rhs.numberSlots_)
+  , shift_(rhs.shift_)
+  , number_(rhs.number_)
+  , minimum_(rhs.minimum_)
+  , maximum_(rhs.maximum_)
+{
+}
+// = copy
+CoinIndexHash &CoinIndexHash::operator=(const CoinIndexHash &rhs)
+{
+  if (this != &rhs) {
+    delete[] keys_;
+    delete[] values_;
+    keys_ = CoinCopyOfArray(rhs.keys_, rhs.numberSlots_);
+    values_ = CoinCopyOfArray(rhs.values_, rhs.numberSlots_);
+    numberSlots_ = rhs.numberSlots_;
+    shift_ = rhs.shift_;
+    number_ = rhs.number_;
+    minimum_ = rhs.minimum_;
+    maximum_ = rhs.maximum_;
+  }
+  return *this;
+}
+// Destructor
+CoinIndexHash::~CoinIndexHash()
+{
+  delete[] keys_;
+  delete[] values_;
+}
+// Empties table (memory is kept)
+void CoinIndexHash::clear()
+{
+  if (number_)
+    CoinFillN(values_, numberSlots_, -1);
+  number_ = 0;
+}
+// Makes room for number keys without growing
+void CoinIndexHash::reserve(int number)
+{
+  // at most half full
+  if (2 * number > numberSlots_)
+    resize(number);
+}
+// Makes table with room for number keys and puts in existing keys
+void CoinIndexHash::resize(int number)
+{
+  int numberSlots = 16;
+  int shift = 28;
+  while (numberSlots < 2 * number) {
+    numberSlots *= 2;
+    shift--;
+  }
+  int *keys = keys_;
+  int *values = values_;
+  int oldNumberSlots = numberSlots_;
+  keys_ = new int[numberSlots];
+  values_ = new int[numberSlots];
+  CoinFillN(values_, numberSlots, -1);
+  numberSlots_ = numberSlots;
+  shift_ = shift;
+  int oldNumber = number_;
+  number_ = 0;
+  for (int i = 0; i < oldNumberSlots && number_ < oldNumber; i++) {
+    if (values[i] >= 0)
+      insert(keys[i], values[i]);
+  }
+  delete[] keys;
+  delete[] values;
+}
+// Adds key with value
+bool CoinIndexHash::insert(int key, int value)
+{
+  assert(value >= 0);
+  if (2 * (number_ + 1) > numberSlots_)
+    resize(2 * (number_ + 1));
+  int mask = numberSlots_ - 1;
+  int slot = hash(key);
+  while (values_[slot] >= 0) {
+    if (keys_[slot] == key)
+      return false;
+    slot = (slot + 1) & mask;
+  }
+  keys_[slot] = key;
+  values_[slot] = value;
+  if (!number_) {
+    minimum_ = key;
+    maximum_ = key;
+  } else if (key < minimum_) {
+    minimum_ = key;
+  } else if (key > maximum_) {
+    maximum_ = key;
+  }
+  number_++;
+  return true;
+}
+// Empties table and adds keys[i] with value i
+int CoinIndexHash::build(int number, const int *keys)
+{
+  clear();
+  reserve(number);
+  for (int i = 0; i < number; i++) {
+    if (!insert(keys[i], i))
+      return i;
+  }
+  return -1;
+}
+// Value for key or -1 if not there
+int CoinIndexHash::find(int key) const
+{
+  if (!number_)
+    return -1;
+  int mask = numberSlots_ - 1;
+  int slot = hash(key);
+  while (values_[slot] >= 0) {
+    if (keys_[slot] == key)
+      return values_[slot];
+    slot = (slot + 1) & mask;
+  }
+  return -1;
+}
+// values[i] = find(keys[i])
+void CoinIndexHash::find(int number, const int *keys, int *values) const
+{
+  if (!number_) {
+    CoinFillN(values, number, -1);
+    return;
+  }
+  int mask = numberSlots_ - 1;
+  for (int i = 0; i < number; i++) {
+    int key = keys[i];
+    int value = -1;
+    // keys out of range need no probing
+    if (key >= minimum_ && key <= maximum_) {
+      int slot = hash(key);
+      while (values_[slot] >= 0) {
+        if (keys_[slot] == key) {
+          value = values_[slot];
+          break;
+        }
+        slot = (slot + 1) & mask;
+      }
+    }
+    values[i] = value;
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,108 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifndef CoinIndexHash_H
+#define CoinIndexHash_H
+
+#include "CoinUtilsConfig.h"
+
+/** Flat hash table from int keys (indices) to nonnegative int values.
+
+    Open addressing with linear probing in one array of slots so, unlike
+    std::set or std::map, nothing is allocated per key.  clear() keeps the
+    memory so a table can be reused (CoinPackedVectorBase keeps one for
+    duplicate index checks).  Smallest and largest keys are kept as keys
+    are added.  Keys cannot be removed.
+*/
+class COINUTILSLIB_EXPORT CoinIndexHash {
+
+public:
+  /**@name Constructors, destructor and copying */
+  //@{
+  /// Default constructor (empty)
+  CoinIndexHash();
+  /// Copy constructor
+  CoinIndexHash(const CoinIndexHash &rhs);
+  /// = copy
+  CoinIndexHash &operator=(const CoinIndexHash &rhs);
+  /// Destructor
+  ~CoinIndexHash();
+  //@}
+
+  /**@name Adding keys */
+  //@{
+  /// Empties table (memory is kept)
+  void clear();
+  /// Makes room for number keys without growing
+  void reserve(int number);
+  /** Adds key with value (>= 0).  Returns false and does nothing if key
+      is already there */
+  bool insert(int key, int value = 0);
+  /** Empties table and adds keys[i] with value i.  Returns position of
+      first duplicate key (table then has keys before it) or -1 */
+  int build(int number, const int *keys);
+  //@}
+
+  /**@name Finding keys */
+  //@{
+  /// Value for key or -1 if not there
+  int find(int key) const;
+  /// Whether key is there
+  inline bool contains(int key) const
+  {
+    return find(key) >= 0;
+  }
+  /// values[i] = find(keys[i]) for i < number
+  void find(int number, const int *keys, int *values) const;
+  /// Number of keys
+  inline int size() const
+  {
+    return number_;
+  }
+  /// Smallest key (only if size() > 0)
+  inline int minimumKey() const
+  {
+    return minimum_;
+  }
+  /// Largest key (only if size() > 0)
+  inline int maximumKey() const
+  {
+    return maximum_;
+  }
+  //@}
+
+private:
+  /**@name Private methods */
+  //@{
+  /// Slot to start looking for key
+  inline int hash(int key) const
+  {
+    return static_cast< int >((static_cast< unsigned int >(key) * 2654435769u) >> shift_);
+  }
+  /// Makes table with room for number keys and puts in existing keys
+  void resize(int number);
+  //@}
+
+  /**@name Data */
+  //@{
+  /// Keys
+  int *keys_;
+  /// Values (-1 for empty slot)
+  int *values_;
+  /// Number of slots (power of 2)
+  int numberSlots_;
+  /// 32 - log2 of number of slots
+  int shift_;
+  /// Number of keys
+  int number_;
+  /// Smallest key
+  int minimum_;
+  /// Largest key
+  int maximum_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -9,11 +9,22 @@
 
 #include <cassert>
 #include <cstdio>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define COIN_ARRAY_MAP
+#endif
 
 #include "CoinTypes.h"
 #include "CoinFloatEqual.hpp"
 #include "CoinHelperFunctions.hpp"
 #include "CoinIndexedVector.hpp"
+#include "CoinSimdKernels.hpp"
+#include "CoinThreadPool.hpp"
+#ifdef COINUTILS_PTHREADS
+#include <pthread.h>
+#endif
 
 //#############################################################################
 #define WARN_USELESS 0
@@ -41,7 +52,7 @@ void CoinIndexedVector::clear()
     for (int i = 0; i < nElements_; i++)
       assert(indices_[i] >= 0 && indices_[i] < capacity_);
 #endif
-    if (3 * nElements_ < capacity_) {
+    if (density() != dense) {
       int i = 0;
       if ((nElements_ & 1) != 0) {
         elements_[indices_[0]] = 0.0;
@@ -91,6 +102,7 @@ CoinIndexedVector::operator=(const CoinIndexedVector &rhs)
   if (this != &rhs) {
     clear();
     packedMode_ = rhs.packedMode_;
+    scanDensity_ = rhs.scanDensity_;
     if (!packedMode_)
       gutsOfSetVector(rhs.capacity_, rhs.nElements_,
         rhs.indices_, rhs.elements_);
@@ -292,18 +304,8 @@ void CoinIndexedVector::add(int index, double element)
 
 int CoinIndexedVector::clean(double tolerance)
 {
-  int number = nElements_;
-  int i;
-  nElements_ = 0;
   assert(!packedMode_);
-  for (i = 0; i < number; i++) {
-    int indexValue = indices_[i];
-    if (fabs(elements_[indexValue]) >= tolerance) {
-      indices_[nElements_++] = indexValue;
-    } else {
-      elements_[indexValue] = 0.0;
-    }
-  }
+  nElements_ = CoinSimdClean(nElements_, indices_, tolerance, elements_);
   return nElements_;
 }
 #ifndef NDEBUG
@@ -465,15 +467,8 @@ void CoinIndexedVector::truncate(int n)
 void CoinIndexedVector::operator+=(double value)
 {
   assert(!packedMode_);
-  int i, indexValue;
-  for (i = 0; i < nElements_; i++) {
-    indexValue = indices_[i];
-    double newValue = elements_[indexValue] + value;
-    if (fabs(newValue) >= COIN_INDEXED_TINY_ELEMENT)
-      elements_[indexValue] = newValue;
-    else
-      elements_[indexValue] = COIN_INDEXED_REALLY_TINY_ELEMENT;
-  }
+  CoinSimdUpdate(CoinSimdAdd, nElements_, indices_, value,
+    COIN_INDEXED_TINY_ELEMENT, COIN_INDEXED_REALLY_TINY_ELEMENT, elements_);
 }
 
 //-----------------------------------------------------------------------------
@@ -481,15 +476,8 @@ void CoinIndexedVector::operator+=(double value)
 void CoinIndexedVector::operator-=(double value)
 {
   assert(!packedMode_);
-  int i, indexValue;
-  for (i = 0; i < nElements_; i++) {
-    indexValue = indices_[i];
-    double newValue = elements_[indexValue] - value;
-    if (fabs(newValue) >= COIN_INDEXED_TINY_ELEMENT)
-      elements_[indexValue] = newValue;
-    else
-      elements_[indexValue] = COIN_INDEXED_REALLY_TINY_ELEMENT;
-  }
+  CoinSimdUpdate(CoinSimdSubtract, nElements_, indices_, value,
+    COIN_INDEXED_TINY_ELEMENT, COIN_INDEXED_REALLY_TINY_ELEMENT, elements_);
 }
 
 //-----------------------------------------------------------------------------
@@ -497,15 +485,8 @@ void CoinIndexedVector::operator-=(double value)
 void CoinIndexedVector::operator*=(double value)
 {
   assert(!packedMode_);
-  int i, indexValue;
-  for (i = 0; i < nElements_; i++) {
-    indexValue = indices_[i];
-    double newValue = elements_[indexValue] * value;
-    if (fabs(newValue) >= COIN_INDEXED_TINY_ELEMENT)
-      elements_[indexValue] = newValue;
-    else
-      elements_[indexValue] = COIN_INDEXED_REALLY_TINY_ELEMENT;
-  }
+  CoinSimdUpdate(CoinSimdMultiply, nElements_, indices_, value,
+    COIN_INDEXED_TINY_ELEMENT, COIN_INDEXED_REALLY_TINY_ELEMENT, elements_);
 }
 
 //-----------------------------------------------------------------------------
@@ -513,15 +494,8 @@ void CoinIndexedVector::operator*=(double value)
 void CoinIndexedVector::operator/=(double value)
 {
   assert(!packedMode_);
-  int i, indexValue;
-  for (i = 0; i < nElements_; i++) {
-    indexValue = indices_[i];
-    double newValue = elements_[indexValue] / value;
-    if (fabs(newValue) >= COIN_INDEXED_TINY_ELEMENT)
-      elements_[indexValue] = newValue;
-    else
-      elements_[indexValue] = COIN_INDEXED_REALLY_TINY_ELEMENT;
-  }
+  CoinSimdUpdate(CoinSimdDivide, nElements_, indices_, value,
+    COIN_INDEXED_TINY_ELEMENT, COIN_INDEXED_REALLY_TINY_ELEMENT, elements_);
 }
 //#############################################################################
 
@@ -670,6 +644,7 @@ CoinIndexedVector::CoinIndexedVector()
   , capacity_(0)
   , offset_(0)
   , packedMode_(false)
+  , scanDensity_(sparse)
 {
 }
 
@@ -680,6 +655,7 @@ CoinIndexedVector::CoinIndexedVector(int size)
   , capacity_(0)
   , offset_(0)
   , packedMode_(false)
+  , scanDensity_(sparse)
 {
   // Get space
   reserve(size);
@@ -695,6 +671,7 @@ CoinIndexedVector::CoinIndexedVector(int size,
   , capacity_(0)
   , offset_(0)
   , packedMode_(false)
+  , scanDensity_(sparse)
 {
   gutsOfSetVector(size, inds, elems);
 }
@@ -709,6 +686,7 @@ CoinIndexedVector::CoinIndexedVector(int size,
   , capacity_(0)
   , offset_(0)
   , packedMode_(false)
+  , scanDensity_(sparse)
 {
   gutsOfSetConstant(size, inds, value);
 }
@@ -722,6 +700,7 @@ CoinIndexedVector::CoinIndexedVector(int size, const double *element)
   , capacity_(0)
   , offset_(0)
   , packedMode_(false)
+  , scanDensity_(sparse)
 {
   setFull(size, element);
 }
@@ -735,6 +714,7 @@ CoinIndexedVector::CoinIndexedVector(const CoinPackedVectorBase &rhs)
   , capacity_(0)
   , offset_(0)
   , packedMode_(false)
+  , scanDensity_(sparse)
 {
   gutsOfSetVector(rhs.getNumElements(),
     rhs.getIndices(), rhs.getElements());
@@ -749,6 +729,7 @@ CoinIndexedVector::CoinIndexedVector(const CoinIndexedVector &rhs)
   , capacity_(0)
   , offset_(0)
   , packedMode_(false)
+  , scanDensity_(rhs.scanDensity_)
 {
   if (!rhs.packedMode_)
     gutsOfSetVector(rhs.capacity_, rhs.nElements_, rhs.indices_, rhs.elements_);
@@ -765,6 +746,7 @@ CoinIndexedVector::CoinIndexedVector(const CoinIndexedVector *rhs)
   , capacity_(0)
   , offset_(0)
   , packedMode_(false)
+  , scanDensity_(rhs->scanDensity_)
 {
   if (!rhs->packedMode_)
     gutsOfSetVector(rhs->capacity_, rhs->nElements_, rhs->indices_, rhs->elements_);
@@ -966,32 +948,114 @@ CoinIndexedVector::operator/(const CoinIndexedVector &op2)
   }
   return newOne;
 }
+// Drops elements which have become tiny
+void CoinIndexedVector::gutsOfClean()
+{
+  nElements_ = CoinSimdClean(nElements_, indices_, COIN_INDEXED_TINY_ELEMENT,
+    elements_);
+}
+namespace {
+// Adds value into position indexValue as operator+ does
+inline void addOne(int indexValue, double value, double *elements,
+  int *indices, int &number, bool &needClean)
+{
+  double oldValue = elements[indexValue];
+  if (!oldValue) {
+    if (fabs(value) >= COIN_INDEXED_TINY_ELEMENT) {
+      elements[indexValue] = value;
+      indices[number++] = indexValue;
+    }
+  } else {
+    value += oldValue;
+    elements[indexValue] = value;
+    if (fabs(value) < COIN_INDEXED_TINY_ELEMENT)
+      needClean = true;
+  }
+}
+}
+// Adds (or subtracts) op2 in place
+void CoinIndexedVector::gutsOfAdd(const CoinIndexedVector &op2, bool subtract)
+{
+  assert(!packedMode_);
+  reserve(std::max(capacity_, op2.capacity_));
+  const double *other = op2.elements_;
+  // old - value is exactly old + (-value)
+  double sign = subtract ? -1.0 : 1.0;
+  bool needClean = false;
+  if (op2.density() == dense) {
+    // sweep (new indices come out in order)
+    for (int i = 0; i < op2.capacity_; i++) {
+      if (other[i])
+        addOne(i, sign * other[i], elements_, indices_, nElements_, needClean);
+    }
+  } else {
+    const int *otherIndices = op2.indices_;
+    int number = op2.nElements_;
+    for (int i = 0; i < number; i++) {
+      int indexValue = otherIndices[i];
+      addOne(indexValue, sign * other[indexValue], elements_, indices_,
+        nElements_, needClean);
+    }
+  }
+  if (needClean)
+    gutsOfClean();
+}
 // The sum of two indexed vectors
 void CoinIndexedVector::operator+=(const CoinIndexedVector &op2)
 {
-  // do slowly at first
-  *this = *this + op2;
+  gutsOfAdd(op2, false);
 }
 
 // The difference of two indexed vectors
 void CoinIndexedVector::operator-=(const CoinIndexedVector &op2)
 {
-  // do slowly at first
-  *this = *this - op2;
+  gutsOfAdd(op2, true);
 }
 
 // The element-wise product of two indexed vectors
 void CoinIndexedVector::operator*=(const CoinIndexedVector &op2)
 {
-  // do slowly at first
-  *this = *this * op2;
+  assert(!packedMode_);
+  reserve(std::max(capacity_, op2.capacity_));
+  bool needClean = false;
+  for (int i = 0; i < op2.nElements_; i++) {
+    int indexValue = op2.indices_[i];
+    double oldValue = elements_[indexValue];
+    if (oldValue) {
+      double value = oldValue * op2.elements_[indexValue];
+      elements_[indexValue] = value;
+      if (fabs(value) < COIN_INDEXED_TINY_ELEMENT)
+        needClean = true;
+    }
+  }
+  if (needClean)
+    gutsOfClean();
 }
 
 // The element-wise ratio of two indexed vectors (0.0/0.0 => 0.0) (0 vanishes)
 void CoinIndexedVector::operator/=(const CoinIndexedVector &op2)
 {
-  // do slowly at first
-  *this = *this / op2;
+  assert(!packedMode_);
+  reserve(std::max(capacity_, op2.capacity_));
+  // check first so unchanged if error
+  for (int i = 0; i < op2.nElements_; i++) {
+    int indexValue = op2.indices_[i];
+    if (elements_[indexValue] && !op2.elements_[indexValue])
+      throw CoinError("zero divisor", "/", "CoinIndexedVector");
+  }
+  bool needClean = false;
+  for (int i = 0; i < op2.nElements_; i++) {
+    int indexValue = op2.indices_[i];
+    double oldValue = elements_[indexValue];
+    if (oldValue) {
+      double value = oldValue / op2.elements_[indexValue];
+      elements_[indexValue] = value;
+      if (fabs(value) < COIN_INDEXED_TINY_ELEMENT)
+        needClean = true;
+    }
+  }
+  if (needClean)
+    gutsOfClean();
 }
 //#############################################################################
 void CoinIndexedVector::sortDecrIndex()
@@ -1249,31 +1313,46 @@ void CoinIndexedVector::append(const CoinIndexedVector &caboose)
 
   const int *cind = caboose.getIndices();
   const double *celem = caboose.denseVector();
-  int maxIndex = -1;
+  bool needClean = false;
+  int numberDuplicates = 0;
   int i;
-  for (i = 0; i < cs; i++) {
-    int indexValue = cind[i];
+  if (caboose.density() == dense && !caboose.packedMode_) {
+    // sweep as far as last nonzero (new indices come out in order)
+    int last = caboose.capacity_;
+    while (last && !celem[last - 1])
+      last--;
+    reserve(last);
+    for (i = 0; i < last; i++) {
+      if (celem[i]) {
+        if (elements_[i])
+          numberDuplicates++;
+        addOne(i, celem[i], elements_, indices_, nElements_, needClean);
+      }
+    }
+  } else {
+    int maxIndex = -1;
+    for (i = 0; i < cs; i++) {
+      int indexValue = cind[i];
 #ifndef COIN_FAST_CODE
-    if (indexValue < 0)
-      throw CoinError("negative index", "append", "CoinIndexedVector");
+      if (indexValue < 0)
+        throw CoinError("negative index", "append", "CoinIndexedVector");
 #endif
-    if (maxIndex < indexValue)
-      maxIndex = indexValue;
-  }
-  reserve(maxIndex + 1);
-  bool needClean = false;
-  int numberDuplicates = 0;
-  for (i = 0; i < cs; i++) {
-    int indexValue = cind[i];
-    if (elements_[indexValue]) {
-      numberDuplicates++;
-      elements_[indexValue] += celem[indexValue];
-      if (fabs(elements_[indexValue]) < COIN_INDEXED_TINY_ELEMENT)
-        needClean = true; // need to go through again
-    } else {
-      if (fabs(celem[indexValue]) >= COIN_INDEXED_TINY_ELEMENT) {
-        elements_[indexValue] = celem[indexValue];
-        indices_[nElements_++] = indexValue;
+      if (maxIndex < indexValue)
+        maxIndex = indexValue;
+    }
+    reserve(maxIndex + 1);
+    for (i = 0; i < cs; i++) {
+      int indexValue = cind[i];
+      if (elements_[indexValue]) {
+        numberDuplicates++;
+        elements_[indexValue] += celem[indexValue];
+        if (fabs(elements_[indexValue]) < COIN_INDEXED_TINY_ELEMENT)
+          needClean = true; // need to go through again
+      } else {
+        if (fabs(celem[indexValue]) >= COIN_INDEXED_TINY_ELEMENT) {
+          elements_[indexValue] = celem[indexValue];
+          indices_[nElements_++] = indexValue;
+        }
       }
     }
   }
@@ -1599,13 +1678,14 @@ int CoinIndexedVector::scan(int start, int end)
   assert(!packedMode_);
   end = std::min(end, capacity_);
   start = std::max(start, 0);
-  int i;
-  int number = 0;
-  int *indices = indices_ + nElements_;
-  for (i = start; i < end; i++)
-    if (elements_[i])
-      indices[number++] = i;
+  int number;
+  if (scanDensity_ == hyperSparse)
+    number = CoinSimdScanSparse(elements_, start, end, indices_ + nElements_);
+  else
+    number = CoinSimdScan(elements_, start, end, indices_ + nElements_);
   nElements_ += number;
+  if (end > start)
+    scanDensity_ = density(number, end - start);
   return number;
 }
 // Scan dense region and set up indices with tolerance
@@ -1628,37 +1708,24 @@ int CoinIndexedVector::scan(int start, int end, double tolerance)
   end = std::min(end, capacity_ & 0x7fffffff);
 #endif
   start = std::max(start, 0);
-  int i;
-  int number = 0;
-  int *indices = indices_ + nElements_;
-  for (i = start; i < end; i++) {
-    double value = elements_[i];
-    if (value) {
-      if (fabs(value) >= tolerance)
-        indices[number++] = i;
-      else
-        elements_[i] = 0.0;
-    }
-  }
+  int number;
+  if (scanDensity_ == hyperSparse)
+    number = CoinSimdScanToleranceSparse(elements_, start, end, tolerance,
+      indices_ + nElements_);
+  else
+    number = CoinSimdScanTolerance(elements_, start, end, tolerance,
+      indices_ + nElements_);
   nElements_ += number;
+  if (end > start)
+    scanDensity_ = density(number, end - start);
   return number;
 }
 // These pack down
 int CoinIndexedVector::cleanAndPack(double tolerance)
 {
   if (!packedMode_) {
-    int number = nElements_;
-    int i;
-    nElements_ = 0;
-    for (i = 0; i < number; i++) {
-      int indexValue = indices_[i];
-      double value = elements_[indexValue];
-      elements_[indexValue] = 0.0;
-      if (fabs(value) >= tolerance) {
-        elements_[nElements_] = value;
-        indices_[nElements_++] = indexValue;
-      }
-    }
+    nElements_ = CoinSimdCleanAndPack(nElements_, indices_, tolerance,
+      elements_);
     packedMode_ = true;
   }
   return nElements_;
@@ -1821,6 +1888,188 @@ void CoinIndexedVector::print() const
   printf("\n");
 }
 
+namespace {
+// Policy arrays are created with
+int defaultPolicy = CoinArrayWithLength::allocateNormal;
+// Bytes got for each counter
+CoinInt64 bytesCounted[CoinArrayWithLength::numberAllocationCounters] = { 0 };
+#ifdef COINUTILS_PTHREADS
+pthread_mutex_t countMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+void countBytes(int counter, CoinByteArray size)
+{
+#ifdef COINUTILS_PTHREADS
+  pthread_mutex_lock(&countMutex);
+#endif
+  bytesCounted[counter] += size;
+#ifdef COINUTILS_PTHREADS
+  pthread_mutex_unlock(&countMutex);
+#endif
+}
+#ifdef COIN_ARRAY_MAP
+// Smallest arrays mapped for huge pages and for NUMA placement
+const size_t hugePageMinimum = 1 << 20;
+const size_t mapMinimum = 1 << 16;
+const size_t hugePageSize = 1 << 21;
+// From linux/mempolicy.h
+const int coinMpolInterleave = 3;
+const int coinMpolLocal = 4;
+/* Maps size bytes with data aligned on 1<<alignment (at most 4096).
+   Bytes mapped and where data starts are kept just before data */
+char *mapArray(size_t size, int alignment, int policy)
+{
+  size_t header = 64;
+  if (alignment > 6)
+    header = static_cast< size_t >(1) << std::min(alignment, 12);
+  bool hugePages = (policy & (CoinArrayWithLength::allocateHugePages
+                     | CoinArrayWithLength::allocateExplicitHugePages))
+    != 0;
+  size_t pageSize = hugePages ? hugePageSize : 4096;
+  size_t length = (header + size + pageSize - 1) & ~(pageSize - 1);
+  char *base = NULL;
+  int counter = -1;
+  if (hugePages) {
+#ifdef MAP_HUGETLB
+    if (policy & CoinArrayWithLength::allocateExplicitHugePages) {
+      void *mapped = mmap(NULL, length, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (mapped != MAP_FAILED) {
+        base = static_cast< char * >(mapped);
+        counter = CoinArrayWithLength::countExplicitHugePages;
+      }
+    }
+#endif
+    if (!base) {
+      // map extra so can start on huge page boundary
+      void *mapped = mmap(NULL, length + hugePageSize, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (mapped == MAP_FAILED)
+        return NULL;
+      char *start = static_cast< char * >(mapped);
+      size_t extra = (hugePageSize - (reinterpret_cast< size_t >(start) & (hugePageSize - 1)))
+        & (hugePageSize - 1);
+      if (extra)
+        munmap(start, extra);
+      base = start + extra;
+      if (hugePageSize - extra)
+        munmap(base + length, hugePageSize - extra);
+#ifdef MADV_HUGEPAGE
+      madvise(base, length, MADV_HUGEPAGE);
+#endif
+      counter = CoinArrayWithLength::countHugePages;
+    }
+  } else {
+    void *mapped = mmap(NULL, length, PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED)
+      return NULL;
+    base = static_cast< char * >(mapped);
+  }
+#ifdef SYS_mbind
+  // placement is only a hint so failure (no NUMA) does not matter
+  if (policy & CoinArrayWithLength::allocateInterleaved) {
+    unsigned long allNodes = ~0UL;
+    if (!syscall(SYS_mbind, base, length, coinMpolInterleave, &allNodes,
+          8 * sizeof(allNodes) + 1, 0)) {
+      if (counter >= 0)
+        countBytes(counter, static_cast< CoinByteArray >(size));
+      counter = CoinArrayWithLength::countInterleaved;
+    }
+  } else if (policy & CoinArrayWithLength::allocateFirstTouch) {
+    if (!syscall(SYS_mbind, base, length, coinMpolLocal, NULL, 0, 0)) {
+      if (counter >= 0)
+        countBytes(counter, static_cast< CoinByteArray >(size));
+      counter = CoinArrayWithLength::countFirstTouch;
+    }
+  }
+#endif
+  countBytes(counter >= 0 ? counter : CoinArrayWithLength::countNormal,
+    static_cast< CoinByteArray >(size));
+  char *array = base + header;
+  size_t *info = reinterpret_cast< size_t * >(array) - 2;
+  info[0] = header;
+  info[1] = length;
+  return array;
+}
+#endif
+}
+// Sets policy arrays are created with
+void CoinArrayWithLength::setDefaultAllocationPolicy(int policy)
+{
+  defaultPolicy = policy;
+}
+// Policy arrays are created with
+int CoinArrayWithLength::defaultAllocationPolicy()
+{
+  return defaultPolicy;
+}
+// Bytes got so far for a counter
+CoinInt64 CoinArrayWithLength::bytesAllocated(int counter)
+{
+  assert(counter >= 0 && counter < numberAllocationCounters);
+  return bytesCounted[counter];
+}
+// Zeroes all counters
+void CoinArrayWithLength::clearAllocationCounters()
+{
+  for (int i = 0; i < numberAllocationCounters; i++)
+    bytesCounted[i] = 0;
+}
+// Gets size bytes as policy_ says and sets offset_
+char *CoinArrayWithLength::newArray(CoinByteArray size)
+{
+  int alignment = alignment_ > 2 ? alignment_ : 0;
+  if (policy_ & allocateAligned)
+    alignment = std::max(alignment, 6);
+#ifdef COIN_ARRAY_MAP
+  if ((policy_ & ~allocateAligned) != 0) {
+    size_t minimum = (policy_ & (allocateHugePages | allocateExplicitHugePages))
+      ? hugePageMinimum
+      : mapMinimum;
+    if (static_cast< size_t >(size) >= minimum) {
+      char *array = mapArray(static_cast< size_t >(size), alignment, policy_);
+      if (array) {
+        offset_ = -1;
+        return array;
+      }
+    }
+  }
+#endif
+  if (alignment) {
+    offset_ = 1 << alignment;
+  } else {
+    offset_ = 0;
+  }
+  char *array = new char[size + offset_];
+  if (offset_) {
+    // need offset
+    CoinInt64 xx = reinterpret_cast< CoinInt64 >(array);
+    int iBottom = static_cast< int >(xx & ((offset_ - 1)));
+    if (iBottom)
+      offset_ = offset_ - iBottom;
+    else
+      offset_ = 0;
+  }
+  if ((policy_ & allocateAligned) && alignment == 6)
+    countBytes(countAligned, size);
+  else
+    countBytes(countNormal, size);
+  return array + offset_;
+}
+// Frees array got by newArray with offset
+void CoinArrayWithLength::deleteArray(char *array, int offset)
+{
+  if (!array)
+    return;
+#ifdef COIN_ARRAY_MAP
+  if (offset < 0) {
+    size_t *info = reinterpret_cast< size_t * >(array) - 2;
+    munmap(array - info[0], info[1]);
+    return;
+  }
+#endif
+  delete[](array - offset);
+}
 // Zero out array
 void CoinArrayWithLength::clear()
 {
@@ -1831,24 +2080,7 @@ void CoinArrayWithLength::clear()
 void CoinArrayWithLength::getArray(CoinByteArray size)
 {
   if (size > 0) {
-    if (alignment_ > 2) {
-      offset_ = 1 << alignment_;
-    } else {
-      offset_ = 0;
-    }
-    char *array = new char[size + offset_];
-    if (offset_) {
-      // need offset
-      CoinInt64 xx = reinterpret_cast< CoinInt64 >(array);
-      int iBottom = static_cast< int >(xx & ((offset_ - 1)));
-      if (iBottom)
-        offset_ = offset_ - iBottom;
-      else
-        offset_ = 0;
-      array_ = array + offset_;
-    } else {
-      array_ = array;
-    }
+    array_ = newArray(size);
     if (size_ != -1)
       size_ = size;
   } else {
@@ -1859,9 +2091,7 @@ void CoinArrayWithLength::getArray(CoinByteArray size)
 void CoinArrayWithLength::conditionalDelete()
 {
   if (size_ == -1) {
-    char *charArray = reinterpret_cast< char * >(array_);
-    if (charArray)
-      delete[](charArray - offset_);
+    deleteArray(array_, offset_);
     array_ = NULL;
   } else if (size_ >= 0) {
     size_ = -size_ - 2;
@@ -1870,9 +2100,7 @@ void CoinArrayWithLength::conditionalDelete()
 // Really get rid of array with alignment
 void CoinArrayWithLength::reallyFreeArray()
 {
-  char *charArray = reinterpret_cast< char * >(array_);
-  if (charArray)
-    delete[](charArray - offset_);
+  deleteArray(array_, offset_);
   array_ = NULL;
   size_ = -1;
 }
@@ -1901,6 +2129,7 @@ void CoinArrayWithLength::getCapacity(CoinByteArray numberBytes, CoinByteArray n
    If abs(mode) >2 then align on that as power of 2
 */
 CoinArrayWithLength::CoinArrayWithLength(CoinByteArray size, int mode)
+  : policy_(defaultAllocationPolicy())
 {
   alignment_ = abs(mode);
   size_ = size;
@@ -1910,8 +2139,7 @@ CoinArrayWithLength::CoinArrayWithLength(CoinByteArray size, int mode)
 }
 CoinArrayWithLength::~CoinArrayWithLength()
 {
-  if (array_)
-    delete[](array_ - offset_);
+  deleteArray(array_, offset_);
 }
 // Conditionally gets new array
 char *
@@ -1929,6 +2157,11 @@ CoinArrayWithLength::conditionalNew(CoinByteArray sizeWanted)
 }
 /* Copy constructor. */
 CoinArrayWithLength::CoinArrayWithLength(const CoinArrayWithLength &rhs)
+  : array_(NULL)
+  , size_(rhs.size_)
+  , offset_(0)
+  , alignment_(rhs.alignment_)
+  , policy_(rhs.policy_)
 {
   assert(capacity() >= 0);
   getArray(rhs.capacity());
@@ -1938,6 +2171,10 @@ CoinArrayWithLength::CoinArrayWithLength(const CoinArrayWithLength &rhs)
 
 /* Copy constructor.2 */
 CoinArrayWithLength::CoinArrayWithLength(const CoinArrayWithLength *rhs)
+  : array_(NULL)
+  , offset_(0)
+  , alignment_(rhs->alignment_)
+  , policy_(rhs->policy_)
 {
   assert(rhs->capacity() >= 0);
   size_ = rhs->size_;
@@ -1986,7 +2223,7 @@ void CoinArrayWithLength::allocate(const CoinArrayWithLength &rhs, CoinByteArray
   } else {
     assert(numberBytes >= 0);
     if (size_ == -1) {
-      delete[] array_;
+      deleteArray(array_, offset_);
       array_ = NULL;
     } else {
       size_ = -1;
@@ -1996,7 +2233,7 @@ void CoinArrayWithLength::allocate(const CoinArrayWithLength &rhs, CoinByteArray
     assert(numberBytes >= 0);
     assert(!array_);
     if (numberBytes)
-      array_ = new char[numberBytes];
+      array_ = newArray(numberBytes);
   }
 }
 // Does what is needed to set persistence
@@ -2006,7 +2243,7 @@ void CoinArrayWithLength::setPersistence(int flag, CoinByteArray currentLength)
     if (size_ == -1) {
       if (currentLength && array_) {
 	if (flag==3) {
-	  delete[](array_ - offset_);
+	  deleteArray(array_, offset_);
 	  getArray(size_);
 	}
         size_ = currentLength;
@@ -2045,10 +2282,12 @@ void CoinArrayWithLength::extend(CoinByteArray newSize)
   assert(size_ >= 0); // not much point otherwise
   if (newSize > size_) {
     char *temp = array_;
+    int tempOffset = offset_;
+    CoinByteArray oldSize = size_;
     getArray(newSize);
     if (temp) {
-      CoinMemcpyN(array_, size_, temp);
-      delete[](temp - offset_);
+      CoinMemcpyN(temp, oldSize, array_);
+      deleteArray(temp, tempOffset);
     }
     size_ = newSize;
   }
@@ -2297,6 +2536,183 @@ int CoinPartitionedVector::scan(int partition, double tolerance)
   numberElementsPartition_[partition] = n;
   return n;
 }
+// Removes elements of a partition with absolute value less than tolerance
+int CoinPartitionedVector::cleanPartition(int partition, double tolerance)
+{
+  assert(packedMode_);
+  assert(partition < COIN_PARTITIONS);
+  int start = startPartition_[partition];
+  double *COIN_RESTRICT elements = elements_ + start;
+  int *COIN_RESTRICT indices = indices_ + start;
+  int number = numberElementsPartition_[partition];
+  int n = 0;
+  for (int i = 0; i < number; i++) {
+    double value = elements[i];
+    elements[i] = 0.0;
+    if (fabs(value) >= tolerance) {
+      elements[n] = value;
+      indices[n++] = indices[i];
+    }
+  }
+  numberElementsPartition_[partition] = n;
+  return n;
+}
+// Does operation with value on elements of a partition
+void CoinPartitionedVector::updatePartition(int partition, int operation,
+  double value)
+{
+  assert(packedMode_);
+  assert(partition < COIN_PARTITIONS);
+  CoinSimdUpdatePacked(operation, numberElementsPartition_[partition], value,
+    COIN_INDEXED_TINY_ELEMENT, COIN_INDEXED_REALLY_TINY_ELEMENT,
+    elements_ + startPartition_[partition]);
+}
+namespace {
+// What to do to each partition
+enum PartitionOperation {
+  partitionScan,
+  partitionClean,
+  partitionUpdate,
+  partitionClear,
+  partitionCopyOut,
+  partitionCopyBack
+};
+struct CoinPartitionInfo {
+  CoinPartitionedVector *vector;
+  PartitionOperation operation;
+  int updateOperation;
+  double value;
+  // for compact - where each partition goes and work area
+  const int *newStart;
+  int *workIndices;
+  double *workElements;
+};
+void partitionTask(void *infoPointer, int which)
+{
+  CoinPartitionInfo *info = static_cast< CoinPartitionInfo * >(infoPointer);
+  CoinPartitionedVector *vector = info->vector;
+  switch (info->operation) {
+  case partitionScan:
+    vector->scan(which, info->value);
+    break;
+  case partitionClean:
+    vector->cleanPartition(which, info->value);
+    break;
+  case partitionUpdate:
+    vector->updatePartition(which, info->updateOperation, info->value);
+    break;
+  case partitionClear:
+    vector->clearPartition(which);
+    break;
+  case partitionCopyOut: {
+    // copy to work area and zero elements beyond new end
+    int start = vector->startPartition(which);
+    int number = vector->getNumElements(which);
+    int newStart = info->newStart[which];
+    double *elements = vector->denseVector() + start;
+    CoinMemcpyN(vector->getIndices() + start, number,
+      info->workIndices + newStart);
+    CoinMemcpyN(elements, number, info->workElements + newStart);
+    int numberElements = info->newStart[vector->getNumPartitions()];
+    int first = CoinMax(numberElements - start, 0);
+    if (first < number)
+      CoinZeroN(elements + first, number - first);
+  } break;
+  case partitionCopyBack: {
+    int newStart = info->newStart[which];
+    int number = info->newStart[which + 1] - newStart;
+    CoinMemcpyN(info->workIndices + newStart, number,
+      vector->getIndices() + newStart);
+    CoinMemcpyN(info->workElements + newStart, number,
+      vector->denseVector() + newStart);
+  } break;
+  }
+}
+// Runs task for each partition
+void runPartitions(CoinThreadPool *pool, CoinPartitionInfo &info)
+{
+  int numberPartitions = info.vector->getNumPartitions();
+  if (pool) {
+    pool->run(numberPartitions, partitionTask, &info);
+  } else {
+    for (int i = 0; i < numberPartitions; i++)
+      partitionTask(&info, i);
+  }
+}
+}
+// Scans all partitions
+int CoinPartitionedVector::scan(CoinThreadPool *pool, double tolerance)
+{
+  assert(packedMode_);
+  CoinPartitionInfo info;
+  info.vector = this;
+  info.operation = partitionScan;
+  info.value = tolerance;
+  runPartitions(pool, info);
+  computeNumberElements();
+  return nElements_;
+}
+// Cleans all partitions
+int CoinPartitionedVector::clean(CoinThreadPool *pool, double tolerance)
+{
+  assert(packedMode_);
+  CoinPartitionInfo info;
+  info.vector = this;
+  info.operation = partitionClean;
+  info.value = tolerance;
+  runPartitions(pool, info);
+  computeNumberElements();
+  return nElements_;
+}
+// Does operation with value on all partitions
+void CoinPartitionedVector::update(CoinThreadPool *pool, int operation,
+  double value)
+{
+  assert(packedMode_);
+  CoinPartitionInfo info;
+  info.vector = this;
+  info.operation = partitionUpdate;
+  info.updateOperation = operation;
+  info.value = value;
+  runPartitions(pool, info);
+}
+// Clears all partitions
+void CoinPartitionedVector::clearAndKeep(CoinThreadPool *pool)
+{
+  assert(packedMode_);
+  CoinPartitionInfo info;
+  info.vector = this;
+  info.operation = partitionClear;
+  runPartitions(pool, info);
+  nElements_ = 0;
+}
+// Packs partitions (through work area) and gets rid of partitions
+void CoinPartitionedVector::compact(CoinThreadPool *pool)
+{
+  if (!numberPartitions_)
+    return;
+  int newStart[COIN_PARTITIONS + 1];
+  newStart[0] = 0;
+  for (int i = 0; i < numberPartitions_; i++)
+    newStart[i + 1] = newStart[i] + numberElementsPartition_[i];
+  int numberElements = newStart[numberPartitions_];
+  CoinPartitionInfo info;
+  info.vector = this;
+  info.newStart = newStart;
+  info.workIndices = new int[numberElements];
+  info.workElements = new double[numberElements];
+  // a partition may be moved on to one not yet copied so two passes
+  info.operation = partitionCopyOut;
+  runPartitions(pool, info);
+  info.operation = partitionCopyBack;
+  runPartitions(pool, info);
+  delete[] info.workIndices;
+  delete[] info.workElements;
+  CoinZeroN(numberElementsPartition_, numberPartitions_);
+  nElements_ = numberElements;
+  packedMode_ = true;
+  numberPartitions_ = 0;
+}
 //  Print out
 void CoinPartitionedVector::print() const
 {
@@ -15,6 +15,8 @@
 #include "CoinHelperFunctions.hpp"
 #include <cassert>
 
+class CoinThreadPool;
+
 #ifndef COIN_FLOAT
 #define COIN_INDEXED_TINY_ELEMENT 1.0e-50
 #define COIN_INDEXED_REALLY_TINY_ELEMENT 1.0e-100
@@ -271,7 +273,9 @@ public:
   inline void checkClear() {};
   inline void checkClean() {};
 #endif
-  /// Scan dense region and set up indices (returns number found)
+  /** Scan dense region and set up indices (returns number found).
+      If the last scan found the vector hyperSparse empty blocks are
+      skipped (see CoinSimdScanSparse) */
   int scan();
   /** Scan dense region from start to < end and set up indices
        returns number found
@@ -303,7 +307,9 @@ public:
   /// Append a CoinPackedVector to the end
   void append(const CoinPackedVectorBase &caboose);
 #endif
-  /// Append a CoinIndexedVector to the end (with extra space)
+  /** Append a CoinIndexedVector to the end (with extra space).
+      If caboose is dense its dense region is swept rather than going
+      through its indices */
   void append(const CoinIndexedVector &caboose);
   /// Append a CoinIndexedVector to the end and modify indices
   void append(CoinIndexedVector &other, int adjustIndex, bool zapElements = false);
@@ -442,6 +448,34 @@ public:
   {
     return packedMode_;
   }
+  /// How full a vector is (chooses loops of scan, append and += / -=)
+  enum Density {
+    /// Fewer than 1/128 of capacity
+    hyperSparse = 0,
+    sparse,
+    /// A third or more of capacity
+    dense
+  };
+  /// Density of number elements out of size
+  static inline Density density(int number, int size)
+  {
+    if (number < size / 128)
+      return hyperSparse;
+    else if (3 * number < size)
+      return sparse;
+    else
+      return dense;
+  }
+  /// Density now
+  inline Density density() const
+  {
+    return density(nElements_, capacity_);
+  }
+  /// Density of part of dense region found by last scan
+  inline Density scanDensity() const
+  {
+    return scanDensity_;
+  }
   //@}
 
   /**@name Constructors and destructors */
@@ -482,6 +516,11 @@ private:
   ///
   void gutsOfSetConstant(int size,
     const int *inds, double value);
+  /** Adds (or subtracts) op2 in place - from its indices or, if it is
+      dense, by sweeping its dense region */
+  void gutsOfAdd(const CoinIndexedVector &op2, bool subtract);
+  /// Drops elements which have become tiny
+  void gutsOfClean();
   //@}
 
 protected:
@@ -499,6 +538,8 @@ protected:
   int offset_;
   /// If true then is operating in packed mode
   bool packedMode_;
+  /// Density found by last scan (sparse until first scan)
+  Density scanDensity_;
   //@}
 };
 
@@ -524,6 +565,10 @@ void CoinIndexedVectorUnitTest();
     and updates number of bytes
     CoinConditionalDelete sets number of bytes = -size-2 and then array 
     returns NULL
+
+    How arrays are got can be changed with an allocation policy (see
+    setAllocationPolicy) - 64 byte alignment, 2MB huge pages and NUMA
+    placement - and bytes got are counted for each policy.
 */
 class COINUTILSLIB_EXPORT CoinArrayWithLength {
 
@@ -591,6 +636,69 @@ public:
   void extend(CoinByteArray newSize);
   //@}
 
+  /**@name Allocation policy
+
+     A policy is a sum of AllocationPolicy values and applies to arrays
+     got from then on.  Huge pages and NUMA placement are for Linux -
+     elsewhere (and if the system refuses) arrays are got as normal.
+     They are only used for large arrays (at least 1MB for huge pages and
+     64KB for NUMA placement) which are then mapped directly rather than
+     taken from the heap.  Counters are kept for all arrays of all
+     classes together.
+  */
+  //@{
+  /// Ways arrays can be got
+  enum AllocationPolicy {
+    /// new [] with alignment from switchOn
+    allocateNormal = 0,
+    /// At least 64 byte (cache line) alignment
+    allocateAligned = 1,
+    /// 2MB transparent huge pages
+    allocateHugePages = 2,
+    /// Explicit (hugetlbfs) 2MB pages - transparent ones if none free
+    allocateExplicitHugePages = 4,
+    /// Pages interleaved over all NUMA nodes
+    allocateInterleaved = 8,
+    /// Pages on NUMA node of thread which first touches them
+    allocateFirstTouch = 16
+  };
+  /// Counters of bytes got
+  enum AllocationCounter {
+    /// Normal new []
+    countNormal = 0,
+    /// Aligned to at least 64 bytes by allocateAligned
+    countAligned,
+    /// Transparent huge pages
+    countHugePages,
+    /// Explicit huge pages
+    countExplicitHugePages,
+    /// Interleaved
+    countInterleaved,
+    /// First touch
+    countFirstTouch,
+    /// Number of counters
+    numberAllocationCounters
+  };
+  /// Sets policy for arrays got from now on
+  inline void setAllocationPolicy(int policy)
+  {
+    policy_ = policy;
+  }
+  /// Gets policy
+  inline int allocationPolicy() const
+  {
+    return policy_;
+  }
+  /// Sets policy arrays are created with
+  static void setDefaultAllocationPolicy(int policy);
+  /// Policy arrays are created with
+  static int defaultAllocationPolicy();
+  /// Bytes got so far for a counter (a huge page array may also be interleaved)
+  static CoinInt64 bytesAllocated(int counter);
+  /// Zeroes all counters
+  static void clearAllocationCounters();
+  //@}
+
   /**@name Condition methods */
   //@{
   /// Conditionally gets new array
@@ -607,6 +715,7 @@ public:
     , size_(-1)
     , offset_(0)
     , alignment_(0)
+    , policy_(defaultAllocationPolicy())
   {
   }
   /** Alternate Constructor - length in bytes - size_ -1 */
@@ -614,6 +723,7 @@ public:
     : size_(-1)
     , offset_(0)
     , alignment_(0)
+    , policy_(defaultAllocationPolicy())
   {
     array_ = new char[size];
   }
@@ -645,16 +755,26 @@ public:
   //@}
 
 protected:
+  /**@name Allocation */
+  //@{
+  /// Gets size bytes as policy_ says and sets offset_
+  char *newArray(CoinByteArray size);
+  /// Frees array got by newArray with offset
+  static void deleteArray(char *array, int offset);
+  //@}
+
   /**@name Private member data */
   //@{
   /// Array
   char *array_;
   /// Size of array in bytes
   CoinByteArray size_;
-  /// Offset of array
+  /// Offset of array (-1 if mapped)
   int offset_;
   /// Alignment wanted (power of 2)
   int alignment_;
+  /// Allocation policy
+  int policy_;
   //@}
 };
 /// double * version
@@ -1362,9 +1482,39 @@ public:
 #endif
   /// Scan dense region and set up indices (returns number found)
   int scan(int partition, double tolerance = 0.0);
-  /** Scan dense region from start to < end and set up indices
-       returns number found
-   */
+  /** Removes elements of a partition with absolute value less than
+      tolerance (rest stay in order).  Returns number left in partition */
+  int cleanPartition(int partition, double tolerance);
+  /** Does operation (CoinSimdOperation) with value on elements of a
+      partition.  As CoinIndexedVector::operator+= etc results which are
+      tiny become COIN_INDEXED_REALLY_TINY_ELEMENT */
+  void updatePartition(int partition, int operation, double value);
+  //@}
+
+  /**@name Operations on all partitions
+
+      Each partition is one task for pool (which may be NULL to do
+      partitions in order).  Partitions do not share any storage so
+      results are the same as doing partitions one at a time.
+  */
+  //@{
+  /// Scans all partitions and returns total number found
+  int scan(CoinThreadPool *pool, double tolerance = 0.0);
+  /// Cleans all partitions and returns total number left
+  int clean(CoinThreadPool *pool, double tolerance);
+  /// clean(tolerance) of CoinIndexedVector (not for partitions)
+  using CoinIndexedVector::clean;
+  /// Does operation (CoinSimdOperation) with value on all partitions
+  void update(CoinThreadPool *pool, int operation, double value);
+  /// As clearAndKeep() a partition at a time
+  void clearAndKeep(CoinThreadPool *pool);
+  /** As compact() - partitions are copied to a work area and back
+      so they can be moved at the same time */
+  void compact(CoinThreadPool *pool);
+  //@}
+
+  /**@name Debug */
+  //@{
   ///  Print out
   void print() const;
   //@}
@@ -25,6 +25,7 @@
 #include "CoinLpIO.hpp"
 #include "CoinMpsIO.hpp"
 #include "CoinFinite.hpp"
+#include "CoinParseNumber.hpp"
 #include "CoinSort.hpp"
 
 #define LPIO_MODIFY_MESSAGES 1
@@ -73,19 +74,6 @@ CoinLpIO::CoinLpIO()
     objName_[j] = NULL;
     objectiveOffset_[j] = 0;
   }
-  card_previous_names_[0] = 0;
-  card_previous_names_[1] = 0;
-  previous_names_[0] = NULL;
-  previous_names_[1] = NULL;
-
-  maxHash_[0] = 0;
-  numberHash_[0] = 0;
-  hash_[0] = NULL;
-  names_[0] = NULL;
-  maxHash_[1] = 0;
-  numberHash_[1] = 0;
-  hash_[1] = NULL;
-  names_[1] = NULL;
   handler_ = new CoinMessageHandler();
   messages_ = CoinMessage();
 }
@@ -129,18 +117,6 @@ CoinLpIO::CoinLpIO(const CoinLpIO &rhs)
     }
     objectiveOffset_[j] = 0;
   }
-  card_previous_names_[0] = 0;
-  card_previous_names_[1] = 0;
-  previous_names_[0] = NULL;
-  previous_names_[1] = NULL;
-  maxHash_[0] = 0;
-  numberHash_[0] = 0;
-  hash_[0] = NULL;
-  names_[0] = NULL;
-  maxHash_[1] = 0;
-  numberHash_[1] = 0;
-  hash_[1] = NULL;
-  names_[1] = NULL;
 
   if (rhs.rowlower_ != NULL || rhs.collower_ != NULL) {
     gutsOfCopy(rhs);
@@ -214,10 +190,6 @@ void CoinLpIO::gutsOfCopy(const CoinLpIO &rhs)
   free(problemName_);
   fileName_ = CoinStrdup(rhs.fileName_);
   problemName_ = CoinStrdup(rhs.problemName_);
-  numberHash_[0] = rhs.numberHash_[0];
-  numberHash_[1] = rhs.numberHash_[1];
-  maxHash_[0] = rhs.maxHash_[0];
-  maxHash_[1] = rhs.maxHash_[1];
   infinity_ = rhs.infinity_;
   numberAcross_ = rhs.numberAcross_;
   for (int j = 0; j < num_objectives_; j++) {
@@ -226,18 +198,9 @@ void CoinLpIO::gutsOfCopy(const CoinLpIO &rhs)
   int section;
 
   for (section = 0; section < 2; section++) {
-    if (numberHash_[section]) {
-      char **names2 = rhs.names_[section];
-      names_[section] = reinterpret_cast< char ** >(malloc(maxHash_[section] * sizeof(char *)));
-      char **names = names_[section];
-      int i;
-
-      for (i = 0; i < numberHash_[section]; i++) {
-        names[i] = CoinStrdup(names2[i]);
-      }
-
-      hash_[section] = new CoinHashLink[maxHash_[section]];
-      std::memcpy(hash_[section], rhs.hash_[section], maxHash_[section] * sizeof(CoinHashLink));
+    if (rhs.names_[section].numberStrings()) {
+      names_[section] = rhs.names_[section];
+      hash_[section] = rhs.hash_[section];
     }
   }
 }
@@ -291,17 +254,7 @@ CoinLpIO::~CoinLpIO()
 /************************************************************************/
 void CoinLpIO::freePreviousNames(const int section)
 {
-
-  int j;
-
-  if (previous_names_[section] != NULL) {
-    for (j = 0; j < card_previous_names_[section]; j++) {
-      free(previous_names_[section][j]);
-    }
-    free(previous_names_[section]);
-  }
-  previous_names_[section] = NULL;
-  card_previous_names_[section] = 0;
+  previous_names_[section].clear();
 } /* freePreviousNames */
 
 /************************************************************************/
@@ -540,7 +493,7 @@ void CoinLpIO::checkRowNames()
 
   int i, nrow = getNumRows();
 
-  if (numberHash_[0] != nrow + 1) {
+  if (names_[0].numberStrings() != nrow + 1) {
     setDefaultRowNames();
     handler_->message(COIN_GENERAL_WARNING, messages_) << "### CoinLpIO::checkRowNames(): non distinct or missing row names or objective function name.\nNow using default row names."
                                                        << CoinMessageEol;
@@ -574,7 +527,7 @@ void CoinLpIO::checkColNames()
 
   int ncol = getNumCols();
 
-  if (numberHash_[1] != ncol) {
+  if (names_[1].numberStrings() != ncol) {
     setDefaultColNames();
     handler_->message(COIN_GENERAL_WARNING, messages_) << "### CoinLpIO::checkColNames(): non distinct or missing column names.\nNow using default column names."
                                                        << CoinMessageEol;
@@ -585,36 +538,36 @@ void CoinLpIO::checkColNames()
 void CoinLpIO::getPreviousRowNames(char const *const *prev,
   int *card_prev) const
 {
-  *card_prev = card_previous_names_[0];
-  prev = previous_names_[0];
+  *card_prev = previous_names_[0].numberStrings();
+  prev = previous_names_[0].stringArray();
 }
 
 /*************************************************************************/
 void CoinLpIO::getPreviousColNames(char const *const *prev,
   int *card_prev) const
 {
-  *card_prev = card_previous_names_[1];
-  prev = previous_names_[1];
+  *card_prev = previous_names_[1].numberStrings();
+  prev = previous_names_[1].stringArray();
 }
 
 /*************************************************************************/
 char const *const *CoinLpIO::getRowNames() const
 {
-  return names_[0];
+  return names_[0].numberStrings() ? names_[0].stringArray() : NULL;
 }
 
 /*************************************************************************/
 char const *const *CoinLpIO::getColNames() const
 {
-  return names_[1];
+  return names_[1].numberStrings() ? names_[1].stringArray() : NULL;
 }
 
 /*************************************************************************/
 const char *CoinLpIO::rowName(int index) const
 {
 
-  if ((names_[0] != NULL) && (index >= 0) && (index < numberRows_ + 1)) {
-    return names_[0][index];
+  if ((index >= 0) && (index < numberRows_ + 1)) {
+    return names_[0].string(index);
   } else {
     return NULL;
   }
@@ -624,8 +577,8 @@ const char *CoinLpIO::rowName(int index) const
 const char *CoinLpIO::columnName(int index) const
 {
 
-  if ((names_[1] != NULL) && (index >= 0) && (index < numberColumns_)) {
-    return names_[1][index];
+  if ((index >= 0) && (index < numberColumns_)) {
+    return names_[1].string(index);
   } else {
     return NULL;
   }
@@ -634,20 +587,12 @@ const char *CoinLpIO::columnName(int index) const
 /*************************************************************************/
 int CoinLpIO::rowIndex(const char *name) const
 {
-
-  if (!hash_[0]) {
-    return -1;
-  }
   return findHash(name, 0);
 }
 
 /*************************************************************************/
 int CoinLpIO::columnIndex(const char *name) const
 {
-
-  if (!hash_[1]) {
-    return -1;
-  }
   return findHash(name, 1);
 }
 
@@ -809,10 +754,10 @@ void CoinLpIO::setLpDataWithoutRowAndColNames(
     integerType_ = 0;
   }
 
-  if ((numberHash_[0] > 0) && (numberHash_[0] != numberRows_ + 1)) {
+  if ((names_[0].numberStrings() > 0) && (names_[0].numberStrings() != numberRows_ + 1)) {
     stopHash(0);
   }
-  if ((numberHash_[1] > 0) && (numberHash_[1] != numberColumns_)) {
+  if ((names_[1].numberStrings() > 0) && (names_[1].numberStrings() != numberColumns_)) {
     stopHash(1);
   }
 } /* SetLpDataWithoutRowAndColNames */
@@ -822,25 +767,19 @@ void CoinLpIO::setDefaultRowNames()
 {
 
   int i, nrow = getNumRows();
-  char **defaultRowNames = reinterpret_cast< char ** >(malloc((nrow + 1) * sizeof(char *)));
+  CoinStringPool defaultRowNames;
   char buff[1024];
 
   for (i = 0; i < nrow; i++) {
     sprintf(buff, "cons%d", i);
-    defaultRowNames[i] = CoinStrdup(buff);
+    defaultRowNames.addString(buff);
   }
-  sprintf(buff, "obj");
-  defaultRowNames[nrow] = CoinStrdup(buff);
+  defaultRowNames.addString("obj");
 
   stopHash(0);
-  startHash(defaultRowNames, nrow + 1, 0);
+  startHash(defaultRowNames, 0);
   objName_[0] = CoinStrdup("obj");
 
-  for (i = 0; i < nrow + 1; i++) {
-    free(defaultRowNames[i]);
-  }
-  free(defaultRowNames);
-
 } /* setDefaultRowNames */
 
 /*************************************************************************/
@@ -848,20 +787,15 @@ void CoinLpIO::setDefaultColNames()
 {
 
   int j, ncol = getNumCols();
-  char **defaultColNames = reinterpret_cast< char ** >(malloc(ncol * sizeof(char *)));
+  CoinStringPool defaultColNames;
   char buff[256];
 
   for (j = 0; j < ncol; j++) {
     sprintf(buff, "x%d", j);
-    defaultColNames[j] = CoinStrdup(buff);
+    defaultColNames.addString(buff);
   }
   stopHash(1);
-  startHash(defaultColNames, ncol, 1);
-
-  for (j = 0; j < ncol; j++) {
-    free(defaultColNames[j]);
-  }
-  free(defaultColNames);
+  startHash(defaultColNames, 1);
 
 } /* setDefaultColNames */
 
@@ -1606,7 +1540,7 @@ int CoinLpIO::are_invalid_names(char const *const *const vnames,
 } /* are_invalid_names */
 
 /*************************************************************************/
-int CoinLpIO::read_monom_obj(double *coeff, char **name, int *cnt,
+int CoinLpIO::read_monom_obj(double *coeff, CoinStringPool &name, int *cnt,
   char **obj_name, int *num_objectives, int *obj_starts)
 {
 
@@ -1685,7 +1619,7 @@ int CoinLpIO::read_monom_obj(double *coeff, char **name, int *cnt,
     while (*temp==' ')
       temp++;
     if (*temp=='+'||*temp=='-') {
-      offset = atof(start);
+      offset = CoinStrtod(start, NULL);
       setObjectiveOffset(-mult*offset);
       start = temp;
       offset = (*temp=='+') ? 1 : -1;
@@ -1697,7 +1631,7 @@ int CoinLpIO::read_monom_obj(double *coeff, char **name, int *cnt,
     }
   }
   if (first_is_number(start)) {
-    coeff[*cnt] = atof(start);
+    coeff[*cnt] = CoinStrtod(start, NULL);
     if ((*cnt)==0&&offset) {
       coeff[*cnt] *= offset;
       bufferPosition_++;
@@ -1745,7 +1679,7 @@ int CoinLpIO::read_monom_obj(double *coeff, char **name, int *cnt,
 	}
 
 	if (first_is_number(start)) {
-	  coefficient = atof(start);
+	  coefficient = CoinStrtod(start, NULL);
 	  sprintf(buff, "aa");
 	  fscanfLpIO(buff);
 	  start = buff;
@@ -1836,10 +1770,10 @@ int CoinLpIO::read_monom_obj(double *coeff, char **name, int *cnt,
   }
 
   coeff[*cnt] *= mult;
-  name[*cnt] = CoinStrdup(loc_name);
+  name.setString(*cnt, loc_name);
 
 #ifdef LPIO_DEBUG
-  printf("read_monom_obj: (%f)  (%s)\n", coeff[*cnt], name[*cnt]);
+  printf("read_monom_obj: (%f)  (%s)\n", coeff[*cnt], name.string(*cnt));
 #endif
 
   (*cnt)++;
@@ -1849,7 +1783,7 @@ int CoinLpIO::read_monom_obj(double *coeff, char **name, int *cnt,
 
 /*************************************************************************/
 int CoinLpIO::read_monom_row(char *start_str,
-  double *coeff, char **name,
+  double *coeff, CoinStringPool &name,
   int cnt_coeff) const
 {
 
@@ -1886,7 +1820,7 @@ int CoinLpIO::read_monom_row(char *start_str,
   }
 
   if (first_is_number(start)) {
-    coeff[cnt_coeff] = atof(start);
+    coeff[cnt_coeff] = CoinStrtod(start, NULL);
     fscanfLpIO(loc_name);
   } else {
     coeff[cnt_coeff] = 1;
@@ -1896,39 +1830,36 @@ int CoinLpIO::read_monom_row(char *start_str,
   coeff[cnt_coeff] *= mult;
 #ifdef KILL_ZERO_READLP
   if (fabs(coeff[cnt_coeff]) > epsilon_)
-    name[cnt_coeff] = CoinStrdup(loc_name);
+    name.setString(cnt_coeff, loc_name);
   else
     read_sense = -2; // effectively zero
 #else
-  name[cnt_coeff] = CoinStrdup(loc_name);
+  name.setString(cnt_coeff, loc_name);
 #endif
 
 #ifdef LPIO_DEBUG
   printf("CoinLpIO: read_monom_row: (%f)  (%s)\n",
-    coeff[cnt_coeff], name[cnt_coeff]);
+    coeff[cnt_coeff], name.string(cnt_coeff));
 #endif
   return (read_sense);
 } /* read_monom_row */
 
 /*************************************************************************/
-void CoinLpIO::realloc_coeff(double **coeff, char ***colNames,
-  int *maxcoeff) const
+void CoinLpIO::realloc_coeff(double **coeff, int *maxcoeff) const
 {
 
   *maxcoeff *= 5;
 
-  *colNames = reinterpret_cast< char ** >(realloc((*colNames), (*maxcoeff + 1) * sizeof(char *)));
   *coeff = reinterpret_cast< double * >(realloc((*coeff), (*maxcoeff + 1) * sizeof(double)));
 
 } /* realloc_coeff */
 
 /*************************************************************************/
-void CoinLpIO::realloc_row(char ***rowNames, CoinBigIndex **start, double **rhs,
+void CoinLpIO::realloc_row(CoinBigIndex **start, double **rhs,
   double **rowlow, double **rowup, int *maxrow) const
 {
 
   *maxrow *= 5;
-  *rowNames = reinterpret_cast< char ** >(realloc((*rowNames), (*maxrow + 1) * sizeof(char *)));
   *start = reinterpret_cast< CoinBigIndex * >(realloc((*start), (*maxrow + 1) * sizeof(CoinBigIndex)));
   *rhs = reinterpret_cast< double * >(realloc((*rhs), (*maxrow + 1) * sizeof(double)));
   *rowlow = reinterpret_cast< double * >(realloc((*rowlow), (*maxrow + 1) * sizeof(double)));
@@ -1956,7 +1887,7 @@ void CoinLpIO::realloc_col(double **collow, double **colup, char **is_int,
 
 /*************************************************************************/
 void CoinLpIO::read_row(char *buff,
-  double **pcoeff, char ***pcolNames,
+  double **pcoeff, CoinStringPool &colNames,
   int *cnt_coeff,
   int *maxcoeff,
   double *rhs, double *rowlow, double *rowup,
@@ -1971,10 +1902,10 @@ void CoinLpIO::read_row(char *buff,
   while (read_sense < 0) {
 
     if ((*cnt_coeff) == (*maxcoeff)) {
-      realloc_coeff(pcoeff, pcolNames, maxcoeff);
+      realloc_coeff(pcoeff, maxcoeff);
     }
     read_sense = read_monom_row(start_str,
-      *pcoeff, *pcolNames, *cnt_coeff);
+      *pcoeff, colNames, *cnt_coeff);
 #ifdef KILL_ZERO_READLP
     if (read_sense != -2) // see if zero
 #endif
@@ -1990,7 +1921,7 @@ void CoinLpIO::read_row(char *buff,
   }
   (*cnt_coeff)--;
 
-  rhs[*cnt_row] = atof(start_str);
+  rhs[*cnt_row] = CoinStrtod(start_str, NULL);
 
   switch (read_sense) {
   case 0:
@@ -2134,9 +2065,10 @@ void CoinLpIO::readLp()
   int num_objectives = 0;
   char *objName[MAX_OBJECTIVES] = { NULL, NULL };
   int obj_starts[MAX_OBJECTIVES + 1];
-  char **colNames = reinterpret_cast< char ** >(malloc((maxcoeff + 1) * sizeof(char *)));
+  // one name for each coefficient
+  CoinStringPool colNames;
   double *coeff = reinterpret_cast< double * >(malloc((maxcoeff + 1) * sizeof(double)));
-  char **rowNames = reinterpret_cast< char ** >(malloc((maxrow + MAX_OBJECTIVES) * sizeof(char *)));
+  CoinStringPool rowNames;
   CoinBigIndex *start = reinterpret_cast< CoinBigIndex * >(malloc((maxrow + MAX_OBJECTIVES) * sizeof(CoinBigIndex)));
   double *rhs = reinterpret_cast< double * >(malloc((maxrow + 1) * sizeof(double)));
   double *rowlow = reinterpret_cast< double * >(malloc((maxrow + 1) * sizeof(double)));
@@ -2151,7 +2083,7 @@ void CoinLpIO::readLp()
     read_st = read_monom_obj(coeff, colNames, &cnt_obj, objName, &num_objectives, obj_starts);
 
     if (cnt_obj == maxcoeff) {
-      realloc_coeff(&coeff, &colNames, &maxcoeff);
+      realloc_coeff(&coeff, &maxcoeff);
     }
   }
 
@@ -2182,34 +2114,35 @@ void CoinLpIO::readLp()
       printf("CoinLpIO::readLp(): rowName[%d]: %s\n", cnt_row, buff);
 #endif
 
-      rowNames[cnt_row] = CoinStrdup(buff);
+      rowNames.addString(buff);
       fscanfLpIO(buff);
     } else {
       char rname[15];
       sprintf(rname, "cons%d", cnt_row);
-      rowNames[cnt_row] = CoinStrdup(rname);
+      rowNames.addString(rname);
     }
     read_row(buff,
-      &coeff, &colNames, &cnt_coeff, &maxcoeff, rhs, rowlow, rowup,
+      &coeff, colNames, &cnt_coeff, &maxcoeff, rhs, rowlow, rowup,
       &cnt_row, lp_inf);
     fscanfLpIO(buff);
     start[cnt_row] = cnt_coeff;
 
     if (cnt_row == maxrow) {
-      realloc_row(&rowNames, &start, &rhs, &rowlow, &rowup, &maxrow);
+      realloc_row(&start, &rhs, &rowlow, &rowup, &maxrow);
     }
   }
 
   numberRows_ = cnt_row;
 
   stopHash(1);
-  startHash(colNames, cnt_coeff, 1);
+  colNames.resize(cnt_coeff);
+  startHash(colNames, 1);
 
   COINColumnIndex icol;
   int read_sense1, read_sense2;
   double bnd1 = 0, bnd2 = 0;
 
-  int maxcol = numberHash_[1] + 100;
+  int maxcol = names_[1].numberStrings() + 100;
 
   double *collow = reinterpret_cast< double * >(malloc((maxcol + 1) * sizeof(double)));
   double *colup = reinterpret_cast< double * >(malloc((maxcol + 1) * sizeof(double)));
@@ -2252,7 +2185,7 @@ void CoinLpIO::readLp()
 	// look for infinity
 	int isInf = is_inf(start_str);
         if (!isInf && first_is_number(start_str)) {
-          bnd1 = mult * atof(start_str);
+          bnd1 = mult * CoinStrtod(start_str, NULL);
           scan_sense = 1;
         } else if (isInf) {
 	  bnd1 = isInf * mult * lp_inf;
@@ -2306,7 +2239,7 @@ void CoinLpIO::readLp()
               }
             }
             if (first_is_number(start_str)) {
-              bnd2 = mult * atof(start_str);
+              bnd2 = mult * CoinStrtod(start_str, NULL);
               fscanfLpIO(buff);
             } else {
               if (is_inf(start_str)) {
@@ -2596,7 +2529,7 @@ void CoinLpIO::readLp()
                       next = buff - 1;
                     }
                   }
-                  double value = atof(next + 1);
+                  double value = CoinStrtod(next + 1, NULL);
                   if (numberEntries == maxEntries) {
                     maxEntries = 2 * maxEntries;
                     double *tempD = new double[maxEntries];
@@ -2712,21 +2645,21 @@ void CoinLpIO::readLp()
   int *ind = reinterpret_cast< int * >(malloc((maxcoeff + 1) * sizeof(int)));
 
   for (i = 0; i < cnt_coeff; i++) {
-    ind[i] = findHash(colNames[i], 1);
+    ind[i] = findHash(colNames.string(i), 1);
 
 #ifdef LPIO_DEBUG
     printf("CoinLpIO::readLp(): name[%d]: (%s)   ind: %d\n",
-      i, colNames[i], ind[i]);
+      i, colNames.string(i), ind[i]);
 #endif
 
     if (ind[i] < 0) {
       char str[8192];
-      sprintf(str, "### ERROR: Hash table: %s not found\n", colNames[i]);
+      sprintf(str, "### ERROR: Hash table: %s not found\n", colNames.string(i));
       throw CoinError(str, "readLp", "CoinLpIO", __FILE__, __LINE__);
     }
   }
 
-  numberColumns_ = numberHash_[1];
+  numberColumns_ = names_[1].numberStrings();
   numberElements_ = cnt_coeff - start[0];
 
   double *obj[MAX_OBJECTIVES];
@@ -2741,10 +2674,10 @@ void CoinLpIO::readLp()
     memset(obj[j], 0, numberColumns_ * sizeof(double));
 
     for (i = obj_starts[j]; i < obj_starts[j + 1]; i++) {
-      icol = findHash(colNames[i], 1);
+      icol = findHash(colNames.string(i), 1);
       if (icol < 0) {
         char str[8192];
-        sprintf(str, "### ERROR: Hash table: %s (obj) not found\n", colNames[i]);
+        sprintf(str, "### ERROR: Hash table: %s (obj) not found\n", colNames.string(i));
         throw CoinError(str, "readLp", "CoinLpIO", __FILE__, __LINE__);
       }
       if (!inRow[icol])
@@ -2829,30 +2762,20 @@ void CoinLpIO::readLp()
 
   for (int j = 0; j < num_objectives; j++) {
     if (objName[j] == NULL) {
-      rowNames[cnt_row + j] = CoinStrdup("obj");
+      rowNames.addString("obj");
     } else {
-      rowNames[cnt_row + j] = CoinStrdup(objName[j]);
+      rowNames.addString(objName[j]);
     }
   }
   // Hash tables for column names are already set up
-  setLpDataRowAndColNames(rowNames, NULL);
+  setLpDataRowAndColNames(rowNames.stringArray(), NULL);
 
-  if (are_invalid_names(names_[1], numberHash_[1], false)) {
+  if (are_invalid_names(names_[1].stringArray(), names_[1].numberStrings(), false)) {
     setDefaultColNames();
     handler_->message(COIN_GENERAL_WARNING, messages_) << "### CoinLpIO::readLp(): Invalid column names\nNow using default column names."
                                                        << CoinMessageEol;
   }
 
-  for (i = 0; i < cnt_coeff; i++) {
-    free(colNames[i]);
-  }
-  free(colNames);
-
-  for (i = 0; i < cnt_row + 1; i++) {
-    free(rowNames[i]);
-  }
-  free(rowNames);
-
   for (int j = 0; j < num_objectives; j++) {
     free(objName[j]);
   }
@@ -2941,36 +2864,6 @@ void CoinLpIO::print() const
 /*************************************************************************/
 // Hash functions slightly modified from CoinMpsIO.cpp
 
-namespace {
-const int mmult[] = {
-  262139, 259459, 256889, 254291, 251701, 249133, 246709, 244247,
-  241667, 239179, 236609, 233983, 231289, 228859, 226357, 223829,
-  221281, 218849, 216319, 213721, 211093, 208673, 206263, 203773,
-  201233, 198637, 196159, 193603, 191161, 188701, 186149, 183761,
-  181303, 178873, 176389, 173897, 171469, 169049, 166471, 163871,
-  161387, 158941, 156437, 153949, 151531, 149159, 146749, 144299,
-  141709, 139369, 136889, 134591, 132169, 129641, 127343, 124853,
-  122477, 120163, 117757, 115361, 112979, 110567, 108179, 105727,
-  103387, 101021, 98639, 96179, 93911, 91583, 89317, 86939, 84521,
-  82183, 79939, 77587, 75307, 72959, 70793, 68447, 66103
-};
-int compute_hash(const char *name, int maxsiz, int length)
-{
-
-  int n = 0;
-  int j;
-
-  const int nEntriesMMult = sizeof(mmult) / sizeof(int);
-
-  for (j = 0; j < length; ++j) {
-    int iname = name[j];
-
-    n += mmult[j % nEntriesMMult] * iname;
-  }
-  return (abs(n) % maxsiz); /* integer abs */
-}
-} // end file-local namespace
-
 /************************************************************************/
 //  startHash.  Creates hash list for names
 //  setup names_[section] with names in the same order as in the parameter,
@@ -2979,133 +2872,39 @@ int compute_hash(const char *name, int maxsiz, int length)
 void CoinLpIO::startHash(char const *const *const names,
   const COINColumnIndex number, int section)
 {
-  maxHash_[section] = 4 * number;
-  int maxhash = maxHash_[section];
-  COINColumnIndex i, ipos, iput;
-
-  names_[section] = reinterpret_cast< char ** >(malloc(maxhash * sizeof(char *)));
-  hash_[section] = new CoinHashLink[maxhash];
-
-  CoinHashLink *hashThis = hash_[section];
-  char **hashNames = names_[section];
-
-  for (i = 0; i < maxhash; i++) {
-    hashThis[i].index = -1;
-    hashThis[i].next = -1;
-  }
-
-  /*
-   * Initialize the hash table.  Only the index of the first name that
-   * hashes to a value is entered in the table; subsequent names that
-   * collide with it are not entered.
-   */
-
-  for (i = 0; i < number; i++) {
-    const char *thisName = names[i];
-    int length = CoinStrlenAsInt(thisName);
-
-    ipos = compute_hash(thisName, maxhash, length);
-    if (hashThis[ipos].index == -1) {
-      hashThis[ipos].index = i; // will be changed below
-    }
-  }
-
-  /*
-   * Now take care of the names that collided in the preceding loop,
-   * by finding some other entry in the table for them.
-   * Since there are as many entries in the table as there are names,
-   * there must be room for them.
-   * Also setting up hashNames.
-   */
-
-  int cnt_distinct = 0;
-
-  iput = -1;
-  for (i = 0; i < number; i++) {
-    const char *thisName = names[i];
-    int length = CoinStrlenAsInt(thisName);
-
-    ipos = compute_hash(thisName, maxhash, length);
-
-    while (1) {
-      COINColumnIndex j1 = hashThis[ipos].index;
-
-      if (j1 == i) {
-
-        // first occurence of thisName in the parameter "names"
-
-        hashThis[ipos].index = cnt_distinct;
-        hashNames[cnt_distinct] = CoinStrdup(thisName);
-        cnt_distinct++;
-        break;
-      } else {
-
-#ifdef LPIO_DEBUG
-        if (j1 > i) {
-          char str[8192];
-          sprintf(str, "### ERROR: Hash table: j1: %d  i: %d\n", j1, i);
-          throw CoinError(str, "startHash", "CoinLpIO", __FILE__, __LINE__);
-        }
-#endif
-
-        if (strcmp(thisName, hashNames[j1]) == 0) {
-
-          // thisName already entered
-
-          break;
-        } else {
-          // Collision; check if thisName already entered
-
-          COINColumnIndex k = hashThis[ipos].next;
-
-          if (k == -1) {
-
-            // thisName not found; enter it
+  CoinStringPool pool;
+  for (int i = 0; i < number; i++)
+    pool.addString(names[i]);
+  startHash(pool, section);
+} /* startHash */
 
-            while (1) {
-              ++iput;
-              if (iput > maxhash) {
-                char str[8192];
-                sprintf(str, "### ERROR: Hash table: too many names\n");
-                throw CoinError(str, "startHash", "CoinLpIO", __FILE__, __LINE__);
-                break;
-              }
-              if (hashThis[iput].index == -1) {
-                break;
-              }
-            }
-            hashThis[ipos].next = iput;
-            hashThis[iput].index = cnt_distinct;
-            hashNames[cnt_distinct] = CoinStrdup(thisName);
-            cnt_distinct++;
-            break;
-          } else {
-            ipos = k;
+void CoinLpIO::startHash(const CoinStringPool &names, int section)
+{
+  COINColumnIndex number = names.numberStrings();
+  CoinStringPool &hashNames = names_[section];
+  CoinNameHash &hash = hash_[section];
+  hashNames.clear();
+  hashNames.reserve(number, names.numberCharacters());
+  hash.clear();
+  hash.reserve(hashNames, number);
 
-            // continue the check with names in collision
-          }
-        }
-      }
-    }
+  // Hash values are in the pool; duplicates are dropped
+  for (COINColumnIndex i = 0; i < number; i++) {
+    if (hash.find(hashNames, names.string(i), names.stringLength(i),
+          names.stringHash(i))
+      < 0)
+      hash.insert(hashNames, hashNames.addString(names, i));
   }
-
-  numberHash_[section] = cnt_distinct;
-
 } /* startHash */
 
 /**************************************************************************/
 //  stopHash.  Deletes hash storage
 void CoinLpIO::stopHash(int section)
 {
-  freePreviousNames(section);
-  previous_names_[section] = names_[section];
-  card_previous_names_[section] = numberHash_[section];
-
-  delete[] hash_[section];
-  hash_[section] = NULL;
+  previous_names_[section].swap(names_[section]);
+  names_[section].clear();
 
-  maxHash_[section] = 0;
-  numberHash_[section] = 0;
+  hash_[section].clear();
 
   if (section == 0) {
     for (int j = 0; j < num_objectives_; j++) {
@@ -3122,98 +2921,18 @@ void CoinLpIO::stopHash(int section)
 COINColumnIndex
 CoinLpIO::findHash(const char *name, int section) const
 {
-  COINColumnIndex found = -1;
-
-  char **names = names_[section];
-  CoinHashLink *hashThis = hash_[section];
-  COINColumnIndex maxhash = maxHash_[section];
-  COINColumnIndex ipos;
-
-  /* default if we don't find anything */
-  if (!maxhash)
-    return -1;
-
-  int length = CoinStrlenAsInt(name);
-
-  ipos = compute_hash(name, maxhash, length);
-  while (1) {
-    COINColumnIndex j1 = hashThis[ipos].index;
-
-    if (j1 >= 0) {
-      char *thisName2 = names[j1];
-
-      if (strcmp(name, thisName2) != 0) {
-        COINColumnIndex k = hashThis[ipos].next;
-
-        if (k != -1)
-          ipos = k;
-        else
-          break;
-      } else {
-        found = j1;
-        break;
-      }
-    } else {
-      found = -1;
-      break;
-    }
-  }
-  return found;
+  return hash_[section].find(names_[section], name);
 } /* findHash */
 
 /*********************************************************************/
 void CoinLpIO::insertHash(const char *thisName, int section)
 {
-
-  int number = numberHash_[section];
-  int maxhash = maxHash_[section];
-
-  CoinHashLink *hashThis = hash_[section];
-  char **hashNames = names_[section];
-
-  int iput = -1;
+  CoinStringPool &hashNames = names_[section];
   int length = CoinStrlenAsInt(thisName);
-
-  int ipos = compute_hash(thisName, maxhash, length);
-
-  while (1) {
-    COINColumnIndex j1 = hashThis[ipos].index;
-
-    if (j1 == -1) {
-      hashThis[ipos].index = number;
-      break;
-    } else {
-      char *thisName2 = hashNames[j1];
-
-      if (strcmp(thisName, thisName2) != 0) {
-        COINColumnIndex k = hashThis[ipos].next;
-
-        if (k == -1) {
-          while (1) {
-            ++iput;
-            if (iput == maxhash) {
-              char str[8192];
-              sprintf(str, "### ERROR: Hash table: too many names\n");
-              throw CoinError(str, "insertHash", "CoinLpIO", __FILE__, __LINE__);
-              break;
-            }
-            if (hashThis[iput].index == -1) {
-              break;
-            }
-          }
-          hashThis[ipos].next = iput;
-          hashThis[iput].index = number;
-          break;
-        } else {
-          ipos = k;
-          /* nothing worked - try it again */
-        }
-      }
-    }
-  }
-
-  hashNames[number] = CoinStrdup(thisName);
-  (numberHash_[section])++;
+  if (hash_[section].find(hashNames, thisName, length,
+        CoinStringPool::hashString(thisName, length))
+    < 0)
+    hash_[section].insert(hashNames, hashNames.addString(thisName, length));
 }
 // Pass in Message handler (not deleted at end)
 void CoinLpIO::passInMessageHandler(CoinMessageHandler *handler)
@@ -20,6 +20,8 @@
 #include "CoinMessage.hpp"
 #include "CoinFileIO.hpp"
 #include "CoinSort.hpp"
+#include "CoinStringPool.hpp"
+#include "CoinNameHash.hpp"
 
 class CoinSet;
 
@@ -127,8 +129,7 @@ public:
   /// Destructor
   ~CoinLpIO();
 
-  /** Free the vector previous_names_[section] and set 
-      card_previous_names_[section] to 0.
+  /** Empty previous_names_[section].
       section = 0 for row names, 
       section = 1 for column names.  
   */
@@ -261,6 +262,13 @@ public:
   /// Get pointer to array[getNumCols()] of column names
   char const *const *getColNames() const;
 
+  /// Row names with objective function name as last entry (section = 0)
+  /// or column names (section = 1) as kept by the object.
+  inline const CoinStringPool &names(int section) const
+  {
+    return names_[section];
+  }
+
   /// Return the row name for the specified index.
   /// Return the objective function name if index = getNumRows().
   /// Return 0 if the index is out of range or if row names are not defined.
@@ -669,38 +677,18 @@ protected:
       read from a file.<BR>
       section = 0 for row names, 
       section = 1 for column names.  */
-  char **previous_names_[2];
-
-  /// card_previous_names_[section] holds the number of entries in the vector
-  /// previous_names_[section].
-  /// section = 0 for row names,
-  /// section = 1 for column names.
-  int card_previous_names_[2];
+  CoinStringPool previous_names_[2];
 
   /// Row names (including objective function name)
   /// and column names (linked to Hash tables).
   /// section = 0 for row names,
   /// section = 1 for column names.
-  char **names_[2];
-
-  typedef struct {
-    int index, next;
-  } CoinHashLink;
-
-  /// Maximum number of entries in a hash table section.
-  /// section = 0 for row names,
-  /// section = 1 for column names.
-  int maxHash_[2];
-
-  /// Number of entries in a hash table section.
-  /// section = 0 for row names,
-  /// section = 1 for column names.
-  int numberHash_[2];
+  CoinStringPool names_[2];
 
   /// Hash tables with two sections.
   /// section = 0 for row names (including objective function name),
   /// section = 1 for column names.
-  mutable CoinHashLink *hash_[2];
+  CoinNameHash hash_[2];
 
   /// Current buffer (needed so can get rid of blanks with :
   mutable char inputBuffer_[1028];
@@ -732,6 +720,9 @@ protected:
     const COINColumnIndex number,
     int section);
 
+  /// As above for names in a pool (hash values are already there).
+  void startHash(const CoinStringPool &names, int section);
+
   /// Delete hash storage. If section = 0, it also frees objName_.
   /// section = 0 for row names,
   /// section = 1 for column names.
@@ -806,21 +797,21 @@ protected:
 
   /// Read a monomial of the objective function.
   /// Return 1 if "subject to" or one of its variants has been read.
-  int read_monom_obj(double *coeff, char **name, int *cnt,
+  int read_monom_obj(double *coeff, CoinStringPool &name, int *cnt,
     char **obj_name, int *num_objectives, int *obj_starts);
 
   /// Read a monomial of a constraint.
   /// Return a positive number if the sense of the inequality has been
   /// read (see method is_sense() for the return code).
   /// Return -1 otherwise.
-  int read_monom_row(char *start_str, double *coeff, char **name,
+  int read_monom_row(char *start_str, double *coeff, CoinStringPool &name,
     int cnt_coeff) const;
 
   /// Reallocate vectors related to number of coefficients.
-  void realloc_coeff(double **coeff, char ***colNames, int *maxcoeff) const;
+  void realloc_coeff(double **coeff, int *maxcoeff) const;
 
   /// Reallocate vectors related to rows.
-  void realloc_row(char ***rowNames, CoinBigIndex **start, double **rhs,
+  void realloc_row(CoinBigIndex **start, double **rhs,
     double **rowlow, double **rowup, int *maxrow) const;
 
   /// Reallocate vectors related to columns.
@@ -828,7 +819,7 @@ protected:
     int *maxcol) const;
 
   /// Read a constraint.
-  void read_row(char *buff, double **pcoeff, char ***pcolNames,
+  void read_row(char *buff, double **pcoeff, CoinStringPool &colNames,
     int *cnt_coeff, int *maxcoeff,
     double *rhs, double *rowlow, double *rowup,
     int *cnt_row, double inf) const;
@@ -290,7 +290,7 @@ CoinModel::CoinModel(const char *fileName, int allowStrings)
     int i;
     for (i = 0; i < numberRows; i++) {
       addRow(rowLength[i], column + rowStart[i],
-        element + rowStart[i], rowLower[i], rowUpper[i], m.rowName(i));
+        element + rowStart[i], rowLower[i], rowUpper[i], NULL);
     }
     int numberIntegers = 0;
     // Now do column part
@@ -304,21 +304,27 @@ CoinModel::CoinModel(const char *fileName, int allowStrings)
       }
     }
     bool quadraticInteger = (numberIntegers != 0) && m.reader()->whichSection() == COIN_QUAD_SECTION;
-    // do names
-    int iRow;
-    for (iRow = 0; iRow < numberRows_; iRow++) {
-      const char *name = m.rowName(iRow);
-      setRowName(iRow, name);
+    // do names - row names are taken over (objective and free rows are at end)
+    {
+      CoinStringPool names;
+      m.swapNames(0, names);
+      names.resize(numberRows_);
+      rowName_.swapNames(names);
     }
     bool ifStrings = (m.numberStringElements() != 0);
     int nChanged = 0;
     int iColumn;
-    for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    if (!ifStrings && !quadraticInteger) {
+      // quadratic part is read with column names so copy then
+      CoinStringPool names;
+      if (m.reader()->whichSection() == COIN_QUAD_SECTION)
+        names = m.names(1);
+      else
+        m.swapNames(1, names);
+      columnName_.swapNames(names);
+    } else {
       // Replace - + or * if strings
-      if (!ifStrings && !quadraticInteger) {
-        const char *name = m.columnName(iColumn);
-        setColumnName(iColumn, name);
-      } else {
+      for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
         assert(strlen(m.columnName(iColumn)) < 100);
         char temp[100];
         strcpy(temp, m.columnName(iColumn));
@@ -1611,8 +1617,6 @@ int CoinModel::packRows()
       rowLower_[n] = rowLower_[iRow];
       rowUpper_[n] = rowUpper_[iRow];
       rowType_[n] = rowType_[iRow];
-      if (doRowNames)
-        rowName_.setName(n, rowName_.getName(iRow));
       newRow[iRow] = n++;
     } else {
       newRow[iRow] = -1;
@@ -1632,8 +1636,14 @@ int CoinModel::packRows()
     numberElements_ = n;
     // now redo
     if (doRowNames) {
-      rowName_.setNumberItems(numberRows_);
-      rowName_.resize(rowName_.maximumItems(), true);
+      int *deleted = new int[numberDeleted];
+      int nDeleted = 0;
+      for (iRow = 0; iRow < numberRows_ + numberDeleted; iRow++) {
+        if (newRow[iRow] < 0)
+          deleted[nDeleted++] = iRow;
+      }
+      rowName_.deleteNames(nDeleted, deleted);
+      delete[] deleted;
     }
     if (hashElements_.numberItems()) {
       hashElements_.setNumberItems(numberElements_);
@@ -1720,8 +1730,6 @@ int CoinModel::packColumns()
       objective_[n] = objective_[iColumn];
       integerType_[n] = integerType_[iColumn];
       columnType_[n] = columnType_[iColumn];
-      if (doColumnNames)
-        columnName_.setName(n, columnName_.getName(iColumn));
       newColumn[iColumn] = n++;
     } else {
       newColumn[iColumn] = -1;
@@ -1741,8 +1749,14 @@ int CoinModel::packColumns()
     numberElements_ = n;
     // now redo
     if (doColumnNames) {
-      columnName_.setNumberItems(numberColumns_);
-      columnName_.resize(columnName_.maximumItems(), true);
+      int *deleted = new int[numberDeleted];
+      int nDeleted = 0;
+      for (iColumn = 0; iColumn < numberColumns_ + numberDeleted; iColumn++) {
+        if (newColumn[iColumn] < 0)
+          deleted[nDeleted++] = iColumn;
+      }
+      columnName_.deleteNames(nDeleted, deleted);
+      delete[] deleted;
     }
     if (hashElements_.numberItems()) {
       hashElements_.setNumberItems(numberElements_);
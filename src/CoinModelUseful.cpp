@@ -80,7 +80,6 @@ const int mmult[] = {
   103387, 101021, 98639, 96179, 93911, 91583, 89317, 86939, 84521,
   82183, 79939, 77587, 75307, 72959, 70793, 68447, 66103
 };
-const int lengthMult = static_cast< int >(sizeof(mmult) / sizeof(int));
 }
 
 //#############################################################################
@@ -91,11 +90,10 @@ const int lengthMult = static_cast< int >(sizeof(mmult) / sizeof(int));
 // Default Constructor
 //-------------------------------------------------------------------
 CoinModelHash::CoinModelHash()
-  : names_(NULL)
-  , hash_(NULL)
+  : names_()
+  , hash_()
   , numberItems_(0)
   , maximumItems_(0)
-  , lastSlot_(-1)
 {
 }
 
@@ -103,19 +101,11 @@ CoinModelHash::CoinModelHash()
 // Copy constructor
 //-------------------------------------------------------------------
 CoinModelHash::CoinModelHash(const CoinModelHash &rhs)
-  : names_(NULL)
-  , hash_(NULL)
+  : names_(rhs.names_)
+  , hash_(rhs.hash_)
   , numberItems_(rhs.numberItems_)
   , maximumItems_(rhs.maximumItems_)
-  , lastSlot_(rhs.lastSlot_)
 {
-  if (maximumItems_) {
-    names_ = new char *[maximumItems_];
-    for (int i = 0; i < maximumItems_; i++) {
-      names_[i] = CoinStrdup(rhs.names_[i]);
-    }
-    hash_ = CoinCopyOfArray(rhs.hash_, 4 * maximumItems_);
-  }
 }
 
 //-------------------------------------------------------------------
@@ -123,10 +113,6 @@ CoinModelHash::CoinModelHash(const CoinModelHash &rhs)
 //-------------------------------------------------------------------
 CoinModelHash::~CoinModelHash()
 {
-  for (int i = 0; i < maximumItems_; i++)
-    free(names_[i]);
-  delete[] names_;
-  delete[] hash_;
 }
 
 //----------------------------------------------------------------
@@ -136,23 +122,10 @@ CoinModelHash &
 CoinModelHash::operator=(const CoinModelHash &rhs)
 {
   if (this != &rhs) {
-    for (int i = 0; i < maximumItems_; i++)
-      free(names_[i]);
-    delete[] names_;
-    delete[] hash_;
+    names_ = rhs.names_;
+    hash_ = rhs.hash_;
     numberItems_ = rhs.numberItems_;
     maximumItems_ = rhs.maximumItems_;
-    lastSlot_ = rhs.lastSlot_;
-    if (maximumItems_) {
-      names_ = new char *[maximumItems_];
-      for (int i = 0; i < maximumItems_; i++) {
-        names_[i] = CoinStrdup(rhs.names_[i]);
-      }
-      hash_ = CoinCopyOfArray(rhs.hash_, 4 * maximumItems_);
-    } else {
-      names_ = NULL;
-      hash_ = NULL;
-    }
   }
   return *this;
 }
@@ -161,6 +134,7 @@ void CoinModelHash::setNumberItems(int number)
 {
   assert(number >= 0 && number <= numberItems_);
   numberItems_ = number;
+  names_.resize(number);
 }
 // Resize hash (also re-hashs)
 void CoinModelHash::resize(int maxItems, bool forceReHash)
@@ -168,140 +142,45 @@ void CoinModelHash::resize(int maxItems, bool forceReHash)
   assert(numberItems_ <= maximumItems_);
   if (maxItems <= maximumItems_ && !forceReHash)
     return;
-  int n = maximumItems_;
   maximumItems_ = maxItems;
-  char **names = new char *[maximumItems_];
-  int i;
-  for (i = 0; i < n; i++)
-    names[i] = names_[i];
-  for (; i < maximumItems_; i++)
-    names[i] = NULL;
-  delete[] names_;
-  names_ = names;
-  delete[] hash_;
-  int maxHash = 4 * maximumItems_;
-  hash_ = new CoinModelHashLink[maxHash];
-  int ipos;
-
-  for (i = 0; i < maxHash; i++) {
-    hash_[i].index = -1;
-    hash_[i].next = -1;
-  }
-
-  /*
-   * Initialize the hash table.  Only the index of the first name that
-   * hashes to a value is entered in the table; subsequent names that
-   * collide with it are not entered.
-   */
-  for (i = 0; i < numberItems_; ++i) {
-    if (names_[i]) {
-      ipos = hashValue(names_[i]);
-      if (hash_[ipos].index == -1) {
-        hash_[ipos].index = i;
-      }
-    }
-  }
-
-  /*
-   * Now take care of the names that collided in the preceding loop,
-   * by finding some other entry in the table for them.
-   * Since there are as many entries in the table as there are names,
-   * there must be room for them.
-   */
-  lastSlot_ = -1;
-  for (i = 0; i < numberItems_; ++i) {
-    if (!names_[i])
-      continue;
-    char *thisName = names[i];
-    ipos = hashValue(thisName);
-
-    while (true) {
-      int j1 = hash_[ipos].index;
-
-      if (j1 == i)
-        break;
-      else {
-        char *thisName2 = names[j1];
-
-        if (strcmp(thisName, thisName2) == 0) {
-          printf("** duplicate name %s\n", names[i]);
-          abort();
-          break;
-        } else {
-          int k = hash_[ipos].next;
-
-          if (k == -1) {
-            while (true) {
-              ++lastSlot_;
-              if (lastSlot_ > numberItems_) {
-                printf("** too many names\n");
-                abort();
-                break;
-              }
-              if (hash_[lastSlot_].index == -1) {
-                break;
-              }
-            }
-            hash_[ipos].next = lastSlot_;
-            hash_[lastSlot_].index = i;
-            break;
-          } else {
-            ipos = k;
-            /* nothing worked - try it again */
-          }
-        }
-      }
+  names_.reserve(maximumItems_, 0);
+  // Hash values are kept with the names so nothing is hashed again
+  hash_.clear();
+  hash_.reserve(names_, maximumItems_);
+  for (int i = 0; i < numberItems_; ++i) {
+    if (names_.string(i) && hash_.insert(names_, i) != i) {
+      printf("** duplicate name %s\n", names_.string(i));
+      abort();
     }
   }
 }
+// Takes names and re-hashes
+void CoinModelHash::swapNames(CoinStringPool &names)
+{
+  names_.swap(names);
+  numberItems_ = names_.numberStrings();
+  resize(std::max(maximumItems_, numberItems_), true);
+}
+// Deletes names and moves rest down
+void CoinModelHash::deleteNames(int number, const int *which)
+{
+  names_.deleteStrings(number, which);
+  numberItems_ = names_.numberStrings();
+  resize(maximumItems_, true);
+}
 // validate
 void CoinModelHash::validateHash() const
 {
   for (int i = 0; i < numberItems_; ++i) {
-    if (names_[i]) {
-      assert(hash(names_[i]) >= 0);
+    if (names_.string(i)) {
+      assert(hash(names_.string(i)) >= 0);
     }
   }
 }
 // Returns index or -1
 int CoinModelHash::hash(const char *name) const
 {
-  int found = -1;
-
-  int ipos;
-
-  /* default if we don't find anything */
-  if (!numberItems_)
-    return -1;
-
-  ipos = hashValue(name);
-  while (true) {
-    int j1 = hash_[ipos].index;
-
-    if (j1 >= 0) {
-      char *thisName2 = names_[j1];
-
-      if (strcmp(name, thisName2) != 0) {
-        int k = hash_[ipos].next;
-
-        if (k != -1)
-          ipos = k;
-        else
-          break;
-      } else {
-        found = j1;
-        break;
-      }
-    } else {
-      int k = hash_[ipos].next;
-
-      if (k != -1)
-        ipos = k;
-      else
-        break;
-    }
-  }
-  return found;
+  return hash_.find(names_, name);
 }
 // Adds to hash
 void CoinModelHash::addHash(int index, const char *name)
@@ -309,75 +188,20 @@ void CoinModelHash::addHash(int index, const char *name)
   // resize if necessary
   if (numberItems_ >= maximumItems_)
     resize(1000 + 3 * numberItems_ / 2);
-  assert(!names_[index]);
-  names_[index] = CoinStrdup(name);
-  int ipos = hashValue(name);
+  assert(!names_.string(index));
+  names_.setString(index, name);
   numberItems_ = std::max(numberItems_, index + 1);
-  if (hash_[ipos].index < 0) {
-    hash_[ipos].index = index;
-  } else {
-    while (true) {
-      int j1 = hash_[ipos].index;
-
-      if (j1 == index)
-        break; // duplicate?
-      else {
-        if (j1 >= 0) {
-          char *thisName2 = names_[j1];
-          if (strcmp(name, thisName2) == 0) {
-            printf("** duplicate name %s\n", names_[index]);
-            abort();
-            break;
-          } else {
-            int k = hash_[ipos].next;
-
-            if (k == -1) {
-              while (true) {
-                ++lastSlot_;
-                if (lastSlot_ > numberItems_) {
-                  printf("** too many names\n");
-                  abort();
-                  break;
-                }
-                if (hash_[lastSlot_].index < 0 && hash_[lastSlot_].next < 0) {
-                  break;
-                }
-              }
-              hash_[ipos].next = lastSlot_;
-              hash_[lastSlot_].index = index;
-              hash_[lastSlot_].next = -1;
-              break;
-            } else {
-              ipos = k;
-            }
-          }
-        } else {
-          //slot available
-          hash_[ipos].index = index;
-        }
-      }
-    }
+  if (hash_.insert(names_, index) != index) {
+    printf("** duplicate name %s\n", name);
+    abort();
   }
 }
 // Deletes from hash
 void CoinModelHash::deleteHash(int index)
 {
-  if (index < numberItems_ && names_[index]) {
-
-    int ipos = hashValue(names_[index]);
-
-    while (ipos >= 0) {
-      int j1 = hash_[ipos].index;
-      if (j1 != index) {
-        ipos = hash_[ipos].next;
-      } else {
-        hash_[ipos].index = -1; // available
-        break;
-      }
-    }
-    assert(ipos >= 0);
-    free(names_[index]);
-    names_[index] = NULL;
+  if (index < numberItems_ && names_.string(index)) {
+    hash_.remove(names_, index);
+    names_.removeString(index);
   }
 }
 // Returns name at position (or NULL)
@@ -385,7 +209,7 @@ const char *
 CoinModelHash::name(int which) const
 {
   if (which < numberItems_)
-    return names_[which];
+    return names_.string(which);
   else
     return NULL;
 }
@@ -394,35 +218,19 @@ char *
 CoinModelHash::getName(int which) const
 {
   if (which < numberItems_)
-    return names_[which];
+    return const_cast< char * >(names_.string(which));
   else
     return NULL;
 }
 // Sets name at position (does not create)
-void CoinModelHash::setName(int which, char *name)
-{
-  if (which < numberItems_)
-    names_[which] = name;
-}
-// Returns a hash value
-int CoinModelHash::hashValue(const char *name) const
+void CoinModelHash::setName(int which, const char *name)
 {
-
-  int n = 0;
-  int j;
-  int length = static_cast< int >(strlen(name));
-  // may get better spread with unsigned
-  const unsigned char *name2 = reinterpret_cast< const unsigned char * >(name);
-  while (length) {
-    int length2 = std::min(length, lengthMult);
-    for (j = 0; j < length2; ++j) {
-      n += mmult[j] * name2[j];
-    }
-    name += length2;
-    length -= length2;
+  if (which < numberItems_) {
+    if (name)
+      names_.setString(which, name);
+    else
+      names_.removeString(which);
   }
-  int maxHash = 4 * maximumItems_;
-  return (abs(n) % maxHash); /* integer abs */
 }
 //#############################################################################
 // Constructors / Destructor / Assignment
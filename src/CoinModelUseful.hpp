@@ -15,6 +15,8 @@
 
 #include "CoinTypes.h"
 #include "CoinPragma.hpp"
+#include "CoinStringPool.hpp"
+#include "CoinNameHash.hpp"
 
 /**
    This is for various structures/classes needed by CoinModel.
@@ -253,9 +255,17 @@ public:
   }
   /// Names
   inline const char *const *names() const
+  {
+    return names_.stringArray();
+  }
+  /// Names as a pool
+  inline const CoinStringPool &namePool() const
   {
     return names_;
   }
+  /** Exchanges names with names (no copying) and re-hashes - so a
+      model can take over names read by CoinMpsIO */
+  void swapNames(CoinStringPool &names);
   //@}
 
   /**@name hashing */
@@ -268,32 +278,29 @@ public:
   void deleteHash(int index);
   /// Returns name at position (or NULL)
   const char *name(int which) const;
-  /// Returns non const name at position (or NULL)
+  /** Returns non const name at position (or NULL).  Characters must
+      not be changed - name stays where it is until it is replaced */
   char *getName(int which) const;
-  /// Sets name at position (does not create)
-  void setName(int which, char *name);
+  /** Sets name at position (does not create).  Copies name (which may be
+      another name of this) and does not re-hash */
+  void setName(int which, const char *name);
+  /// Deletes number names (which need not be sorted), moves rest down and re-hashes
+  void deleteNames(int number, const int *which);
   /// Validates
   void validateHash() const;
 
-private:
-  /// Returns a hash value
-  int hashValue(const char *name) const;
-
-public:
   //@}
 private:
   /**@name Data members */
   //@{
-  /// Names
-  char **names_;
+  /// Names (with hash values)
+  CoinStringPool names_;
   /// hash
-  CoinModelHashLink *hash_;
+  CoinNameHash hash_;
   /// Number of items
   int numberItems_;
   /// Maximum number of items
   int maximumItems_;
-  /// Last slot looked at
-  int lastSlot_;
   //@}
 };
 /// For int,int hashing
@@ -21,20 +21,12 @@
 #include "CoinMessage.hpp"
 #include "CoinHelperFunctions.hpp"
 #include "CoinModel.hpp"
+#include "CoinParseNumber.hpp"
 #include "CoinSort.hpp"
+#include "CoinThreadPool.hpp"
 //#############################################################################
 // type - 0 normal, 1 INTEL IEEE, 2 other IEEE
 
-namespace {
-
-const double fraction[] = { 1.0, 1.0e-1, 1.0e-2, 1.0e-3, 1.0e-4, 1.0e-5, 1.0e-6, 1.0e-7, 1.0e-8,
-  1.0e-9, 1.0e-10, 1.0e-11, 1.0e-12, 1.0e-13, 1.0e-14, 1.0e-15, 1.0e-16,
-  1.0e-17, 1.0e-18, 1.0e-19, 1.0e-20, 1.0e-21, 1.0e-22, 1.0e-23 };
-
-const double exponent[] = { 1.0e-9, 1.0e-8, 1.0e-7, 1.0e-6, 1.0e-5, 1.0e-4, 1.0e-3, 1.0e-2, 1.0e-1,
-  1.0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9 };
-
-} // end file-local namespace
 double CoinMpsCardReader::osi_strtod(char *ptr, char **output, int type)
 {
 
@@ -56,83 +48,25 @@ double CoinMpsCardReader::osi_strtod(char *ptr, char **output, int type)
     // more white space
     while (*ptr == ' ' || *ptr == '\t')
       ptr++;
-    char thisChar = 0;
-    while (value < 1.0e30) {
-      thisChar = *ptr;
-      ptr++;
-      if (thisChar >= '0' && thisChar <= '9')
-        value = value * 10.0 + thisChar - '0';
-      else
-        break;
-    }
-    if (value < 1.0e30) {
-      if (thisChar == '.') {
-        // do fraction
-        double value2 = 0.0;
-        int nfrac = 0;
-        while (nfrac < 24) {
-          thisChar = *ptr;
-          ptr++;
-          if (thisChar >= '0' && thisChar <= '9') {
-            value2 = value2 * 10.0 + thisChar - '0';
-            nfrac++;
-          } else {
-            break;
-          }
-        }
-        if (nfrac < 24) {
-          value += value2 * fraction[nfrac];
-        } else {
-          thisChar = 'x'; // force error
-        }
-      }
-      if (thisChar == 'e' || thisChar == 'E') {
-        // exponent
-        int sign2 = 1;
-        // do + or -
-        if (*ptr == '-') {
-          sign2 = -1;
-          ptr++;
-        } else if (*ptr == '+') {
-          ptr++;
-        }
-        int value3 = 0;
-        while (value3 < 1000) {
-          thisChar = *ptr;
-          ptr++;
-          if (thisChar >= '0' && thisChar <= '9') {
-            value3 = value3 * 10 + thisChar - '0';
-          } else {
-            break;
-          }
-        }
-        if (value3 < 300) {
-          value3 *= sign2; // power of 10
-          if (abs(value3) < 10) {
-            // do most common by lookup (for accuracy?)
-            value *= exponent[value3 + 9];
-          } else {
-            value *= pow(10.0, value3);
-          }
-        } else if (sign2 < 0.0) {
-          value = 0.0; // force zero
-        } else {
-          value = COIN_DBL_MAX;
-        }
-      }
-      if (thisChar == 0 || thisChar == '\t' || thisChar == ' ') {
-        // okay
-        *output = ptr;
-      } else {
-        value = osi_strtod(save, output);
-        sign1 = 1.0;
-      }
+    const char *after;
+    bool okay;
+    if ((*ptr >= '0' && *ptr <= '9') || *ptr == '.') {
+      after = CoinParseDouble(ptr, ptr + strlen(ptr), value);
+      okay = after > ptr && (*after == '\0' || *after == '\t' || *after == ' ');
+    } else {
+      // nothing there counts as zero
+      after = ptr + 1;
+      okay = !*ptr;
+    }
+    if (okay) {
+      // okay
+      *output = const_cast< char * >(after);
+      if (value > COIN_DBL_MAX)
+        value = COIN_DBL_MAX;
+      value *= sign1;
     } else {
-      // bad value
       value = osi_strtod(save, output);
-      sign1 = 1.0;
     }
-    value *= sign1;
   } else {
     // ieee - 3 bytes go to 2
     assert(sizeof(double) == 8 * sizeof(char));
@@ -275,7 +209,19 @@ const static char *mpsTypes[] = {
 int CoinMpsCardReader::cleanCard()
 {
   char *getit;
-  getit = input_->gets(card_, MAX_CARD_LENGTH);
+  if (input_->mapped()) {
+    // line is looked at in mapping and just card copied
+    int length;
+    const char *line = input_->nextLine(length, MAX_CARD_LENGTH - 1);
+    getit = NULL;
+    if (line) {
+      memcpy(card_, line, length);
+      card_[length] = '\0';
+      getit = card_;
+    }
+  } else {
+    getit = input_->gets(card_, MAX_CARD_LENGTH);
+  }
 
   if (getit) {
     cardNumber_++;
@@ -459,6 +405,29 @@ CoinMpsCardReader::CoinMpsCardReader(CoinFileInput *input,
   memset(valueString_, 0, COIN_MAX_FIELD_LENGTH);
   stringsAllowed_ = false;
 }
+// Constructor for reading part of a section
+CoinMpsCardReader::CoinMpsCardReader(CoinFileInput *input,
+  const CoinMpsCardReader &format)
+{
+  memset(card_, 0, MAX_CARD_LENGTH);
+  position_ = card_;
+  eol_ = card_;
+  mpsType_ = COIN_UNKNOWN_MPS_TYPE;
+  memset(rowName_, 0, COIN_MAX_FIELD_LENGTH);
+  memset(columnName_, 0, COIN_MAX_FIELD_LENGTH);
+  value_ = 0.0;
+  input_ = input;
+  section_ = format.section_;
+  cardNumber_ = 0;
+  freeFormat_ = format.freeFormat_;
+  ieeeFormat_ = format.ieeeFormat_;
+  eightChar_ = format.eightChar_;
+  reader_ = format.reader_;
+  handler_ = format.handler_;
+  messages_ = format.messages_;
+  memset(valueString_, 0, COIN_MAX_FIELD_LENGTH);
+  stringsAllowed_ = format.stringsAllowed_;
+}
 //  ~CoinMpsCardReader.  Destructor
 CoinMpsCardReader::~CoinMpsCardReader()
 {
@@ -1033,8 +1002,10 @@ int CoinMpsCardReader::nextGmsField(int expectedType)
             strcpy(rowName_, position_);
             next = eol_;
           }
-          value_ = -1.0e100;
-          sscanf(rowName_, "%lg", &value_);
+          char *after;
+          value_ = CoinStrtod(rowName_, &after);
+          if (after == rowName_)
+            value_ = -1.0e100;
           position_ = next;
         } else {
           returnCode = 1;
@@ -1084,8 +1055,10 @@ int CoinMpsCardReader::nextGmsField(int expectedType)
               assert(*next == '*');
               next++;
               rowName_[put] = '\0';
-              value_ = -1.0e100;
-              sscanf(rowName_, "%lg", &value_);
+              char *after;
+              value_ = CoinStrtod(rowName_, &after);
+              if (after == rowName_)
+                value_ = -1.0e100;
               position_ = next;
             } else {
               returnCode = 1;
@@ -1101,8 +1074,10 @@ int CoinMpsCardReader::nextGmsField(int expectedType)
             int length = static_cast< int >(next - position_);
             strncpy(rowName_, position_, length);
             rowName_[length] = '\0';
-            value_ = -1.0e100;
-            sscanf(rowName_, "%lg", &value_);
+            char *after;
+            value_ = CoinStrtod(rowName_, &after);
+            if (after == rowName_)
+              value_ = -1.0e100;
             position_ = next;
           }
         } else if ((nextChar >= 'a' && nextChar <= 'z') || (nextChar >= 'A' && nextChar <= 'Z')) {
@@ -1193,186 +1168,44 @@ int CoinMpsCardReader::nextGmsField(int expectedType)
 
 //#############################################################################
 
-namespace {
-const int mmult[] = {
-  262139, 259459, 256889, 254291, 251701, 249133, 246709, 244247,
-  241667, 239179, 236609, 233983, 231289, 228859, 226357, 223829,
-  221281, 218849, 216319, 213721, 211093, 208673, 206263, 203773,
-  201233, 198637, 196159, 193603, 191161, 188701, 186149, 183761,
-  181303, 178873, 176389, 173897, 171469, 169049, 166471, 163871,
-  161387, 158941, 156437, 153949, 151531, 149159, 146749, 144299,
-  141709, 139369, 136889, 134591, 132169, 129641, 127343, 124853,
-  122477, 120163, 117757, 115361, 112979, 110567, 108179, 105727,
-  103387, 101021, 98639, 96179, 93911, 91583, 89317, 86939, 84521,
-  82183, 79939, 77587, 75307, 72959, 70793, 68447, 66103
-};
-
-int hash(const char *name, int maxsiz, int length)
-{
-
-  int n = 0;
-  int j;
-
-  for (j = 0; j < length; ++j) {
-    int iname = name[j];
-
-    n += mmult[j % (sizeof(mmult)/sizeof(int)) ] * iname;
-  }
-  return (abs(n) % maxsiz); /* integer abs */
-}
-} // end file-local namespace
-
 // Define below if you are reading a Cnnnnnn file
 // Will not do row names (for electricfence)
 //#define NONAMES
 #ifndef NONAMES
 //  startHash.  Creates hash list for names
-void CoinMpsIO::startHash(char **names, const COINColumnIndex number, int section)
-{
-  names_[section] = names;
-  numberHash_[section] = number;
-  startHash(section);
-}
 void CoinMpsIO::startHash(int section) const
 {
-  char **names = names_[section];
-  COINColumnIndex number = numberHash_[section];
-  COINColumnIndex i;
-  COINColumnIndex maxhash = 4 * number;
-  COINColumnIndex ipos, iput;
-
-  //hash_=(CoinHashLink *) malloc(maxhash*sizeof(CoinHashLink));
-  hash_[section] = new CoinHashLink[maxhash];
-
-  CoinHashLink *hashThis = hash_[section];
-
-  for (i = 0; i < maxhash; i++) {
-    hashThis[i].index = -1;
-    hashThis[i].next = -1;
-  }
+  const CoinStringPool &names = names_[section];
+  CoinNameHash &hash = hash_[section];
+  int number = names.numberStrings();
 
   /*
-   * Initialize the hash table.  Only the index of the first name that
-   * hashes to a value is entered in the table; subsequent names that
-   * collide with it are not entered.
+   * Hash values were computed when names went into the pool.  For a
+   * duplicate name only the first is entered in the table.
    */
-  for (i = 0; i < number; ++i) {
-    char *thisName = names[i];
-    int length = static_cast< int >(strlen(thisName));
-
-    ipos = hash(thisName, maxhash, length);
-    if (hashThis[ipos].index == -1) {
-      hashThis[ipos].index = i;
-    }
-  }
-
-  /*
-   * Now take care of the names that collided in the preceding loop,
-   * by finding some other entry in the table for them.
-   * Since there are as many entries in the table as there are names,
-   * there must be room for them.
-   */
-  iput = -1;
-  for (i = 0; i < number; ++i) {
-    char *thisName = names[i];
-    int length = static_cast< int >(strlen(thisName));
-
-    ipos = hash(thisName, maxhash, length);
-
-    while (1) {
-      COINColumnIndex j1 = hashThis[ipos].index;
-
-      if (j1 == i)
-        break;
-      else {
-        char *thisName2 = names[j1];
-
-        if (strcmp(thisName, thisName2) == 0) {
-          printf("** duplicate name %s\n", names[i]);
-          break;
-        } else {
-          COINColumnIndex k = hashThis[ipos].next;
-
-          if (k == -1) {
-            while (1) {
-              ++iput;
-              if (iput > number) {
-                printf("** too many names\n");
-                break;
-              }
-              if (hashThis[iput].index == -1) {
-                break;
-              }
-            }
-            hashThis[ipos].next = iput;
-            hashThis[iput].index = i;
-            break;
-          } else {
-            ipos = k;
-            /* nothing worked - try it again */
-          }
-        }
-      }
-    }
+  hash.clear();
+  hash.reserve(names, number);
+  for (int i = 0; i < number; ++i) {
+    if (names.stringLength(i) >= 0 && hash.insert(names, i) != i)
+      printf("** duplicate name %s\n", names.string(i));
   }
 }
 
 //  stopHash.  Deletes hash storage
 void CoinMpsIO::stopHash(int section)
 {
-  delete[] hash_[section];
-  hash_[section] = NULL;
+  hash_[section].clear();
 }
 
 //  findHash.  -1 not found
 COINColumnIndex
 CoinMpsIO::findHash(const char *name, int section) const
 {
-  COINColumnIndex found = -1;
-
-  char **names = names_[section];
-  CoinHashLink *hashThis = hash_[section];
-  COINColumnIndex maxhash = 4 * numberHash_[section];
-  COINColumnIndex ipos;
-
-  /* default if we don't find anything */
-  if (!maxhash)
-    return -1;
-  int length = static_cast< int >(strlen(name));
-
-  ipos = hash(name, maxhash, length);
-  while (1) {
-    COINColumnIndex j1 = hashThis[ipos].index;
-
-    if (j1 >= 0) {
-      char *thisName2 = names[j1];
-
-      if (strcmp(name, thisName2) != 0) {
-        COINColumnIndex k = hashThis[ipos].next;
-
-        if (k != -1)
-          ipos = k;
-        else
-          break;
-      } else {
-        found = j1;
-        break;
-      }
-    } else {
-      found = -1;
-      break;
-    }
-  }
-  return found;
+  return hash_[section].find(names_[section], name);
 }
 #else
 // Version when we know images are C/Rnnnnnn
 //  startHash.  Creates hash list for names
-void CoinMpsIO::startHash(char **names, const COINColumnIndex number, int section)
-{
-  numberHash_[section] = number;
-  names_[section] = names;
-}
 void CoinMpsIO::startHash(int section) const
 {
 }
@@ -1388,7 +1221,7 @@ CoinMpsIO::findHash(const char *name, int section) const
 {
   COINColumnIndex found = atoi(name + 1);
   if (!strcmp(name, "OBJROW"))
-    found = numberHash_[section] - 1;
+    found = names_[section].numberStrings() - 1;
   return found;
 }
 #endif
@@ -1485,7 +1318,10 @@ int CoinMpsIO::dealWithFileName(const char *filename, const char *extension,
         if (!readable)
           goodFile = -1;
         else {
-          input = CoinFileInput::create(fname);
+          if (mappedFiles_)
+            input = CoinFileInput::createMapped(fname);
+          else
+            input = CoinFileInput::create(fname);
           goodFile = 1;
         }
       } else {
@@ -1582,6 +1418,471 @@ int CoinMpsIO::readMps()
   delete[] sets;
   return returnCode;
 }
+//-----------------------------------------------------------------------------
+// Reading COLUMNS section in chunks
+//-----------------------------------------------------------------------------
+
+// One chunk of COLUMNS section
+struct CoinMpsIO::ColumnsChunk {
+  /// Reader (for row names and sizes)
+  const CoinMpsIO *model;
+  /// Card reader with section and format at start of section
+  const CoinMpsCardReader *format;
+  /// Text of chunk
+  const char *data;
+  size_t size;
+  /// Format at start (a guess until checked) and at end
+  bool freeFormat;
+  bool eightChar;
+  bool endFreeFormat;
+  bool endEightChar;
+  /// Whether chunk is up to date (task does nothing)
+  bool done;
+  /// Whether to copy out to final arrays instead of reading
+  bool copyOut;
+  /// Whether serial reading would give an error or do something different
+  bool failed;
+  /// Number of cards read
+  CoinBigIndex numberCards;
+  /// Columns before first integer marker (they carry on state)
+  int numberBeforeMarker;
+  /// State of integer markers at end (-1 if no marker)
+  int integerAtEnd;
+  /// Marks of rows in column for each thread (one bit per row)
+  unsigned char **marks;
+  /// Columns
+  std::vector< COINMpsType > columnType;
+  CoinStringPool columnName;
+  std::vector< double > objective;
+  std::vector< CoinBigIndex > start;
+  /// Elements
+  std::vector< COINRowIndex > row;
+  std::vector< double > element;
+  /// Where to copy out (with offsets of this chunk)
+  COINColumnIndex columnOffset;
+  CoinBigIndex elementOffset;
+  COINMpsType *toColumnType;
+  double *toObjective;
+  CoinBigIndex *toStart;
+  COINRowIndex *toRow;
+  double *toElement;
+
+  /// Empties chunk
+  void clear()
+  {
+    columnType.clear();
+    columnName.clear();
+    objective.clear();
+    start.clear();
+    row.clear();
+    element.clear();
+  }
+};
+
+// Reads (or copies out) a chunk
+void CoinMpsIO::readColumnsTask(void *info, int which)
+{
+  ColumnsChunk &chunk = static_cast< ColumnsChunk * >(info)[which];
+  if (chunk.done)
+    return;
+  chunk.done = true;
+  if (chunk.copyOut) {
+    COINColumnIndex numberColumns = static_cast< COINColumnIndex >(chunk.start.size());
+    CoinBigIndex numberElements = static_cast< CoinBigIndex >(chunk.row.size());
+    for (COINColumnIndex i = 0; i < numberColumns; i++) {
+      int iColumn = chunk.columnOffset + i;
+      chunk.toColumnType[iColumn] = chunk.columnType[i];
+      chunk.toObjective[iColumn] = chunk.objective[i];
+      chunk.toStart[iColumn] = chunk.start[i] + chunk.elementOffset;
+    }
+    if (numberElements) {
+      memcpy(chunk.toRow + chunk.elementOffset, &chunk.row[0],
+        numberElements * sizeof(COINRowIndex));
+      memcpy(chunk.toElement + chunk.elementOffset, &chunk.element[0],
+        numberElements * sizeof(double));
+    }
+    return;
+  }
+  chunk.clear();
+  chunk.failed = false;
+  const CoinMpsIO *model = chunk.model;
+  int numberRows = model->numberRows_;
+  double smallElement = model->smallElement_;
+  CoinMpsCardReader reader(CoinFileInput::createFromMemory(chunk.data,
+                             chunk.size),
+    *chunk.format);
+  reader.setFreeFormat(chunk.freeFormat);
+  reader.setEightChar(chunk.eightChar);
+  unsigned char *&mark = chunk.marks[CoinThreadPool::threadIndex()];
+  if (!mark) {
+    mark = new unsigned char[(numberRows + 8) / 8];
+    memset(mark, 0, (numberRows + 8) / 8);
+  }
+  char lastColumn[200];
+  memset(lastColumn, '\0', 200);
+  bool objUsed = false;
+  int integerState = -1;
+  chunk.numberBeforeMarker = -1;
+  CoinBigIndex columnStart = 0;
+  COINSectionType section;
+  while (!chunk.failed && (section = reader.nextField()) == COIN_COLUMN_SECTION) {
+    switch (reader.mpsType()) {
+    case COIN_BLANK_COLUMN:
+      if (strcmp(lastColumn, reader.columnName())) {
+        // new column - unmark rows of old one
+        for (size_t i = columnStart; i < chunk.row.size(); i++) {
+          COINRowIndex iRow = chunk.row[i];
+          mark[iRow >> 3] = static_cast< unsigned char >(mark[iRow >> 3] & ~(1 << (iRow & 7)));
+        }
+        objUsed = false;
+        columnStart = static_cast< CoinBigIndex >(chunk.row.size());
+        chunk.columnType.push_back(integerState == 1 ? COIN_INTORG : COIN_UNSET_BOUND);
+#ifndef NONAMES
+        chunk.columnName.addString(reader.columnName());
+#else
+        chunk.columnName.resize(chunk.columnName.numberStrings() + 1);
+#endif
+        strcpy(lastColumn, reader.columnName());
+        chunk.objective.push_back(0.0);
+        chunk.start.push_back(columnStart);
+      }
+      if (fabs(reader.value()) > smallElement) {
+        COINRowIndex iRow = model->findHash(reader.rowName(), 0);
+        double value = reader.value();
+        if (iRow < 0) {
+          chunk.failed = true;
+        } else if (iRow == numberRows) {
+          // objective
+          if (objUsed)
+            chunk.failed = true;
+          objUsed = true;
+          value += chunk.objective.back();
+          if (fabs(value) <= smallElement)
+            value = 0.0;
+          chunk.objective.back() = value;
+        } else if (iRow < numberRows) {
+          // other free rows will just be discarded so won't get here
+          if (mark[iRow >> 3] & (1 << (iRow & 7))) {
+            // duplicate
+            chunk.failed = true;
+          } else {
+            mark[iRow >> 3] = static_cast< unsigned char >(mark[iRow >> 3] | (1 << (iRow & 7)));
+            chunk.row.push_back(iRow);
+            chunk.element.push_back(value);
+          }
+        }
+      } else if (reader.value() == STRING_VALUE) {
+        chunk.failed = true;
+      }
+      break;
+    case COIN_INTORG:
+    case COIN_INTEND:
+      if (integerState < 0)
+        chunk.numberBeforeMarker = static_cast< int >(chunk.start.size());
+      integerState = reader.mpsType() == COIN_INTORG ? 1 : 0;
+      break;
+    default:
+      chunk.failed = true;
+      break;
+    }
+  }
+  // section card inside chunk would also be wrong
+  if (!chunk.failed && section != COIN_EOF_SECTION)
+    chunk.failed = true;
+  for (size_t i = columnStart; i < chunk.row.size(); i++) {
+    COINRowIndex iRow = chunk.row[i];
+    mark[iRow >> 3] = static_cast< unsigned char >(mark[iRow >> 3] & ~(1 << (iRow & 7)));
+  }
+  if (chunk.numberBeforeMarker < 0)
+    chunk.numberBeforeMarker = static_cast< int >(chunk.start.size());
+  chunk.integerAtEnd = integerState;
+  chunk.numberCards = reader.cardNumber();
+  chunk.endFreeFormat = reader.freeFormat();
+  chunk.endEightChar = reader.eightChar();
+}
+
+namespace {
+// Looking for end of a section in part of a mapped file
+struct CoinMpsScanInfo {
+  const char *data;
+  // range of section to look in and end of file
+  size_t begin;
+  size_t end;
+  size_t fileEnd;
+  int numberTasks;
+  // for each task first section card found (or fileEnd)
+  size_t *sectionStart;
+  // and whether a card before it is too long to be read in one go
+  bool *longCard;
+};
+
+// Finds first section card starting in part which of range
+void scanForSectionTask(void *infoPointer, int which)
+{
+  CoinMpsScanInfo *info = static_cast< CoinMpsScanInfo * >(infoPointer);
+  const char *data = info->data;
+  size_t fileEnd = info->fileEnd;
+  size_t length = info->end - info->begin;
+  size_t first = info->begin + (length * which) / info->numberTasks;
+  size_t last = info->begin + (length * (which + 1)) / info->numberTasks;
+  info->sectionStart[which] = fileEnd;
+  info->longCard[which] = false;
+  // to start of first line at or after first
+  size_t lineStart = first;
+  if (which) {
+    const char *newline = static_cast< const char * >(memchr(data + first - 1, '\n', fileEnd - first + 1));
+    lineStart = newline ? newline - data + 1 : fileEnd;
+  }
+  while (lineStart < last) {
+    unsigned char look = static_cast< unsigned char >(data[lineStart]);
+    // as CoinMpsCardReader::nextField - blank, control character or * is not section
+    if (look != ' ' && look != '*' && (look == '\t' || look >= ' ')) {
+      info->sectionStart[which] = lineStart;
+      break;
+    }
+    const char *newline = static_cast< const char * >(memchr(data + lineStart, '\n', fileEnd - lineStart));
+    size_t lineEnd = newline ? newline - data : fileEnd;
+    if (lineEnd - lineStart >= MAX_CARD_LENGTH - 1)
+      info->longCard[which] = true;
+    lineStart = newline ? lineEnd + 1 : fileEnd;
+  }
+}
+}
+
+// Offset of first line at or after position starting a new column
+size_t CoinMpsIO::columnBoundary(const char *data, size_t position,
+  size_t end) const
+{
+  // to start of line
+  if (position && data[position - 1] != '\n') {
+    const char *newline = static_cast< const char * >(memchr(data + position, '\n', end - position));
+    if (!newline)
+      return end;
+    position = newline - data + 1;
+  }
+  CoinFileInput *input = CoinFileInput::createFromMemory(data + position,
+    end - position);
+  CoinMpsCardReader reader(input, *cardReader_);
+  char firstColumn[200];
+  firstColumn[0] = '\0';
+  while (true) {
+    size_t lineStart = input->mappedPosition();
+    if (reader.nextField() != COIN_COLUMN_SECTION)
+      return end;
+    if (reader.mpsType() == COIN_BLANK_COLUMN) {
+      if (!firstColumn[0])
+        strcpy(firstColumn, reader.columnName());
+      else if (strcmp(firstColumn, reader.columnName()))
+        return position + lineStart;
+    }
+  }
+}
+
+// Reads COLUMNS section in chunks on threadPool_
+bool CoinMpsIO::readColumnsInChunks(COINMpsType *&columnType,
+  CoinBigIndex *&start, COINRowIndex *&row,
+  double *&element, COINColumnIndex &numberIntegers)
+{
+  // chunks smaller than this are not worth it
+  const size_t minimumChunk = 16384;
+  CoinFileInput *input = cardReader_->fileInput();
+  int numberThreads = threadPool_->numberThreads();
+  if (numberThreads < 2 || !input->mapped())
+    return false;
+  size_t fileEnd;
+  const char *data = input->mappedData(fileEnd);
+  size_t begin = input->mappedPosition();
+  if (fileEnd - begin < 2 * minimumChunk)
+    return false;
+  // find end of section
+  size_t end = fileEnd;
+  {
+    int numberTasks = static_cast< int >(CoinMin(static_cast< size_t >(4 * numberThreads),
+      (fileEnd - begin) / minimumChunk));
+    CoinMpsScanInfo info;
+    info.data = data;
+    info.begin = begin;
+    info.end = fileEnd;
+    info.fileEnd = fileEnd;
+    info.numberTasks = numberTasks;
+    std::vector< size_t > sectionStart(numberTasks);
+    bool *longCard = new bool[numberTasks];
+    info.sectionStart = &sectionStart[0];
+    info.longCard = longCard;
+    threadPool_->run(numberTasks, scanForSectionTask, &info);
+    bool anyLong = false;
+    for (int i = 0; i < numberTasks; i++) {
+      anyLong = anyLong || longCard[i];
+      if (sectionStart[i] < fileEnd) {
+        end = sectionStart[i];
+        break;
+      }
+    }
+    delete[] longCard;
+    // long cards are split as by fgets - leave to serial reading
+    if (anyLong)
+      return false;
+  }
+  int numberChunks = static_cast< int >(CoinMin(static_cast< size_t >(4 * numberThreads),
+    (end - begin) / minimumChunk));
+  if (numberChunks < 2)
+    return false;
+  // split at column boundaries
+  std::vector< size_t > split(numberChunks + 1);
+  split[0] = begin;
+  for (int i = 1; i < numberChunks; i++) {
+    size_t position = begin + ((end - begin) * i) / numberChunks;
+    split[i] = columnBoundary(data, CoinMax(position, split[i - 1]), end);
+  }
+  split[numberChunks] = end;
+  // format usually settles in first few cards so guess from them
+  bool freeFormat;
+  bool eightChar;
+  {
+    CoinMpsCardReader reader(CoinFileInput::createFromMemory(data + begin,
+                               end - begin),
+      *cardReader_);
+    for (int i = 0; i < 100; i++) {
+      if (reader.nextField() != COIN_COLUMN_SECTION)
+        break;
+    }
+    freeFormat = reader.freeFormat();
+    eightChar = reader.eightChar();
+  }
+  std::vector< unsigned char * > marks(numberThreads, static_cast< unsigned char * >(NULL));
+  ColumnsChunk *chunks = new ColumnsChunk[numberChunks];
+  for (int i = 0; i < numberChunks; i++) {
+    ColumnsChunk &chunk = chunks[i];
+    chunk.model = this;
+    chunk.format = cardReader_;
+    chunk.data = data + split[i];
+    chunk.size = split[i + 1] - split[i];
+    chunk.freeFormat = i ? freeFormat : cardReader_->freeFormat();
+    chunk.eightChar = i ? eightChar : cardReader_->eightChar();
+    chunk.done = false;
+    chunk.copyOut = false;
+    chunk.failed = false;
+    chunk.marks = &marks[0];
+  }
+  threadPool_->run(numberChunks, readColumnsTask, chunks);
+  /* Each chunk must have started with format at end of one before.
+     Format only changes a couple of times so after reading one chunk
+     again all later ones which started wrong are read again together */
+  bool good = true;
+  for (int i = 0; i < numberChunks; i++) {
+    freeFormat = i ? chunks[i - 1].endFreeFormat : cardReader_->freeFormat();
+    eightChar = i ? chunks[i - 1].endEightChar : cardReader_->eightChar();
+    ColumnsChunk &chunk = chunks[i];
+    if (chunk.freeFormat != freeFormat || chunk.eightChar != eightChar) {
+      chunk.freeFormat = freeFormat;
+      chunk.eightChar = eightChar;
+      chunk.done = false;
+      readColumnsTask(chunks, i);
+      int numberAgain = 0;
+      for (int j = i + 1; j < numberChunks; j++) {
+        ColumnsChunk &later = chunks[j];
+        if (later.freeFormat != chunk.endFreeFormat || later.eightChar != chunk.endEightChar) {
+          later.freeFormat = chunk.endFreeFormat;
+          later.eightChar = chunk.endEightChar;
+          later.done = false;
+          numberAgain++;
+        }
+      }
+      if (numberAgain)
+        threadPool_->run(numberChunks, readColumnsTask, chunks);
+    }
+    if (chunk.failed) {
+      good = false;
+      break;
+    }
+  }
+  // a column must not go on into next chunk
+  if (good) {
+    const char *lastName = NULL;
+    for (int i = 0; i < numberChunks && good; i++) {
+      ColumnsChunk &chunk = chunks[i];
+      int numberNames = chunk.columnName.numberStrings();
+      if (!numberNames)
+        continue;
+#ifndef NONAMES
+      if (lastName && !strcmp(lastName, chunk.columnName.string(0)))
+        good = false;
+      lastName = chunk.columnName.string(numberNames - 1);
+#endif
+    }
+  }
+  for (int i = 0; i < numberThreads; i++)
+    delete[] marks[i];
+  if (!good) {
+    for (int i = 0; i < numberChunks; i++)
+      chunks[i].clear();
+    delete[] chunks;
+    return false;
+  }
+  // integer markers carry on and offsets
+  COINColumnIndex numberColumns = 0;
+  CoinBigIndex numberElements = 0;
+  CoinBigIndex numberCards = 0;
+  int integerState = 0;
+  numberIntegers = 0;
+  for (int i = 0; i < numberChunks; i++) {
+    ColumnsChunk &chunk = chunks[i];
+    int numberInChunk = static_cast< int >(chunk.start.size());
+    for (int j = 0; j < chunk.numberBeforeMarker; j++)
+      chunk.columnType[j] = integerState ? COIN_INTORG : COIN_UNSET_BOUND;
+    for (int j = 0; j < numberInChunk; j++) {
+      if (chunk.columnType[j] == COIN_INTORG)
+        numberIntegers++;
+    }
+    if (chunk.integerAtEnd >= 0)
+      integerState = chunk.integerAtEnd;
+    chunk.columnOffset = numberColumns;
+    chunk.elementOffset = numberElements;
+    numberColumns += numberInChunk;
+    numberElements += static_cast< CoinBigIndex >(chunk.row.size());
+    numberCards += chunk.numberCards;
+  }
+  free(columnType);
+  free(objective_);
+  free(start);
+  free(row);
+  free(element);
+  columnType = reinterpret_cast< COINMpsType * >(malloc(CoinMax(numberColumns, 1) * sizeof(COINMpsType)));
+  objective_ = reinterpret_cast< double * >(malloc(CoinMax(numberColumns, 1) * sizeof(double)));
+  start = reinterpret_cast< CoinBigIndex * >(malloc((numberColumns + 1) * sizeof(CoinBigIndex)));
+  row = reinterpret_cast< COINRowIndex * >(malloc(CoinMax(numberElements, static_cast< CoinBigIndex >(1)) * sizeof(COINRowIndex)));
+  element = reinterpret_cast< double * >(malloc(CoinMax(numberElements, static_cast< CoinBigIndex >(1)) * sizeof(double)));
+  for (int i = 0; i < numberChunks; i++) {
+    ColumnsChunk &chunk = chunks[i];
+    chunk.done = false;
+    chunk.copyOut = true;
+    chunk.toColumnType = columnType;
+    chunk.toObjective = objective_;
+    chunk.toStart = start;
+    chunk.toRow = row;
+    chunk.toElement = element;
+  }
+  threadPool_->run(numberChunks, readColumnsTask, chunks);
+  // names of all chunks are copied into one block (hashes are kept)
+  size_t numberCharacters = 0;
+  for (int i = 0; i < numberChunks; i++)
+    numberCharacters += chunks[i].columnName.numberCharacters();
+  names_[1].clear();
+  names_[1].reserve(numberColumns, numberCharacters);
+  for (int i = 0; i < numberChunks; i++)
+    names_[1].append(chunks[i].columnName);
+  numberColumns_ = numberColumns;
+  numberElements_ = numberElements;
+  start[numberColumns] = numberElements;
+  // carry on after section as if read serially
+  cardReader_->setCardNumber(cardReader_->cardNumber() + numberCards);
+  cardReader_->setFreeFormat(chunks[numberChunks - 1].endFreeFormat);
+  cardReader_->setEightChar(chunks[numberChunks - 1].endEightChar);
+  input->setMappedPosition(end);
+  delete[] chunks;
+  return true;
+}
+
 int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
 {
   bool ifmps;
@@ -1716,14 +2017,11 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
     COINMpsType *rowType =
 
       reinterpret_cast< COINMpsType * >(malloc(maxRows * sizeof(COINMpsType)));
-    char **rowName = reinterpret_cast< char ** >(malloc(maxRows * sizeof(char *)));
+    CoinStringPool &rowName = names_[0];
+    rowName.clear();
 
     // for discarded free rows
-    COINRowIndex maxFreeRows = 100;
-    COINRowIndex numberOtherFreeRows = 0;
-    char **freeRowName =
-
-      reinterpret_cast< char ** >(malloc(maxFreeRows * sizeof(char *)));
+    CoinStringPool freeRowName;
     while (cardReader_->nextField() == COIN_ROW_SECTION) {
       switch (cardReader_->mpsType()) {
       case COIN_N_ROW:
@@ -1734,13 +2032,7 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
           objectiveName_ = CoinStrdup(cardReader_->columnName());
         } else {
           // add to discard list
-          if (numberOtherFreeRows == maxFreeRows) {
-            maxFreeRows = (3 * maxFreeRows) / 2 + 100;
-            freeRowName = reinterpret_cast< char ** >(realloc(freeRowName,
-              maxFreeRows * sizeof(char *)));
-          }
-          freeRowName[numberOtherFreeRows] = CoinStrdup(cardReader_->columnName());
-          numberOtherFreeRows++;
+          freeRowName.addString(cardReader_->columnName());
         }
         break;
       case COIN_E_ROW:
@@ -1750,13 +2042,10 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
           maxRows = (3 * maxRows) / 2 + 1000;
           rowType = reinterpret_cast< COINMpsType * >(realloc(rowType,
             maxRows * sizeof(COINMpsType)));
-          rowName =
-
-            reinterpret_cast< char ** >(realloc(rowName, maxRows * sizeof(char *)));
         }
         rowType[numberRows_] = cardReader_->mpsType();
 #ifndef NONAMES
-        rowName[numberRows_] = CoinStrdup(cardReader_->columnName());
+        rowName.addString(cardReader_->columnName());
 #endif
         numberRows_++;
         break;
@@ -1786,26 +2075,19 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
     else
       rowType = reinterpret_cast< COINMpsType * >(realloc(rowType, sizeof(COINMpsType)));
     // put objective and other free rows at end
-    rowName = reinterpret_cast< char ** >(realloc(rowName,
-      (numberRows_ + 1 +
-
-        numberOtherFreeRows)
-        * sizeof(char *)));
 #ifndef NONAMES
-    rowName[numberRows_] = CoinStrdup(objectiveName_);
-    memcpy(rowName + numberRows_ + 1, freeRowName,
-      numberOtherFreeRows * sizeof(char *));
-    // now we can get rid of this array
-    free(freeRowName);
+    rowName.addString(objectiveName_);
+    rowName.append(freeRowName);
 #else
-    memset(rowName, 0, (numberRows_ + 1) * sizeof(char **));
+    rowName.resize(numberRows_ + 1);
 #endif
 
-    startHash(rowName, numberRows_ + 1 + numberOtherFreeRows, 0);
+    startHash(0);
     COINColumnIndex maxColumns = 1000 + numberRows_ / 5;
     CoinBigIndex maxElements = 5000 + numberRows_ / 2;
     COINMpsType *columnType = reinterpret_cast< COINMpsType * >(malloc(maxColumns * sizeof(COINMpsType)));
-    char **columnName = reinterpret_cast< char ** >(malloc(maxColumns * sizeof(char *)));
+    CoinStringPool &columnName = names_[1];
+    columnName.clear();
 
     objective_ = reinterpret_cast< double * >(malloc(maxColumns * sizeof(double)));
     start = reinterpret_cast< CoinBigIndex * >(malloc((maxColumns + 1) * sizeof(CoinBigIndex)));
@@ -1826,6 +2108,9 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
     COINColumnIndex column = -1;
     bool inIntegerSet = false;
     COINColumnIndex numberIntegers = 0;
+    // if done in chunks loop just reads next section card
+    if (threadPool_)
+      readColumnsInChunks(columnType, start, row, element, numberIntegers);
 
     while (cardReader_->nextField() == COIN_COLUMN_SECTION) {
       switch (cardReader_->mpsType()) {
@@ -1854,7 +2139,6 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
           if (numberColumns_ == maxColumns) {
             maxColumns = (3 * maxColumns) / 2 + 1000;
             columnType = reinterpret_cast< COINMpsType * >(realloc(columnType, maxColumns * sizeof(COINMpsType)));
-            columnName = reinterpret_cast< char ** >(realloc(columnName, maxColumns * sizeof(char *)));
 
             objective_ = reinterpret_cast< double * >(realloc(objective_, maxColumns * sizeof(double)));
             start = reinterpret_cast< CoinBigIndex * >(realloc(start,
@@ -1867,9 +2151,9 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
             numberIntegers++;
           }
 #ifndef NONAMES
-          columnName[column] = CoinStrdup(cardReader_->columnName());
+          columnName.addString(cardReader_->columnName());
 #else
-          columnName[column] = NULL;
+          columnName.resize(column + 1);
 #endif
           strcpy(lastColumn, cardReader_->columnName());
           objective_[column] = 0.0;
@@ -2001,16 +2285,10 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
     if (numberColumns_) {
       columnType = reinterpret_cast< COINMpsType * >(realloc(columnType,
         numberColumns_ * sizeof(COINMpsType)));
-      columnName =
-
-        reinterpret_cast< char ** >(realloc(columnName, numberColumns_ * sizeof(char *)));
       objective_ = reinterpret_cast< double * >(realloc(objective_, numberColumns_ * sizeof(double)));
     } else {
       columnType = reinterpret_cast< COINMpsType * >(realloc(columnType,
         sizeof(COINMpsType)));
-      columnName =
-
-        reinterpret_cast< char ** >(realloc(columnName, sizeof(char *)));
       objective_ = reinterpret_cast< double * >(realloc(objective_, sizeof(double)));
     }
     start = reinterpret_cast< CoinBigIndex * >(realloc(start, (numberColumns_ + 1) * sizeof(CoinBigIndex)));
@@ -2296,7 +2574,7 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
       }
     }
     // start hash even if no bound section - to make sure names survive
-    startHash(columnName, numberColumns_, 1);
+    startHash(1);
     gotNextSection = false;
     if (cardReader_->whichSection() == COIN_BOUNDS_SECTION) {
       memset(lastColumn, '\0', 200);
@@ -2663,7 +2941,7 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
           //integerType_[icolumn]=2;
           double value = cardReader_->value();
           if (value == -1.0e100)
-            value = atof(cardReader_->rowName()); // try from row name
+            value = CoinStrtod(cardReader_->rowName(), NULL); // try from row name
           which[numberInSet] = icolumn;
           weights[numberInSet++] = value;
         } else {
@@ -3000,12 +3278,8 @@ int CoinMpsIO::readGMPL(const char *modelName, const char *dataName, bool keepNa
   // spare space for checking
   double *el = new double[numberColumns_];
   int *ind = new int[numberColumns_];
-  char **names = NULL;
-  if (keepNames) {
-    names = reinterpret_cast< char ** >(malloc(numberRows_ * sizeof(char *)));
-    names_[0] = names;
-    numberHash_[0] = numberRows_;
-  }
+  if (keepNames)
+    names_[0].reserve(numberRows_, 0);
   for (iRow = 0; iRow < numberRows_; iRow++) {
     int number = glp_get_mat_row(g_prob, iRow + 1, ind - 1, el - 1);
     double rowLower, rowUpper;
@@ -3037,7 +3311,7 @@ int CoinMpsIO::readGMPL(const char *modelName, const char *dataName, bool keepNa
     if (keepNames) {
       strcpy(name, glp_get_row_name(g_prob, iRow + 1));
       // could look at name?
-      names[kRow] = CoinStrdup(name);
+      names_[0].addString(name);
     }
     kRow++;
     start[kRow] = numberElements_;
@@ -3070,11 +3344,8 @@ int CoinMpsIO::readGMPL(const char *modelName, const char *dataName, bool keepNa
   collower_ = reinterpret_cast< double * >(malloc(numberColumns_ * sizeof(double)));
   colupper_ = reinterpret_cast< double * >(malloc(numberColumns_ * sizeof(double)));
   integerType_ = reinterpret_cast< char * >(malloc(numberColumns_ * sizeof(char)));
-  if (keepNames) {
-    names = reinterpret_cast< char ** >(malloc(numberColumns_ * sizeof(char *)));
-    names_[1] = names;
-    numberHash_[1] = numberColumns_;
-  }
+  if (keepNames)
+    names_[1].reserve(numberColumns_, 0);
   int numberIntegers = 0;
   for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
     double columnLower = glp_get_col_lb(g_prob, iColumn + 1);
@@ -3116,7 +3387,7 @@ int CoinMpsIO::readGMPL(const char *modelName, const char *dataName, bool keepNa
     if (keepNames) {
       strcpy(name, glp_get_col_name(g_prob, iColumn + 1));
       // could look at name?
-      names[iColumn] = CoinStrdup(name);
+      names_[1].addString(name);
     }
   }
   // leave in case report needed
@@ -3292,9 +3563,9 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
   COINColumnIndex *column = reinterpret_cast< COINRowIndex * >(malloc(numberElements_ * sizeof(COINRowIndex)));
   double *element = reinterpret_cast< double * >(malloc(numberElements_ * sizeof(double)));
   COINMpsType *rowType = reinterpret_cast< COINMpsType * >(malloc(numberRows_ * sizeof(COINMpsType)));
-  char **rowName = reinterpret_cast< char ** >(malloc(numberRows_ * sizeof(char *)));
   COINMpsType *columnType = reinterpret_cast< COINMpsType * >(malloc(numberColumns_ * sizeof(COINMpsType)));
-  char **columnName = reinterpret_cast< char ** >(malloc(numberColumns_ * sizeof(char *)));
+  names_[0].clear();
+  names_[1].clear();
 
   start[0] = 0;
   numberElements_ = 0;
@@ -3320,7 +3591,7 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
     }
     assert(*next == ',' || *next == ';');
     cardReader_->setPosition(next + 1);
-    columnName[i] = CoinStrdup(cardReader_->columnName());
+    names_[1].addString(cardReader_->columnName());
     // Default is free?
     collower_[i] = -COIN_DBL_MAX;
     // Surely not - check
@@ -3329,7 +3600,7 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
     objective_[i] = 0.0;
     columnType[i] = COIN_UNSET_BOUND;
   }
-  startHash(columnName, numberColumns_, 1);
+  startHash(1);
   integerType_ = reinterpret_cast< char * >(malloc(numberColumns_ * sizeof(char)));
   memset(integerType_, 0, numberColumns_);
   // Lists come in various flavors - I don't know many now
@@ -3404,13 +3675,13 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
     }
     assert(*next == ',' || *next == ';');
     cardReader_->setPosition(next + 1);
-    rowName[i] = CoinStrdup(cardReader_->columnName());
+    names_[0].addString(cardReader_->columnName());
     // Default is free?
     rowlower_[i] = -COIN_DBL_MAX;
     rowupper_[i] = COIN_DBL_MAX;
     rowType[i] = COIN_N_ROW;
   }
-  startHash(rowName, numberRows_, 0);
+  startHash(0);
   const double largeElement = 1.0e14;
   int numberTiny = 0;
   int numberLarge = 0;
@@ -3519,7 +3790,7 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
         // bound
         char *next = strchr(dot + 1, '=');
         assert(next);
-        double value = atof(next + 1);
+        double value = CoinStrtod(next + 1, NULL);
         if (!strncmp(dot + 1, "fx", 2)) {
           collower_[iColumn] = value;
           colupper_[iColumn] = value;
@@ -3543,7 +3814,7 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
         // bound
         next = strchr(dot + 1, '=');
         assert(next);
-        double value = atof(next + 1);
+        double value = CoinStrtod(next + 1, NULL);
         if (!strncmp(dot + 1, "fx", 2)) {
           collower_[iColumn] = value;
           abort();
@@ -3568,14 +3839,12 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
   } else {
     // move column stuff
     COINColumnIndex iColumn;
-    free(names_[1][iObjCol]);
     for (iColumn = iObjCol + 1; iColumn < numberColumns_; iColumn++) {
       integerType_[iColumn - 1] = integerType_[iColumn];
       collower_[iColumn - 1] = collower_[iColumn];
       colupper_[iColumn - 1] = colupper_[iColumn];
-      names_[1][iColumn - 1] = names_[1][iColumn];
     }
-    numberHash_[1]--;
+    names_[1].deleteStrings(1, &iObjCol);
     numberColumns_--;
     double multiplier = minimize ? 1.0 : -1.0;
     // but swap
@@ -3602,11 +3871,9 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
         last = start[iRow + 1];
         rowlower_[kRow] = rowlower_[iRow];
         rowupper_[kRow] = rowupper_[iRow];
-        names_[0][kRow] = names_[0][iRow];
         start[kRow + 1] = nel;
         kRow++;
       } else {
-        free(names_[0][iRow]);
         iObjRow = iRow;
         for (j = last; j < start[iRow + 1]; j++) {
           int iColumn = column[j];
@@ -3622,7 +3889,7 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
     }
     numberRows_ = kRow;
     assert(iObjRow >= 0);
-    numberHash_[0]--;
+    names_[0].deleteStrings(1, &iObjRow);
   }
   stopHash(0);
   stopHash(1);
@@ -3747,25 +4014,27 @@ int CoinMpsIO::readBasis(const char *filename, const char *extension,
   numberColumns_ = numberColumns;
   // bas file - always read in free format
   bool gotNames;
+  // names (if any) are put back at end
+  CoinStringPool savedNames[2];
   if (rownames.size() != static_cast< unsigned int >(numberRows_) || colnames.size() != static_cast< unsigned int >(numberColumns_)) {
     gotNames = false;
   } else {
     gotNames = true;
-    numberHash_[0] = numberRows_;
-    numberHash_[1] = numberColumns_;
-    names_[0] = reinterpret_cast< char ** >(malloc(numberRows_ * sizeof(char *)));
-    names_[1] = reinterpret_cast< char ** >(malloc(numberColumns_ * sizeof(char *)));
-    const char **rowNames = const_cast< const char ** >(names_[0]);
-    const char **columnNames = const_cast< const char ** >(names_[1]);
+    stopHash(0);
+    stopHash(1);
+    savedNames[0].swap(names_[0]);
+    savedNames[1].swap(names_[1]);
     int i;
     for (i = 0; i < numberRows_; ++i) {
-      rowNames[i] = rownames[i].c_str();
+      names_[0].addString(rownames[i].c_str(),
+        static_cast< int >(rownames[i].size()));
     }
     for (i = 0; i < numberColumns_; ++i) {
-      columnNames[i] = colnames[i].c_str();
+      names_[1].addString(colnames[i].c_str(),
+        static_cast< int >(colnames[i].size()));
     }
-    startHash(const_cast< char ** >(rowNames), numberRows, 0);
-    startHash(const_cast< char ** >(columnNames), numberColumns, 1);
+    startHash(0);
+    startHash(1);
   }
   cardReader_->setWhichSection(COIN_BASIS_SECTION);
   cardReader_->setFreeFormat(true);
@@ -3850,16 +4119,8 @@ int CoinMpsIO::readBasis(const char *filename, const char *extension,
   if (gotNames) {
     stopHash(0);
     stopHash(1);
-    free(names_[0]);
-    names_[0] = NULL;
-    numberHash_[0] = 0;
-    free(names_[1]);
-    names_[1] = NULL;
-    numberHash_[1] = 0;
-    delete[] hash_[0];
-    delete[] hash_[1];
-    hash_[0] = 0;
-    hash_[1] = 0;
+    names_[0].swap(savedNames[0]);
+    names_[1].swap(savedNames[1]);
   }
   if (cardReader_->whichSection() != COIN_ENDATA_SECTION) {
     handler_->message(COIN_MPS_BADIMAGE, messages_) << cardReader_->cardNumber()
@@ -4152,12 +4413,12 @@ static void outputCard(int formatType, int numberFields,
   writeString(output, line.c_str());
 }
 static int
-makeUniqueNames(char **names, int number, char first)
+makeUniqueNames(CoinStringPool &names, int number, char first)
 {
   int largest = -1;
   int i;
   for (i = 0; i < number; i++) {
-    char *name = names[i];
+    const char *name = names.string(i);
     if (name[0] == first && strlen(name) == 8) {
       // check number
       int n = 0;
@@ -4182,7 +4443,7 @@ makeUniqueNames(char **names, int number, char first)
     memset(used, 0, largest);
     int nDup = 0;
     for (i = 0; i < number; i++) {
-      char *name = names[i];
+      const char *name = names.string(i);
       if (name[0] == first && strlen(name) == 8) {
         // check number
         int n = 0;
@@ -4202,10 +4463,9 @@ makeUniqueNames(char **names, int number, char first)
           } else {
             // duplicate
             nDup++;
-            free(names[i]);
             char newName[12];
             sprintf(newName, "%c%7.7d", first, largest);
-            names[i] = CoinStrdup(newName);
+            names.setString(i, newName);
             largest++;
           }
         }
@@ -4274,21 +4534,26 @@ int CoinMpsIO::writeMps(const char *filename, int compression,
   // Set locale so won't get , instead of .
   char *saveLocale = strdup(setlocale(LC_ALL, NULL));
   setlocale(LC_ALL, "C");
-  const char *const *const rowNames = names_[0];
-  const char *const *const columnNames = names_[1];
   int i;
   unsigned int length = 8;
   bool freeFormat = (formatType == 1);
   // Check names for uniqueness if default
   int nChanged;
-  nChanged = makeUniqueNames(names_[0], numberRows_, 'R');
-  if (nChanged)
+  CoinMpsIO *mutableThis = const_cast< CoinMpsIO * >(this);
+  nChanged = makeUniqueNames(mutableThis->names_[0], numberRows_, 'R');
+  if (nChanged) {
+    mutableThis->stopHash(0);
     handler_->message(COIN_MPS_CHANGED, messages_) << "row" << nChanged
                                                    << CoinMessageEol;
-  nChanged = makeUniqueNames(names_[1], numberColumns_, 'C');
-  if (nChanged)
+  }
+  nChanged = makeUniqueNames(mutableThis->names_[1], numberColumns_, 'C');
+  if (nChanged) {
+    mutableThis->stopHash(1);
     handler_->message(COIN_MPS_CHANGED, messages_) << "column" << nChanged
                                                    << CoinMessageEol;
+  }
+  const char *const *const rowNames = names_[0].stringArray();
+  const char *const *const columnNames = names_[1].stringArray();
   for (i = 0; i < numberRows_; ++i) {
     if (strlen(rowNames[i]) > length) {
       length = static_cast< int >(strlen(rowNames[i]));
@@ -5142,63 +5407,27 @@ void CoinMpsIO::setMpsDataColAndRowNames(
   releaseRowNames();
   releaseColumnNames();
   // If long names free format
-  names_[0] = reinterpret_cast< char ** >(malloc(numberRows_ * sizeof(char *)));
-  names_[1] = reinterpret_cast< char ** >(malloc(numberColumns_ * sizeof(char *)));
-  numberHash_[0] = numberRows_;
-  numberHash_[1] = numberColumns_;
-  char **rowNames = names_[0];
-  char **columnNames = names_[1];
+  CoinStringPool &rowNames = names_[0];
+  CoinStringPool &columnNames = names_[1];
+  rowNames.reserve(numberRows_, 9 * static_cast< size_t >(numberRows_));
+  columnNames.reserve(numberColumns_, 9 * static_cast< size_t >(numberColumns_));
   int i;
-  // so we can adjust for long names
-  int lengthMalloc = 9;
-  int maxIndex = 10000000;
-  if (rownames) {
-    for (i = 0; i < numberRows_; ++i) {
-      if (i == maxIndex) {
-        lengthMalloc++;
-        maxIndex *= 10;
-      }
-      if (rownames[i]) {
-        rowNames[i] = CoinStrdup(rownames[i]);
-      } else {
-        rowNames[i] = reinterpret_cast< char * >(malloc(lengthMalloc * sizeof(char)));
-        sprintf(rowNames[i], "R%7.7d", i);
-      }
-    }
-  } else {
-    for (i = 0; i < numberRows_; ++i) {
-      if (i == maxIndex) {
-        lengthMalloc++;
-        maxIndex *= 10;
-      }
-      rowNames[i] = reinterpret_cast< char * >(malloc(lengthMalloc * sizeof(char)));
-      sprintf(rowNames[i], "R%7.7d", i);
+  char temp[20];
+  for (i = 0; i < numberRows_; ++i) {
+    if (rownames && rownames[i]) {
+      rowNames.addString(rownames[i]);
+    } else {
+      sprintf(temp, "R%7.7d", i);
+      rowNames.addString(temp);
     }
   }
 #ifndef NONAMES
-  lengthMalloc = 9;
-  maxIndex = 10000000;
-  if (colnames) {
-    for (i = 0; i < numberColumns_; ++i) {
-      if (i == maxIndex) {
-        lengthMalloc++;
-        maxIndex *= 10;
-      }
-      if (colnames[i]) {
-        columnNames[i] = CoinStrdup(colnames[i]);
-      } else {
-        columnNames[i] = reinterpret_cast< char * >(malloc(lengthMalloc * sizeof(char)));
-        sprintf(columnNames[i], "C%7.7d", i);
-      }
-    }
-  } else {
-    for (i = 0; i < numberColumns_; ++i) {
-      if (i == maxIndex) {
-        lengthMalloc++;
-        maxIndex *= 10;
-      }
-      columnNames[i] = reinterpret_cast< char * >(malloc(lengthMalloc * sizeof(char)));
-      sprintf(columnNames[i], "C%7.7d", i);
+  for (i = 0; i < numberColumns_; ++i) {
+    if (colnames && colnames[i]) {
+      columnNames.addString(colnames[i]);
+    } else {
+      sprintf(temp, "C%7.7d", i);
+      columnNames.addString(temp);
     }
   }
 #else
@@ -5207,8 +5436,8 @@ void CoinMpsIO::setMpsDataColAndRowNames(
   const int *lengths = matrix->getVectorLengths();
   int k = 0;
   for (i = 0; i < numberColumns_; ++i) {
-    columnNames[i] = reinterpret_cast< char * >(malloc(9 * sizeof(char)));
-    sprintf(columnNames[i], "C%7.7d", k);
+    sprintf(temp, "C%7.7d", k);
+    columnNames.addString(temp);
     if (objective[i] || lengths[i])
       k++;
   }
@@ -5219,44 +5448,27 @@ void CoinMpsIO::setMpsDataColAndRowNames(
   const std::vector< std::string > &colnames,
   const std::vector< std::string > &rownames)
 {
+  releaseRowNames();
+  releaseColumnNames();
   // If long names free format
-  names_[0] = reinterpret_cast< char ** >(malloc(numberRows_ * sizeof(char *)));
-  names_[1] = reinterpret_cast< char ** >(malloc(numberColumns_ * sizeof(char *)));
-  char **rowNames = names_[0];
-  char **columnNames = names_[1];
+  CoinStringPool &rowNames = names_[0];
+  CoinStringPool &columnNames = names_[1];
   int i;
-  if (rownames.size() != 0) {
-    for (i = 0; i < numberRows_; ++i) {
-      rowNames[i] = CoinStrdup(rownames[i].c_str());
-    }
-  } else {
-    // so we can adjust for long names
-    int lengthMalloc = 9;
-    int maxIndex = 10000000;
-    for (i = 0; i < numberRows_; ++i) {
-      if (i == maxIndex) {
-        lengthMalloc++;
-        maxIndex *= 10;
-      }
-      rowNames[i] = reinterpret_cast< char * >(malloc(lengthMalloc * sizeof(char)));
-      sprintf(rowNames[i], "R%7.7d", i);
+  char temp[20];
+  for (i = 0; i < numberRows_; ++i) {
+    if (rownames.size() != 0) {
+      rowNames.addString(rownames[i].c_str(), static_cast< int >(rownames[i].size()));
+    } else {
+      sprintf(temp, "R%7.7d", i);
+      rowNames.addString(temp);
     }
   }
-  if (colnames.size() != 0) {
-    for (i = 0; i < numberColumns_; ++i) {
-      columnNames[i] = CoinStrdup(colnames[i].c_str());
-    }
-  } else {
-    // so we can adjust for long names
-    int lengthMalloc = 9;
-    int maxIndex = 10000000;
-    for (i = 0; i < numberColumns_; ++i) {
-      if (i == maxIndex) {
-        lengthMalloc++;
-        maxIndex *= 10;
-      }
-      columnNames[i] = reinterpret_cast< char * >(malloc(lengthMalloc * sizeof(char)));
-      sprintf(columnNames[i], "C%7.7d", i);
+  for (i = 0; i < numberColumns_; ++i) {
+    if (colnames.size() != 0) {
+      columnNames.addString(colnames[i].c_str(), static_cast< int >(colnames[i].size()));
+    } else {
+      sprintf(temp, "C%7.7d", i);
+      columnNames.addString(temp);
     }
   }
 }
@@ -5401,7 +5613,7 @@ void CoinMpsIO::copyInIntegerInformation(const char *integerType)
 const char *CoinMpsIO::rowName(int index) const
 {
   if (index >= 0 && index < numberRows_) {
-    return names_[0][index];
+    return names_[0].string(index);
   } else {
     return NULL;
   }
@@ -5409,15 +5621,21 @@ const char *CoinMpsIO::rowName(int index) const
 const char *CoinMpsIO::columnName(int index) const
 {
   if (index >= 0 && index < numberColumns_) {
-    return names_[1][index];
+    return names_[1].string(index);
   } else {
     return NULL;
   }
 }
+// Exchanges names with names (no copying)
+void CoinMpsIO::swapNames(int section, CoinStringPool &names)
+{
+  stopHash(section);
+  names_[section].swap(names);
+}
 // names - returns -1 if name not found
 int CoinMpsIO::rowIndex(const char *name) const
 {
-  if (!hash_[0]) {
+  if (!hash_[0].numberEntries()) {
     if (numberRows_) {
       startHash(0);
     } else {
@@ -5428,7 +5646,7 @@ int CoinMpsIO::rowIndex(const char *name) const
 }
 int CoinMpsIO::columnIndex(const char *name) const
 {
-  if (!hash_[1]) {
+  if (!hash_[1].numberEntries()) {
     if (numberColumns_) {
       startHash(1);
     } else {
@@ -5466,25 +5684,13 @@ void CoinMpsIO::releaseIntegerInformation()
 void CoinMpsIO::releaseRowNames()
 {
   releaseRedundantInformation();
-  int i;
-  for (i = 0; i < numberHash_[0]; i++) {
-    free(names_[0][i]);
-  }
-  free(names_[0]);
-  names_[0] = NULL;
-  numberHash_[0] = 0;
+  names_[0].clear();
 }
 // Release column names
 void CoinMpsIO::releaseColumnNames()
 {
   releaseRedundantInformation();
-  int i;
-  for (i = 0; i < numberHash_[1]; i++) {
-    free(names_[1][i]);
-  }
-  free(names_[1]);
-  names_[1] = NULL;
-  numberHash_[1] = 0;
+  names_[1].clear();
 }
 // Release matrix information
 void CoinMpsIO::releaseMatrixInformation()
@@ -5526,17 +5732,13 @@ CoinMpsIO::CoinMpsIO()
   , cardReader_(NULL)
   , convertObjective_(false)
   , allowStringElements_(0)
+  , mappedFiles_(true)
+  , threadPool_(NULL)
   , maximumStringElements_(0)
   , numberStringElements_(0)
   , stringElements_(NULL)
   , isMaximization_(0)
 {
-  numberHash_[0] = 0;
-  hash_[0] = NULL;
-  names_[0] = NULL;
-  numberHash_[1] = 0;
-  hash_[1] = NULL;
-  names_[1] = NULL;
   handler_ = new CoinMessageHandler();
   messages_ = CoinMessage();
 }
@@ -5572,17 +5774,13 @@ CoinMpsIO::CoinMpsIO(const CoinMpsIO &rhs)
   , defaultHandler_(true)
   , cardReader_(NULL)
   , allowStringElements_(rhs.allowStringElements_)
+  , mappedFiles_(rhs.mappedFiles_)
+  , threadPool_(rhs.threadPool_)
   , maximumStringElements_(rhs.maximumStringElements_)
   , numberStringElements_(rhs.numberStringElements_)
   , stringElements_(NULL)
   , isMaximization_(0)
 {
-  numberHash_[0] = 0;
-  hash_[0] = NULL;
-  names_[0] = NULL;
-  numberHash_[1] = 0;
-  hash_[1] = NULL;
-  names_[1] = NULL;
   if (rhs.rowlower_ != NULL || rhs.collower_ != NULL) {
     gutsOfCopy(rhs);
     // OK and proper to leave rowsense_, rhs_, and
@@ -5636,25 +5834,15 @@ void CoinMpsIO::gutsOfCopy(const CoinMpsIO &rhs)
   rhsName_ = CoinStrdup(rhs.rhsName_);
   rangeName_ = CoinStrdup(rhs.rangeName_);
   boundName_ = CoinStrdup(rhs.boundName_);
-  numberHash_[0] = rhs.numberHash_[0];
-  numberHash_[1] = rhs.numberHash_[1];
   defaultBound_ = rhs.defaultBound_;
   infinity_ = rhs.infinity_;
   smallElement_ = rhs.smallElement_;
   objectiveOffset_ = rhs.objectiveOffset_;
-  int section;
-  for (section = 0; section < 2; section++) {
-    if (numberHash_[section]) {
-      char **names2 = rhs.names_[section];
-      names_[section] = reinterpret_cast< char ** >(malloc(numberHash_[section] * sizeof(char *)));
-      char **names = names_[section];
-      int i;
-      for (i = 0; i < numberHash_[section]; i++) {
-        names[i] = CoinStrdup(names2[i]);
-      }
-    }
-  }
+  names_[0] = rhs.names_[0];
+  names_[1] = rhs.names_[1];
   allowStringElements_ = rhs.allowStringElements_;
+  mappedFiles_ = rhs.mappedFiles_;
+  threadPool_ = rhs.threadPool_;
   maximumStringElements_ = rhs.maximumStringElements_;
   numberStringElements_ = rhs.numberStringElements_;
   if (numberStringElements_) {
@@ -5756,10 +5944,8 @@ void CoinMpsIO::releaseRedundantInformation()
   rowsense_ = NULL;
   rhs_ = NULL;
   rowrange_ = NULL;
-  delete[] hash_[0];
-  delete[] hash_[1];
-  hash_[0] = 0;
-  hash_[1] = 0;
+  hash_[0].clear();
+  hash_[1].clear();
   delete matrixByRow_;
   matrixByRow_ = NULL;
 }
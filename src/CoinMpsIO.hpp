@@ -17,12 +17,15 @@
 #include "CoinPackedMatrix.hpp"
 #include "CoinMessageHandler.hpp"
 #include "CoinFileIO.hpp"
+#include "CoinStringPool.hpp"
+#include "CoinNameHash.hpp"
 
 #ifdef COINUTILS_HAS_GLPK
 #include "glpk.h"
 #endif
 
 class CoinModel;
+class CoinThreadPool;
 
 /// The following lengths are in decreasing order (for 64 bit etc)
 /// Large enough to contain element index
@@ -101,6 +104,10 @@ public:
   /// Constructor expects file to be open
   /// This one takes gzFile if fp null
   CoinMpsCardReader(CoinFileInput *input, CoinMpsIO *reader);
+  /** Constructor for reading part of a section from input (as when
+      MPS COLUMNS are read in chunks).  Section and format are as in
+      format */
+  CoinMpsCardReader(CoinFileInput *input, const CoinMpsCardReader &format);
 
   /// Destructor
   ~CoinMpsCardReader();
@@ -146,6 +153,16 @@ public:
   {
     freeFormat_ = yesNo;
   }
+  /// Whether fixed format names can be taken as eight characters
+  inline bool eightChar() const
+  {
+    return eightChar_;
+  }
+  /// Sets whether fixed format names can be taken as eight characters
+  inline void setEightChar(bool yesNo)
+  {
+    eightChar_ = yesNo;
+  }
   /// Only for first field on card otherwise BLANK_COLUMN
   /// e.g. COIN_E_ROW
   inline COINMpsType mpsType() const
@@ -199,6 +216,11 @@ public:
   {
     return cardNumber_;
   }
+  /// Sets card number (when cards have been read elsewhere)
+  inline void setCardNumber(CoinBigIndex value)
+  {
+    cardNumber_ = value;
+  }
   /// Returns file input
   inline CoinFileInput *fileInput() const
   {
@@ -539,6 +561,21 @@ public:
     */
   int columnIndex(const char *name) const;
 
+  /** Row names (section 0) or column names (section 1).
+
+	Row names go on past getNumRows() with the objective and any
+	dropped free rows.
+    */
+  inline const CoinStringPool &names(int section) const
+  {
+    return names_[section];
+  }
+
+  /** Exchanges row names (section 0) or column names (section 1) with
+      names - no copying, so a model can take over names read here.
+    */
+  void swapNames(int section, CoinStringPool &names);
+
   /** Returns the (constant) objective offset
     
 	This is the RHS entry for the objective row
@@ -652,6 +689,32 @@ public:
   {
     allowStringElements_ = yesNo;
   }
+  /** Whether plain files are memory mapped when read (default true).
+      Lines are then looked at where they are in the mapping instead of
+      going through stdio.  Compressed files are always streamed */
+  inline bool mappedFiles() const
+  {
+    return mappedFiles_;
+  }
+  /// Set whether plain files are memory mapped when read
+  inline void setMappedFiles(bool yesNo)
+  {
+    mappedFiles_ = yesNo;
+  }
+  /// Pool used to read COLUMNS section (NULL if serial)
+  inline CoinThreadPool *threadPool() const
+  {
+    return threadPool_;
+  }
+  /** Set pool used to read COLUMNS section of memory mapped files in
+      chunks (NULL - the default - to read serially).  The pool is not
+      owned.  Results are identical to serial reading - a section with
+      anything chunks can not do exactly as serial reading (for example
+      duplicates, unknown rows or string elements) is read serially */
+  inline void setThreadPool(CoinThreadPool *pool)
+  {
+    threadPool_ = pool;
+  }
   /** Small element value - elements less than this set to zero on input
         default is 1.0e-14 */
   inline double getSmallElementValue() const
@@ -1003,16 +1066,24 @@ protected:
   void decodeString(int iString, int &iRow, int &iColumn, const char *&value) const;
   //@}
 
-  // for hashing
-  typedef struct {
-    int index, next;
-  } CoinHashLink;
+  /**@name Reading COLUMNS in chunks */
+  //@{
+  /// One chunk of COLUMNS section
+  struct ColumnsChunk;
+  /** Reads COLUMNS section (from card after COLUMNS) in chunks on
+      threadPool_ and replaces arrays by ones of right size.  Returns
+      false with input unchanged if section should be read serially */
+  bool readColumnsInChunks(COINMpsType *&columnType, CoinBigIndex *&start,
+    COINRowIndex *&row, double *&element, COINColumnIndex &numberIntegers);
+  /// Offset of first line at or after position starting a new column
+  size_t columnBoundary(const char *data, size_t position, size_t end) const;
+  /// Task for pool - reads (or copies out) a chunk
+  static void readColumnsTask(void *info, int which);
+  //@}
 
   /**@name Hash table methods */
   //@{
   /// Creates hash list for names (section = 0 for rows, 1 columns)
-  void startHash(char **names, const int number, int section);
-  /// This one does it when names are already in
   void startHash(int section) const;
   /// Deletes hash storage
   void stopHash(int section);
@@ -1089,7 +1160,7 @@ protected:
   /** Row and column names
 	  Linked to hash table sections (0 - row names, 1 column names)
       */
-  char **names_[2];
+  CoinStringPool names_[2];
   //@}
 
   /** @name Hash tables */
@@ -1097,11 +1168,8 @@ protected:
   /// Current file name
   char *fileName_;
 
-  /// Number of entries in a hash table section
-  int numberHash_[2];
-
   /// Hash tables (two sections, 0 - row names, 1 - column names)
-  mutable CoinHashLink *hash_[2];
+  mutable CoinNameHash hash_[2];
   //@}
 
   /** @name CoinMpsIO object parameters */
@@ -1130,6 +1198,10 @@ protected:
   bool convertObjective_;
   /// Whether to allow string elements
   int allowStringElements_;
+  /// Whether to memory map plain files
+  bool mappedFiles_;
+  /// Pool for reading COLUMNS in chunks (not owned)
+  CoinThreadPool *threadPool_;
   /// Maximum number of string elements
   int maximumStringElements_;
   /// Number of string elements
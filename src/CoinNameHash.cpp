@@ -0,0 +1,272 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#include "CoinUtilsConfig.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "CoinNameHash.hpp"
+#include "CoinHelperFunctions.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define COIN_NAMEHASH_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+const int groupSize = 16;
+// Control bytes - full slots have seven bits of hash value (0-127)
+const unsigned char emptySlot = 0x80;
+const unsigned char deletedSlot = 0xfe;
+
+// Bit i set if control byte i of group is value
+inline unsigned int matchByte(const unsigned char *group, unsigned char value)
+{
+#ifdef COIN_NAMEHASH_SSE2
+  __m128i control = _mm_loadu_si128(reinterpret_cast< const __m128i * >(group));
+  return static_cast< unsigned int >(_mm_movemask_epi8(
+    _mm_cmpeq_epi8(control, _mm_set1_epi8(static_cast< char >(value)))));
+#else
+  unsigned int mask = 0;
+  for (int i = 0; i < groupSize; i++)
+    mask |= static_cast< unsigned int >(group[i] == value) << i;
+  return mask;
+#endif
+}
+
+// Bit i set if slot i of group is empty or deleted
+inline unsigned int matchFree(const unsigned char *group)
+{
+#ifdef COIN_NAMEHASH_SSE2
+  return static_cast< unsigned int >(_mm_movemask_epi8(
+    _mm_loadu_si128(reinterpret_cast< const __m128i * >(group))));
+#else
+  unsigned int mask = 0;
+  for (int i = 0; i < groupSize; i++)
+    mask |= static_cast< unsigned int >(group[i] >> 7) << i;
+  return mask;
+#endif
+}
+
+// Position of lowest set bit (mask not zero)
+inline int lowestBit(unsigned int mask)
+{
+#if defined(__GNUC__)
+  return __builtin_ctz(mask);
+#else
+  int number = 0;
+  while (!(mask & 1)) {
+    mask >>= 1;
+    number++;
+  }
+  return number;
+#endif
+}
+
+// Seven bits of hash value kept in control byte
+inline unsigned char hashTag(unsigned int hashValue)
+{
+  return static_cast< unsigned char >(hashValue >> 25);
+}
+
+// Entries allowed in numberGroups groups (7/8 full)
+inline int maximumLoad(int numberGroups)
+{
+  return numberGroups * groupSize - (numberGroups * groupSize) / 8;
+}
+
+} // end file-local namespace
+
+// Default constructor
+CoinNameHash::CoinNameHash()
+  : groups_(NULL)
+  , numberGroups_(0)
+  , numberEntries_(0)
+  , growthLeft_(0)
+{
+}
+// Copy constructor
+CoinNameHash::CoinNameHash(const CoinNameHash &rhs)
+  : groups_(NULL)
+  , numberGroups_(rhs.numberGroups_)
+  , numberEntries_(rhs.numberEntries_)
+  , growthLeft_(rhs.growthLeft_)
+{
+  if (numberGroups_)
+    groups_ = CoinCopyOfArray(rhs.groups_, numberGroups_);
+}
+// = copy
+CoinNameHash &CoinNameHash::operator=(const CoinNameHash &rhs)
+{
+  if (this != &rhs) {
+    CoinNameHash copy(rhs);
+    swap(copy);
+  }
+  return *this;
+}
+// Destructor
+CoinNameHash::~CoinNameHash()
+{
+  delete[] groups_;
+}
+// Exchanges contents with rhs
+void CoinNameHash::swap(CoinNameHash &rhs)
+{
+  std::swap(groups_, rhs.groups_);
+  std::swap(numberGroups_, rhs.numberGroups_);
+  std::swap(numberEntries_, rhs.numberEntries_);
+  std::swap(growthLeft_, rhs.growthLeft_);
+}
+// Removes all entries and frees storage
+void CoinNameHash::clear()
+{
+  delete[] groups_;
+  groups_ = NULL;
+  numberGroups_ = 0;
+  numberEntries_ = 0;
+  growthLeft_ = 0;
+}
+// Makes room for number entries
+void CoinNameHash::reserve(const CoinStringPool &names, int number)
+{
+  if (number > numberEntries_ + growthLeft_)
+    rehash(names, number);
+}
+// Index of name or -1
+int CoinNameHash::find(const CoinStringPool &names, const char *name,
+  int length, unsigned int hashValue) const
+{
+  if (!numberEntries_)
+    return -1;
+  unsigned char tag = hashTag(hashValue);
+  int mask = numberGroups_ - 1;
+  int group = static_cast< int >(hashValue) & mask;
+  for (int step = 1;; step++) {
+    const Group &slots = groups_[group];
+    unsigned int match = matchByte(slots.control, tag);
+    while (match) {
+      int which = slots.index[lowestBit(match)];
+      if (names.stringHash(which) == hashValue
+        && names.sameString(which, name, length))
+        return which;
+      match &= match - 1;
+    }
+    // an empty slot ends the search (there is always one)
+    if (matchByte(slots.control, emptySlot))
+      return -1;
+    group = (group + step) & mask;
+  }
+}
+// Index of null terminated name or -1
+int CoinNameHash::find(const CoinStringPool &names, const char *name) const
+{
+  if (!numberEntries_)
+    return -1;
+  int length = static_cast< int >(strlen(name));
+  return find(names, name, length, CoinStringPool::hashString(name, length));
+}
+// Inserts entry index of names
+int CoinNameHash::insert(const CoinStringPool &names, int index)
+{
+  unsigned int hashValue = names.stringHash(index);
+  int found = find(names, names.string(index), names.stringLength(index),
+    hashValue);
+  if (found >= 0)
+    return found;
+  if (!growthLeft_)
+    rehash(names, 2 * numberEntries_ + 1);
+  put(index, hashValue);
+  numberEntries_++;
+  return index;
+}
+// Inserts all set entries of names from first on
+int CoinNameHash::insertAll(const CoinStringPool &names, int first)
+{
+  int number = names.numberStrings();
+  reserve(names, numberEntries_ + number - first);
+  int numberDuplicates = 0;
+  for (int i = first; i < number; i++) {
+    if (names.stringLength(i) >= 0 && insert(names, i) != i)
+      numberDuplicates++;
+  }
+  return numberDuplicates;
+}
+// Removes entry index of names
+void CoinNameHash::remove(const CoinStringPool &names, int index)
+{
+  unsigned int hashValue = names.stringHash(index);
+  unsigned char tag = hashTag(hashValue);
+  int mask = numberGroups_ - 1;
+  int group = static_cast< int >(hashValue) & mask;
+  for (int step = 1; numberEntries_; step++) {
+    unsigned char *control = groups_[group].control;
+    unsigned int match = matchByte(control, tag);
+    while (match) {
+      int k = lowestBit(match);
+      if (groups_[group].index[k] == index) {
+        /* If group has an empty slot no search went past it so slot
+           can be empty again */
+        if (matchByte(control, emptySlot)) {
+          control[k] = emptySlot;
+          growthLeft_++;
+        } else {
+          control[k] = deletedSlot;
+        }
+        numberEntries_--;
+        return;
+      }
+      match &= match - 1;
+    }
+    if (matchByte(control, emptySlot))
+      break;
+    group = (group + step) & mask;
+  }
+  assert(!"name not in CoinNameHash");
+}
+// Puts index in first free slot
+void CoinNameHash::put(int index, unsigned int hashValue)
+{
+  int mask = numberGroups_ - 1;
+  int group = static_cast< int >(hashValue) & mask;
+  for (int step = 1;; step++) {
+    Group &slots = groups_[group];
+    unsigned int available = matchFree(slots.control);
+    if (available) {
+      int k = lowestBit(available);
+      if (slots.control[k] == emptySlot)
+        growthLeft_--;
+      slots.control[k] = hashTag(hashValue);
+      slots.index[k] = index;
+      return;
+    }
+    group = (group + step) & mask;
+  }
+}
+// New table big enough for number entries
+void CoinNameHash::rehash(const CoinStringPool &names, int number)
+{
+  int numberGroups = 1;
+  while (maximumLoad(numberGroups) < number)
+    numberGroups *= 2;
+  Group *groups = groups_;
+  int numberOld = numberGroups_;
+  groups_ = new Group[numberGroups];
+  for (int i = 0; i < numberGroups; i++)
+    memset(groups_[i].control, emptySlot, groupSize);
+  numberGroups_ = numberGroups;
+  growthLeft_ = maximumLoad(numberGroups);
+  // hash values are in pool so nothing is hashed again
+  for (int i = 0; i < numberOld; i++) {
+    for (int k = 0; k < groupSize; k++) {
+      if (!(groups[i].control[k] & 0x80))
+        put(groups[i].index[k], names.stringHash(groups[i].index[k]));
+    }
+  }
+  delete[] groups;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
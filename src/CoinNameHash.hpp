@@ -0,0 +1,111 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifndef CoinNameHash_H
+#define CoinNameHash_H
+
+#include "CoinUtilsConfig.h"
+#include "CoinStringPool.hpp"
+
+/** Name to index lookup for the strings of a CoinStringPool.
+
+    CoinMpsIO, CoinLpIO and CoinModelHash find row and column names with
+    this.  It is an open addressing table - no links and no nodes.  Slots
+    are in groups of 16, each slot has a control byte (empty, deleted or
+    seven bits of the name's hash value) and an index into the pool.  A
+    lookup looks at one group of control bytes at a time (with one SSE2
+    compare where available) so a string is only compared when seven
+    more bits of the hash value agree.  Groups are probed quadratically.
+    The table grows as names are inserted so there is no fixed maximum.
+
+    Only indices are stored.  Names and their hash values (from
+    CoinStringPool::hashString) are in the pool, which is passed to each
+    method and must be the one the indices refer to.
+*/
+class COINUTILSLIB_EXPORT CoinNameHash {
+
+public:
+  /**@name Constructors, destructor and copying */
+  //@{
+  /// Default constructor (empty)
+  CoinNameHash();
+  /// Copy constructor
+  CoinNameHash(const CoinNameHash &rhs);
+  /// = copy
+  CoinNameHash &operator=(const CoinNameHash &rhs);
+  /// Destructor
+  ~CoinNameHash();
+  /// Exchanges contents with rhs (no copying)
+  void swap(CoinNameHash &rhs);
+  //@}
+
+  /**@name Sizes */
+  //@{
+  /// Number of names in table
+  inline int numberEntries() const
+  {
+    return numberEntries_;
+  }
+  /// Number of slots
+  inline int numberSlots() const
+  {
+    return 16 * numberGroups_;
+  }
+  /// Removes all entries and frees storage
+  void clear();
+  /// Makes room for number entries without growing
+  void reserve(const CoinStringPool &names, int number);
+  //@}
+
+  /**@name Lookup */
+  //@{
+  /** Index of name (length characters with hash value hashValue) or -1
+      if not in table */
+  int find(const CoinStringPool &names, const char *name, int length,
+    unsigned int hashValue) const;
+  /// Index of null terminated name or -1 if not in table
+  int find(const CoinStringPool &names, const char *name) const;
+  /** Inserts entry index of names (which must be set).  Returns index or,
+      if an equal name is already in table, index of that (and index is
+      not inserted) */
+  int insert(const CoinStringPool &names, int index);
+  /** Inserts all set entries of names from first on (as insert).
+      Returns number which were not inserted as duplicates */
+  int insertAll(const CoinStringPool &names, int first = 0);
+  /// Removes entry index of names (must be in table with same name)
+  void remove(const CoinStringPool &names, int index);
+  //@}
+
+private:
+  /// Control bytes and indices of 16 slots (next to each other so a
+  /// lookup does not wait for two separate cache misses)
+  struct Group {
+    unsigned char control[16];
+    int index[16];
+  };
+
+  /**@name Private methods */
+  //@{
+  /// Puts index in first free slot for hashValue (no checking)
+  void put(int index, unsigned int hashValue);
+  /// New table big enough for number entries with same entries
+  void rehash(const CoinStringPool &names, int number);
+  //@}
+
+  /**@name Data */
+  //@{
+  /// Groups of slots
+  Group *groups_;
+  /// Number of groups (zero or power of two)
+  int numberGroups_;
+  /// Number of entries
+  int numberEntries_;
+  /// Entries which can be added before table must grow
+  int growthLeft_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -12,6 +12,8 @@
 #include "CoinHelperFunctions.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinFinite.hpp"
+#include "CoinArrayFile.hpp"
+#include "CoinFactorizationStatistics.hpp"
 #include <stdio.h>
 static void c_ekksmem(EKKfactinfo *fact, int numberRows, int maximumPivots);
 static void c_ekksmem_copy(EKKfactinfo *fact, const EKKfactinfo *rhsFact);
@@ -234,6 +236,8 @@ void CoinOslFactorization::preProcess()
 //Does factorization
 int CoinOslFactorization::factor()
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::factorizePhase);
   /*     Uwe's factorization (sort of) */
   int irtcod = c_ekklfct(&factInfo_);
 
@@ -259,6 +263,11 @@ int CoinOslFactorization::factor()
     status_ = -1;
     //printf("singular %d\n",irtcod);
   }
+  if (!status_) {
+    factorElements_ = numberFactorElements();
+    if (statistics_)
+      statistics_->addFactorization(0, factorElements_, 0);
+  }
   return status_;
 }
 // Makes a non-singular basis by replacing variables
@@ -378,6 +387,8 @@ int CoinOslFactorization::replaceColumn(CoinIndexedVector *regionSparse,
   bool /*checkBeforeModifying*/,
   double acceptablePivot)
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::replaceColumnPhase);
   if (numberPivots_ + 1 == maximumPivots_)
     return 3;
   int *regionIndex = regionSparse->getIndices();
@@ -404,6 +415,8 @@ int CoinOslFactorization::replaceColumn(CoinIndexedVector *regionSparse,
       assert(dluval[mcstrt[ndo] + 1] < 1.0e50);
   }
 #endif
+  if (statistics_)
+    statistics_->setUpdateElements(numberFactorElements() - factorElements_);
   return returnCode;
 }
 /* This version has same effect as above with FTUpdate==false
@@ -412,6 +425,8 @@ int CoinOslFactorization::updateColumn(CoinIndexedVector *regionSparse,
   CoinIndexedVector *regionSparse2,
   bool /*noPermute*/) const
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::ftranPhase);
 #ifndef NDEBUG
   {
     int lstart = numberRows_ + factInfo_.maxinv + 5;
@@ -456,6 +471,8 @@ int CoinOslFactorization::updateColumnFT(CoinIndexedVector *regionSparse,
   CoinIndexedVector *regionSparse2,
   bool /*noPermute*/)
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::ftranFTPhase);
   assert(numberRows_ == numberColumns_);
   double *region2 = regionSparse2->denseVector();
   int *regionIndex2 = regionSparse2->getIndices();
@@ -481,6 +498,8 @@ int CoinOslFactorization::updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
   CoinIndexedVector *regionSparse3,
   bool /*noPermute*/)
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::ftranTwoPhase);
 #if 1
   // probably best to merge on a LU part by part
   // but can try full merge
@@ -530,6 +549,8 @@ int CoinOslFactorization::updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
 int CoinOslFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
   CoinIndexedVector *regionSparse2) const
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::btranPhase);
   assert(numberRows_ == numberColumns_);
   double *region2 = regionSparse2->denseVector();
   int *regionIndex2 = regionSparse2->getIndices();
@@ -1349,6 +1370,131 @@ static void c_ekksmem_delete(EKKfactinfo *fact)
   fact->kadrpm = 0;
   fact->kw1adr = 0;
 }
+namespace {
+// Version of saved factors - change if EKKfactinfo changes
+const int savedOslVersion = 1;
+// Sections in saved factors
+enum {
+  savedOslIntegers = 1,
+  savedOslDoubles,
+  savedOslTolerances,
+  savedOslScalars,
+  savedOslOffsets,
+  savedOslWork,
+  savedOslEtaRow,
+  savedOslEtaColumn,
+  savedOslEtaElement,
+  savedOslEtaElement2
+};
+}
+/* Saves factors.  The work arrays are one chunk (as in c_ekksmem_copy)
+   and the eta arrays are saved whole */
+int CoinOslFactorization::saveFactors(const char *fileName) const
+{
+  if (status_ || !factInfo_.nrowmx || !factInfo_.xeradr)
+    return -1;
+  EKKfactinfo fact = factInfo_;
+  clp_adjust_pointers(&fact, +1);
+  int offsets[3];
+  offsets[0] = static_cast< int >(fact.R_etas_start - fact.xcsadr);
+  offsets[1] = static_cast< int >(fact.R_etas_index - fact.xeradr);
+  offsets[2] = static_cast< int >(fact.R_etas_element - fact.xeeadr);
+  int length;
+  clp_alloc_memory(&fact, 0, &length);
+  int integers[numberSavedBaseIntegers];
+  double doubles[numberSavedBaseDoubles];
+  getBaseScalars(integers, doubles);
+  // eta_size may have been increased since arrays were allocated
+  int nnetas = fact.nnetas;
+  CoinArrayFileWriter file(CoinArrayFileOslFactorization, savedOslVersion);
+  file.addArray(savedOslIntegers, integers, numberSavedBaseIntegers);
+  file.addArray(savedOslDoubles, doubles, numberSavedBaseDoubles);
+  file.addArray(savedOslTolerances, &fact.drtpiv, 5);
+  // scalars from nrow to maxNNetas (as c_ekksmem_copy)
+  file.addArray(savedOslScalars, reinterpret_cast< const char * >(&fact.nrow),
+    static_cast< int >(((&fact.maxNNetas - &fact.nrow) + 1) * sizeof(int)));
+  file.addArray(savedOslOffsets, offsets, 3);
+  file.addArray(savedOslWork, fact.kw1adr, length);
+  file.addArray(savedOslEtaRow, fact.xeradr, nnetas);
+  file.addArray(savedOslEtaColumn, fact.xecadr, nnetas);
+  file.addArray(savedOslEtaElement, fact.xeeadr, nnetas);
+  if (fact.xe2adr)
+    file.addArray(savedOslEtaElement2, fact.xe2adr, nnetas);
+  return file.write(fileName);
+}
+/* Restores factors.  Memory is as after c_ekksmem but all of each
+   eta array is copied (c_ekksmem_copy only copies parts in use) */
+int CoinOslFactorization::restoreFactors(const char *fileName)
+{
+  CoinArrayFileReader file;
+  int returnCode = file.open(fileName);
+  if (returnCode)
+    return returnCode;
+  if (file.kind() != CoinArrayFileOslFactorization
+    || file.kindVersion() != savedOslVersion)
+    return 2;
+  EKKfactinfo fact;
+  memset(&fact, 0, sizeof(fact));
+  CoinBigIndex n;
+  const int *integers = file.array< int >(savedOslIntegers, n);
+  if (!integers || n != numberSavedBaseIntegers)
+    return 2;
+  const double *doubles = file.array< double >(savedOslDoubles, n);
+  if (!doubles || n != numberSavedBaseDoubles)
+    return 2;
+  if (!file.copyArray(savedOslTolerances, &fact.drtpiv, 5)
+    || !file.copyArray(savedOslScalars, reinterpret_cast< char * >(&fact.nrow),
+         static_cast< int >(((&fact.maxNNetas - &fact.nrow) + 1) * sizeof(int))))
+    return 2;
+  const int *offsets = file.array< int >(savedOslOffsets, n);
+  if (!offsets || n != 3 || fact.nrowmx <= 0 || fact.nnetas <= 0)
+    return 2;
+  // check work chunk is right size (pointers are only used for length)
+  CoinBigIndex lengthWork;
+  const double *work = file.array< double >(savedOslWork, lengthWork);
+  if (!work)
+    return 2;
+  fact.trueStart = const_cast< double * >(work);
+  fact.kw1adr = fact.trueStart;
+  int length;
+  clp_alloc_memory(&fact, 0, &length);
+  int nnetas = fact.nnetas;
+  CoinBigIndex n1, n2, n3, n4;
+  const int *etaRow = file.array< int >(savedOslEtaRow, n1);
+  const int *etaColumn = file.array< int >(savedOslEtaColumn, n2);
+  const double *etaElement = file.array< double >(savedOslEtaElement, n3);
+  const double *etaElement2 = file.array< double >(savedOslEtaElement2, n4);
+  if (length != lengthWork || !etaRow || !etaColumn || !etaElement
+    || n1 != nnetas || n2 != nnetas || n3 != nnetas
+    || (etaElement2 && n4 != nnetas))
+    return 2;
+  gutsOfDestructor(true);
+  gutsOfInitialize(true);
+  setBaseScalars(integers, doubles);
+  // allocate as c_ekksmem and copy everything
+  memcpy(&factInfo_.drtpiv, &fact.drtpiv, 5 * sizeof(double));
+  memcpy(&factInfo_.nrow, &fact.nrow, ((&fact.maxNNetas - &fact.nrow) + 1) * sizeof(int));
+  factInfo_.trueStart = clp_alloc_memory(&factInfo_, 1, &length);
+  factInfo_.kw1adr = reinterpret_cast< double * >(clp_align(factInfo_.trueStart));
+  clp_alloc_memory(&factInfo_, 0, &length);
+  memcpy(factInfo_.kw1adr, work, length * sizeof(double));
+  factInfo_.xeradr = clp_int(nnetas);
+  factInfo_.xecadr = clp_int(nnetas);
+  factInfo_.xeeadr = clp_double(nnetas);
+  CoinMemcpyN(etaRow, nnetas, factInfo_.xeradr);
+  CoinMemcpyN(etaColumn, nnetas, factInfo_.xecadr);
+  CoinMemcpyN(etaElement, nnetas, factInfo_.xeeadr);
+  if (etaElement2) {
+    factInfo_.xe2adr = clp_double(nnetas);
+    CoinMemcpyN(etaElement2, nnetas, factInfo_.xe2adr);
+  }
+  factInfo_.R_etas_start = factInfo_.xcsadr + offsets[0];
+  factInfo_.R_etas_index = factInfo_.xeradr + offsets[1];
+  factInfo_.R_etas_element = factInfo_.xeeadr + offsets[2];
+  clp_adjust_pointers(&factInfo_, -1);
+  clp_setup_pointers(&factInfo_);
+  return 0;
+}
 int c_ekk_IsSet(const int *array, int bit);
 void c_ekk_Set(int *array, int bit);
 void c_ekk_Unset(int *array, int bit);
@@ -162,6 +162,12 @@ public:
   {
     return numberRows_ * (numberColumns_ + numberPivots_);
   }
+  /** Number of elements actually held in L, U and etas
+      (numberElements is dense size) */
+  inline int numberFactorElements() const
+  {
+    return factInfo_.nnentu + factInfo_.nnentl;
+  }
   /// Returns array to put basis elements in
   virtual CoinFactorizationDouble2 *elements() const;
   /// Returns pivot row
@@ -194,6 +200,13 @@ public:
   double conditionNumber() const;
   /// Get rid of all memory
   virtual void clearArrays();
+  /** Saves factors in binary form (see CoinArrayFile.hpp).
+      Returns 0 if okay, 1 if could not write, -1 if not factorized */
+  virtual int saveFactors(const char *file) const;
+  /** Restores factors saved by saveFactors.
+      Returns 0 if okay, 1 if could not read, 2 if not a valid file,
+      3 if a checksum is wrong */
+  virtual int restoreFactors(const char *file);
   //@}
 
   /**@name rank one updates which do exist */
@@ -205,7 +218,10 @@ public:
       before modifying factorization.  Whether to set this depends on
       speed considerations.  You could just do this on first iteration
       after factorization and thereafter re-factorize
-   partial update already in U */
+   partial update already in U.
+      There is no rank k version - to bring in several columns call
+      updateColumnFT and replaceColumn for each in turn (U and R would
+      grow as much anyway) */
   virtual int replaceColumn(CoinIndexedVector *regionSparse,
     int pivotRow,
     double pivotCheck,
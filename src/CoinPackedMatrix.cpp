@@ -19,6 +19,7 @@
 #endif
 #include "CoinFloatEqual.hpp"
 #include "CoinPackedMatrix.hpp"
+#include "CoinThreadPool.hpp"
 
 #if !defined(COINUTILS_CHECKLEVEL)
 #define COINUTILS_CHECKLEVEL 0
@@ -1065,6 +1066,15 @@ void CoinPackedMatrix::reverseOrdering()
   swap(m);
 }
 
+void CoinPackedMatrix::reverseOrdering(CoinThreadPool *pool)
+{
+  CoinPackedMatrix m;
+  m.extraGap_ = extraMajor_;
+  m.extraMajor_ = extraGap_;
+  m.reverseOrderedCopyOf(*this, pool);
+  swap(m);
+}
+
 //-----------------------------------------------------------------------------
 
 void CoinPackedMatrix::transpose()
@@ -1131,6 +1141,27 @@ void CoinPackedMatrix::transposeTimes(const CoinPackedVectorBase &x, double *y)
     timesMajor(x, y);
 }
 #endif
+//-----------------------------------------------------------------------------
+
+void CoinPackedMatrix::times(const double *x, double *y,
+  CoinThreadPool *pool) const
+{
+  if (colOrdered_)
+    timesMajor(x, y, pool);
+  else
+    timesMinor(x, y, pool);
+}
+
+//-----------------------------------------------------------------------------
+
+void CoinPackedMatrix::transposeTimes(const double *x, double *y,
+  CoinThreadPool *pool) const
+{
+  if (colOrdered_)
+    timesMinor(x, y, pool);
+  else
+    timesMajor(x, y, pool);
+}
 //#############################################################################
 //#############################################################################
 /* Count the number of entries in every minor-dimension vector and
@@ -1818,6 +1849,357 @@ void CoinPackedMatrix::timesMinor(const CoinPackedVectorBase &x, double *y) cons
   }
 }
 #endif
+//-----------------------------------------------------------------------------
+
+namespace {
+// Work for threaded timesMajor and timesMinor
+typedef struct {
+  const CoinPackedMatrix *matrix;
+  const double *x;
+  double *y;
+  // first major vector of each chunk (numberChunks+1)
+  const int *first;
+  // first minor index summed by each task (timesMajor)
+  const int *firstMinor;
+  // copies of y for chunks after first (timesMajor)
+  double *work;
+  int numberCopies;
+} CoinTimesInfo;
+
+/* Splits major vectors into numberChunks chunks with about the same
+   number of elements (gaps between vectors are counted too) */
+void splitByElements(const CoinPackedMatrix &matrix, int numberChunks,
+  int *first)
+{
+  int majorDim = matrix.getMajorDim();
+  const CoinBigIndex *start = matrix.getVectorStarts();
+  double total = static_cast< double >(start[majorDim] - start[0]);
+  first[0] = 0;
+  for (int i = 1; i < numberChunks; i++) {
+    CoinBigIndex target = start[0]
+      + static_cast< CoinBigIndex >(total * i / numberChunks);
+    int iMajor = static_cast< int >(std::lower_bound(start, start + majorDim,
+                                      target)
+      - start);
+    first[i] = CoinMax(first[i - 1], iMajor);
+  }
+  first[numberChunks] = majorDim;
+}
+
+// Scatters one chunk into y (chunk 0) or its own copy of y
+void timesMajorTask(void *infoPointer, int which)
+{
+  const CoinTimesInfo *info = static_cast< const CoinTimesInfo * >(infoPointer);
+  const CoinPackedMatrix *matrix = info->matrix;
+  int minorDim = matrix->getMinorDim();
+  const CoinBigIndex *start = matrix->getVectorStarts();
+  const int *length = matrix->getVectorLengths();
+  const int *index = matrix->getIndices();
+  const double *element = matrix->getElements();
+  const double *x = info->x;
+  double *y = which ? info->work + (which - 1) * static_cast< size_t >(minorDim)
+                    : info->y;
+  memset(y, 0, minorDim * sizeof(double));
+  for (int i = info->first[which + 1] - 1; i >= info->first[which]; --i) {
+    const double x_i = x[i];
+    if (x_i != 0.0) {
+      const CoinBigIndex last = start[i] + length[i];
+      for (CoinBigIndex j = start[i]; j < last; ++j)
+        y[index[j]] += x_i * element[j];
+    }
+  }
+}
+
+// Sums copies of y in chunk order for one range of minor indices
+void sumCopiesTask(void *infoPointer, int which)
+{
+  const CoinTimesInfo *info = static_cast< const CoinTimesInfo * >(infoPointer);
+  size_t stride = static_cast< size_t >(info->matrix->getMinorDim());
+  int numberCopies = info->numberCopies;
+  double *y = info->y;
+  for (int i = info->firstMinor[which]; i < info->firstMinor[which + 1]; i++) {
+    double value = y[i];
+    const double *work = info->work + i;
+    for (int k = 0; k < numberCopies; k++)
+      value += work[k * stride];
+    y[i] = value;
+  }
+}
+
+// Gathers for one chunk
+void timesMinorTask(void *infoPointer, int which)
+{
+  const CoinTimesInfo *info = static_cast< const CoinTimesInfo * >(infoPointer);
+  const CoinPackedMatrix *matrix = info->matrix;
+  const CoinBigIndex *start = matrix->getVectorStarts();
+  const int *length = matrix->getVectorLengths();
+  const int *index = matrix->getIndices();
+  const double *element = matrix->getElements();
+  const double *x = info->x;
+  double *y = info->y;
+  for (int i = info->first[which + 1] - 1; i >= info->first[which]; --i) {
+    double y_i = 0;
+    const CoinBigIndex last = start[i] + length[i];
+    for (CoinBigIndex j = start[i]; j < last; ++j)
+      y_i += x[index[j]] * element[j];
+    y[i] = y_i;
+  }
+}
+}
+
+void CoinPackedMatrix::timesMajor(const double *x, double *y,
+  CoinThreadPool *pool) const
+{
+  // each chunk must have at least minorDim elements to be worth a copy
+  int numberChunks = pool ? pool->numberThreads() : 1;
+  if (minorDim_ > 0)
+    numberChunks = static_cast< int >(CoinMin(static_cast< CoinBigIndex >(numberChunks),
+      size_ / minorDim_));
+  if (numberChunks <= 1 || !majorDim_) {
+    timesMajor(x, y);
+    return;
+  }
+  int *first = new int[2 * (numberChunks + 1)];
+  int *firstMinor = first + numberChunks + 1;
+  splitByElements(*this, numberChunks, first);
+  // copies are summed in ranges of minor indices
+  for (int i = 0; i <= numberChunks; i++)
+    firstMinor[i] = static_cast< int >((static_cast< double >(minorDim_) * i)
+      / numberChunks);
+  double *work = new double[(numberChunks - 1) * static_cast< size_t >(minorDim_)];
+  CoinTimesInfo info;
+  info.matrix = this;
+  info.x = x;
+  info.y = y;
+  info.first = first;
+  info.firstMinor = firstMinor;
+  info.work = work;
+  info.numberCopies = numberChunks - 1;
+  pool->run(numberChunks, timesMajorTask, &info);
+  pool->run(numberChunks, sumCopiesTask, &info);
+  delete[] work;
+  delete[] first;
+}
+
+//-----------------------------------------------------------------------------
+
+void CoinPackedMatrix::timesMinor(const double *x, double *y,
+  CoinThreadPool *pool) const
+{
+  int numberChunks = pool ? CoinMin(pool->numberThreads(), majorDim_) : 1;
+  if (numberChunks <= 1) {
+    timesMinor(x, y);
+    return;
+  }
+  int *first = new int[numberChunks + 1];
+  splitByElements(*this, numberChunks, first);
+  CoinTimesInfo info;
+  info.matrix = this;
+  info.x = x;
+  info.y = y;
+  info.first = first;
+  info.firstMinor = NULL;
+  info.work = NULL;
+  info.numberCopies = 0;
+  pool->run(numberChunks, timesMinorTask, &info);
+  delete[] first;
+}
+
+//-----------------------------------------------------------------------------
+
+namespace {
+// Work for threaded reverseOrderedCopyOf
+typedef struct {
+  const CoinPackedMatrix *rhs;
+  // first major vector of rhs in each chunk (numberChunks+1)
+  const int *first;
+  // first new major vector in each range for counting (numberChunks+1)
+  const int *firstNew;
+  // counts and then positions - numberChunks by new major dimension
+  CoinBigIndex *position;
+  // total length (with extra gap) of each range
+  CoinBigIndex *rangeLength;
+  int numberChunks;
+  int majorDim;
+  double extraGap;
+  CoinBigIndex *start;
+  int *length;
+  int *index;
+  double *element;
+} CoinReverseInfo;
+
+// Counts entries of one chunk in each new major vector
+void reverseCountTask(void *infoPointer, int which)
+{
+  const CoinReverseInfo *info = static_cast< const CoinReverseInfo * >(infoPointer);
+  const CoinPackedMatrix *rhs = info->rhs;
+  const CoinBigIndex *COIN_RESTRICT start = rhs->getVectorStarts();
+  const int *COIN_RESTRICT length = rhs->getVectorLengths();
+  const int *COIN_RESTRICT index = rhs->getIndices();
+  CoinBigIndex *COIN_RESTRICT count = info->position
+    + which * static_cast< size_t >(info->majorDim);
+  CoinZeroN(count, info->majorDim);
+  for (int i = info->first[which]; i < info->first[which + 1]; i++) {
+    const CoinBigIndex last = start[i] + length[i];
+    for (CoinBigIndex j = start[i]; j < last; ++j)
+      count[index[j]]++;
+  }
+}
+
+// Lengths of new major vectors in one range
+void reverseLengthTask(void *infoPointer, int which)
+{
+  const CoinReverseInfo *info = static_cast< const CoinReverseInfo * >(infoPointer);
+  size_t stride = static_cast< size_t >(info->majorDim);
+  const CoinBigIndex *position = info->position;
+  int *length = info->length;
+  const double eg = info->extraGap;
+  CoinBigIndex total = 0;
+  for (int i = info->firstNew[which]; i < info->firstNew[which + 1]; i++) {
+    CoinBigIndex n = 0;
+    for (int k = 0; k < info->numberChunks; k++)
+      n += position[k * stride + i];
+    length[i] = static_cast< int >(n);
+    total += eg ? CoinLengthWithExtra(n, eg) : n;
+  }
+  info->rangeLength[which] = total;
+}
+
+// Starts of new major vectors in one range and where each chunk puts
+void reverseStartTask(void *infoPointer, int which)
+{
+  const CoinReverseInfo *info = static_cast< const CoinReverseInfo * >(infoPointer);
+  size_t stride = static_cast< size_t >(info->majorDim);
+  CoinBigIndex *position = info->position;
+  const int *length = info->length;
+  CoinBigIndex *start = info->start;
+  const double eg = info->extraGap;
+  // rangeLength now has start of each range
+  CoinBigIndex put = info->rangeLength[which];
+  for (int i = info->firstNew[which]; i < info->firstNew[which + 1]; i++) {
+    start[i] = put;
+    CoinBigIndex next = put;
+    for (int k = 0; k < info->numberChunks; k++) {
+      CoinBigIndex n = position[k * stride + i];
+      position[k * stride + i] = next;
+      next += n;
+    }
+    put += eg ? CoinLengthWithExtra(static_cast< CoinBigIndex >(length[i]), eg)
+              : length[i];
+  }
+}
+
+// Copies entries of one chunk
+void reverseCopyTask(void *infoPointer, int which)
+{
+  const CoinReverseInfo *info = static_cast< const CoinReverseInfo * >(infoPointer);
+  const CoinPackedMatrix *rhs = info->rhs;
+  const CoinBigIndex *COIN_RESTRICT start = rhs->getVectorStarts();
+  const int *COIN_RESTRICT length = rhs->getVectorLengths();
+  const int *COIN_RESTRICT index = rhs->getIndices();
+  const double *COIN_RESTRICT element = rhs->getElements();
+  CoinBigIndex *COIN_RESTRICT put = info->position
+    + which * static_cast< size_t >(info->majorDim);
+  int *COIN_RESTRICT newIndex = info->index;
+  double *COIN_RESTRICT newElement = info->element;
+  for (int i = info->first[which]; i < info->first[which + 1]; i++) {
+    const CoinBigIndex last = start[i] + length[i];
+    for (CoinBigIndex j = start[i]; j < last; ++j) {
+      const CoinBigIndex where = put[index[j]]++;
+      newElement[where] = element[j];
+      newIndex[where] = i;
+    }
+  }
+}
+}
+
+void CoinPackedMatrix::reverseOrderedCopyOf(const CoinPackedMatrix &rhs,
+  CoinThreadPool *pool)
+{
+  // each chunk must have at least as many elements as counts it zeroes
+  int numberChunks = pool ? pool->numberThreads() : 1;
+  if (rhs.minorDim_ > 0)
+    numberChunks = static_cast< int >(CoinMin(static_cast< CoinBigIndex >(numberChunks),
+      rhs.size_ / rhs.minorDim_));
+  numberChunks = CoinMin(numberChunks, rhs.majorDim_);
+  if (this == &rhs) {
+    reverseOrdering(pool);
+    return;
+  } else if (numberChunks <= 1) {
+    reverseOrderedCopyOf(rhs);
+    return;
+  }
+
+  colOrdered_ = !rhs.colOrdered_;
+  majorDim_ = rhs.minorDim_;
+  minorDim_ = rhs.majorDim_;
+  size_ = rhs.size_;
+
+  // Allocate sufficient space as serial version
+  const int newMaxMajorDim_ = std::max(maxMajorDim_, CoinLengthWithExtra(majorDim_, extraMajor_));
+
+  if (newMaxMajorDim_ > maxMajorDim_) {
+    maxMajorDim_ = newMaxMajorDim_;
+    delete[] start_;
+    delete[] length_;
+    start_ = new CoinBigIndex[maxMajorDim_ + 1];
+    length_ = new int[maxMajorDim_];
+  }
+
+  int *first = new int[2 * (numberChunks + 1)];
+  int *firstNew = first + numberChunks + 1;
+  splitByElements(rhs, numberChunks, first);
+  for (int i = 0; i <= numberChunks; i++)
+    firstNew[i] = static_cast< int >((static_cast< double >(majorDim_) * i)
+      / numberChunks);
+  CoinBigIndex *position = new CoinBigIndex[numberChunks * static_cast< size_t >(majorDim_)];
+  CoinBigIndex *rangeLength = new CoinBigIndex[numberChunks];
+  CoinReverseInfo info;
+  info.rhs = &rhs;
+  info.first = first;
+  info.firstNew = firstNew;
+  info.position = position;
+  info.rangeLength = rangeLength;
+  info.numberChunks = numberChunks;
+  info.majorDim = majorDim_;
+  info.extraGap = extraGap_;
+  info.start = start_;
+  info.length = length_;
+  info.index = NULL;
+  info.element = NULL;
+  pool->run(numberChunks, reverseCountTask, &info);
+  pool->run(numberChunks, reverseLengthTask, &info);
+  // ranges follow each other
+  CoinBigIndex put = 0;
+  for (int i = 0; i < numberChunks; i++) {
+    CoinBigIndex n = rangeLength[i];
+    rangeLength[i] = put;
+    put += n;
+  }
+  start_[majorDim_] = put;
+  pool->run(numberChunks, reverseStartTask, &info);
+
+  const CoinBigIndex newMaxSize = std::max(maxSize_, CoinLengthWithExtra(getLastStart(), extraMajor_));
+
+  if (newMaxSize > maxSize_) {
+    maxSize_ = newMaxSize;
+    delete[] index_;
+    delete[] element_;
+    index_ = new int[maxSize_];
+    element_ = new double[maxSize_];
+#ifdef ZEROFAULT
+    memset(index_, 0, (maxSize_ * sizeof(int)));
+    memset(element_, 0, (maxSize_ * sizeof(double)));
+#endif
+  }
+  info.index = index_;
+  info.element = element_;
+  pool->run(numberChunks, reverseCopyTask, &info);
+  delete[] rangeLength;
+  delete[] position;
+  delete[] first;
+}
+
 //#############################################################################
 //#############################################################################
 
@@ -13,6 +13,7 @@
 #else
 class COINUTILSLIB_EXPORT CoinRelFltEq;
 #endif
+class CoinThreadPool;
 
 /** Sparse Matrix Base Class
 
@@ -411,6 +412,15 @@ public:
       (Cf. #reverseOrdering, which does the same thing in place.)
     */
   void reverseOrderedCopyOf(const CoinPackedMatrix &rhs);
+  /** As reverseOrderedCopyOf but using the threads of pool (serial if
+      NULL).  Major vectors of rhs are split into chunks with about the
+      same number of elements.  Each chunk counts its entries of each new
+      major vector, the counts give every chunk its own place in each new
+      major vector and then chunks copy their entries in parallel.  The
+      result is exactly the same as that of the serial version.  Fewer
+      chunks are used if a chunk would have fewer elements than the new
+      major dimension. */
+  void reverseOrderedCopyOf(const CoinPackedMatrix &rhs, CoinThreadPool *pool);
 
   /** Assign the arguments to the matrix. If <code>len</code> is a NULL
 	pointer then the matrix is assumed to have no gaps in it and
@@ -438,6 +448,8 @@ public:
       the same thing but produces a new matrix.)
     */
   void reverseOrdering();
+  /// As reverseOrdering but using the threads of pool (serial if NULL)
+  void reverseOrdering(CoinThreadPool *pool);
 
   /*! \brief Transpose the matrix.
 
@@ -476,6 +488,13 @@ public:
         method, just <code>x</code> is given in the form of a packed vector. */
   void transposeTimes(const CoinPackedVectorBase &x, double *y) const;
 #endif
+  /** Return <code>A * x</code> in <code>y</code> using the threads of
+        pool (serial if pool is NULL).  See timesMajor and timesMinor for
+        which results are the same as those of the serial version. */
+  void times(const double *x, double *y, CoinThreadPool *pool) const;
+  /** Return <code>x * A</code> in <code>y</code> using the threads of
+        pool (serial if pool is NULL). */
+  void transposeTimes(const double *x, double *y, CoinThreadPool *pool) const;
   //@}
 
   //---------------------------------------------------------------------------
@@ -643,6 +662,22 @@ public:
 	  given in the form of a packed vector. */
   void timesMinor(const CoinPackedVectorBase &x, double *y) const;
 #endif
+  /** As timesMajor but using the threads of pool (serial if NULL).
+        Major vectors are split into one chunk per thread with about the
+        same number of elements.  Each chunk adds into its own copy of
+        <code>y</code> and the copies are then summed in chunk order, so
+        results do not depend on timing but can differ in the last bits
+        from those of the serial version or another number of threads.
+        Fewer chunks are used if a chunk would have fewer elements than
+        minorDim (as then summing copies would cost more than it saves).
+        For results identical to the serial ones keep a copy of the
+        matrix with the other ordering and use its timesMinor. */
+  void timesMajor(const double *x, double *y, CoinThreadPool *pool) const;
+  /** As timesMinor but using the threads of pool (serial if NULL).
+        Major vectors are split into one chunk per thread with about the
+        same number of elements.  Each element of <code>y</code> is
+        computed exactly as by the serial version. */
+  void timesMinor(const double *x, double *y, CoinThreadPool *pool) const;
   //@}
   //@}
 
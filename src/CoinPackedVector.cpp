@@ -192,8 +192,8 @@ void CoinPackedVector::insert(int index, double element)
 {
   const int s = nElements_;
   if (testForDuplicateIndex()) {
-    std::set< int > &is = *indexSet("insert", "CoinPackedVector");
-    if (!is.insert(index).second)
+    CoinIndexHash &is = *indexSet("insert", "CoinPackedVector");
+    if (!is.insert(index))
       throw CoinError("Index already exists", "insert", "CoinPackedVector");
   }
 
@@ -215,9 +215,10 @@ void CoinPackedVector::append(const CoinPackedVectorBase &caboose)
   if (cs == 0) {
     return;
   }
+  CoinIndexHash *is = NULL;
   if (testForDuplicateIndex()) {
-    // Just to initialize the index heap
-    indexSet("append (1st call)", "CoinPackedVector");
+    // Just to initialize the index set
+    is = indexSet("append (1st call)", "CoinPackedVector");
   }
   const int s = nElements_;
   // Make sure there is enough room for the caboose
@@ -230,10 +231,9 @@ void CoinPackedVector::append(const CoinPackedVectorBase &caboose)
   CoinDisjointCopyN(celem, cs, elements_ + s);
   CoinIotaN(origIndices_ + s, cs, s);
   nElements_ += cs;
-  if (testForDuplicateIndex()) {
-    std::set< int > &is = *indexSet("append (2nd call)", "CoinPackedVector");
+  if (is) {
     for (int i = 0; i < cs; ++i) {
-      if (!is.insert(cind[i]).second)
+      if (!is->insert(cind[i]))
         throw CoinError("duplicate index", "append", "CoinPackedVector");
     }
   }
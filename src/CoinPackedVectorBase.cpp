@@ -38,16 +38,10 @@ double
 
   // Get a reference to a map of full storage indices to
   // packed storage location.
-  const std::set< int > &sv = *indexSet("operator[]", "CoinPackedVectorBase");
-#if 1
-  if (sv.find(i) == sv.end())
+  const CoinIndexHash &sv = *indexSet("operator[]", "CoinPackedVectorBase");
+  if (!sv.contains(i))
     return 0.0;
   return getElements()[findIndex(i)];
-#else
-  // LL: suggested change, somthing is wrong with this
-  const size_t ind = std::distance(sv.begin(), sv.find(i));
-  return (ind == sv.size()) ? 0.0 : getElements()[ind];
-#endif
 }
 
 //#############################################################################
@@ -105,8 +99,8 @@ bool CoinPackedVectorBase::isExistingIndex(int i) const
   if (!testedDuplicateIndex_)
     duplicateIndex("indexExists", "CoinPackedVectorBase");
 
-  const std::set< int > &sv = *indexSet("indexExists", "CoinPackedVectorBase");
-  return sv.find(i) != sv.end();
+  const CoinIndexHash &sv = *indexSet("indexExists", "CoinPackedVectorBase");
+  return sv.contains(i);
 }
 
 int CoinPackedVectorBase::findIndex(int i) const
@@ -118,6 +112,39 @@ int CoinPackedVectorBase::findIndex(int i) const
   return retVal;
 }
 
+void CoinPackedVectorBase::findIndex(int number, const int *which,
+  int *positions) const
+{
+  const int s = getNumElements();
+  if (!s || number < 4) {
+    for (int k = 0; k < number; k++)
+      positions[k] = findIndex(which[k]);
+    return;
+  }
+  const int *inds = getIndices();
+  findMaxMinIndices();
+  CoinBigIndex range = static_cast< CoinBigIndex >(maxIndex_) - minIndex_ + 1;
+  if (minIndex_ >= 0 && range <= 4 * static_cast< CoinBigIndex >(s + number)) {
+    // dense array of positions (going backwards so first one is found)
+    int *position = new int[range];
+    CoinFillN(position, static_cast< int >(range), -1);
+    for (int j = s - 1; j >= 0; --j)
+      position[inds[j] - minIndex_] = j;
+    for (int k = 0; k < number; k++) {
+      int i = which[k];
+      positions[k] = (i >= minIndex_ && i <= maxIndex_) ? position[i - minIndex_] : -1;
+    }
+    delete[] position;
+  } else {
+    // hash table (duplicates are not added so first one is found)
+    CoinIndexHash hash;
+    hash.reserve(s);
+    for (int j = 0; j < s; ++j)
+      hash.insert(inds[j], j);
+    hash.find(number, which, positions);
+  }
+}
+
 //#############################################################################
 
 bool CoinPackedVectorBase::operator==(const CoinPackedVectorBase &rhs) const
@@ -250,9 +277,9 @@ void CoinPackedVectorBase::findMaxMinIndices() const
   if (getNumElements() == 0)
     return;
   // if indexSet exists then grab begin and rend to get min & max indices
-  else if (indexSetPtr_ != NULL) {
-    maxIndex_ = *indexSetPtr_->rbegin();
-    minIndex_ = *indexSetPtr_->begin();
+  else if (indexSetPtr_ != NULL && indexSetPtr_->size()) {
+    maxIndex_ = indexSetPtr_->maximumKey();
+    minIndex_ = indexSetPtr_->minimumKey();
   } else {
     // Have to scan through vector to find min and max.
     maxIndex_ = *(std::max_element(getIndices(),
@@ -264,27 +291,24 @@ void CoinPackedVectorBase::findMaxMinIndices() const
 
 //-------------------------------------------------------------------
 
-std::set< int > *
+CoinIndexHash *
 CoinPackedVectorBase::indexSet(const char *methodName,
   const char *className) const
 {
   testedDuplicateIndex_ = true;
-  if (indexSetPtr_ == NULL) {
-    // create a set of the indices
-    indexSetPtr_ = new std::set< int >;
-    const int s = getNumElements();
-    const int *inds = getIndices();
-    for (int j = 0; j < s; ++j) {
-      if (!indexSetPtr_->insert(inds[j]).second) {
-        testedDuplicateIndex_ = false;
-        delete indexSetPtr_;
-        indexSetPtr_ = NULL;
-        if (methodName != NULL) {
-          throw CoinError("Duplicate index found", methodName, className);
-        } else {
-          throw CoinError("Duplicate index found",
-            "indexSet", "CoinPackedVectorBase");
-        }
+  if (indexSetPtr_ == NULL)
+    indexSetPtr_ = new CoinIndexHash;
+  const int s = getNumElements();
+  if (indexSetPtr_->size() != s) {
+    // fill with the indices
+    if (indexSetPtr_->build(s, getIndices()) >= 0) {
+      testedDuplicateIndex_ = false;
+      indexSetPtr_->clear();
+      if (methodName != NULL) {
+        throw CoinError("Duplicate index found", methodName, className);
+      } else {
+        throw CoinError("Duplicate index found",
+          "indexSet", "CoinPackedVectorBase");
       }
     }
   }
@@ -295,8 +319,8 @@ CoinPackedVectorBase::indexSet(const char *methodName,
 
 void CoinPackedVectorBase::clearIndexSet() const
 {
-  delete indexSetPtr_;
-  indexSetPtr_ = NULL;
+  if (indexSetPtr_)
+    indexSetPtr_->clear();
 }
 
 //-----------------------------------------------------------------------------
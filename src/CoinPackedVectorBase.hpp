@@ -9,6 +9,7 @@
 #include <map>
 #include "CoinPragma.hpp"
 #include "CoinError.hpp"
+#include "CoinIndexHash.hpp"
 
 class COINUTILSLIB_EXPORT CoinPackedVector;
 
@@ -105,6 +106,12 @@ public:
        If index does not exist then -1 is returned  */
   int findIndex(int i) const;
 
+  /** Puts in positions[k] the position of element which[k] of the full
+       storage vector (as findIndex) for k < number.  This is done in one
+       pass over the vector so is much faster than calling findIndex for
+       each when there are more than a few. */
+  void findIndex(int number, const int *which, int *positions) const;
+
   //@}
 
   /**@name Comparison operators on two packed vectors */
@@ -233,11 +240,12 @@ protected:
   /// Find Maximum and Minimum Indices
   void findMaxMinIndices() const;
 
-  /// Return indexSetPtr_ (create it if necessary).
-  std::set< int > *indexSet(const char *methodName = NULL,
+  /** Return indexSetPtr_ (fill it if necessary).  Throws CoinError if
+       there are duplicate indices. */
+  CoinIndexHash *indexSet(const char *methodName = NULL,
     const char *className = NULL) const;
 
-  /// Delete the indexSet
+  /// Empty the indexSet (memory is kept for reuse)
   void clearIndexSet() const;
   void clearBase() const;
   void copyMaxMinIndex(const CoinPackedVectorBase &x) const
@@ -254,10 +262,11 @@ private:
   mutable int maxIndex_;
   /// Contains minimum index value or infinity
   mutable int minIndex_;
-  /** Store the indices in a set. This set is only created if it is needed.
+  /** Store the indices in a hash table. This is only created if it is
+       needed and is empty when out of date.
        Its primary use is testing for duplicate indices.
     */
-  mutable std::set< int > *indexSetPtr_;
+  mutable CoinIndexHash *indexSetPtr_;
   /** True if the vector should be tested for duplicate indices when they can
        occur. */
   mutable bool testForDuplicateIndex_;
@@ -0,0 +1,375 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#include "CoinUtilsConfig.h"
+
+#include <algorithm>
+
+#include "CoinSellMatrix.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinSimdKernels.hpp"
+
+#if !defined(COIN_SIMD_NO_DISPATCH) && (defined(__GNUC__) || defined(__clang__)) \
+  && (defined(__x86_64__) || defined(__i386__))
+#define COIN_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace {
+
+typedef void (*SlicesKernel)(int numberSlices, const CoinBigIndex *sliceStart,
+  const int *permute, const int *index, const double *element,
+  const double *x, double *y);
+
+// Each lane adds its products in order starting from zero
+void slicesScalar(int numberSlices, const CoinBigIndex *sliceStart,
+  const int *permute, const int *index, const double *element,
+  const double *x, double *y)
+{
+  for (int iSlice = 0; iSlice < numberSlices; iSlice++) {
+    double sum[CoinSellMatrix::sliceHeight] = { 0.0 };
+    for (CoinBigIndex j = sliceStart[iSlice]; j < sliceStart[iSlice + 1];
+         j += CoinSellMatrix::sliceHeight) {
+      for (int k = 0; k < CoinSellMatrix::sliceHeight; k++)
+        sum[k] += element[j + k] * x[index[j + k]];
+    }
+    const int *which = permute + iSlice * CoinSellMatrix::sliceHeight;
+    for (int k = 0; k < CoinSellMatrix::sliceHeight; k++) {
+      if (which[k] >= 0)
+        y[which[k]] = sum[k];
+    }
+  }
+}
+
+#ifdef COIN_SIMD_DISPATCH
+/* Stops compiler fusing multiply and add (so results are the same as
+   scalar code) - AVX-512 implies FMA */
+#define COIN_SIMD_BARRIER(x) __asm__("" : "+v"(x))
+
+// Gathers are masked (all lanes) with a zero source as in CoinSimdKernels
+__attribute__((target("avx2"))) inline __m256d gatherAvx2(const double *x,
+  __m128i which)
+{
+  return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, which,
+    _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8);
+}
+
+__attribute__((target("avx512f"))) inline __m512d gatherAvx512(
+  const double *x, __m256i which)
+{
+  return _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xff, which, x, 8);
+}
+
+__attribute__((target("avx2"))) void slicesAvx2(int numberSlices,
+  const CoinBigIndex *sliceStart, const int *permute, const int *index,
+  const double *element, const double *x, double *y)
+{
+  for (int iSlice = 0; iSlice < numberSlices; iSlice++) {
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    for (CoinBigIndex j = sliceStart[iSlice]; j < sliceStart[iSlice + 1]; j += 8) {
+      __m128i which0 = _mm_loadu_si128(reinterpret_cast< const __m128i * >(index + j));
+      __m128i which1 = _mm_loadu_si128(reinterpret_cast< const __m128i * >(index + j + 4));
+      __m256d product0 = _mm256_mul_pd(_mm256_loadu_pd(element + j),
+        gatherAvx2(x, which0));
+      __m256d product1 = _mm256_mul_pd(_mm256_loadu_pd(element + j + 4),
+        gatherAvx2(x, which1));
+      COIN_SIMD_BARRIER(product0);
+      COIN_SIMD_BARRIER(product1);
+      sum0 = _mm256_add_pd(sum0, product0);
+      sum1 = _mm256_add_pd(sum1, product1);
+    }
+    double sum[8];
+    _mm256_storeu_pd(sum, sum0);
+    _mm256_storeu_pd(sum + 4, sum1);
+    const int *which = permute + iSlice * 8;
+    for (int k = 0; k < 8; k++) {
+      if (which[k] >= 0)
+        y[which[k]] = sum[k];
+    }
+  }
+}
+
+__attribute__((target("avx512f"))) void slicesAvx512(int numberSlices,
+  const CoinBigIndex *sliceStart, const int *permute, const int *index,
+  const double *element, const double *x, double *y)
+{
+  // all but last slice are full
+  for (int iSlice = 0; iSlice < numberSlices; iSlice++) {
+    __m512d sum = _mm512_setzero_pd();
+    for (CoinBigIndex j = sliceStart[iSlice]; j < sliceStart[iSlice + 1]; j += 8) {
+      __m256i which = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(index + j));
+      __m512d product = _mm512_mul_pd(_mm512_loadu_pd(element + j),
+        gatherAvx512(x, which));
+      COIN_SIMD_BARRIER(product);
+      sum = _mm512_add_pd(sum, product);
+    }
+    __m256i which = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(permute + iSlice * 8));
+    if (iSlice < numberSlices - 1) {
+      _mm512_i32scatter_pd(y, which, sum, 8);
+    } else {
+      // last slice may have padding
+      double last[8];
+      _mm512_storeu_pd(last, sum);
+      for (int k = 0; k < 8; k++) {
+        if (permute[iSlice * 8 + k] >= 0)
+          y[permute[iSlice * 8 + k]] = last[k];
+      }
+    }
+  }
+}
+#endif
+
+SlicesKernel slicesKernel()
+{
+#ifdef COIN_SIMD_DISPATCH
+  int level = CoinSimdLevelInUse();
+  if (level == CoinSimdAvx512)
+    return slicesAvx512;
+  else if (level == CoinSimdAvx2)
+    return slicesAvx2;
+#endif
+  return slicesScalar;
+}
+
+// Orders positions in a window by decreasing length then position
+class CoinSellLonger {
+public:
+  CoinSellLonger(const CoinBigIndex *start)
+    : start_(start)
+  {
+  }
+  inline bool operator()(int a, int b) const
+  {
+    CoinBigIndex lengthA = start_[a + 1] - start_[a];
+    CoinBigIndex lengthB = start_[b + 1] - start_[b];
+    return lengthA > lengthB || (lengthA == lengthB && a < b);
+  }
+
+private:
+  const CoinBigIndex *start_;
+};
+}
+
+// Default constructor
+CoinSellMatrix::CoinSellMatrix()
+  : colOrdered_(true)
+  , sortWindow_(256)
+  , numberElements_(0)
+{
+  for (int i = 0; i < 2; i++) {
+    numberVectors_[i] = 0;
+    permute_[i] = NULL;
+    sliceStart_[i] = NULL;
+    index_[i] = NULL;
+    element_[i] = NULL;
+  }
+  gutsOfDestructor();
+}
+// Constructor from a CoinPackedMatrix
+CoinSellMatrix::CoinSellMatrix(const CoinPackedMatrix &matrix, int sortWindow)
+  : colOrdered_(true)
+  , sortWindow_(256)
+  , numberElements_(0)
+{
+  for (int i = 0; i < 2; i++) {
+    numberVectors_[i] = 0;
+    permute_[i] = NULL;
+    sliceStart_[i] = NULL;
+    index_[i] = NULL;
+    element_[i] = NULL;
+  }
+  copyOf(matrix, sortWindow);
+}
+// Copy constructor
+CoinSellMatrix::CoinSellMatrix(const CoinSellMatrix &rhs)
+  : colOrdered_(true)
+  , sortWindow_(256)
+  , numberElements_(0)
+{
+  for (int i = 0; i < 2; i++) {
+    numberVectors_[i] = 0;
+    permute_[i] = NULL;
+    sliceStart_[i] = NULL;
+    index_[i] = NULL;
+    element_[i] = NULL;
+  }
+  gutsOfCopy(rhs);
+}
+// = copy
+CoinSellMatrix &CoinSellMatrix::operator=(const CoinSellMatrix &rhs)
+{
+  if (this != &rhs)
+    gutsOfCopy(rhs);
+  return *this;
+}
+// Destructor
+CoinSellMatrix::~CoinSellMatrix()
+{
+  for (int i = 0; i < 2; i++) {
+    delete[] permute_[i];
+    delete[] sliceStart_[i];
+    delete[] index_[i];
+    delete[] element_[i];
+  }
+}
+// Frees arrays and sets to empty
+void CoinSellMatrix::gutsOfDestructor()
+{
+  numberElements_ = 0;
+  for (int i = 0; i < 2; i++) {
+    numberVectors_[i] = 0;
+    delete[] permute_[i];
+    delete[] sliceStart_[i];
+    delete[] index_[i];
+    delete[] element_[i];
+    permute_[i] = NULL;
+    // so getPaddedSize works when empty
+    sliceStart_[i] = new CoinBigIndex[1];
+    sliceStart_[i][0] = 0;
+    index_[i] = NULL;
+    element_[i] = NULL;
+  }
+}
+// Copies arrays of rhs
+void CoinSellMatrix::gutsOfCopy(const CoinSellMatrix &rhs)
+{
+  gutsOfDestructor();
+  colOrdered_ = rhs.colOrdered_;
+  sortWindow_ = rhs.sortWindow_;
+  numberElements_ = rhs.numberElements_;
+  for (int i = 0; i < 2; i++) {
+    numberVectors_[i] = rhs.numberVectors_[i];
+    int nSlices = numberSlices(i);
+    CoinBigIndex size = rhs.sliceStart_[i][nSlices];
+    delete[] sliceStart_[i];
+    sliceStart_[i] = CoinCopyOfArray(rhs.sliceStart_[i], nSlices + 1);
+    permute_[i] = CoinCopyOfArray(rhs.permute_[i], nSlices * sliceHeight);
+    index_[i] = CoinCopyOfArray(rhs.index_[i], size);
+    element_[i] = CoinCopyOfArray(rhs.element_[i], size);
+  }
+}
+// Rebuilds from a CoinPackedMatrix
+void CoinSellMatrix::copyOf(const CoinPackedMatrix &matrix, int sortWindow)
+{
+  gutsOfDestructor();
+  colOrdered_ = matrix.isColOrdered();
+  sortWindow_ = CoinMax(1, sortWindow);
+  if (sortWindow_ > 1)
+    sortWindow_ = ((sortWindow_ + sliceHeight - 1) / sliceHeight) * sliceHeight;
+  int majorDim = matrix.getMajorDim();
+  int minorDim = matrix.getMinorDim();
+  numberVectors_[0] = majorDim;
+  numberVectors_[1] = minorDim;
+  numberElements_ = matrix.getNumElements();
+  const CoinBigIndex *start = matrix.getVectorStarts();
+  const int *length = matrix.getVectorLengths();
+  const int *index = matrix.getIndices();
+  const double *element = matrix.getElements();
+  // major vectors without gaps
+  CoinBigIndex *newStart = new CoinBigIndex[CoinMax(majorDim, minorDim) + 1];
+  int *newIndex = new int[numberElements_];
+  double *newElement = new double[numberElements_];
+  CoinBigIndex put = 0;
+  newStart[0] = 0;
+  for (int i = 0; i < majorDim; i++) {
+    CoinMemcpyN(index + start[i], length[i], newIndex + put);
+    CoinMemcpyN(element + start[i], length[i], newElement + put);
+    put += length[i];
+    newStart[i + 1] = put;
+  }
+  makeSlices(0, newStart, newIndex, newElement);
+  /* minor vectors - CoinPackedMatrix::timesMajor adds in major vectors
+     last to first so store in that order */
+  CoinZeroN(newStart, minorDim + 1);
+  for (int i = 0; i < majorDim; i++) {
+    for (CoinBigIndex j = start[i]; j < start[i] + length[i]; j++)
+      newStart[index[j] + 1]++;
+  }
+  for (int i = 0; i < minorDim; i++)
+    newStart[i + 1] += newStart[i];
+  CoinBigIndex *next = CoinCopyOfArray(newStart, minorDim);
+  for (int i = majorDim - 1; i >= 0; i--) {
+    for (CoinBigIndex j = start[i]; j < start[i] + length[i]; j++) {
+      put = next[index[j]]++;
+      newIndex[put] = i;
+      newElement[put] = element[j];
+    }
+  }
+  makeSlices(1, newStart, newIndex, newElement);
+  delete[] next;
+  delete[] newElement;
+  delete[] newIndex;
+  delete[] newStart;
+}
+// Makes slices for which from vectors given in compressed form
+void CoinSellMatrix::makeSlices(int which, const CoinBigIndex *start,
+  const int *index, const double *element)
+{
+  int numberVectors = numberVectors_[which];
+  int nSlices = numberSlices(which);
+  int *permute = new int[nSlices * sliceHeight];
+  for (int i = 0; i < nSlices * sliceHeight; i++)
+    permute[i] = i < numberVectors ? i : -1;
+  if (sortWindow_ > 1) {
+    CoinSellLonger longer(start);
+    for (int i = 0; i < numberVectors; i += sortWindow_)
+      std::sort(permute + i, permute + CoinMin(i + sortWindow_, numberVectors),
+        longer);
+  }
+  delete[] sliceStart_[which];
+  CoinBigIndex *sliceStart = new CoinBigIndex[nSlices + 1];
+  sliceStart[0] = 0;
+  for (int iSlice = 0; iSlice < nSlices; iSlice++) {
+    CoinBigIndex longest = 0;
+    for (int k = 0; k < sliceHeight; k++) {
+      int iVector = permute[iSlice * sliceHeight + k];
+      if (iVector >= 0)
+        longest = CoinMax(longest, start[iVector + 1] - start[iVector]);
+    }
+    sliceStart[iSlice + 1] = sliceStart[iSlice] + longest * sliceHeight;
+  }
+  CoinBigIndex size = sliceStart[nSlices];
+  int *newIndex = new int[size];
+  double *newElement = new double[size];
+  // padding
+  CoinZeroN(newIndex, size);
+  CoinZeroN(newElement, size);
+  for (int iSlice = 0; iSlice < nSlices; iSlice++) {
+    for (int k = 0; k < sliceHeight; k++) {
+      int iVector = permute[iSlice * sliceHeight + k];
+      if (iVector < 0)
+        continue;
+      CoinBigIndex put = sliceStart[iSlice] + k;
+      for (CoinBigIndex j = start[iVector]; j < start[iVector + 1]; j++) {
+        newIndex[put] = index[j];
+        newElement[put] = element[j];
+        put += sliceHeight;
+      }
+    }
+  }
+  permute_[which] = permute;
+  sliceStart_[which] = sliceStart;
+  index_[which] = newIndex;
+  element_[which] = newElement;
+}
+// y = products of slices for which with x
+void CoinSellMatrix::gather(int which, const double *x, double *y) const
+{
+  slicesKernel()(numberSlices(which), sliceStart_[which], permute_[which],
+    index_[which], element_[which], x, y);
+}
+// Return A * x in y
+void CoinSellMatrix::times(const double *x, double *y) const
+{
+  gather(colOrdered_ ? 1 : 0, x, y);
+}
+// Return x * A in y
+void CoinSellMatrix::transposeTimes(const double *x, double *y) const
+{
+  gather(colOrdered_ ? 0 : 1, x, y);
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,152 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifndef CoinSellMatrix_H
+#define CoinSellMatrix_H
+
+#include "CoinUtilsConfig.h"
+#include "CoinTypes.h"
+
+class CoinPackedMatrix;
+
+/** Read only copy of a CoinPackedMatrix in sliced ELLPACK (SELL-C-sigma)
+    storage for fast matrix times vector.
+
+    Short vectors (typical of MIP models) make the inner loops of
+    CoinPackedMatrix::times and transposeTimes too short to vectorize.
+    Here vectors are taken sliceHeight at a time and a slice is stored
+    as its longest vector times sliceHeight entries - first entries of
+    each vector, then second entries and so on, with shorter vectors
+    padded by zero elements.  Within windows of sortWindow vectors,
+    vectors are sorted by decreasing length before being sliced so
+    there is little padding.  Products are then done for sliceHeight
+    vectors at once with AVX2 or AVX-512 gathers (chosen at run time as
+    for CoinSimdKernels - CoinSimdSetLevel forces the scalar version).
+
+    Both products are done as gathers so there are two sets of slices -
+    one over the major vectors of the matrix and one over the minor
+    vectors.  Entries of each minor vector are stored in the order in
+    which CoinPackedMatrix adds them in so, for finite x, times and
+    transposeTimes give exactly the same results as those of the
+    matrix this was built from.
+
+    Changes to the CoinPackedMatrix afterwards are not seen - build
+    again with copyOf.
+*/
+class COINUTILSLIB_EXPORT CoinSellMatrix {
+
+public:
+  /// Vectors in a slice (one AVX-512 vector of doubles)
+  enum { sliceHeight = 8 };
+
+  /**@name Constructors, destructor and copying */
+  //@{
+  /// Default constructor (empty matrix)
+  CoinSellMatrix();
+  /** Constructor from a CoinPackedMatrix.  sortWindow is rounded up to
+      a multiple of sliceHeight (1 means no sorting) */
+  CoinSellMatrix(const CoinPackedMatrix &matrix, int sortWindow = 256);
+  /// Copy constructor
+  CoinSellMatrix(const CoinSellMatrix &rhs);
+  /// = copy
+  CoinSellMatrix &operator=(const CoinSellMatrix &rhs);
+  /// Destructor
+  ~CoinSellMatrix();
+  /// Rebuilds from a CoinPackedMatrix
+  void copyOf(const CoinPackedMatrix &matrix, int sortWindow = 256);
+  //@}
+
+  /**@name Gets */
+  //@{
+  /// Whether the matrix this was built from was column ordered
+  inline bool isColOrdered() const
+  {
+    return colOrdered_;
+  }
+  /// Number of rows
+  inline int getNumRows() const
+  {
+    return colOrdered_ ? numberVectors_[1] : numberVectors_[0];
+  }
+  /// Number of columns
+  inline int getNumCols() const
+  {
+    return colOrdered_ ? numberVectors_[0] : numberVectors_[1];
+  }
+  /// Number of elements (not counting padding)
+  inline CoinBigIndex getNumElements() const
+  {
+    return numberElements_;
+  }
+  /// Number of entries stored for major (0) or minor (1) slices
+  inline CoinBigIndex getPaddedSize(int which) const
+  {
+    return sliceStart_[which][numberSlices(which)];
+  }
+  /// Sort window used
+  inline int getSortWindow() const
+  {
+    return sortWindow_;
+  }
+  //@}
+
+  /**@name Matrix times vector */
+  //@{
+  /** Return <code>A * x</code> in <code>y</code> (as
+      CoinPackedMatrix::times).
+      @pre <code>x</code> must be of size <code>numColumns()</code>
+      @pre <code>y</code> must be of size <code>numRows()</code> */
+  void times(const double *x, double *y) const;
+  /** Return <code>x * A</code> in <code>y</code> (as
+      CoinPackedMatrix::transposeTimes).
+      @pre <code>x</code> must be of size <code>numRows()</code>
+      @pre <code>y</code> must be of size <code>numColumns()</code> */
+  void transposeTimes(const double *x, double *y) const;
+  //@}
+
+private:
+  /**@name Private methods */
+  //@{
+  /// Number of slices for major (0) or minor (1) vectors
+  inline int numberSlices(int which) const
+  {
+    return (numberVectors_[which] + sliceHeight - 1) / sliceHeight;
+  }
+  /// Frees arrays and sets to empty
+  void gutsOfDestructor();
+  /// Copies arrays of rhs
+  void gutsOfCopy(const CoinSellMatrix &rhs);
+  /** Makes slices for which from vectors given in compressed form
+      (start has numberVectors_[which]+1 entries) */
+  void makeSlices(int which, const CoinBigIndex *start, const int *index,
+    const double *element);
+  /// y = products of slices for which with x
+  void gather(int which, const double *x, double *y) const;
+  //@}
+
+  /**@name Data */
+  //@{
+  /// Whether built from column ordered matrix
+  bool colOrdered_;
+  /// Sort window
+  int sortWindow_;
+  /// Number of elements
+  CoinBigIndex numberElements_;
+  /// Number of major (0) and minor (1) vectors
+  int numberVectors_[2];
+  /** Vector in each position of slices (-1 for padding after last
+      vector) - sliceHeight times number of slices */
+  int *permute_[2];
+  /// Start of each slice (number of slices + 1)
+  CoinBigIndex *sliceStart_[2];
+  /// Indices (padding has 0)
+  int *index_[2];
+  /// Elements (padding has 0.0)
+  double *element_[2];
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
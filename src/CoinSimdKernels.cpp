@@ -0,0 +1,872 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#include "CoinUtilsConfig.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#include "CoinSimdKernels.hpp"
+
+#if !defined(COIN_SIMD_NO_DISPATCH) && (defined(__GNUC__) || defined(__clang__)) \
+  && (defined(__x86_64__) || defined(__i386__))
+#define COIN_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+// Shorter vectors are always done by scalar code
+#define COIN_SIMD_MINIMUM 8
+// Number of doubles sparse scans test at once
+#define COIN_SIMD_BLOCK 32
+
+namespace {
+
+typedef void (*ScatterAxpyKernel)(int n, const double *element,
+  const int *index, double multiplier, double *region);
+typedef double (*DotSubtractKernel)(double value, int n, const double *element,
+  const int *index, const double *region);
+typedef int (*ScanKernel)(const double *region, int start, int end,
+  int *indices);
+typedef int (*ScanToleranceKernel)(double *region, int start, int end,
+  double tolerance, int *indices);
+typedef int (*CleanKernel)(int number, int *indices, double tolerance,
+  double *region);
+typedef void (*UpdateKernel)(int operation, int number, const int *indices,
+  double value, double tiny, double reallyTiny, double *region);
+typedef void (*UpdatePackedKernel)(int operation, int number, double value,
+  double tiny, double reallyTiny, double *region);
+
+// Kernels of one level
+typedef struct {
+  int level;
+  ScatterAxpyKernel scatterAxpy;
+  DotSubtractKernel dotSubtract;
+  ScanKernel scan;
+  ScanToleranceKernel scanTolerance;
+  ScanKernel scanSparse;
+  ScanToleranceKernel scanToleranceSparse;
+  CleanKernel clean;
+  CleanKernel cleanAndPack;
+  UpdateKernel update;
+  UpdatePackedKernel updatePacked;
+} Kernels;
+
+void scatterAxpyScalar(int n, const double *element, const int *index,
+  double multiplier, double *region)
+{
+  for (int i = 0; i < n; i++)
+    region[index[i]] -= element[i] * multiplier;
+}
+
+double dotSubtractScalar(double value, int n, const double *element,
+  const int *index, const double *region)
+{
+  for (int i = 0; i < n; i++)
+    value -= element[i] * region[index[i]];
+  return value;
+}
+
+/* Reference versions of CoinIndexedVector loops (the vector versions
+   must give exactly the same results) */
+int scanScalar(const double *region, int start, int end, int *indices)
+{
+  int number = 0;
+  for (int i = start; i < end; i++)
+    if (region[i])
+      indices[number++] = i;
+  return number;
+}
+
+int scanToleranceScalar(double *region, int start, int end,
+  double tolerance, int *indices)
+{
+  int number = 0;
+  for (int i = start; i < end; i++) {
+    double value = region[i];
+    if (value) {
+      if (fabs(value) >= tolerance)
+        indices[number++] = i;
+      else
+        region[i] = 0.0;
+    }
+  }
+  return number;
+}
+
+// True if no bits set in COIN_SIMD_BLOCK doubles (so -0.0 is not zero)
+bool zeroBlockScalar(const double *region)
+{
+  unsigned long long bits = 0;
+  for (int i = 0; i < COIN_SIMD_BLOCK; i++) {
+    unsigned long long value;
+    memcpy(&value, region + i, sizeof(value));
+    bits |= value;
+  }
+  return !bits;
+}
+
+int scanSparseScalar(const double *region, int start, int end, int *indices)
+{
+  int number = 0;
+  int i = start;
+  for (; i + COIN_SIMD_BLOCK <= end; i += COIN_SIMD_BLOCK) {
+    if (!zeroBlockScalar(region + i))
+      number += scanScalar(region, i, i + COIN_SIMD_BLOCK, indices + number);
+  }
+  return number + scanScalar(region, i, end, indices + number);
+}
+
+int scanToleranceSparseScalar(double *region, int start, int end,
+  double tolerance, int *indices)
+{
+  int number = 0;
+  int i = start;
+  for (; i + COIN_SIMD_BLOCK <= end; i += COIN_SIMD_BLOCK) {
+    if (!zeroBlockScalar(region + i))
+      number += scanToleranceScalar(region, i, i + COIN_SIMD_BLOCK, tolerance,
+        indices + number);
+  }
+  return number + scanToleranceScalar(region, i, end, tolerance,
+           indices + number);
+}
+
+int cleanScalar(int number, int *indices, double tolerance, double *region)
+{
+  int nElements = 0;
+  for (int i = 0; i < number; i++) {
+    int indexValue = indices[i];
+    if (fabs(region[indexValue]) >= tolerance) {
+      indices[nElements++] = indexValue;
+    } else {
+      region[indexValue] = 0.0;
+    }
+  }
+  return nElements;
+}
+
+int cleanAndPackScalar(int number, int *indices, double tolerance,
+  double *region)
+{
+  int nElements = 0;
+  for (int i = 0; i < number; i++) {
+    int indexValue = indices[i];
+    double value = region[indexValue];
+    region[indexValue] = 0.0;
+    if (fabs(value) >= tolerance) {
+      region[nElements] = value;
+      indices[nElements++] = indexValue;
+    }
+  }
+  return nElements;
+}
+
+inline double operate(int operation, double oldValue, double value)
+{
+  switch (operation) {
+  case CoinSimdAdd:
+    return oldValue + value;
+  case CoinSimdSubtract:
+    return oldValue - value;
+  case CoinSimdMultiply:
+    return oldValue * value;
+  default:
+    return oldValue / value;
+  }
+}
+
+void updateScalar(int operation, int number, const int *indices,
+  double value, double tiny, double reallyTiny, double *region)
+{
+  for (int i = 0; i < number; i++) {
+    int indexValue = indices[i];
+    double newValue = operate(operation, region[indexValue], value);
+    if (fabs(newValue) >= tiny)
+      region[indexValue] = newValue;
+    else
+      region[indexValue] = reallyTiny;
+  }
+}
+
+void updatePackedScalar(int operation, int number, double value,
+  double tiny, double reallyTiny, double *region)
+{
+  for (int i = 0; i < number; i++) {
+    double newValue = operate(operation, region[i], value);
+    region[i] = (fabs(newValue) >= tiny) ? newValue : reallyTiny;
+  }
+}
+
+#ifdef COIN_SIMD_DISPATCH
+/* Stops compiler fusing multiply and subtract (so scatter results are
+   the same as scalar code) - AVX-512 implies FMA even for scalars */
+#define COIN_SIMD_BARRIER(x) __asm__("" : "+v"(x))
+
+/* Gathers are masked (all lanes) with a zero source as the unmasked
+   intrinsics leave the source undefined and gcc warns */
+__attribute__((target("avx2"))) inline __m256d gatherAvx2(const double *region,
+  __m128i which)
+{
+  return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), region, which,
+    _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8);
+}
+
+__attribute__((target("avx512f"))) inline __m512d gatherAvx512(
+  const double *region, __m256i which)
+{
+  return _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xff, which, region, 8);
+}
+
+/* Eight indices in low half of a vector with upper half zero (the cast
+   and insert intrinsics leave it undefined and gcc warns) */
+__attribute__((target("avx512f"))) inline __m512i loadIndicesAvx512(
+  const int *indices)
+{
+  return _mm512_maskz_loadu_epi32(0xff, indices);
+}
+
+__attribute__((target("avx2"))) void scatterAxpyAvx2(int n,
+  const double *element, const int *index, double multiplier, double *region)
+{
+  __m256d multiply = _mm256_set1_pd(multiplier);
+  int n4 = n & ~3;
+  for (int i = 0; i < n4; i += 4) {
+    __m128i which = _mm_loadu_si128(reinterpret_cast< const __m128i * >(index + i));
+    __m256d old = gatherAvx2(region, which);
+    __m256d product = _mm256_mul_pd(_mm256_loadu_pd(element + i), multiply);
+    COIN_SIMD_BARRIER(product);
+    double result[4];
+    _mm256_storeu_pd(result, _mm256_sub_pd(old, product));
+    // no scatter in AVX2
+    region[index[i]] = result[0];
+    region[index[i + 1]] = result[1];
+    region[index[i + 2]] = result[2];
+    region[index[i + 3]] = result[3];
+  }
+  for (int i = n4; i < n; i++) {
+    double product = element[i] * multiplier;
+    COIN_SIMD_BARRIER(product);
+    region[index[i]] -= product;
+  }
+}
+
+__attribute__((target("avx2"))) double dotSubtractAvx2(double value, int n,
+  const double *element, const int *index, const double *region)
+{
+  __m256d sum0 = _mm256_setzero_pd();
+  __m256d sum1 = _mm256_setzero_pd();
+  int n8 = n & ~7;
+  for (int i = 0; i < n8; i += 8) {
+    __m128i which0 = _mm_loadu_si128(reinterpret_cast< const __m128i * >(index + i));
+    __m128i which1 = _mm_loadu_si128(reinterpret_cast< const __m128i * >(index + i + 4));
+    __m256d product0 = _mm256_mul_pd(_mm256_loadu_pd(element + i),
+      gatherAvx2(region, which0));
+    __m256d product1 = _mm256_mul_pd(_mm256_loadu_pd(element + i + 4),
+      gatherAvx2(region, which1));
+    sum0 = _mm256_add_pd(sum0, product0);
+    sum1 = _mm256_add_pd(sum1, product1);
+  }
+  double part[4];
+  _mm256_storeu_pd(part, _mm256_add_pd(sum0, sum1));
+  double sum = (part[0] + part[1]) + (part[2] + part[3]);
+  for (int i = n8; i < n; i++)
+    sum += element[i] * region[index[i]];
+  return value - sum;
+}
+
+__attribute__((target("avx512f"))) void scatterAxpyAvx512(int n,
+  const double *element, const int *index, double multiplier, double *region)
+{
+  __m512d multiply = _mm512_set1_pd(multiplier);
+  int n8 = n & ~7;
+  for (int i = 0; i < n8; i += 8) {
+    __m256i which = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(index + i));
+    __m512d old = gatherAvx512(region, which);
+    __m512d product = _mm512_mul_pd(_mm512_loadu_pd(element + i), multiply);
+    COIN_SIMD_BARRIER(product);
+    _mm512_i32scatter_pd(region, which, _mm512_sub_pd(old, product), 8);
+  }
+  for (int i = n8; i < n; i++) {
+    double product = element[i] * multiplier;
+    COIN_SIMD_BARRIER(product);
+    region[index[i]] -= product;
+  }
+}
+
+__attribute__((target("avx512f"))) double dotSubtractAvx512(double value, int n,
+  const double *element, const int *index, const double *region)
+{
+  __m512d sum0 = _mm512_setzero_pd();
+  int n8 = n & ~7;
+  for (int i = 0; i < n8; i += 8) {
+    __m256i which = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(index + i));
+    __m512d product = _mm512_mul_pd(_mm512_loadu_pd(element + i),
+      gatherAvx512(region, which));
+    sum0 = _mm512_add_pd(sum0, product);
+  }
+  // as _mm512_reduce_add_pd but halves extracted with zero source
+  __m256d sum4 = _mm256_add_pd(
+    _mm512_mask_extractf64x4_pd(_mm256_setzero_pd(), 0xff, sum0, 0),
+    _mm512_mask_extractf64x4_pd(_mm256_setzero_pd(), 0xff, sum0, 1));
+  __m128d sum2 = _mm_add_pd(_mm256_castpd256_pd128(sum4),
+    _mm256_extractf128_pd(sum4, 1));
+  double sum = _mm_cvtsd_f64(_mm_add_sd(sum2, _mm_unpackhi_pd(sum2, sum2)));
+  for (int i = n8; i < n; i++)
+    sum += element[i] * region[index[i]];
+  return value - sum;
+}
+
+/* CoinIndexedVector kernels - AVX2 has no compress store or scatter so
+   masks are turned into indices a bit at a time */
+__attribute__((target("avx2"))) int scanAvx2(const double *region,
+  int start, int end, int *indices)
+{
+  const __m256d zero = _mm256_setzero_pd();
+  int number = 0;
+  int i = start;
+  for (; i + 8 <= end; i += 8) {
+    int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(region + i),
+                 zero, _CMP_NEQ_UQ))
+      | (_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(region + i + 4),
+           zero, _CMP_NEQ_UQ))
+        << 4);
+    while (mask) {
+      indices[number++] = i + __builtin_ctz(mask);
+      mask &= mask - 1;
+    }
+  }
+  return number + scanScalar(region, i, end, indices + number);
+}
+
+__attribute__((target("avx2"))) int scanToleranceAvx2(double *region,
+  int start, int end, double tolerance, int *indices)
+{
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d sign = _mm256_set1_pd(-0.0);
+  const __m256d tolerance4 = _mm256_set1_pd(tolerance);
+  int number = 0;
+  int i = start;
+  for (; i + 4 <= end; i += 4) {
+    __m256d value = _mm256_loadu_pd(region + i);
+    __m256d nonZero = _mm256_cmp_pd(value, zero, _CMP_NEQ_UQ);
+    if (!_mm256_movemask_pd(nonZero))
+      continue;
+    __m256d keep = _mm256_cmp_pd(_mm256_andnot_pd(sign, value), tolerance4,
+      _CMP_GE_OQ);
+    __m256d small = _mm256_andnot_pd(keep, nonZero);
+    if (_mm256_movemask_pd(small))
+      _mm256_storeu_pd(region + i, _mm256_blendv_pd(value, zero, small));
+    int mask = _mm256_movemask_pd(keep);
+    while (mask) {
+      indices[number++] = i + __builtin_ctz(mask);
+      mask &= mask - 1;
+    }
+  }
+  return number + scanToleranceScalar(region, i, end, tolerance,
+           indices + number);
+}
+
+__attribute__((target("avx2"))) bool zeroBlockAvx2(const double *region)
+{
+  __m256i bits = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(region));
+  for (int i = 4; i < COIN_SIMD_BLOCK; i += 4)
+    bits = _mm256_or_si256(bits,
+      _mm256_loadu_si256(reinterpret_cast< const __m256i * >(region + i)));
+  return _mm256_testz_si256(bits, bits) != 0;
+}
+
+__attribute__((target("avx2"))) int scanSparseAvx2(const double *region,
+  int start, int end, int *indices)
+{
+  int number = 0;
+  int i = start;
+  for (; i + COIN_SIMD_BLOCK <= end; i += COIN_SIMD_BLOCK) {
+    if (!zeroBlockAvx2(region + i))
+      number += scanAvx2(region, i, i + COIN_SIMD_BLOCK, indices + number);
+  }
+  return number + scanScalar(region, i, end, indices + number);
+}
+
+__attribute__((target("avx2"))) int scanToleranceSparseAvx2(double *region,
+  int start, int end, double tolerance, int *indices)
+{
+  int number = 0;
+  int i = start;
+  for (; i + COIN_SIMD_BLOCK <= end; i += COIN_SIMD_BLOCK) {
+    if (!zeroBlockAvx2(region + i))
+      number += scanToleranceAvx2(region, i, i + COIN_SIMD_BLOCK, tolerance,
+        indices + number);
+  }
+  return number + scanToleranceScalar(region, i, end, tolerance,
+           indices + number);
+}
+
+// As operate and then reallyTiny for results less than tiny
+__attribute__((target("avx2"))) inline __m256d operateAvx2(int operation,
+  __m256d oldValue, __m256d value4, __m256d tiny4, __m256d reallyTiny4)
+{
+  __m256d newValue;
+  switch (operation) {
+  case CoinSimdAdd:
+    newValue = _mm256_add_pd(oldValue, value4);
+    break;
+  case CoinSimdSubtract:
+    newValue = _mm256_sub_pd(oldValue, value4);
+    break;
+  case CoinSimdMultiply:
+    newValue = _mm256_mul_pd(oldValue, value4);
+    break;
+  default:
+    newValue = _mm256_div_pd(oldValue, value4);
+    break;
+  }
+  __m256d keep = _mm256_cmp_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), newValue),
+    tiny4, _CMP_GE_OQ);
+  return _mm256_blendv_pd(reallyTiny4, newValue, keep);
+}
+
+__attribute__((target("avx2"))) void updateAvx2(int operation, int number,
+  const int *indices, double value, double tiny, double reallyTiny,
+  double *region)
+{
+  const __m256d value4 = _mm256_set1_pd(value);
+  const __m256d tiny4 = _mm256_set1_pd(tiny);
+  const __m256d reallyTiny4 = _mm256_set1_pd(reallyTiny);
+  int i = 0;
+  for (; i + 4 <= number; i += 4) {
+    __m128i which = _mm_loadu_si128(reinterpret_cast< const __m128i * >(indices + i));
+    __m256d newValue = operateAvx2(operation, gatherAvx2(region, which),
+      value4, tiny4, reallyTiny4);
+    double result[4];
+    _mm256_storeu_pd(result, newValue);
+    region[indices[i]] = result[0];
+    region[indices[i + 1]] = result[1];
+    region[indices[i + 2]] = result[2];
+    region[indices[i + 3]] = result[3];
+  }
+  updateScalar(operation, number - i, indices + i, value, tiny, reallyTiny,
+    region);
+}
+
+__attribute__((target("avx2"))) void updatePackedAvx2(int operation,
+  int number, double value, double tiny, double reallyTiny, double *region)
+{
+  const __m256d value4 = _mm256_set1_pd(value);
+  const __m256d tiny4 = _mm256_set1_pd(tiny);
+  const __m256d reallyTiny4 = _mm256_set1_pd(reallyTiny);
+  int i = 0;
+  for (; i + 4 <= number; i += 4) {
+    __m256d newValue = operateAvx2(operation, _mm256_loadu_pd(region + i),
+      value4, tiny4, reallyTiny4);
+    _mm256_storeu_pd(region + i, newValue);
+  }
+  updatePackedScalar(operation, number - i, value, tiny, reallyTiny,
+    region + i);
+}
+
+// AVX-512 has compress store so finds 16 indices at a time
+__attribute__((target("avx512f"))) int scanAvx512(const double *region,
+  int start, int end, int *indices)
+{
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512i iota = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8,
+    7, 6, 5, 4, 3, 2, 1, 0);
+  int number = 0;
+  int i = start;
+  for (; i + 16 <= end; i += 16) {
+    __mmask16 mask = static_cast< __mmask16 >(
+      _mm512_cmp_pd_mask(_mm512_loadu_pd(region + i), zero, _CMP_NEQ_UQ)
+      | (_mm512_cmp_pd_mask(_mm512_loadu_pd(region + i + 8), zero, _CMP_NEQ_UQ)
+        << 8));
+    if (mask) {
+      _mm512_mask_compressstoreu_epi32(indices + number, mask,
+        _mm512_add_epi32(_mm512_set1_epi32(i), iota));
+      number += __builtin_popcount(mask);
+    }
+  }
+  return number + scanScalar(region, i, end, indices + number);
+}
+
+__attribute__((target("avx512f"))) int scanToleranceAvx512(double *region,
+  int start, int end, double tolerance, int *indices)
+{
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512d tolerance8 = _mm512_set1_pd(tolerance);
+  const __m512i iota = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8,
+    7, 6, 5, 4, 3, 2, 1, 0);
+  int number = 0;
+  int i = start;
+  for (; i + 16 <= end; i += 16) {
+    __m512d value0 = _mm512_loadu_pd(region + i);
+    __m512d value1 = _mm512_loadu_pd(region + i + 8);
+    __mmask8 nonZero0 = _mm512_cmp_pd_mask(value0, zero, _CMP_NEQ_UQ);
+    __mmask8 nonZero1 = _mm512_cmp_pd_mask(value1, zero, _CMP_NEQ_UQ);
+    if (!(nonZero0 | nonZero1))
+      continue;
+    __mmask8 keep0 = _mm512_cmp_pd_mask(_mm512_abs_pd(value0), tolerance8, _CMP_GE_OQ);
+    __mmask8 keep1 = _mm512_cmp_pd_mask(_mm512_abs_pd(value1), tolerance8, _CMP_GE_OQ);
+    __mmask8 small0 = static_cast< __mmask8 >(nonZero0 & ~keep0);
+    __mmask8 small1 = static_cast< __mmask8 >(nonZero1 & ~keep1);
+    if (small0)
+      _mm512_mask_storeu_pd(region + i, small0, zero);
+    if (small1)
+      _mm512_mask_storeu_pd(region + i + 8, small1, zero);
+    __mmask16 mask = static_cast< __mmask16 >(keep0 | (keep1 << 8));
+    if (mask) {
+      _mm512_mask_compressstoreu_epi32(indices + number, mask,
+        _mm512_add_epi32(_mm512_set1_epi32(i), iota));
+      number += __builtin_popcount(mask);
+    }
+  }
+  return number + scanToleranceScalar(region, i, end, tolerance,
+           indices + number);
+}
+
+__attribute__((target("avx512f"))) bool zeroBlockAvx512(const double *region)
+{
+  __m512i bits = _mm512_loadu_si512(region);
+  for (int i = 8; i < COIN_SIMD_BLOCK; i += 8)
+    bits = _mm512_or_si512(bits, _mm512_loadu_si512(region + i));
+  return !_mm512_test_epi64_mask(bits, bits);
+}
+
+__attribute__((target("avx512f"))) int scanSparseAvx512(const double *region,
+  int start, int end, int *indices)
+{
+  int number = 0;
+  int i = start;
+  for (; i + COIN_SIMD_BLOCK <= end; i += COIN_SIMD_BLOCK) {
+    if (!zeroBlockAvx512(region + i))
+      number += scanAvx512(region, i, i + COIN_SIMD_BLOCK, indices + number);
+  }
+  return number + scanScalar(region, i, end, indices + number);
+}
+
+__attribute__((target("avx512f"))) int scanToleranceSparseAvx512(double *region,
+  int start, int end, double tolerance, int *indices)
+{
+  int number = 0;
+  int i = start;
+  for (; i + COIN_SIMD_BLOCK <= end; i += COIN_SIMD_BLOCK) {
+    if (!zeroBlockAvx512(region + i))
+      number += scanToleranceAvx512(region, i, i + COIN_SIMD_BLOCK, tolerance,
+        indices + number);
+  }
+  return number + scanToleranceScalar(region, i, end, tolerance,
+           indices + number);
+}
+
+__attribute__((target("avx512f"))) int cleanAvx512(int number, int *indices,
+  double tolerance, double *region)
+{
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512d tolerance8 = _mm512_set1_pd(tolerance);
+  int nElements = 0;
+  int i = 0;
+  for (; i + 8 <= number; i += 8) {
+    __m256i which = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(indices + i));
+    __m512d value = gatherAvx512(region, which);
+    __mmask8 keep = _mm512_cmp_pd_mask(_mm512_abs_pd(value), tolerance8, _CMP_GE_OQ);
+    if (keep != 0xff)
+      _mm512_mask_i32scatter_pd(region, static_cast< __mmask8 >(~keep), which,
+        zero, 8);
+    _mm512_mask_compressstoreu_epi32(indices + nElements, keep,
+      loadIndicesAvx512(indices + i));
+    nElements += __builtin_popcount(keep);
+  }
+  for (; i < number; i++) {
+    int indexValue = indices[i];
+    if (fabs(region[indexValue]) >= tolerance)
+      indices[nElements++] = indexValue;
+    else
+      region[indexValue] = 0.0;
+  }
+  return nElements;
+}
+
+/* Packed values are written over the start of region so a block is
+   done with vectors only if none of its indices is where one of its
+   values could be packed to */
+__attribute__((target("avx512f"))) int cleanAndPackAvx512(int number,
+  int *indices, double tolerance, double *region)
+{
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512d tolerance8 = _mm512_set1_pd(tolerance);
+  int nElements = 0;
+  int i = 0;
+  for (; i + 8 <= number; i += 8) {
+    __m256i which8 = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(indices + i));
+    __m512i which = loadIndicesAvx512(indices + i);
+    if (_mm512_mask_cmplt_epu32_mask(0xff,
+          _mm512_sub_epi32(which, _mm512_set1_epi32(nElements)),
+          _mm512_set1_epi32(8))) {
+      // may overlap
+      for (int k = i; k < i + 8; k++) {
+        int indexValue = indices[k];
+        double value = region[indexValue];
+        region[indexValue] = 0.0;
+        if (fabs(value) >= tolerance) {
+          region[nElements] = value;
+          indices[nElements++] = indexValue;
+        }
+      }
+      continue;
+    }
+    __m512d value = gatherAvx512(region, which8);
+    __mmask8 keep = _mm512_cmp_pd_mask(_mm512_abs_pd(value), tolerance8, _CMP_GE_OQ);
+    _mm512_i32scatter_pd(region, which8, zero, 8);
+    _mm512_mask_compressstoreu_pd(region + nElements, keep, value);
+    _mm512_mask_compressstoreu_epi32(indices + nElements, keep, which);
+    nElements += __builtin_popcount(keep);
+  }
+  for (; i < number; i++) {
+    int indexValue = indices[i];
+    double value = region[indexValue];
+    region[indexValue] = 0.0;
+    if (fabs(value) >= tolerance) {
+      region[nElements] = value;
+      indices[nElements++] = indexValue;
+    }
+  }
+  return nElements;
+}
+
+// As operate and then reallyTiny for results less than tiny
+__attribute__((target("avx512f"))) inline __m512d operateAvx512(int operation,
+  __m512d oldValue, __m512d value8, __m512d tiny8, __m512d reallyTiny8)
+{
+  __m512d newValue;
+  switch (operation) {
+  case CoinSimdAdd:
+    newValue = _mm512_add_pd(oldValue, value8);
+    break;
+  case CoinSimdSubtract:
+    newValue = _mm512_sub_pd(oldValue, value8);
+    break;
+  case CoinSimdMultiply:
+    newValue = _mm512_mul_pd(oldValue, value8);
+    break;
+  default:
+    newValue = _mm512_div_pd(oldValue, value8);
+    break;
+  }
+  __mmask8 keep = _mm512_cmp_pd_mask(_mm512_abs_pd(newValue), tiny8, _CMP_GE_OQ);
+  return _mm512_mask_blend_pd(keep, reallyTiny8, newValue);
+}
+
+__attribute__((target("avx512f"))) void updateAvx512(int operation,
+  int number, const int *indices, double value, double tiny,
+  double reallyTiny, double *region)
+{
+  const __m512d value8 = _mm512_set1_pd(value);
+  const __m512d tiny8 = _mm512_set1_pd(tiny);
+  const __m512d reallyTiny8 = _mm512_set1_pd(reallyTiny);
+  int i = 0;
+  for (; i + 8 <= number; i += 8) {
+    __m256i which = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(indices + i));
+    __m512d newValue = operateAvx512(operation, gatherAvx512(region, which),
+      value8, tiny8, reallyTiny8);
+    _mm512_i32scatter_pd(region, which, newValue, 8);
+  }
+  updateScalar(operation, number - i, indices + i, value, tiny, reallyTiny,
+    region);
+}
+
+__attribute__((target("avx512f"))) void updatePackedAvx512(int operation,
+  int number, double value, double tiny, double reallyTiny, double *region)
+{
+  const __m512d value8 = _mm512_set1_pd(value);
+  const __m512d tiny8 = _mm512_set1_pd(tiny);
+  const __m512d reallyTiny8 = _mm512_set1_pd(reallyTiny);
+  int i = 0;
+  for (; i + 8 <= number; i += 8) {
+    __m512d newValue = operateAvx512(operation, _mm512_loadu_pd(region + i),
+      value8, tiny8, reallyTiny8);
+    _mm512_storeu_pd(region + i, newValue);
+  }
+  updatePackedScalar(operation, number - i, value, tiny, reallyTiny,
+    region + i);
+}
+#endif
+
+// Best level processor supports
+int findLevelAvailable()
+{
+  int level = CoinSimdScalar;
+#ifdef COIN_SIMD_DISPATCH
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    level = CoinSimdAvx512;
+  else if (__builtin_cpu_supports("avx2"))
+    level = CoinSimdAvx2;
+#endif
+  return level;
+}
+
+int levelAvailable()
+{
+  static const int available = findLevelAvailable();
+  return available;
+}
+
+const Kernels scalarKernels = { CoinSimdScalar, scatterAxpyScalar,
+  dotSubtractScalar, scanScalar, scanToleranceScalar, scanSparseScalar,
+  scanToleranceSparseScalar, cleanScalar, cleanAndPackScalar, updateScalar,
+  updatePackedScalar };
+#ifdef COIN_SIMD_DISPATCH
+// (gathers without scatter or compress store are no faster so
+// clean and cleanAndPack stay scalar with AVX2)
+const Kernels avx2Kernels = { CoinSimdAvx2, scatterAxpyAvx2,
+  dotSubtractAvx2, scanAvx2, scanToleranceAvx2, scanSparseAvx2,
+  scanToleranceSparseAvx2, cleanScalar, cleanAndPackScalar, updateAvx2,
+  updatePackedAvx2 };
+const Kernels avx512Kernels = { CoinSimdAvx512, scatterAxpyAvx512,
+  dotSubtractAvx512, scanAvx512, scanToleranceAvx512, scanSparseAvx512,
+  scanToleranceSparseAvx512, cleanAvx512, cleanAndPackAvx512, updateAvx512,
+  updatePackedAvx512 };
+#endif
+
+/* Kernels in use (set on first call).  Pool threads may make the first
+   call so a whole table is published at once - a thread either sees
+   NULL or a complete table */
+std::atomic< const Kernels * > kernelsInUse(NULL);
+
+const Kernels *setKernels(int level)
+{
+  if (level > levelAvailable())
+    level = levelAvailable();
+  const Kernels *table = &scalarKernels;
+#ifdef COIN_SIMD_DISPATCH
+  if (level == CoinSimdAvx2)
+    table = &avx2Kernels;
+  else if (level == CoinSimdAvx512)
+    table = &avx512Kernels;
+#endif
+  kernelsInUse.store(table, std::memory_order_release);
+  return table;
+}
+
+inline const Kernels *kernels()
+{
+  const Kernels *table = kernelsInUse.load(std::memory_order_acquire);
+  if (!table)
+    table = setKernels(levelAvailable());
+  return table;
+}
+}
+
+int CoinSimdLevelAvailable()
+{
+  return levelAvailable();
+}
+
+int CoinSimdLevelInUse()
+{
+  return kernels()->level;
+}
+
+void CoinSimdSetLevel(int level)
+{
+  setKernels(level);
+}
+
+void CoinSimdScatterAxpy(int n, const double *element, const int *index,
+  double multiplier, double *region)
+{
+  if (n < COIN_SIMD_MINIMUM) {
+    scatterAxpyScalar(n, element, index, multiplier, region);
+  } else {
+    kernels()->scatterAxpy(n, element, index, multiplier, region);
+  }
+}
+
+double CoinSimdDotSubtract(double value, int n, const double *element,
+  const int *index, const double *region)
+{
+  if (n < COIN_SIMD_MINIMUM) {
+    return dotSubtractScalar(value, n, element, index, region);
+  } else {
+    return kernels()->dotSubtract(value, n, element, index, region);
+  }
+}
+
+int CoinSimdScan(const double *region, int start, int end, int *indices)
+{
+  if (end - start < 2 * COIN_SIMD_MINIMUM) {
+    return scanScalar(region, start, end, indices);
+  } else {
+    return kernels()->scan(region, start, end, indices);
+  }
+}
+
+int CoinSimdScanTolerance(double *region, int start, int end,
+  double tolerance, int *indices)
+{
+  if (end - start < 2 * COIN_SIMD_MINIMUM) {
+    return scanToleranceScalar(region, start, end, tolerance, indices);
+  } else {
+    return kernels()->scanTolerance(region, start, end, tolerance, indices);
+  }
+}
+
+int CoinSimdScanSparse(const double *region, int start, int end, int *indices)
+{
+  if (end - start < 2 * COIN_SIMD_MINIMUM) {
+    return scanScalar(region, start, end, indices);
+  } else {
+    return kernels()->scanSparse(region, start, end, indices);
+  }
+}
+
+int CoinSimdScanToleranceSparse(double *region, int start, int end,
+  double tolerance, int *indices)
+{
+  if (end - start < 2 * COIN_SIMD_MINIMUM) {
+    return scanToleranceScalar(region, start, end, tolerance, indices);
+  } else {
+    return kernels()->scanToleranceSparse(region, start, end, tolerance,
+      indices);
+  }
+}
+
+int CoinSimdClean(int number, int *indices, double tolerance, double *region)
+{
+  if (number < COIN_SIMD_MINIMUM) {
+    return cleanScalar(number, indices, tolerance, region);
+  } else {
+    return kernels()->clean(number, indices, tolerance, region);
+  }
+}
+
+int CoinSimdCleanAndPack(int number, int *indices, double tolerance,
+  double *region)
+{
+  if (number < COIN_SIMD_MINIMUM) {
+    return cleanAndPackScalar(number, indices, tolerance, region);
+  } else {
+    return kernels()->cleanAndPack(number, indices, tolerance, region);
+  }
+}
+
+void CoinSimdUpdate(int operation, int number, const int *indices,
+  double value, double tiny, double reallyTiny, double *region)
+{
+  if (number < COIN_SIMD_MINIMUM) {
+    updateScalar(operation, number, indices, value, tiny, reallyTiny, region);
+  } else {
+    kernels()->update(operation, number, indices, value, tiny, reallyTiny, region);
+  }
+}
+
+void CoinSimdUpdatePacked(int operation, int number, double value,
+  double tiny, double reallyTiny, double *region)
+{
+  if (number < COIN_SIMD_MINIMUM) {
+    updatePackedScalar(operation, number, value, tiny, reallyTiny, region);
+  } else {
+    kernels()->updatePacked(operation, number, value, tiny, reallyTiny, region);
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
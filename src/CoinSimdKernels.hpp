@@ -0,0 +1,117 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifndef CoinSimdKernels_H
+#define CoinSimdKernels_H
+
+#include "CoinUtilsConfig.h"
+
+/** Sparse kernels with run time choice of instruction set.
+
+    The triangular solves and eta file of CoinSimpFactorization spend
+    nearly all their time in two loops over a packed column or row -
+    scattering a multiple of it into a dense region or taking its dot
+    product with a dense region.  These functions do that work.
+
+    On x86 with gcc or clang there are AVX2 and AVX-512 versions as
+    well as the scalar one and the best one the processor supports is
+    chosen the first time a kernel is called.  Other compilers and
+    processors just have the scalar version.  COIN_SIMD_NO_DISPATCH
+    switches off the vector versions at compile time.
+
+    The scatter versions compute each element as the scalar code does
+    (multiply then subtract - no fused multiply add) so give exactly the
+    same results.  The dot product versions add in a different order so
+    results can differ in the last bits.  CoinSimdSetLevel can force the
+    scalar versions so results can be checked against them.
+
+    There are also the dense loops of CoinIndexedVector - scanning a
+    region for nonzeros, cleaning small values and updating every
+    element.  These give exactly the same results (and order of
+    indices) as the scalar loops which are kept as the reference.
+*/
+
+/// Instruction sets used by kernels
+enum CoinSimdLevel {
+  CoinSimdScalar = 0,
+  CoinSimdAvx2 = 1,
+  CoinSimdAvx512 = 2
+};
+
+/// Operations for CoinSimdUpdate
+enum CoinSimdOperation {
+  CoinSimdAdd = 0,
+  CoinSimdSubtract = 1,
+  CoinSimdMultiply = 2,
+  CoinSimdDivide = 3
+};
+
+/**@name Sparse kernels */
+//@{
+/// Best level this processor (and build) supports
+COINUTILSLIB_EXPORT
+int CoinSimdLevelAvailable();
+/// Level being used
+COINUTILSLIB_EXPORT
+int CoinSimdLevelInUse();
+/** Sets level to use (reduced to what is available).
+    Kernels already running finish at the old level so results of
+    work in progress may mix levels */
+COINUTILSLIB_EXPORT
+void CoinSimdSetLevel(int level);
+/// region[index[i]] -= element[i]*multiplier for i < n (indices distinct)
+COINUTILSLIB_EXPORT
+void CoinSimdScatterAxpy(int n, const double *element, const int *index,
+  double multiplier, double *region);
+/// Returns value - sum of element[i]*region[index[i]] for i < n
+COINUTILSLIB_EXPORT
+double CoinSimdDotSubtract(double value, int n, const double *element,
+  const int *index, const double *region);
+//@}
+
+/**@name CoinIndexedVector kernels */
+//@{
+/** Puts indices of nonzeros (NaN counts as nonzero) in region[start..end)
+    into indices in increasing order and returns how many */
+COINUTILSLIB_EXPORT
+int CoinSimdScan(const double *region, int start, int end, int *indices);
+/** As CoinSimdScan but nonzeros with absolute value less than tolerance
+    (and NaN) are set to zero and left out */
+COINUTILSLIB_EXPORT
+int CoinSimdScanTolerance(double *region, int start, int end,
+  double tolerance, int *indices);
+/** As CoinSimdScan but quicker when nonzeros are few - each block of 32
+    with no bits set is skipped after one test.  Slower when most blocks
+    have a nonzero */
+COINUTILSLIB_EXPORT
+int CoinSimdScanSparse(const double *region, int start, int end,
+  int *indices);
+/// As CoinSimdScanTolerance skipping blocks as CoinSimdScanSparse
+COINUTILSLIB_EXPORT
+int CoinSimdScanToleranceSparse(double *region, int start, int end,
+  double tolerance, int *indices);
+/** Keeps those of the number indices whose region value has absolute
+    value at least tolerance (in order) and zeroes the others.  Returns
+    number kept */
+COINUTILSLIB_EXPORT
+int CoinSimdClean(int number, int *indices, double tolerance, double *region);
+/** As CoinSimdClean but kept values are also moved to the start of
+    region (packed) and the rest of the old values zeroed */
+COINUTILSLIB_EXPORT
+int CoinSimdCleanAndPack(int number, int *indices, double tolerance,
+  double *region);
+/** region[indices[i]] = region[indices[i]] operation value for i < number
+    with results of absolute value less than tiny replaced by reallyTiny */
+COINUTILSLIB_EXPORT
+void CoinSimdUpdate(int operation, int number, const int *indices,
+  double value, double tiny, double reallyTiny, double *region);
+/// As CoinSimdUpdate on region[i] for i < number (packed)
+COINUTILSLIB_EXPORT
+void CoinSimdUpdatePacked(int operation, int number, double value,
+  double tiny, double reallyTiny, double *region);
+//@}
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -10,6 +10,9 @@
 #include "CoinHelperFunctions.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinFinite.hpp"
+#include "CoinArrayFile.hpp"
+#include "CoinSimdKernels.hpp"
+#include "CoinFactorizationStatistics.hpp"
 #include <stdio.h>
 
 #define ARRAY 0
@@ -648,6 +651,250 @@ void CoinSimpFactorization::gutsOfCopy(const CoinSimpFactorization &other)
   pivotCandLimit_ = other.pivotCandLimit_;
 }
 
+namespace {
+// Version of saved factors - change if layout changes
+const int savedSimpVersion = 1;
+// Sections in saved factors
+enum {
+  savedSimpIntegers = 1,
+  savedSimpDoubles,
+  savedSimpPivotRow,
+  savedSimpElements,
+  savedSimpUrowCapacities,
+  savedSimpUcolCapacities,
+  // rest are in order of gutsOfCopy
+  savedSimpArrays
+};
+// Number of integers and doubles saved after those of base class
+const int numberSavedSimpIntegers = 22;
+const int numberSavedSimpDoubles = 4;
+/* Restores array saved with given length (NULL if saved as empty).
+   Returns false if wrong length */
+template < class T >
+bool restoreSimpArray(const CoinArrayFileReader &file, int id, T *&array,
+  int length)
+{
+  CoinBigIndex n;
+  const T *from = file.array< T >(id, n);
+  array = NULL;
+  if (!from || (n && n != length))
+    return false;
+  if (n) {
+    array = new T[length];
+    memcpy(array, from, length * sizeof(T));
+  }
+  return true;
+}
+}
+// Saves factors - arrays as in gutsOfCopy
+int CoinSimpFactorization::saveFactors(const char *fileName) const
+{
+  if (status_ || !pivotRow_)
+    return -1;
+  int integers[numberSavedBaseIntegers + numberSavedSimpIntegers];
+  double doubles[numberSavedBaseDoubles + numberSavedSimpDoubles];
+  getBaseScalars(integers, doubles);
+  int *moreIntegers = integers + numberSavedBaseIntegers;
+  moreIntegers[0] = numberSlacks_;
+  moreIntegers[1] = firstNumberSlacks_;
+  moreIntegers[2] = keepSize_;
+  moreIntegers[3] = LrowSize_;
+  moreIntegers[4] = LrowCap_;
+  moreIntegers[5] = LcolSize_;
+  moreIntegers[6] = LcolCap_;
+  moreIntegers[7] = UrowMaxCap_;
+  moreIntegers[8] = UrowEnd_;
+  moreIntegers[9] = firstRowInU_;
+  moreIntegers[10] = lastRowInU_;
+  moreIntegers[11] = firstColInU_;
+  moreIntegers[12] = lastColInU_;
+  moreIntegers[13] = UcolMaxCap_;
+  moreIntegers[14] = UcolEnd_;
+  moreIntegers[15] = EtaSize_;
+  moreIntegers[16] = lastEtaRow_;
+  moreIntegers[17] = maxEtaRows_;
+  moreIntegers[18] = EtaMaxCap_;
+  moreIntegers[19] = minIncrease_;
+  moreIntegers[20] = pivotCandLimit_;
+  moreIntegers[21] = doSuhlHeuristic_ ? 1 : 0;
+  double *moreDoubles = doubles + numberSavedBaseDoubles;
+  moreDoubles[0] = updateTol_;
+  moreDoubles[1] = maxU_;
+  moreDoubles[2] = maxGrowth_;
+  moreDoubles[3] = maxA_;
+  CoinArrayFileWriter file(CoinArrayFileSimpFactorization, savedSimpVersion);
+  file.addArray(savedSimpIntegers, integers,
+    numberSavedBaseIntegers + numberSavedSimpIntegers);
+  file.addArray(savedSimpDoubles, doubles,
+    numberSavedBaseDoubles + numberSavedSimpDoubles);
+  file.addArray(savedSimpPivotRow, pivotRow_, 2 * maximumRows_ + numberPivots_);
+  file.addArray(savedSimpElements, elements_,
+    (maximumRows_ + numberPivots_) * maximumRows_);
+#ifdef COIN_SIMP_CAPACITY
+  file.addArray(savedSimpUrowCapacities, UrowCapacities_, maximumRows_);
+  file.addArray(savedSimpUcolCapacities, UcolCapacities_, maximumRows_);
+#endif
+  int id = savedSimpArrays;
+  file.addArray(id++, denseVector_, maximumRows_);
+  file.addArray(id++, workArea2_, maximumRows_);
+  file.addArray(id++, workArea3_, maximumRows_);
+  file.addArray(id++, vecLabels_, maximumRows_);
+  file.addArray(id++, indVector_, maximumRows_);
+  file.addArray(id++, auxVector_, maximumRows_);
+  file.addArray(id++, auxInd_, maximumRows_);
+  file.addArray(id++, vecKeep_, maximumRows_);
+  file.addArray(id++, indKeep_, maximumRows_);
+  file.addArray(id++, LrowStarts_, maximumRows_);
+  file.addArray(id++, LrowLengths_, maximumRows_);
+  file.addArray(id++, Lrows_, LrowCap_);
+  file.addArray(id++, LrowInd_, LrowCap_);
+  file.addArray(id++, LcolStarts_, maximumRows_);
+  file.addArray(id++, LcolLengths_, maximumRows_);
+  file.addArray(id++, Lcolumns_, LcolCap_);
+  file.addArray(id++, LcolInd_, LcolCap_);
+  file.addArray(id++, UrowStarts_, maximumRows_);
+  file.addArray(id++, UrowLengths_, maximumRows_);
+  file.addArray(id++, Urows_, UrowMaxCap_);
+  file.addArray(id++, UrowInd_, UrowMaxCap_);
+  file.addArray(id++, prevRowInU_, maximumRows_);
+  file.addArray(id++, nextRowInU_, maximumRows_);
+  file.addArray(id++, UcolStarts_, maximumRows_);
+  file.addArray(id++, UcolLengths_, maximumRows_);
+  file.addArray(id++, Ucolumns_, UcolMaxCap_);
+  file.addArray(id++, UcolInd_, UcolMaxCap_);
+  file.addArray(id++, prevColInU_, maximumRows_);
+  file.addArray(id++, nextColInU_, maximumRows_);
+  file.addArray(id++, colSlack_, maximumRows_);
+  file.addArray(id++, invOfPivots_, maximumRows_);
+  file.addArray(id++, colOfU_, maximumRows_);
+  file.addArray(id++, colPosition_, maximumRows_);
+  file.addArray(id++, rowOfU_, maximumRows_);
+  file.addArray(id++, rowPosition_, maximumRows_);
+  file.addArray(id++, secRowOfU_, maximumRows_);
+  file.addArray(id++, secRowPosition_, maximumRows_);
+  file.addArray(id++, EtaPosition_, maxEtaRows_);
+  file.addArray(id++, EtaStarts_, maxEtaRows_);
+  file.addArray(id++, EtaLengths_, maxEtaRows_);
+  file.addArray(id++, EtaInd_, EtaMaxCap_);
+  file.addArray(id++, Eta_, EtaMaxCap_);
+  return file.write(fileName);
+}
+// Restores factors - arrays as in gutsOfCopy
+int CoinSimpFactorization::restoreFactors(const char *fileName)
+{
+  CoinArrayFileReader file;
+  int returnCode = file.open(fileName);
+  if (returnCode)
+    return returnCode;
+  if (file.kind() != CoinArrayFileSimpFactorization
+    || file.kindVersion() != savedSimpVersion)
+    return 2;
+  CoinBigIndex n;
+  const int *integers = file.array< int >(savedSimpIntegers, n);
+  if (!integers || n != numberSavedBaseIntegers + numberSavedSimpIntegers)
+    return 2;
+  const double *doubles = file.array< double >(savedSimpDoubles, n);
+  if (!doubles || n != numberSavedBaseDoubles + numberSavedSimpDoubles)
+    return 2;
+  gutsOfDestructor();
+  gutsOfInitialize();
+  setBaseScalars(integers, doubles);
+  const int *moreIntegers = integers + numberSavedBaseIntegers;
+  numberSlacks_ = moreIntegers[0];
+  firstNumberSlacks_ = moreIntegers[1];
+  keepSize_ = moreIntegers[2];
+  LrowSize_ = moreIntegers[3];
+  LrowCap_ = moreIntegers[4];
+  LcolSize_ = moreIntegers[5];
+  LcolCap_ = moreIntegers[6];
+  UrowMaxCap_ = moreIntegers[7];
+  UrowEnd_ = moreIntegers[8];
+  firstRowInU_ = moreIntegers[9];
+  lastRowInU_ = moreIntegers[10];
+  firstColInU_ = moreIntegers[11];
+  lastColInU_ = moreIntegers[12];
+  UcolMaxCap_ = moreIntegers[13];
+  UcolEnd_ = moreIntegers[14];
+  EtaSize_ = moreIntegers[15];
+  lastEtaRow_ = moreIntegers[16];
+  maxEtaRows_ = moreIntegers[17];
+  EtaMaxCap_ = moreIntegers[18];
+  minIncrease_ = moreIntegers[19];
+  pivotCandLimit_ = moreIntegers[20];
+  doSuhlHeuristic_ = moreIntegers[21] != 0;
+  const double *moreDoubles = doubles + numberSavedBaseDoubles;
+  updateTol_ = moreDoubles[0];
+  maxU_ = moreDoubles[1];
+  maxGrowth_ = moreDoubles[2];
+  maxA_ = moreDoubles[3];
+  bool good = maximumRows_ > 0 && numberPivots_ >= 0
+    && numberPivots_ <= maximumPivots_
+    && (maximumRows_ + numberPivots_) * maximumRows_ <= maximumSpace_;
+  if (good) {
+    pivotRow_ = new int[2 * maximumRows_ + maximumPivots_];
+    elements_ = new CoinFactorizationDouble2[maximumSpace_];
+    workArea_ = new CoinFactorizationDouble2[maximumRows_];
+    good = file.copyArray(savedSimpPivotRow, pivotRow_, 2 * maximumRows_ + numberPivots_)
+      && file.copyArray(savedSimpElements, elements_,
+        (maximumRows_ + numberPivots_) * maximumRows_);
+  }
+#ifdef COIN_SIMP_CAPACITY
+  good = good
+    && restoreSimpArray(file, savedSimpUrowCapacities, UrowCapacities_, maximumRows_)
+    && restoreSimpArray(file, savedSimpUcolCapacities, UcolCapacities_, maximumRows_);
+#endif
+  int id = savedSimpArrays;
+  good = good
+    && restoreSimpArray(file, id++, denseVector_, maximumRows_)
+    && restoreSimpArray(file, id++, workArea2_, maximumRows_)
+    && restoreSimpArray(file, id++, workArea3_, maximumRows_)
+    && restoreSimpArray(file, id++, vecLabels_, maximumRows_)
+    && restoreSimpArray(file, id++, indVector_, maximumRows_)
+    && restoreSimpArray(file, id++, auxVector_, maximumRows_)
+    && restoreSimpArray(file, id++, auxInd_, maximumRows_)
+    && restoreSimpArray(file, id++, vecKeep_, maximumRows_)
+    && restoreSimpArray(file, id++, indKeep_, maximumRows_)
+    && restoreSimpArray(file, id++, LrowStarts_, maximumRows_)
+    && restoreSimpArray(file, id++, LrowLengths_, maximumRows_)
+    && restoreSimpArray(file, id++, Lrows_, LrowCap_)
+    && restoreSimpArray(file, id++, LrowInd_, LrowCap_)
+    && restoreSimpArray(file, id++, LcolStarts_, maximumRows_)
+    && restoreSimpArray(file, id++, LcolLengths_, maximumRows_)
+    && restoreSimpArray(file, id++, Lcolumns_, LcolCap_)
+    && restoreSimpArray(file, id++, LcolInd_, LcolCap_)
+    && restoreSimpArray(file, id++, UrowStarts_, maximumRows_)
+    && restoreSimpArray(file, id++, UrowLengths_, maximumRows_)
+    && restoreSimpArray(file, id++, Urows_, UrowMaxCap_)
+    && restoreSimpArray(file, id++, UrowInd_, UrowMaxCap_)
+    && restoreSimpArray(file, id++, prevRowInU_, maximumRows_)
+    && restoreSimpArray(file, id++, nextRowInU_, maximumRows_)
+    && restoreSimpArray(file, id++, UcolStarts_, maximumRows_)
+    && restoreSimpArray(file, id++, UcolLengths_, maximumRows_)
+    && restoreSimpArray(file, id++, Ucolumns_, UcolMaxCap_)
+    && restoreSimpArray(file, id++, UcolInd_, UcolMaxCap_)
+    && restoreSimpArray(file, id++, prevColInU_, maximumRows_)
+    && restoreSimpArray(file, id++, nextColInU_, maximumRows_)
+    && restoreSimpArray(file, id++, colSlack_, maximumRows_)
+    && restoreSimpArray(file, id++, invOfPivots_, maximumRows_)
+    && restoreSimpArray(file, id++, colOfU_, maximumRows_)
+    && restoreSimpArray(file, id++, colPosition_, maximumRows_)
+    && restoreSimpArray(file, id++, rowOfU_, maximumRows_)
+    && restoreSimpArray(file, id++, rowPosition_, maximumRows_)
+    && restoreSimpArray(file, id++, secRowOfU_, maximumRows_)
+    && restoreSimpArray(file, id++, secRowPosition_, maximumRows_)
+    && restoreSimpArray(file, id++, EtaPosition_, maxEtaRows_)
+    && restoreSimpArray(file, id++, EtaStarts_, maxEtaRows_)
+    && restoreSimpArray(file, id++, EtaLengths_, maxEtaRows_)
+    && restoreSimpArray(file, id++, EtaInd_, EtaMaxCap_)
+    && restoreSimpArray(file, id++, Eta_, EtaMaxCap_);
+  if (!good) {
+    gutsOfDestructor();
+    gutsOfInitialize();
+    return 2;
+  }
+  return 0;
+}
+
 //  getAreas.  Gets space for a factorization
 //called by constructors
 void CoinSimpFactorization::getAreas(int numberOfRows,
@@ -800,6 +1047,8 @@ void CoinSimpFactorization::factorize(int numberOfRows,
 //Does factorization
 int CoinSimpFactorization::factor()
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::factorizePhase);
   numberPivots_ = 0;
   status_ = 0;
 
@@ -832,9 +1081,21 @@ int CoinSimpFactorization::factor()
       pivotRow_[j] = j;
       pivotRow_[j + numberRows_] = j;
     }
+  if (statistics_ && !status_)
+    statistics_->addFactorization(0, numberFactorElements(), 0);
 
   return status_;
 }
+// Number of elements actually held in L, U and etas
+int CoinSimpFactorization::numberFactorElements() const
+{
+  if (LcolSize_ < 0)
+    return 0;
+  int total = numberRows_ + LcolSize_ + EtaSize_;
+  for (int i = 0; i < numberRows_; i++)
+    total += UcolLengths_[i];
+  return total;
+}
 //
 
 // Makes a non-singular basis by replacing variables
@@ -890,6 +1151,8 @@ int CoinSimpFactorization::replaceColumn(CoinIndexedVector *,
   bool,
   double)
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::replaceColumnPhase);
   if (numberPivots_ == maximumPivots_)
     return 3;
 
@@ -902,6 +1165,8 @@ int CoinSimpFactorization::replaceColumn(CoinIndexedVector *,
 
   pivotRow_[2 * numberRows_ + numberPivots_] = realPivotRow;
   numberPivots_++;
+  if (statistics_)
+    statistics_->setUpdateElements(EtaSize_);
 
   return 0;
 }
@@ -909,12 +1174,16 @@ int CoinSimpFactorization::updateColumn(CoinIndexedVector *regionSparse,
   CoinIndexedVector *regionSparse2,
   bool noPermute) const
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::ftranPhase);
   return upColumn(regionSparse, regionSparse2, noPermute, false);
 }
 int CoinSimpFactorization::updateColumnFT(CoinIndexedVector *regionSparse,
   CoinIndexedVector *regionSparse2,
   bool noPermute)
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::ftranFTPhase);
 
   int rc = upColumn(regionSparse, regionSparse2, noPermute, true);
   return rc;
@@ -971,6 +1240,8 @@ int CoinSimpFactorization::updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
   CoinIndexedVector *regionSparse3,
   bool)
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::ftranTwoPhase);
   assert(numberRows_ == numberColumns_);
 
   double *region2 = regionSparse2->denseVector();
@@ -1058,6 +1329,8 @@ int CoinSimpFactorization::updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
 int CoinSimpFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
   CoinIndexedVector *regionSparse2) const
 {
+  CoinFactorizationStatisticsTimer timer(statistics_,
+    CoinFactorizationStatistics::btranPhase);
   upColumnTranspose(regionSparse, regionSparse2);
   return 0;
 }
@@ -2036,8 +2309,8 @@ void CoinSimpFactorization::allocateSomeArrays()
 void CoinSimpFactorization::Lxeqb(double *b) const
 {
   double *rhs = b;
-  int k, colBeg, *ind, *indEnd;
-  double xk, *Lcol;
+  int k, colBeg;
+  double xk;
   // now solve
   for (int j = firstNumberSlacks_; j < numberRows_; ++j) {
     k = rowOfU_[j];
@@ -2045,13 +2318,8 @@ void CoinSimpFactorization::Lxeqb(double *b) const
     if (xk != 0.0) {
       //if ( fabs(xk)>zeroTolerance_ ) {
       colBeg = LcolStarts_[k];
-      ind = LcolInd_ + colBeg;
-      indEnd = ind + LcolLengths_[k];
-      Lcol = Lcolumns_ + colBeg;
-      for (; ind != indEnd; ++ind) {
-        rhs[*ind] -= (*Lcol) * xk;
-        ++Lcol;
-      }
+      CoinSimdScatterAxpy(LcolLengths_[k], Lcolumns_ + colBeg,
+        LcolInd_ + colBeg, xk, rhs);
     }
   }
 }
@@ -2060,72 +2328,31 @@ void CoinSimpFactorization::Lxeqb2(double *b1, double *b2) const
 {
   double *rhs1 = b1;
   double *rhs2 = b2;
-  double x1, x2, *Lcol;
-  int k, colBeg, *ind, *indEnd, j;
+  double x1, x2;
+  int k, colBeg, length, j;
   // now solve
   for (j = firstNumberSlacks_; j < numberRows_; ++j) {
     k = rowOfU_[j];
     x1 = rhs1[k];
     x2 = rhs2[k];
-    if (x1 == 0.0) {
-      if (x2 == 0.0) {
-      } else {
-        colBeg = LcolStarts_[k];
-        ind = LcolInd_ + colBeg;
-        indEnd = ind + LcolLengths_[k];
-        Lcol = Lcolumns_ + colBeg;
-        for (; ind != indEnd; ++ind) {
-#if 0
-		    rhs2[ *ind ]-= (*Lcol) * x2;
-#else
-          double value = rhs2[*ind];
-          rhs2[*ind] = value - (*Lcol) * x2;
-#endif
-          ++Lcol;
-        }
-      }
-    } else {
-      if (x2 == 0.0) {
-        colBeg = LcolStarts_[k];
-        ind = LcolInd_ + colBeg;
-        indEnd = ind + LcolLengths_[k];
-        Lcol = Lcolumns_ + colBeg;
-        for (; ind != indEnd; ++ind) {
-#if 0
-		    rhs1[ *ind ]-= (*Lcol) * x1;
-#else
-          double value = rhs1[*ind];
-          rhs1[*ind] = value - (*Lcol) * x1;
-#endif
-          ++Lcol;
-        }
-      } else {
-        colBeg = LcolStarts_[k];
-        ind = LcolInd_ + colBeg;
-        indEnd = ind + LcolLengths_[k];
-        Lcol = Lcolumns_ + colBeg;
-        for (; ind != indEnd; ++ind) {
-#if 0
-		    rhs1[ *ind ]-= (*Lcol) * x1;
-		    rhs2[ *ind ]-= (*Lcol) * x2;
-#else
-          double value1 = rhs1[*ind];
-          rhs1[*ind] = value1 - (*Lcol) * x1;
-          double value2 = rhs2[*ind];
-          rhs2[*ind] = value2 - (*Lcol) * x2;
-#endif
-          ++Lcol;
-        }
-      }
-    }
+    if (x1 == 0.0 && x2 == 0.0)
+      continue;
+    colBeg = LcolStarts_[k];
+    length = LcolLengths_[k];
+    if (x1 != 0.0)
+      CoinSimdScatterAxpy(length, Lcolumns_ + colBeg, LcolInd_ + colBeg,
+        x1, rhs1);
+    if (x2 != 0.0)
+      CoinSimdScatterAxpy(length, Lcolumns_ + colBeg, LcolInd_ + colBeg,
+        x2, rhs2);
   }
 }
 
 void CoinSimpFactorization::Uxeqb(double *b, double *sol) const
 {
   double *rhs = b;
-  int row, column, colBeg, *ind, *indEnd, k;
-  double x, *uCol;
+  int row, column, colBeg, k;
+  double x;
   // now solve
   for (k = numberRows_ - 1; k >= numberSlacks_; --k) {
     row = secRowOfU_[k];
@@ -2135,18 +2362,8 @@ void CoinSimpFactorization::Uxeqb(double *b, double *sol) const
       //if ( fabs(x) > zeroTolerance_ ) {
       x *= invOfPivots_[row];
       colBeg = UcolStarts_[column];
-      ind = UcolInd_ + colBeg;
-      indEnd = ind + UcolLengths_[column];
-      uCol = Ucolumns_ + colBeg;
-      for (; ind != indEnd; ++ind) {
-#if 0 
-		rhs[ *ind ]-= (*uCol) * x;
-#else
-        double value = rhs[*ind];
-        rhs[*ind] = value - (*uCol) * x;
-#endif
-        ++uCol;
-      }
+      CoinSimdScatterAxpy(UcolLengths_[column], Ucolumns_ + colBeg,
+        UcolInd_ + colBeg, x, rhs);
       sol[column] = x;
     } else
       sol[column] = 0.0;
@@ -2162,77 +2379,32 @@ void CoinSimpFactorization::Uxeqb2(double *b1, double *sol1, double *b2, double
 {
   double *rhs1 = b1;
   double *rhs2 = b2;
-  int row, column, colBeg, *ind, *indEnd;
-  double x1, x2, *uCol;
+  int row, column, colBeg, length;
+  double x1, x2;
   // now solve
   for (int k = numberRows_ - 1; k >= numberSlacks_; --k) {
     row = secRowOfU_[k];
     x1 = rhs1[row];
     x2 = rhs2[row];
     column = colOfU_[k];
-    if (x1 == 0.0) {
-      if (x2 == 0.0) {
-        sol1[column] = 0.0;
-        sol2[column] = 0.0;
-      } else {
-        x2 *= invOfPivots_[row];
-        colBeg = UcolStarts_[column];
-        ind = UcolInd_ + colBeg;
-        indEnd = ind + UcolLengths_[column];
-        uCol = Ucolumns_ + colBeg;
-        for (; ind != indEnd; ++ind) {
-#if 0
-		    rhs2[ *ind ]-= (*uCol) * x2;
-#else
-          double value = rhs2[*ind];
-          rhs2[*ind] = value - (*uCol) * x2;
-#endif
-          ++uCol;
-        }
-        sol1[column] = 0.0;
-        sol2[column] = x2;
-      }
+    colBeg = UcolStarts_[column];
+    length = UcolLengths_[column];
+    if (x1 != 0.0) {
+      x1 *= invOfPivots_[row];
+      CoinSimdScatterAxpy(length, Ucolumns_ + colBeg, UcolInd_ + colBeg,
+        x1, rhs1);
     } else {
-      if (x2 == 0.0) {
-        x1 *= invOfPivots_[row];
-        colBeg = UcolStarts_[column];
-        ind = UcolInd_ + colBeg;
-        indEnd = ind + UcolLengths_[column];
-        uCol = Ucolumns_ + colBeg;
-        for (; ind != indEnd; ++ind) {
-#if 0
-		    rhs1[ *ind ]-= (*uCol) * x1;
-#else
-          double value = rhs1[*ind];
-          rhs1[*ind] = value - (*uCol) * x1;
-#endif
-          ++uCol;
-        }
-        sol1[column] = x1;
-        sol2[column] = 0.0;
-      } else {
-        x1 *= invOfPivots_[row];
-        x2 *= invOfPivots_[row];
-        colBeg = UcolStarts_[column];
-        ind = UcolInd_ + colBeg;
-        indEnd = ind + UcolLengths_[column];
-        uCol = Ucolumns_ + colBeg;
-        for (; ind != indEnd; ++ind) {
-#if 0
-		    rhs1[ *ind ]-= (*uCol) * x1;
-		    rhs2[ *ind ]-= (*uCol) * x2;
-#else
-          double value1 = rhs1[*ind];
-          rhs1[*ind] = value1 - (*uCol) * x1;
-          double value2 = rhs2[*ind];
-          rhs2[*ind] = value2 - (*uCol) * x2;
-#endif
-          ++uCol;
-        }
-        sol1[column] = x1;
-        sol2[column] = x2;
-      }
+      x1 = 0.0;
+    }
+    if (x2 != 0.0) {
+      x2 *= invOfPivots_[row];
+      CoinSimdScatterAxpy(length, Ucolumns_ + colBeg, UcolInd_ + colBeg,
+        x2, rhs2);
+    } else {
+      x2 = 0.0;
     }
+    sol1[column] = x1;
+    sol2[column] = x2;
   }
   for (int k = numberSlacks_ - 1; k >= 0; --k) {
     row = secRowOfU_[k];
@@ -2245,9 +2417,8 @@ void CoinSimpFactorization::Uxeqb2(double *b1, double *sol1, double *b2, double
 void CoinSimpFactorization::xLeqb(double *b) const
 {
   double *rhs = b;
-  int k, *ind, *indEnd, j;
+  int k, j;
   int colBeg;
-  double x, *Lcol;
   // find last nonzero
   int last;
   for (last = numberColumns_ - 1; last >= 0; --last) {
@@ -2258,16 +2429,9 @@ void CoinSimpFactorization::xLeqb(double *b) const
   if (last >= 0) {
     for (j = last; j >= firstNumberSlacks_; --j) {
       k = rowOfU_[j];
-      x = rhs[k];
       colBeg = LcolStarts_[k];
-      ind = LcolInd_ + colBeg;
-      indEnd = ind + LcolLengths_[k];
-      Lcol = Lcolumns_ + colBeg;
-      for (; ind != indEnd; ++ind) {
-        x -= (*Lcol) * rhs[*ind];
-        ++Lcol;
-      }
-      rhs[k] = x;
+      rhs[k] = CoinSimdDotSubtract(rhs[k], LcolLengths_[k],
+        Lcolumns_ + colBeg, LcolInd_ + colBeg, rhs);
     }
   } // if ( last >= 0 ){
 }
@@ -2275,12 +2439,11 @@ void CoinSimpFactorization::xLeqb(double *b) const
 void CoinSimpFactorization::xUeqb(double *b, double *sol) const
 {
   double *rhs = b;
-  int row, col, *ind, *indEnd, k;
+  int row, col, k;
   double xr;
   // now solve
 #if 1
   int rowBeg;
-  double *uRow;
   for (k = 0; k < numberSlacks_; ++k) {
     row = secRowOfU_[k];
     col = colOfU_[k];
@@ -2289,13 +2452,8 @@ void CoinSimpFactorization::xUeqb(double *b, double *sol) const
       //if ( fabs(xr)> zeroTolerance_ ) {
       xr = -xr;
       rowBeg = UrowStarts_[row];
-      ind = UrowInd_ + rowBeg;
-      indEnd = ind + UrowLengths_[row];
-      uRow = Urows_ + rowBeg;
-      for (; ind != indEnd; ++ind) {
-        rhs[*ind] -= (*uRow) * xr;
-        ++uRow;
-      }
+      CoinSimdScatterAxpy(UrowLengths_[row], Urows_ + rowBeg,
+        UrowInd_ + rowBeg, xr, rhs);
       sol[row] = xr;
     } else
       sol[row] = 0.0;
@@ -2308,18 +2466,14 @@ void CoinSimpFactorization::xUeqb(double *b, double *sol) const
       //if ( fabs(xr)> zeroTolerance_ ) {
       xr *= invOfPivots_[row];
       rowBeg = UrowStarts_[row];
-      ind = UrowInd_ + rowBeg;
-      indEnd = ind + UrowLengths_[row];
-      uRow = Urows_ + rowBeg;
-      for (; ind != indEnd; ++ind) {
-        rhs[*ind] -= (*uRow) * xr;
-        ++uRow;
-      }
+      CoinSimdScatterAxpy(UrowLengths_[row], Urows_ + rowBeg,
+        UrowInd_ + rowBeg, xr, rhs);
       sol[row] = xr;
     } else
       sol[row] = 0.0;
   }
 #else
+  int *ind, *indEnd;
   for (k = 0; k < numberSlacks_; ++k) {
     row = secRowOfU_[k];
     col = colOfU_[k];
@@ -2460,13 +2614,8 @@ int CoinSimpFactorization::LUupdate(int newBasicCol)
       denseVector_[UrowInd_[j]] -= multiplier * Urows_[j];
     }
 #else
-    int *ind = UrowInd_ + rowBeg;
-    int *indEnd = UrowInd_ + rowEnd;
-    double *uRow = Urows_ + rowBeg;
-    for (; ind != indEnd; ++ind) {
-      denseVector_[*ind] -= multiplier * (*uRow);
-      ++uRow;
-    }
+    CoinSimdScatterAxpy(rowEnd - rowBeg, Urows_ + rowBeg, UrowInd_ + rowBeg,
+      multiplier, denseVector_);
 #endif
     // store multiplier
     Eta_[EtaSize_] = multiplier;
@@ -2564,21 +2713,13 @@ void CoinSimpFactorization::copyRowPermutations()
 void CoinSimpFactorization::Hxeqb(double *b) const
 {
   double *rhs = b;
-  int row, rowBeg, *ind, *indEnd;
-  double xr, *eta;
-  // now solve
+  int row, rowBeg;
+  // now solve (value - dot with 0.0 start is minus dot exactly)
   for (int k = 0; k <= lastEtaRow_; ++k) {
     row = EtaPosition_[k];
     rowBeg = EtaStarts_[k];
-    xr = 0.0;
-    ind = EtaInd_ + rowBeg;
-    indEnd = ind + EtaLengths_[k];
-    eta = Eta_ + rowBeg;
-    for (; ind != indEnd; ++ind) {
-      xr += rhs[*ind] * (*eta);
-      ++eta;
-    }
-    rhs[row] -= xr;
+    rhs[row] += CoinSimdDotSubtract(0.0, EtaLengths_[k], Eta_ + rowBeg,
+      EtaInd_ + rowBeg, rhs);
   }
 }
 
@@ -2586,32 +2727,24 @@ void CoinSimpFactorization::Hxeqb2(double *b1, double *b2) const
 {
   double *rhs1 = b1;
   double *rhs2 = b2;
-  int row, rowBeg, *ind, *indEnd;
-  double x1, x2, *eta;
+  int row, rowBeg, length;
   // now solve
   for (int k = 0; k <= lastEtaRow_; ++k) {
     row = EtaPosition_[k];
     rowBeg = EtaStarts_[k];
-    x1 = 0.0;
-    x2 = 0.0;
-    ind = EtaInd_ + rowBeg;
-    indEnd = ind + EtaLengths_[k];
-    eta = Eta_ + rowBeg;
-    for (; ind != indEnd; ++ind) {
-      x1 += rhs1[*ind] * (*eta);
-      x2 += rhs2[*ind] * (*eta);
-      ++eta;
-    }
-    rhs1[row] -= x1;
-    rhs2[row] -= x2;
+    length = EtaLengths_[k];
+    rhs1[row] += CoinSimdDotSubtract(0.0, length, Eta_ + rowBeg,
+      EtaInd_ + rowBeg, rhs1);
+    rhs2[row] += CoinSimdDotSubtract(0.0, length, Eta_ + rowBeg,
+      EtaInd_ + rowBeg, rhs2);
   }
 }
 
 void CoinSimpFactorization::xHeqb(double *b) const
 {
   double *rhs = b;
-  int row, rowBeg, *ind, *indEnd;
-  double xr, *eta;
+  int row, rowBeg;
+  double xr;
   // now solve
   for (int k = lastEtaRow_; k >= 0; --k) {
     row = EtaPosition_[k];
@@ -2620,13 +2753,8 @@ void CoinSimpFactorization::xHeqb(double *b) const
       continue;
     //if ( fabs(xr) <= zeroTolerance_ ) continue;
     rowBeg = EtaStarts_[k];
-    ind = EtaInd_ + rowBeg;
-    indEnd = ind + EtaLengths_[k];
-    eta = Eta_ + rowBeg;
-    for (; ind != indEnd; ++ind) {
-      rhs[*ind] -= xr * (*eta);
-      ++eta;
-    }
+    CoinSimdScatterAxpy(EtaLengths_[k], Eta_ + rowBeg, EtaInd_ + rowBeg,
+      xr, rhs);
   }
 }
 
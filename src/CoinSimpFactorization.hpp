@@ -81,8 +81,18 @@ public:
   {
     return numberRows_ * (numberColumns_ + numberPivots_);
   }
+  /** Number of elements actually held in L, U and etas
+      (numberElements is dense size) */
+  int numberFactorElements() const;
   /// Returns maximum absolute value in factorization
   double maximumCoefficient() const;
+  /** Saves factors in binary form (see CoinArrayFile.hpp).
+      Returns 0 if okay, 1 if could not write, -1 if not factorized */
+  virtual int saveFactors(const char *file) const;
+  /** Restores factors saved by saveFactors.
+      Returns 0 if okay, 1 if could not read, 2 if not a valid file,
+      3 if a checksum is wrong */
+  virtual int restoreFactors(const char *file);
   //@}
 
   /**@name rank one updates which do exist */
@@ -0,0 +1,383 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#include "CoinUtilsConfig.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "CoinStringPool.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinTypes.h"
+
+namespace {
+// Size of blocks when no bigger one is needed
+const size_t blockSize = 65536;
+}
+
+// Default constructor
+CoinStringPool::CoinStringPool()
+  : blocks_(NULL)
+  , numberBlocks_(0)
+  , maximumBlocks_(0)
+  , lastBlock_(-1)
+  , numberCharacters_(0)
+  , unusedCharacters_(0)
+  , entries_(NULL)
+  , strings_(NULL)
+  , number_(0)
+  , maximumNumber_(0)
+{
+}
+// Copy constructor
+CoinStringPool::CoinStringPool(const CoinStringPool &rhs)
+  : blocks_(NULL)
+  , numberBlocks_(0)
+  , maximumBlocks_(0)
+  , lastBlock_(-1)
+  , numberCharacters_(0)
+  , unusedCharacters_(0)
+  , entries_(NULL)
+  , strings_(NULL)
+  , number_(0)
+  , maximumNumber_(0)
+{
+  append(rhs);
+}
+// = copy
+CoinStringPool &CoinStringPool::operator=(const CoinStringPool &rhs)
+{
+  if (this != &rhs) {
+    clear();
+    append(rhs);
+  }
+  return *this;
+}
+// Destructor
+CoinStringPool::~CoinStringPool()
+{
+  freeBlocks();
+  delete[] blocks_;
+  delete[] entries_;
+  delete[] strings_;
+}
+// Exchanges contents with rhs
+void CoinStringPool::swap(CoinStringPool &rhs)
+{
+  std::swap(blocks_, rhs.blocks_);
+  std::swap(numberBlocks_, rhs.numberBlocks_);
+  std::swap(maximumBlocks_, rhs.maximumBlocks_);
+  std::swap(lastBlock_, rhs.lastBlock_);
+  std::swap(numberCharacters_, rhs.numberCharacters_);
+  std::swap(unusedCharacters_, rhs.unusedCharacters_);
+  std::swap(entries_, rhs.entries_);
+  std::swap(strings_, rhs.strings_);
+  std::swap(number_, rhs.number_);
+  std::swap(maximumNumber_, rhs.maximumNumber_);
+}
+// Makes room for more entries
+void CoinStringPool::growEntries(int number)
+{
+  if (number <= maximumNumber_)
+    return;
+  int maximum = CoinMax(number, CoinMax(2 * maximumNumber_, 16));
+  Entry *entries = new Entry[maximum];
+  const char **strings = new const char *[maximum];
+  CoinMemcpyN(entries_, number_, entries);
+  CoinMemcpyN(strings_, number_, strings);
+  for (int i = number_; i < maximum; i++)
+    strings[i] = NULL;
+  delete[] entries_;
+  delete[] strings_;
+  entries_ = entries;
+  strings_ = strings;
+  maximumNumber_ = maximum;
+}
+// Makes a new last block of at least size characters
+void CoinStringPool::newBlock(size_t size)
+{
+  // use a free slot if there is one
+  int which = 0;
+  while (which < numberBlocks_ && blocks_[which].characters)
+    which++;
+  if (which == maximumBlocks_) {
+    int maximum = CoinMax(2 * maximumBlocks_, 8);
+    Block *blocks = new Block[maximum];
+    CoinMemcpyN(blocks_, numberBlocks_, blocks);
+    delete[] blocks_;
+    blocks_ = blocks;
+    maximumBlocks_ = maximum;
+  }
+  if (which == numberBlocks_)
+    numberBlocks_++;
+  // last block may now be empty - it was only kept to be added to
+  if (lastBlock_ >= 0 && !blocks_[lastBlock_].live) {
+    Block &last = blocks_[lastBlock_];
+    numberCharacters_ -= last.used;
+    unusedCharacters_ -= last.used;
+    delete[] last.characters;
+    last.characters = NULL;
+  }
+  Block &block = blocks_[which];
+  block.characters = new char[size];
+  block.size = size;
+  block.used = 0;
+  block.live = 0;
+  lastBlock_ = which;
+}
+// Puts string in last block and sets entry
+void CoinStringPool::store(int which, const char *string, int length)
+{
+  size_t needed = length + 1;
+  if (lastBlock_ < 0 || blocks_[lastBlock_].used + needed > blocks_[lastBlock_].size)
+    newBlock(CoinMax(needed, blockSize));
+  Block &block = blocks_[lastBlock_];
+  char *put = block.characters + block.used;
+  // string may be in a block of this pool but blocks do not move
+  memcpy(put, string, length);
+  put[length] = '\0';
+  block.used += needed;
+  block.live += needed;
+  numberCharacters_ += needed;
+  entries_[which].length = length;
+  entries_[which].block = lastBlock_;
+  strings_[which] = put;
+}
+// Characters of entry are no longer needed
+void CoinStringPool::release(const Entry &entry)
+{
+  if (entry.length < 0)
+    return;
+  size_t characters = entry.length + 1;
+  Block &block = blocks_[entry.block];
+  block.live -= characters;
+  unusedCharacters_ += characters;
+  if (!block.live && entry.block != lastBlock_) {
+    numberCharacters_ -= block.used;
+    unusedCharacters_ -= block.used;
+    delete[] block.characters;
+    block.characters = NULL;
+  }
+}
+// Frees all blocks
+void CoinStringPool::freeBlocks()
+{
+  for (int i = 0; i < numberBlocks_; i++) {
+    delete[] blocks_[i].characters;
+    blocks_[i].characters = NULL;
+  }
+  numberBlocks_ = 0;
+  lastBlock_ = -1;
+  numberCharacters_ = 0;
+  unusedCharacters_ = 0;
+}
+// Makes room for numberStrings entries and numberCharacters characters
+void CoinStringPool::reserve(int numberStrings, size_t numberCharacters)
+{
+  growEntries(numberStrings);
+  if (numberCharacters > numberCharacters_) {
+    size_t needed = numberCharacters - numberCharacters_;
+    if (lastBlock_ < 0 || blocks_[lastBlock_].used + needed > blocks_[lastBlock_].size)
+      newBlock(needed);
+  }
+}
+// Removes all entries
+void CoinStringPool::clear()
+{
+  for (int i = 0; i < number_; i++)
+    strings_[i] = NULL;
+  number_ = 0;
+  // keep last block (empty)
+  Block last;
+  bool keep = lastBlock_ >= 0;
+  if (keep) {
+    last = blocks_[lastBlock_];
+    blocks_[lastBlock_].characters = NULL;
+  }
+  freeBlocks();
+  if (keep) {
+    last.used = 0;
+    last.live = 0;
+    blocks_[0] = last;
+    numberBlocks_ = 1;
+    lastBlock_ = 0;
+  }
+}
+// Keeps first numberStrings entries or adds unset entries
+void CoinStringPool::resize(int numberStrings)
+{
+  assert(numberStrings >= 0);
+  if (numberStrings < number_) {
+    for (int i = numberStrings; i < number_; i++) {
+      release(entries_[i]);
+      strings_[i] = NULL;
+    }
+  } else {
+    growEntries(numberStrings);
+    for (int i = number_; i < numberStrings; i++) {
+      entries_[i].length = -1;
+      entries_[i].hash = 0;
+      entries_[i].block = -1;
+    }
+  }
+  number_ = numberStrings;
+}
+// Adds string as new last entry
+int CoinStringPool::addString(const char *string, int length)
+{
+  setString(number_, string, length);
+  return number_ - 1;
+}
+// Adds entry which of other as new last entry
+int CoinStringPool::addString(const CoinStringPool &other, int which)
+{
+  assert(this != &other && other.entries_[which].length >= 0);
+  growEntries(number_ + 1);
+  store(number_, other.strings_[which], other.entries_[which].length);
+  entries_[number_].hash = other.entries_[which].hash;
+  return number_++;
+}
+// Sets entry which
+void CoinStringPool::setString(int which, const char *string, int length)
+{
+  assert(which >= 0);
+  if (length < 0)
+    length = static_cast< int >(strlen(string));
+  if (which >= number_)
+    resize(which + 1);
+  // copy before old characters are released (string may be them)
+  Entry old = entries_[which];
+  store(which, string, length);
+  entries_[which].hash = hashString(strings_[which], length);
+  release(old);
+}
+// Makes entry which unset
+void CoinStringPool::removeString(int which)
+{
+  if (which < number_ && entries_[which].length >= 0) {
+    release(entries_[which]);
+    entries_[which].length = -1;
+    entries_[which].hash = 0;
+    entries_[which].block = -1;
+    strings_[which] = NULL;
+  }
+}
+// Adds entries of other
+void CoinStringPool::append(const CoinStringPool &other)
+{
+  assert(this != &other);
+  int number = other.number_;
+  reserve(number_ + number,
+    numberCharacters_ + other.numberCharacters_ - other.unusedCharacters_);
+  for (int i = 0; i < number; i++) {
+    const Entry &entry = other.entries_[i];
+    if (entry.length >= 0) {
+      store(number_ + i, other.strings_[i], entry.length);
+      entries_[number_ + i].hash = entry.hash;
+    } else {
+      entries_[number_ + i] = entry;
+      strings_[number_ + i] = NULL;
+    }
+  }
+  number_ += number;
+}
+// Deletes number entries and moves rest down
+void CoinStringPool::deleteStrings(int number, const int *which)
+{
+  if (!number)
+    return;
+  char *deleted = new char[number_];
+  CoinZeroN(deleted, number_);
+  for (int i = 0; i < number; i++) {
+    int j = which[i];
+    if (j >= 0 && j < number_ && !deleted[j]) {
+      deleted[j] = 1;
+      release(entries_[j]);
+    }
+  }
+  int put = 0;
+  for (int i = 0; i < number_; i++) {
+    if (!deleted[i]) {
+      entries_[put] = entries_[i];
+      strings_[put++] = strings_[i];
+    }
+  }
+  for (int i = put; i < number_; i++)
+    strings_[i] = NULL;
+  delete[] deleted;
+  number_ = put;
+}
+// Squeezes out characters of unset and replaced strings
+void CoinStringPool::compact()
+{
+  if (!unusedCharacters_)
+    return;
+  size_t numberCharacters = numberCharacters_ - unusedCharacters_;
+  char *characters = new char[CoinMax< size_t >(numberCharacters, 1)];
+  size_t put = 0;
+  for (int i = 0; i < number_; i++) {
+    Entry &entry = entries_[i];
+    if (entry.length >= 0) {
+      memcpy(characters + put, strings_[i], entry.length + 1);
+      strings_[i] = characters + put;
+      entry.block = 0;
+      put += entry.length + 1;
+    }
+  }
+  assert(put == numberCharacters);
+  freeBlocks();
+  Block &block = blocks_[0];
+  block.characters = characters;
+  block.size = CoinMax< size_t >(numberCharacters, 1);
+  block.used = numberCharacters;
+  block.live = numberCharacters;
+  numberBlocks_ = 1;
+  lastBlock_ = 0;
+  numberCharacters_ = numberCharacters;
+}
+// Hash value of length characters
+unsigned int CoinStringPool::hashString(const char *string, int length)
+{
+  // eight characters at a time, multiply and shift to mix
+  const CoinUInt64 multiplier = 0x9e3779b97f4a7c15ULL;
+  CoinUInt64 hash = static_cast< CoinUInt64 >(length) * multiplier;
+  const char *last = string + length;
+  while (last - string > 8) {
+    CoinUInt64 word;
+    memcpy(&word, string, 8);
+    hash = (hash ^ word) * multiplier;
+    hash ^= hash >> 29;
+    string += 8;
+  }
+  /* Last one to eight characters with fixed size reads (which may
+     overlap characters already used) - variable size copies are slow */
+  CoinUInt64 word;
+  if (length >= 8) {
+    memcpy(&word, last - 8, 8);
+  } else if (length >= 4) {
+    unsigned int first4;
+    unsigned int last4;
+    memcpy(&first4, string, 4);
+    memcpy(&last4, last - 4, 4);
+    word = (static_cast< CoinUInt64 >(first4) << 32) | last4;
+  } else if (length > 0) {
+    word = (static_cast< CoinUInt64 >(static_cast< unsigned char >(string[0])) << 16)
+      | (static_cast< CoinUInt64 >(static_cast< unsigned char >(string[length >> 1])) << 8)
+      | static_cast< unsigned char >(last[-1]);
+  } else {
+    word = 0;
+  }
+  hash = (hash ^ word) * multiplier;
+  hash ^= hash >> 29;
+  // finish as MurmurHash3 does
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return static_cast< unsigned int >(hash);
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
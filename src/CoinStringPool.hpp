@@ -0,0 +1,188 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifndef CoinStringPool_H
+#define CoinStringPool_H
+
+#include <cstddef>
+#include <cstring>
+
+#include "CoinUtilsConfig.h"
+
+/** Numbered strings kept in large blocks of characters.
+
+    Row and column names used to be one malloc each - tens of millions of
+    small allocations for a big model.  Here the characters of strings go
+    end to end (each null terminated) in blocks and each string has a
+    length and a hash value computed once when it is added.  CoinMpsIO,
+    CoinLpIO and CoinModelHash keep their names in pools, and swap()
+    hands a whole pool from one to another without copying.
+
+    Blocks are never moved or grown, so a string stays where it is until
+    its entry is replaced, removed or deleted, or the pool is cleared,
+    compacted or destroyed.  Pointers returned by string() may be kept
+    that long (callers such as CoinModel::getRowName rely on this) and
+    stringArray() is kept up to date as strings are stored.  A block is
+    freed when all the strings in it have gone.
+
+    Entries may be unset (string() is then NULL).
+*/
+class COINUTILSLIB_EXPORT CoinStringPool {
+
+public:
+  /**@name Constructors, destructor and copying */
+  //@{
+  /// Default constructor (empty)
+  CoinStringPool();
+  /// Copy constructor (copy is compact)
+  CoinStringPool(const CoinStringPool &rhs);
+  /// = copy
+  CoinStringPool &operator=(const CoinStringPool &rhs);
+  /// Destructor
+  ~CoinStringPool();
+  /// Exchanges contents with rhs (no copying)
+  void swap(CoinStringPool &rhs);
+  //@}
+
+  /**@name Sizes */
+  //@{
+  /// Number of entries (set or not)
+  inline int numberStrings() const
+  {
+    return number_;
+  }
+  /// Characters in blocks (including terminators and unused)
+  inline size_t numberCharacters() const
+  {
+    return numberCharacters_;
+  }
+  /// Makes room for numberStrings entries and numberCharacters characters
+  void reserve(int numberStrings, size_t numberCharacters);
+  /// Removes all entries (last block is kept)
+  void clear();
+  /// Keeps first numberStrings entries or adds unset entries up to it
+  void resize(int numberStrings);
+  //@}
+
+  /**@name Adding and changing strings */
+  //@{
+  /** Adds string (length characters or up to null if length < 0) as
+      new last entry and returns its index */
+  int addString(const char *string, int length = -1);
+  /** Adds entry which of other (must be set) as new last entry and
+      returns its index - hash value is not computed again */
+  int addString(const CoinStringPool &other, int which);
+  /// Sets entry which (adding unset entries before it if needed)
+  void setString(int which, const char *string, int length = -1);
+  /// Makes entry which unset
+  void removeString(int which);
+  /// Adds entries of other (no hashing needed)
+  void append(const CoinStringPool &other);
+  /** Deletes number entries (which need not be sorted) and moves the
+      rest down.  Characters are not moved */
+  void deleteStrings(int number, const int *which);
+  /** Squeezes out characters of unset and replaced strings.  This moves
+      all strings to one new block */
+  void compact();
+  //@}
+
+  /**@name Looking at strings */
+  //@{
+  /// String at which or NULL if unset or out of range
+  inline const char *string(int which) const
+  {
+    return (which >= 0 && which < number_) ? strings_[which] : NULL;
+  }
+  /// Length of string at which (-1 if unset)
+  inline int stringLength(int which) const
+  {
+    return entries_[which].length;
+  }
+  /// Hash value of string at which (from hashString)
+  inline unsigned int stringHash(int which) const
+  {
+    return entries_[which].hash;
+  }
+  /// Whether string at which is the length characters at string
+  inline bool sameString(int which, const char *string, int length) const
+  {
+    return entries_[which].length == length
+      && !memcmp(strings_[which], string, length);
+  }
+  /** Pointers to all strings (NULL for unset and after last entry), for
+      code that wants an array of names.  NULL if pool has never had
+      entries */
+  inline const char *const *stringArray() const
+  {
+    return strings_;
+  }
+  /// Hash value of length characters (same for equal strings)
+  static unsigned int hashString(const char *string, int length);
+  //@}
+
+private:
+  /// Length and hash of a string (together so a lookup touches one cache line)
+  struct Entry {
+    /// Length (-1 unset)
+    int length;
+    /// Hash value
+    unsigned int hash;
+    /// Block string is in
+    int block;
+  };
+  /// Block of characters
+  struct Block {
+    /// Characters (NULL if block slot is free)
+    char *characters;
+    /// Size
+    size_t size;
+    /// Characters used (strings go end to end)
+    size_t used;
+    /// Characters of strings still in block
+    size_t live;
+  };
+
+  /**@name Private methods */
+  //@{
+  /// Makes room for more entries
+  void growEntries(int number);
+  /// Makes a new last block of at least size characters
+  void newBlock(size_t size);
+  /// Puts string in last block and sets entry (hash is not set)
+  void store(int which, const char *string, int length);
+  /// Characters of entry are no longer needed (frees block if empty)
+  void release(const Entry &entry);
+  /// Frees all blocks
+  void freeBlocks();
+  //@}
+
+  /**@name Data */
+  //@{
+  /// Blocks
+  Block *blocks_;
+  /// Number of block slots used
+  int numberBlocks_;
+  /// Room for block slots
+  int maximumBlocks_;
+  /// Block strings are being added to (-1 if none)
+  int lastBlock_;
+  /// Characters used in blocks
+  size_t numberCharacters_;
+  /// Characters of unset and replaced strings
+  size_t unusedCharacters_;
+  /// Entries
+  Entry *entries_;
+  /** Pointer to each string (NULL if unset).  Sized as entries_ with
+      NULL after last entry so it can be given out by stringArray */
+  const char **strings_;
+  /// Number of entries
+  int number_;
+  /// Room for entries
+  int maximumNumber_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
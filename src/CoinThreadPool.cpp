@@ -0,0 +1,231 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#include "CoinUtilsConfig.h"
+#include "CoinThreadPool.hpp"
+
+#include <cassert>
+#include <cstddef>
+#ifdef COINUTILS_PTHREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#ifdef COINUTILS_PTHREADS
+namespace {
+// Per thread index (stored as index+1 so that 0 means not set)
+pthread_key_t threadIndexKey;
+pthread_once_t threadIndexOnce = PTHREAD_ONCE_INIT;
+void makeThreadIndexKey()
+{
+  pthread_key_create(&threadIndexKey, NULL);
+}
+void setThreadIndex(int which)
+{
+  pthread_once(&threadIndexOnce, makeThreadIndexKey);
+  pthread_setspecific(threadIndexKey,
+    reinterpret_cast< void * >(static_cast< size_t >(which + 1)));
+}
+
+struct CoinThreadPoolInfo;
+typedef struct {
+  CoinThreadPoolInfo *pool;
+  int which;
+} CoinThreadStart;
+
+struct CoinThreadPoolInfo {
+  pthread_t *threads;
+  CoinThreadStart *starts;
+  int numberWorkers;
+  // protects everything below
+  pthread_mutex_t mutex;
+  // signalled when there is new work (or stopping)
+  pthread_cond_t workReady;
+  // signalled when last worker has finished
+  pthread_cond_t workDone;
+  // only one run() at a time
+  pthread_mutex_t runMutex;
+  CoinThreadPool::CoinThreadTask function;
+  void *info;
+  int numberTasks;
+  int nextTask;
+  int numberBusy;
+  int generation;
+  bool stop;
+};
+
+/* Takes tasks until none left (called with mutex held and
+   returns with it held) */
+void doTasks(CoinThreadPoolInfo *pool)
+{
+  while (pool->nextTask < pool->numberTasks) {
+    int which = pool->nextTask++;
+    CoinThreadPool::CoinThreadTask function = pool->function;
+    void *info = pool->info;
+    pthread_mutex_unlock(&pool->mutex);
+    function(info, which);
+    pthread_mutex_lock(&pool->mutex);
+  }
+}
+
+void *workerLoop(void *arg)
+{
+  CoinThreadStart *start = reinterpret_cast< CoinThreadStart * >(arg);
+  CoinThreadPoolInfo *pool = start->pool;
+  setThreadIndex(start->which);
+  pthread_mutex_lock(&pool->mutex);
+  // pool starts at generation 0 (work may be posted before we get here)
+  int seen = 0;
+  while (true) {
+    while (pool->generation == seen && !pool->stop)
+      pthread_cond_wait(&pool->workReady, &pool->mutex);
+    if (pool->stop)
+      break;
+    seen = pool->generation;
+    doTasks(pool);
+    pool->numberBusy--;
+    if (!pool->numberBusy)
+      pthread_cond_signal(&pool->workDone);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+  return NULL;
+}
+}
+#endif
+
+//#############################################################################
+
+CoinThreadPool::CoinThreadPool(int numberThreads)
+  : numberThreads_(numberThreads > 0 ? numberThreads : defaultNumberThreads())
+  , threads_(NULL)
+{
+#ifdef COINUTILS_PTHREADS
+  if (numberThreads_ > 1) {
+    CoinThreadPoolInfo *pool = new CoinThreadPoolInfo;
+    pool->numberWorkers = numberThreads_ - 1;
+    pool->threads = new pthread_t[pool->numberWorkers];
+    pool->starts = new CoinThreadStart[pool->numberWorkers];
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_mutex_init(&pool->runMutex, NULL);
+    pthread_cond_init(&pool->workReady, NULL);
+    pthread_cond_init(&pool->workDone, NULL);
+    pool->function = NULL;
+    pool->info = NULL;
+    pool->numberTasks = 0;
+    pool->nextTask = 0;
+    pool->numberBusy = 0;
+    pool->generation = 0;
+    pool->stop = false;
+    int numberStarted = 0;
+    for (int i = 0; i < pool->numberWorkers; i++) {
+      pool->starts[i].pool = pool;
+      pool->starts[i].which = i + 1;
+      if (pthread_create(pool->threads + i, NULL, workerLoop, pool->starts + i))
+        break;
+      numberStarted++;
+    }
+    // carry on with what we could get
+    pool->numberWorkers = numberStarted;
+    numberThreads_ = numberStarted + 1;
+    threads_ = pool;
+  } else {
+    numberThreads_ = 1;
+  }
+#else
+  numberThreads_ = 1;
+#endif
+}
+
+CoinThreadPool::~CoinThreadPool()
+{
+#ifdef COINUTILS_PTHREADS
+  CoinThreadPoolInfo *pool = reinterpret_cast< CoinThreadPoolInfo * >(threads_);
+  if (pool) {
+    pthread_mutex_lock(&pool->mutex);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->workReady);
+    pthread_mutex_unlock(&pool->mutex);
+    for (int i = 0; i < pool->numberWorkers; i++)
+      pthread_join(pool->threads[i], NULL);
+    pthread_cond_destroy(&pool->workDone);
+    pthread_cond_destroy(&pool->workReady);
+    pthread_mutex_destroy(&pool->runMutex);
+    pthread_mutex_destroy(&pool->mutex);
+    delete[] pool->starts;
+    delete[] pool->threads;
+    delete pool;
+  }
+#endif
+}
+
+// Runs function(info,i) for all tasks
+void CoinThreadPool::run(int numberTasks, CoinThreadTask function, void *info)
+{
+  if (numberTasks <= 0)
+    return;
+#ifdef COINUTILS_PTHREADS
+  CoinThreadPoolInfo *pool = reinterpret_cast< CoinThreadPoolInfo * >(threads_);
+  if (pool && pool->numberWorkers && numberTasks > 1) {
+    pthread_mutex_lock(&pool->runMutex);
+    // caller is thread 0 while running tasks
+    int saveIndex = threadIndex();
+    setThreadIndex(0);
+    pthread_mutex_lock(&pool->mutex);
+    pool->function = function;
+    pool->info = info;
+    pool->numberTasks = numberTasks;
+    pool->nextTask = 0;
+    pool->numberBusy = pool->numberWorkers;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->workReady);
+    doTasks(pool);
+    while (pool->numberBusy)
+      pthread_cond_wait(&pool->workDone, &pool->mutex);
+    pool->function = NULL;
+    pool->info = NULL;
+    pool->numberTasks = 0;
+    pthread_mutex_unlock(&pool->mutex);
+    setThreadIndex(saveIndex);
+    pthread_mutex_unlock(&pool->runMutex);
+    return;
+  }
+#endif
+  for (int i = 0; i < numberTasks; i++)
+    function(info, i);
+}
+
+// True if built with thread support
+bool CoinThreadPool::threadsAvailable()
+{
+#ifdef COINUTILS_PTHREADS
+  return true;
+#else
+  return false;
+#endif
+}
+
+// Number of processors
+int CoinThreadPool::defaultNumberThreads()
+{
+#if defined(COINUTILS_PTHREADS) && defined(_SC_NPROCESSORS_ONLN)
+  long number = sysconf(_SC_NPROCESSORS_ONLN);
+  return number > 0 ? static_cast< int >(number) : 1;
+#else
+  return 1;
+#endif
+}
+
+// Index of thread running current task
+int CoinThreadPool::threadIndex()
+{
+#ifdef COINUTILS_PTHREADS
+  pthread_once(&threadIndexOnce, makeThreadIndexKey);
+  size_t value = reinterpret_cast< size_t >(pthread_getspecific(threadIndexKey));
+  return value ? static_cast< int >(value - 1) : 0;
+#else
+  return 0;
+#endif
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
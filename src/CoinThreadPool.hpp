@@ -0,0 +1,81 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifndef CoinThreadPool_H
+#define CoinThreadPool_H
+
+#include "CoinUtilsConfig.h"
+
+/** A small pool of worker threads.
+
+    The pool runs a number of independent tasks and returns when all of
+    them have finished.  Each task is a call function(info,which) with
+    which running from 0 to numberTasks-1.  Tasks are handed out in
+    whatever order threads become free, so a task must only write to
+    storage that belongs to it if results are to be deterministic.
+
+    Threads are only used if CoinUtils was configured with
+    --enable-coinutils-threads.  Otherwise (or if the pool has just one
+    thread) tasks are run in order by the calling thread, so code using
+    the pool does not need a serial version as well.
+
+    The worker threads are created once and then wait for work, so it
+    is cheap to call run() many times.
+*/
+class COINUTILSLIB_EXPORT CoinThreadPool {
+
+public:
+  /// Task run by the pool - info is passed through, which is task number
+  typedef void (*CoinThreadTask)(void *info, int which);
+
+  /**@name Constructors and destructor */
+  //@{
+  /** Constructor - if numberThreads <= 0 then uses
+      defaultNumberThreads() */
+  CoinThreadPool(int numberThreads = 0);
+  /// Destructor (stops threads)
+  ~CoinThreadPool();
+  //@}
+
+  /**@name Running tasks */
+  //@{
+  /** Runs function(info,i) for i = 0 .. numberTasks-1 and
+      returns when all have finished.  The calling thread does work too */
+  void run(int numberTasks, CoinThreadTask function, void *info);
+  /// Number of threads (including calling thread)
+  inline int numberThreads() const
+  {
+    return numberThreads_;
+  }
+  //@}
+
+  /**@name Static methods */
+  //@{
+  /// True if CoinUtils was built with thread support
+  static bool threadsAvailable();
+  /// Number of processors (1 if no thread support)
+  static int defaultNumberThreads();
+  /** Index of thread running current task, 0 .. numberThreads()-1.
+      The calling thread of run() (or any thread outside a pool) is 0.
+      This can be used to pick per thread work areas. */
+  static int threadIndex();
+  //@}
+
+private:
+  /// Not allowed
+  CoinThreadPool(const CoinThreadPool &);
+  CoinThreadPool &operator=(const CoinThreadPool &);
+
+  /**@name Private member data */
+  //@{
+  /// Number of threads including caller
+  int numberThreads_;
+  /// Threads, locks etc (opaque so header does not need pthread.h)
+  void *threads_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
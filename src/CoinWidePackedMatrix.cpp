@@ -0,0 +1,352 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#include "CoinUtilsConfig.h"
+
+#include <cstring>
+#include <limits>
+
+#include "CoinWidePackedMatrix.hpp"
+#include "CoinError.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinModel.hpp"
+#include "CoinMpsIO.hpp"
+#include "CoinPackedMatrix.hpp"
+
+namespace {
+// Whether value fits in type T
+template < typename T, typename V >
+inline bool fitsIn(V value)
+{
+  return value >= 0
+    && static_cast< CoinUInt64 >(value)
+    <= static_cast< CoinUInt64 >(std::numeric_limits< T >::max());
+}
+
+/* CoinCopyOfArray and CoinZeroN take CoinBigIndex sizes which may be
+   too small here */
+template < typename T, typename S >
+inline T *copyOfArray(const T *array, S size)
+{
+  if (!array)
+    return NULL;
+  T *copy = new T[size];
+  memcpy(copy, array, static_cast< size_t >(size) * sizeof(T));
+  return copy;
+}
+
+template < typename T, typename S >
+inline void zeroN(T *to, S size)
+{
+  memset(to, 0, static_cast< size_t >(size) * sizeof(T));
+}
+}
+
+// Default constructor
+template < typename StartType, typename IndexType >
+CoinWidePackedMatrix< StartType, IndexType >::CoinWidePackedMatrix()
+  : colOrdered_(true)
+  , majorDim_(0)
+  , minorDim_(0)
+  , start_(NULL)
+  , index_(NULL)
+  , element_(NULL)
+{
+  gutsOfDestructor(true, 0, 0);
+}
+// Constructor from arrays
+template < typename StartType, typename IndexType >
+CoinWidePackedMatrix< StartType, IndexType >::CoinWidePackedMatrix(bool colOrdered,
+  IndexType minor, IndexType major, const StartType *starts,
+  const IndexType *indices, const double *elements)
+  : colOrdered_(true)
+  , majorDim_(0)
+  , minorDim_(0)
+  , start_(NULL)
+  , index_(NULL)
+  , element_(NULL)
+{
+  if (minor < 0 || major < 0 || starts[0] != 0)
+    throw CoinError("bad dimensions or starts", "CoinWidePackedMatrix",
+      "CoinWidePackedMatrix");
+  gutsOfCopy(colOrdered, minor, major, starts, indices, elements);
+}
+// Constructor from a CoinPackedMatrix
+template < typename StartType, typename IndexType >
+CoinWidePackedMatrix< StartType, IndexType >::CoinWidePackedMatrix(const CoinPackedMatrix &matrix)
+  : colOrdered_(true)
+  , majorDim_(0)
+  , minorDim_(0)
+  , start_(NULL)
+  , index_(NULL)
+  , element_(NULL)
+{
+  fromPackedMatrix(matrix);
+}
+// Copy constructor
+template < typename StartType, typename IndexType >
+CoinWidePackedMatrix< StartType, IndexType >::CoinWidePackedMatrix(const CoinWidePackedMatrix &rhs)
+  : colOrdered_(true)
+  , majorDim_(0)
+  , minorDim_(0)
+  , start_(NULL)
+  , index_(NULL)
+  , element_(NULL)
+{
+  gutsOfCopy(rhs.colOrdered_, rhs.minorDim_, rhs.majorDim_, rhs.start_,
+    rhs.index_, rhs.element_);
+}
+// = copy
+template < typename StartType, typename IndexType >
+CoinWidePackedMatrix< StartType, IndexType > &
+CoinWidePackedMatrix< StartType, IndexType >::operator=(const CoinWidePackedMatrix &rhs)
+{
+  if (this != &rhs)
+    gutsOfCopy(rhs.colOrdered_, rhs.minorDim_, rhs.majorDim_, rhs.start_,
+      rhs.index_, rhs.element_);
+  return *this;
+}
+// Destructor
+template < typename StartType, typename IndexType >
+CoinWidePackedMatrix< StartType, IndexType >::~CoinWidePackedMatrix()
+{
+  delete[] start_;
+  delete[] index_;
+  delete[] element_;
+}
+// Frees arrays and makes empty matrix with given dimensions
+template < typename StartType, typename IndexType >
+void CoinWidePackedMatrix< StartType, IndexType >::gutsOfDestructor(bool colOrdered,
+  IndexType minor, IndexType major)
+{
+  delete[] start_;
+  delete[] index_;
+  delete[] element_;
+  colOrdered_ = colOrdered;
+  minorDim_ = minor;
+  majorDim_ = major;
+  start_ = new StartType[major + 1];
+  zeroN(start_, major + 1);
+  index_ = NULL;
+  element_ = NULL;
+}
+// Copies arrays
+template < typename StartType, typename IndexType >
+void CoinWidePackedMatrix< StartType, IndexType >::gutsOfCopy(bool colOrdered,
+  IndexType minor, IndexType major, const StartType *starts,
+  const IndexType *indices, const double *elements)
+{
+  // starts may be those of this
+  StartType *start = copyOfArray(starts, major + 1);
+  StartType size = start[major];
+  IndexType *index = copyOfArray(indices, size);
+  double *element = copyOfArray(elements, size);
+  delete[] start_;
+  delete[] index_;
+  delete[] element_;
+  colOrdered_ = colOrdered;
+  minorDim_ = minor;
+  majorDim_ = major;
+  start_ = start;
+  index_ = index;
+  element_ = element;
+}
+// Builds from triples
+template < typename StartType, typename IndexType >
+void CoinWidePackedMatrix< StartType, IndexType >::fromTriples(bool colOrdered,
+  IndexType numberRows, IndexType numberColumns, StartType numberElements,
+  const IndexType *rowIndices, const IndexType *colIndices,
+  const double *elements)
+{
+  if (numberRows < 0 || numberColumns < 0 || numberElements < 0)
+    throw CoinError("negative size", "fromTriples", "CoinWidePackedMatrix");
+  const IndexType *majorIndex = colOrdered ? colIndices : rowIndices;
+  const IndexType *minorIndex = colOrdered ? rowIndices : colIndices;
+  IndexType major = colOrdered ? numberColumns : numberRows;
+  IndexType minor = colOrdered ? numberRows : numberColumns;
+  for (StartType j = 0; j < numberElements; j++) {
+    if (majorIndex[j] < 0 || majorIndex[j] >= major
+      || minorIndex[j] < 0 || minorIndex[j] >= minor)
+      throw CoinError("index out of range", "fromTriples", "CoinWidePackedMatrix");
+  }
+  gutsOfDestructor(colOrdered, minor, major);
+  // count then put (start_[i+1] is next free place in i while putting)
+  StartType *start = start_;
+  for (StartType j = 0; j < numberElements; j++)
+    start[majorIndex[j] + 1]++;
+  for (IndexType i = 0; i < major; i++)
+    start[i + 1] += start[i];
+  index_ = new IndexType[numberElements];
+  element_ = new double[numberElements];
+  for (IndexType i = major; i > 0; i--)
+    start[i] = start[i - 1];
+  for (StartType j = 0; j < numberElements; j++) {
+    StartType put = start[majorIndex[j] + 1]++;
+    index_[put] = minorIndex[j];
+    element_[put] = elements[j];
+  }
+}
+// Builds from a CoinPackedMatrix
+template < typename StartType, typename IndexType >
+void CoinWidePackedMatrix< StartType, IndexType >::fromPackedMatrix(const CoinPackedMatrix &matrix)
+{
+  int major = matrix.getMajorDim();
+  int minor = matrix.getMinorDim();
+  if (!fitsIn< StartType >(matrix.getNumElements()) || !fitsIn< IndexType >(major)
+    || !fitsIn< IndexType >(minor))
+    throw CoinError("matrix too big", "fromPackedMatrix", "CoinWidePackedMatrix");
+  gutsOfDestructor(matrix.isColOrdered(), static_cast< IndexType >(minor),
+    static_cast< IndexType >(major));
+  const CoinBigIndex *start = matrix.getVectorStarts();
+  const int *length = matrix.getVectorLengths();
+  const int *index = matrix.getIndices();
+  const double *element = matrix.getElements();
+  index_ = new IndexType[matrix.getNumElements()];
+  element_ = new double[matrix.getNumElements()];
+  StartType put = 0;
+  for (int i = 0; i < major; i++) {
+    for (CoinBigIndex j = start[i]; j < start[i] + length[i]; j++) {
+      index_[put] = static_cast< IndexType >(index[j]);
+      element_[put++] = element[j];
+    }
+    start_[i + 1] = put;
+  }
+}
+// Whether sizes fit in a CoinPackedMatrix
+template < typename StartType, typename IndexType >
+bool CoinWidePackedMatrix< StartType, IndexType >::fitsPackedMatrix() const
+{
+  return fitsIn< CoinBigIndex >(getNumElements()) && fitsIn< int >(majorDim_)
+    && fitsIn< int >(minorDim_);
+}
+// Puts into a CoinPackedMatrix
+template < typename StartType, typename IndexType >
+void CoinWidePackedMatrix< StartType, IndexType >::toPackedMatrix(CoinPackedMatrix &matrix) const
+{
+  if (!fitsPackedMatrix())
+    throw CoinError("matrix too big", "toPackedMatrix", "CoinWidePackedMatrix");
+  int major = static_cast< int >(majorDim_);
+  CoinBigIndex size = static_cast< CoinBigIndex >(getNumElements());
+  CoinBigIndex *start = new CoinBigIndex[major + 1];
+  int *index = new int[size];
+  double *element = copyOfArray(element_, size);
+  for (int i = 0; i <= major; i++)
+    start[i] = static_cast< CoinBigIndex >(start_[i]);
+  for (CoinBigIndex j = 0; j < size; j++)
+    index[j] = static_cast< int >(index_[j]);
+  int *length = NULL;
+  matrix.assignMatrix(colOrdered_, static_cast< int >(minorDim_), major, size,
+    element, index, start, length);
+}
+// Builds from elements of a CoinModel
+template < typename StartType, typename IndexType >
+void CoinWidePackedMatrix< StartType, IndexType >::fromModel(CoinModel &model)
+{
+  if (model.packedMatrix()) {
+    fromPackedMatrix(*model.packedMatrix());
+  } else {
+    CoinPackedMatrix matrix;
+    if (model.createPackedMatrix(matrix, model.associatedArray()))
+      throw CoinError("string elements", "fromModel", "CoinWidePackedMatrix");
+    fromPackedMatrix(matrix);
+  }
+}
+// Passes into a CoinModel
+template < typename StartType, typename IndexType >
+void CoinWidePackedMatrix< StartType, IndexType >::toModel(CoinModel &model) const
+{
+  CoinPackedMatrix matrix;
+  toPackedMatrix(matrix);
+  model.passInMatrix(matrix);
+}
+// Builds from matrix of a CoinMpsIO
+template < typename StartType, typename IndexType >
+void CoinWidePackedMatrix< StartType, IndexType >::fromMpsIO(const CoinMpsIO &reader)
+{
+  const CoinPackedMatrix *matrix = reader.getMatrixByCol();
+  if (matrix)
+    fromPackedMatrix(*matrix);
+  else
+    gutsOfDestructor(true, 0, 0);
+}
+// Makes a copy of rhs with the other ordering
+template < typename StartType, typename IndexType >
+void CoinWidePackedMatrix< StartType, IndexType >::reverseOrderedCopyOf(const CoinWidePackedMatrix &rhs)
+{
+  if (this == &rhs) {
+    CoinWidePackedMatrix copy(rhs);
+    reverseOrderedCopyOf(copy);
+    return;
+  }
+  gutsOfDestructor(!rhs.colOrdered_, rhs.majorDim_, rhs.minorDim_);
+  StartType size = rhs.getNumElements();
+  StartType *start = start_;
+  for (StartType j = 0; j < size; j++)
+    start[rhs.index_[j] + 1]++;
+  for (IndexType i = 0; i < majorDim_; i++)
+    start[i + 1] += start[i];
+  index_ = new IndexType[size];
+  element_ = new double[size];
+  for (IndexType i = majorDim_; i > 0; i--)
+    start[i] = start[i - 1];
+  for (IndexType i = 0; i < rhs.majorDim_; i++) {
+    for (StartType j = rhs.start_[i]; j < rhs.start_[i + 1]; j++) {
+      StartType put = start[rhs.index_[j] + 1]++;
+      index_[put] = i;
+      element_[put] = rhs.element_[j];
+    }
+  }
+}
+// As CoinPackedMatrix::timesMajor
+template < typename StartType, typename IndexType >
+void CoinWidePackedMatrix< StartType, IndexType >::timesMajor(const double *x, double *y) const
+{
+  zeroN(y, minorDim_);
+  for (IndexType i = majorDim_ - 1; i >= 0; --i) {
+    const double x_i = x[i];
+    if (x_i != 0.0) {
+      const StartType last = start_[i + 1];
+      for (StartType j = start_[i]; j < last; ++j)
+        y[index_[j]] += x_i * element_[j];
+    }
+  }
+}
+// As CoinPackedMatrix::timesMinor
+template < typename StartType, typename IndexType >
+void CoinWidePackedMatrix< StartType, IndexType >::timesMinor(const double *x, double *y) const
+{
+  for (IndexType i = majorDim_ - 1; i >= 0; --i) {
+    double y_i = 0;
+    const StartType last = start_[i + 1];
+    for (StartType j = start_[i]; j < last; ++j)
+      y_i += x[index_[j]] * element_[j];
+    y[i] = y_i;
+  }
+}
+// Return A * x in y
+template < typename StartType, typename IndexType >
+void CoinWidePackedMatrix< StartType, IndexType >::times(const double *x, double *y) const
+{
+  if (colOrdered_)
+    timesMajor(x, y);
+  else
+    timesMinor(x, y);
+}
+// Return x * A in y
+template < typename StartType, typename IndexType >
+void CoinWidePackedMatrix< StartType, IndexType >::transposeTimes(const double *x, double *y) const
+{
+  if (colOrdered_)
+    timesMinor(x, y);
+  else
+    timesMajor(x, y);
+}
+
+//#############################################################################
+
+template class COINUTILSLIB_EXPORT CoinWidePackedMatrix< int, int >;
+template class COINUTILSLIB_EXPORT CoinWidePackedMatrix< CoinInt64, int >;
+template class COINUTILSLIB_EXPORT CoinWidePackedMatrix< CoinInt64, CoinInt64 >;
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,190 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifndef CoinWidePackedMatrix_H
+#define CoinWidePackedMatrix_H
+
+#include "CoinUtilsConfig.h"
+#include "CoinTypes.h"
+
+class CoinPackedMatrix;
+class CoinModel;
+class CoinMpsIO;
+
+/** Packed matrix with the width of starts and indices chosen per matrix.
+
+    CoinPackedMatrix has CoinBigIndex starts (fixed when CoinUtils is
+    configured) and int indices.  Building everything with 64 bit
+    CoinBigIndex makes every model pay for models with more than 2^31
+    elements.  This template lets just the large models have wide
+    starts (StartType) and, for more than 2^31 rows or columns, wide
+    indices (IndexType).  It is instantiated for
+
+    - CoinWidePackedMatrix32 - int starts and indices
+    - CoinWidePackedMatrix64 - 64 bit starts and int indices
+    - CoinWidePackedMatrix64x64 - 64 bit starts and indices
+
+    Methods have the names and meanings of those of CoinPackedMatrix
+    but there are far fewer of them - the matrix is built in one go
+    (from triples, a CoinPackedMatrix, a CoinModel or a CoinMpsIO),
+    major vectors have no gaps and it can be multiplied and copied with
+    the other ordering.  Sizes are checked when building and converting
+    and CoinError is thrown if anything does not fit.  The readers and
+    CoinModel use CoinBigIndex themselves so models go to and from them
+    through a CoinPackedMatrix, which must fit.
+*/
+template < typename StartType, typename IndexType >
+class CoinWidePackedMatrix {
+
+public:
+  /**@name Constructors, destructor and copying */
+  //@{
+  /// Default constructor (empty column ordered matrix)
+  CoinWidePackedMatrix();
+  /** Constructor from arrays - starts has major+1 entries (first
+      must be 0) */
+  CoinWidePackedMatrix(bool colOrdered, IndexType minor, IndexType major,
+    const StartType *starts, const IndexType *indices, const double *elements);
+  /// Constructor from a CoinPackedMatrix
+  explicit CoinWidePackedMatrix(const CoinPackedMatrix &matrix);
+  /// Copy constructor
+  CoinWidePackedMatrix(const CoinWidePackedMatrix &rhs);
+  /// = copy
+  CoinWidePackedMatrix &operator=(const CoinWidePackedMatrix &rhs);
+  /// Destructor
+  ~CoinWidePackedMatrix();
+  //@}
+
+  /**@name Building and converting */
+  //@{
+  /** Builds from triples.  Entries of each major vector are in the order
+      they are given (duplicates are kept).  Throws CoinError if an
+      index is out of range */
+  void fromTriples(bool colOrdered, IndexType numberRows,
+    IndexType numberColumns, StartType numberElements,
+    const IndexType *rowIndices, const IndexType *colIndices,
+    const double *elements);
+  /// Builds from a CoinPackedMatrix (gaps are removed)
+  void fromPackedMatrix(const CoinPackedMatrix &matrix);
+  /// Whether sizes fit in a CoinPackedMatrix
+  bool fitsPackedMatrix() const;
+  /// Puts into a CoinPackedMatrix.  Throws CoinError if too big
+  void toPackedMatrix(CoinPackedMatrix &matrix) const;
+  /** Builds from elements of a CoinModel (column ordered).  String
+      elements are not allowed (CoinError is thrown) */
+  void fromModel(CoinModel &model);
+  /** Passes into a CoinModel (as CoinModel::passInMatrix).  Throws
+      CoinError if too big */
+  void toModel(CoinModel &model) const;
+  /// Builds from matrix of a CoinMpsIO (column ordered)
+  void fromMpsIO(const CoinMpsIO &reader);
+  /// Makes a copy of rhs with the other ordering
+  void reverseOrderedCopyOf(const CoinWidePackedMatrix &rhs);
+  //@}
+
+  /**@name Gets */
+  //@{
+  /// Whether column ordered
+  inline bool isColOrdered() const
+  {
+    return colOrdered_;
+  }
+  /// Number of elements
+  inline StartType getNumElements() const
+  {
+    return start_[majorDim_];
+  }
+  /// Number of columns
+  inline IndexType getNumCols() const
+  {
+    return colOrdered_ ? majorDim_ : minorDim_;
+  }
+  /// Number of rows
+  inline IndexType getNumRows() const
+  {
+    return colOrdered_ ? minorDim_ : majorDim_;
+  }
+  /// Number of major vectors
+  inline IndexType getMajorDim() const
+  {
+    return majorDim_;
+  }
+  /// Number of minor vectors
+  inline IndexType getMinorDim() const
+  {
+    return minorDim_;
+  }
+  /// Starts of major vectors (getMajorDim()+1 entries)
+  inline const StartType *getVectorStarts() const
+  {
+    return start_;
+  }
+  /// Length of a major vector
+  inline StartType getVectorSize(IndexType i) const
+  {
+    return start_[i + 1] - start_[i];
+  }
+  /// Minor indices
+  inline const IndexType *getIndices() const
+  {
+    return index_;
+  }
+  /// Elements
+  inline const double *getElements() const
+  {
+    return element_;
+  }
+  //@}
+
+  /**@name Matrix times vector */
+  //@{
+  /** Return <code>A * x</code> in <code>y</code> (as
+      CoinPackedMatrix::times) */
+  void times(const double *x, double *y) const;
+  /** Return <code>x * A</code> in <code>y</code> (as
+      CoinPackedMatrix::transposeTimes) */
+  void transposeTimes(const double *x, double *y) const;
+  //@}
+
+private:
+  /**@name Private methods */
+  //@{
+  /// Frees arrays and makes empty matrix with given dimensions
+  void gutsOfDestructor(bool colOrdered, IndexType minor, IndexType major);
+  /// Copies arrays
+  void gutsOfCopy(bool colOrdered, IndexType minor, IndexType major,
+    const StartType *starts, const IndexType *indices, const double *elements);
+  /// As CoinPackedMatrix::timesMajor
+  void timesMajor(const double *x, double *y) const;
+  /// As CoinPackedMatrix::timesMinor
+  void timesMinor(const double *x, double *y) const;
+  //@}
+
+  /**@name Data */
+  //@{
+  /// Whether column ordered
+  bool colOrdered_;
+  /// Number of major vectors
+  IndexType majorDim_;
+  /// Number of minor vectors
+  IndexType minorDim_;
+  /// Starts of major vectors
+  StartType *start_;
+  /// Minor indices
+  IndexType *index_;
+  /// Elements
+  double *element_;
+  //@}
+};
+
+/// Both int
+typedef CoinWidePackedMatrix< int, int > CoinWidePackedMatrix32;
+/// 64 bit starts
+typedef CoinWidePackedMatrix< CoinInt64, int > CoinWidePackedMatrix64;
+/// 64 bit starts and indices
+typedef CoinWidePackedMatrix< CoinInt64, CoinInt64 > CoinWidePackedMatrix64x64;
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,1057 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+// Timings for dense part of CoinFactorization
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CoinUtilsConfig.h"
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinSort.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinIndexedVector.hpp"
+#include "CoinMpsIO.hpp"
+#include "CoinFactorization.hpp"
+#include "CoinFactorizationView.hpp"
+#include "CoinFactorizationEngine.hpp"
+#include "CoinFactorizationStatistics.hpp"
+#include "CoinOslFactorization.hpp"
+#include "CoinSimpFactorization.hpp"
+#include "CoinDenseLU.hpp"
+#include "CoinSimdKernels.hpp"
+#include "CoinThreadPool.hpp"
+#include "CoinTime.hpp"
+
+//----------------------------------------------------------------
+// factorizationBench [-threads=N] [-repeat=N] [-stages=N] [-rows=N]
+//                    [-updates=N] [-batch=N]
+//                    [-statistics=file.csv|file.json] [file.mps ...]
+//
+// For each model a basis is found and factorized (a) with the dense
+// code switched off and (b) with the normal dense threshold (71 if
+// built without LAPACK as the dense part is then off by default).  Then a
+// dense matrix the size of the dense part is factorized with the
+// simple unblocked LU that was used before and with CoinDenseLUFactor
+// (with and without threads).  If no files are given a staircase model
+// (-stages blocks of -rows rows) is generated and written and read
+// back using CoinMpsIO.
+//
+// The sparse part is then timed choosing pivots one at a time and in
+// batches of up to -batch pivots (see CoinFactorization::setPivotBatch)
+// with one thread and with -threads threads.  Speedup is reported and
+// factors must be the same for both numbers of threads.
+//
+// To compare against LAPACK build CoinUtils once as normal and once
+// with -DCOIN_FACTORIZATION_DENSE_CODE=4 in CXXFLAGS and compare (b).
+//
+// Finally the factorization is shared by one CoinFactorizationView per
+// thread.  Each does -updates updates and checks ftran and btran
+// residuals.  Time to make views is compared with time to copy.
+//
+// Factors of CoinFactorization, CoinOslFactorization and
+// CoinSimpFactorization are saved and restored and ftran/btran results
+// compared with the originals.  A corrupted file must be rejected.
+//
+// Ftran and btran of CoinSimpFactorization are timed with each level of
+// CoinSimdKernels the processor supports.  Relative differences from
+// scalar results are printed (the unit test checks ftran without
+// updates is exact).
+//
+// Each factorization engine is run with and without a
+// CoinFactorizationStatistics attached and the statistics are printed
+// (and written to -statistics file if given - one JSON object per line
+// for .json).
+//----------------------------------------------------------------
+
+namespace {
+// Writes staircase model
+void makeStaircase(const char *fileName, int numberStages, int rowsPerStage)
+{
+  int numberRows = numberStages * rowsPerStage;
+  int numberColumns = numberRows;
+  CoinPackedMatrix matrix(true, 0, 0);
+  matrix.setDimensions(numberRows, 0);
+  std::vector< int > rows;
+  std::vector< double > elements;
+  unsigned int seed = 12345;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    int iStage = iColumn / rowsPerStage;
+    rows.clear();
+    elements.clear();
+    // fairly dense in own stage
+    for (int i = 0; i < rowsPerStage; i++) {
+      seed = 1664525 * seed + 1013904223;
+      if ((seed >> 8) % 100 < 30 || i == iColumn % rowsPerStage) {
+        rows.push_back(iStage * rowsPerStage + i);
+        elements.push_back(1.0 + static_cast< double >((seed >> 12) % 1000) / 100.0);
+      }
+    }
+    // links to next stage
+    if (iStage + 1 < numberStages) {
+      for (int i = 0; i < 3; i++) {
+        seed = 1664525 * seed + 1013904223;
+        rows.push_back((iStage + 1) * rowsPerStage + static_cast< int >((seed >> 8) % rowsPerStage));
+        elements.push_back(-1.0);
+      }
+    }
+    CoinSort_2(&rows[0], &rows[0] + rows.size(), &elements[0]);
+    // remove duplicates
+    int n = 0;
+    for (size_t i = 0; i < rows.size(); i++) {
+      if (n && rows[n - 1] == rows[i]) {
+        elements[n - 1] += elements[i];
+      } else {
+        rows[n] = rows[i];
+        elements[n++] = elements[i];
+      }
+    }
+    matrix.appendCol(n, &rows[0], &elements[0]);
+  }
+  std::vector< double > columnLower(numberColumns, 0.0);
+  std::vector< double > columnUpper(numberColumns, 1.0e30);
+  std::vector< double > objective(numberColumns, 1.0);
+  std::vector< double > rowLower(numberRows, 1.0);
+  std::vector< double > rowUpper(numberRows, 1.0e30);
+  CoinMpsIO m;
+  m.setMpsData(matrix, 1.0e30, &columnLower[0], &columnUpper[0],
+    &objective[0], NULL, &rowLower[0], &rowUpper[0],
+    static_cast< char ** >(NULL), static_cast< char ** >(NULL));
+  m.writeMps(fileName);
+}
+
+/* Gets a non singular basis - as many structurals as possible.
+   Returns number of structurals */
+int getBasis(const CoinPackedMatrix &matrix, std::vector< int > &rowIsBasic,
+  std::vector< int > &columnIsBasic)
+{
+  int numberRows = matrix.getNumRows();
+  int numberColumns = matrix.getNumCols();
+  rowIsBasic.assign(numberRows, -1);
+  columnIsBasic.assign(numberColumns, -1);
+  int numberBasic = 0;
+  for (int i = 0; i < numberColumns && numberBasic < numberRows; i++) {
+    columnIsBasic[i] = 1;
+    numberBasic++;
+  }
+  for (int i = numberBasic; i < numberRows; i++)
+    rowIsBasic[i] = 1;
+  for (int iPass = 0; iPass < 10; iPass++) {
+    CoinFactorization factorization;
+    std::vector< int > rowCopy = rowIsBasic;
+    std::vector< int > columnCopy = columnIsBasic;
+    int status = factorization.factorize(matrix, &rowCopy[0], &columnCopy[0]);
+    if (status != -1)
+      break;
+    // put in slacks for rows not covered
+    std::vector< char > covered(numberRows, 0);
+    for (int i = 0; i < numberRows; i++) {
+      if (rowCopy[i] >= 0)
+        covered[rowCopy[i]] = 1;
+    }
+    for (int i = 0; i < numberColumns; i++) {
+      if (columnIsBasic[i] >= 0) {
+        if (columnCopy[i] >= 0)
+          covered[columnCopy[i]] = 1;
+        else
+          columnIsBasic[i] = -1;
+      }
+    }
+    for (int i = 0; i < numberRows; i++) {
+      if (rowIsBasic[i] < 0 && !covered[i])
+        rowIsBasic[i] = 1;
+    }
+  }
+  int numberStructurals = 0;
+  for (int i = 0; i < numberColumns; i++) {
+    if (columnIsBasic[i] >= 0)
+      numberStructurals++;
+  }
+  return numberStructurals;
+}
+
+// Times factorizations and ftran/btran - returns number in dense part
+int timeFactorization(const CoinPackedMatrix &matrix,
+  const std::vector< int > &rowIsBasic, const std::vector< int > &columnIsBasic,
+  bool dense, int numberThreads, int numberRepeats)
+{
+  int numberRows = matrix.getNumRows();
+  CoinFactorization factorization;
+  factorization.setNumberThreads(numberThreads);
+  if (!dense)
+    factorization.setDenseThreshold(0);
+  else if (!factorization.denseThreshold())
+    factorization.setDenseThreshold(71); // no LAPACK - switch on built in
+  int threshold = factorization.denseThreshold();
+  double time1 = CoinWallclockTime();
+  int status = 0;
+  for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++) {
+    std::vector< int > rowCopy = rowIsBasic;
+    std::vector< int > columnCopy = columnIsBasic;
+    factorization.setDenseThreshold(threshold);
+    status = factorization.factorize(matrix, &rowCopy[0], &columnCopy[0]);
+  }
+  double time2 = CoinWallclockTime();
+  if (status) {
+    printf("  %-8s factorize status %d\n", dense ? "dense" : "sparse", status);
+    return 0;
+  }
+  // ftran then btran random right hand sides
+  CoinIndexedVector work(numberRows);
+  CoinIndexedVector region(numberRows);
+  unsigned int seed = 54321;
+  int numberSolves = CoinMax(10, 100000 / CoinMax(numberRows, 1));
+  for (int i = 0; i < numberSolves; i++) {
+    region.clear();
+    for (int j = 0; j < 5; j++) {
+      seed = 1664525 * seed + 1013904223;
+      region.add(static_cast< int >((seed >> 8) % numberRows), 1.0);
+    }
+    factorization.updateColumn(&work, &region);
+    region.clear();
+    region.insert(static_cast< int >((seed >> 4) % numberRows), 1.0);
+    factorization.updateColumnTranspose(&work, &region);
+  }
+  double time3 = CoinWallclockTime();
+  printf("  %-8s dense %5d L+U %9d factor %8.4f solves(%d) %8.4f\n",
+    dense ? "dense" : "sparse", factorization.numberDense(),
+    factorization.numberElementsL() + factorization.numberElementsU(),
+    (time2 - time1) / numberRepeats, 2 * numberSolves, time3 - time2);
+  return factorization.numberDense();
+}
+
+typedef struct {
+  const CoinFactorization *factorization;
+  const CoinPackedMatrix *matrix;
+  // column in each position (-1-row if slack)
+  const int *positionColumn;
+  int numberUpdates;
+  // per task results
+  double *residual;
+  int *numberDone;
+} SharedInfo;
+
+// Adds multiple of column (in position) of basis to dense region
+void addBasisColumn(const SharedInfo *info, int iColumn, double multiplier,
+  double *region)
+{
+  if (iColumn < 0) {
+    region[-1 - iColumn] += multiplier * info->factorization->slackValue();
+  } else {
+    const CoinPackedMatrix *matrix = info->matrix;
+    const int *row = matrix->getIndices();
+    const double *element = matrix->getElements();
+    CoinBigIndex start = matrix->getVectorStarts()[iColumn];
+    CoinBigIndex end = start + matrix->getVectorLengths()[iColumn];
+    for (CoinBigIndex j = start; j < end; j++)
+      region[row[j]] += multiplier * element[j];
+  }
+}
+
+// Does updates in own view and checks residuals
+void sharedTask(void *infoPointer, int which)
+{
+  SharedInfo *info = reinterpret_cast< SharedInfo * >(infoPointer);
+  const CoinPackedMatrix *matrix = info->matrix;
+  int numberRows = matrix->getNumRows();
+  int numberColumns = matrix->getNumCols();
+  CoinFactorizationView view(*info->factorization);
+  std::vector< int > position(info->positionColumn,
+    info->positionColumn + numberRows);
+  // updates use rows after numberRows
+  int size = numberRows + view.maximumPivots() + 1;
+  CoinIndexedVector work(size);
+  CoinIndexedVector region(size);
+  CoinIndexedVector btran(size);
+  std::vector< double > dense(numberRows);
+  unsigned int seed = 1000 + which;
+  int numberDone = 0;
+  for (int k = 0; k < info->numberUpdates; k++) {
+    seed = 1664525 * seed + 1013904223;
+    int iColumn = static_cast< int >((seed >> 8) % numberColumns);
+    CoinZeroN(&dense[0], numberRows);
+    addBasisColumn(info, iColumn, 1.0, &dense[0]);
+    region.clear();
+    for (int i = 0; i < numberRows; i++) {
+      if (dense[i])
+        region.insert(i, dense[i]);
+    }
+    view.updateColumnFT(&work, &region);
+    int pivotRow = -1;
+    double largest = 0.0;
+    for (int i = 0; i < region.getNumElements(); i++) {
+      int iRow = region.getIndices()[i];
+      if (fabs(region[iRow]) > largest) {
+        largest = fabs(region[iRow]);
+        pivotRow = iRow;
+      }
+    }
+    if (pivotRow < 0)
+      continue;
+    // pivot from other side
+    btran.clear();
+    btran.insert(pivotRow, 1.0);
+    view.updateColumnTranspose(&work, &btran);
+    double pivotCheck = 0.0;
+    for (int i = 0; i < numberRows; i++)
+      pivotCheck += btran[i] * dense[i];
+    if (view.replaceColumn(&work, pivotRow, pivotCheck) >= 2)
+      break;
+    position[pivotRow] = iColumn;
+    numberDone++;
+  }
+  // B*x - b
+  region.clear();
+  for (int j = 0; j < 5; j++) {
+    seed = 1664525 * seed + 1013904223;
+    region.add(static_cast< int >((seed >> 8) % numberRows), 1.0);
+  }
+  CoinZeroN(&dense[0], numberRows);
+  for (int i = 0; i < region.getNumElements(); i++) {
+    int iRow = region.getIndices()[i];
+    dense[iRow] = -region[iRow];
+  }
+  view.updateColumn(&work, &region);
+  for (int i = 0; i < region.getNumElements(); i++) {
+    int iRow = region.getIndices()[i];
+    addBasisColumn(info, position[iRow], region[iRow], &dense[0]);
+  }
+  double residual = 0.0;
+  for (int i = 0; i < numberRows; i++)
+    residual = CoinMax(residual, fabs(dense[i]));
+  // y'*B - c
+  btran.clear();
+  btran.insert(static_cast< int >((seed >> 4) % numberRows), 1.0);
+  std::vector< double > c(numberRows);
+  c[btran.getIndices()[0]] = 1.0;
+  view.updateColumnTranspose(&work, &btran);
+  for (int i = 0; i < numberRows; i++) {
+    CoinZeroN(&dense[0], numberRows);
+    addBasisColumn(info, position[i], 1.0, &dense[0]);
+    double value = -c[i];
+    for (int j = 0; j < numberRows; j++)
+      value += dense[j] * btran[j];
+    residual = CoinMax(residual, fabs(value));
+  }
+  info->residual[which] = residual;
+  info->numberDone[which] = numberDone;
+}
+
+// Shares factorization among threads each with own updates
+void timeShared(const CoinPackedMatrix &matrix,
+  const std::vector< int > &rowIsBasic, const std::vector< int > &columnIsBasic,
+  int numberThreads, int numberUpdates)
+{
+  int numberRows = matrix.getNumRows();
+  int numberColumns = matrix.getNumCols();
+  CoinFactorization factorization;
+  std::vector< int > rowCopy = rowIsBasic;
+  std::vector< int > columnCopy = columnIsBasic;
+  if (factorization.factorize(matrix, &rowCopy[0], &columnCopy[0]))
+    return;
+  factorization.sparseThreshold(1);
+  std::vector< int > positionColumn(numberRows, -1);
+  for (int i = 0; i < numberRows; i++) {
+    if (rowCopy[i] >= 0)
+      positionColumn[rowCopy[i]] = -1 - i;
+  }
+  for (int i = 0; i < numberColumns; i++) {
+    if (columnCopy[i] >= 0)
+      positionColumn[columnCopy[i]] = i;
+  }
+  numberThreads = CoinMax(numberThreads, 1);
+  // cost of copies against views
+  int numberCopies = 10;
+  double time1 = CoinWallclockTime();
+  for (int i = 0; i < numberCopies; i++) {
+    CoinFactorization copy(factorization);
+  }
+  double time2 = CoinWallclockTime();
+  for (int i = 0; i < numberCopies; i++) {
+    CoinFactorizationView view(factorization);
+  }
+  double time3 = CoinWallclockTime();
+  std::vector< double > residual(numberThreads);
+  std::vector< int > numberDone(numberThreads);
+  SharedInfo info;
+  info.factorization = &factorization;
+  info.matrix = &matrix;
+  info.positionColumn = &positionColumn[0];
+  info.numberUpdates = numberUpdates;
+  info.residual = &residual[0];
+  info.numberDone = &numberDone[0];
+  CoinThreadPool pool(numberThreads);
+  pool.run(numberThreads, sharedTask, &info);
+  double time4 = CoinWallclockTime();
+  printf("  shared   copy %8.5f view %8.5f threads %d run %8.4f\n",
+    (time2 - time1) / numberCopies, (time3 - time2) / numberCopies,
+    pool.numberThreads(), time4 - time3);
+  for (int i = 0; i < numberThreads; i++)
+    printf("    view %d updates %d residual %g\n", i, numberDone[i], residual[i]);
+}
+
+/* Factorizes with batches of pivots and solves B x = b.
+   Returns time for factorize (negative if failed).  Solution is
+   returned by basic variable (row i is numberColumns+i) so it can be
+   compared whatever the pivot order */
+double factorBatch(const CoinPackedMatrix &matrix,
+  const std::vector< int > &rowIsBasic, const std::vector< int > &columnIsBasic,
+  int pivotBatch, int numberThreads, int numberRepeats,
+  std::vector< double > &solution, int &numberElements, double &residual)
+{
+  int numberRows = matrix.getNumRows();
+  int numberColumns = matrix.getNumCols();
+  CoinFactorization factorization;
+  factorization.setNumberThreads(numberThreads);
+  factorization.setPivotBatch(pivotBatch);
+  int threshold = factorization.denseThreshold();
+  std::vector< int > rowCopy;
+  std::vector< int > columnCopy;
+  double time1 = CoinWallclockTime();
+  for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++) {
+    rowCopy = rowIsBasic;
+    columnCopy = columnIsBasic;
+    factorization.setDenseThreshold(threshold);
+    if (factorization.factorize(matrix, &rowCopy[0], &columnCopy[0]))
+      return -1.0;
+  }
+  double time2 = CoinWallclockTime();
+  numberElements = factorization.numberElementsL() + factorization.numberElementsU();
+  CoinIndexedVector work(numberRows);
+  CoinIndexedVector region(numberRows);
+  for (int i = 0; i < numberRows; i++)
+    region.insert(i, 1.0 + (i % 7));
+  factorization.updateColumn(&work, &region);
+  const double *x = region.denseVector();
+  solution.assign(numberColumns + numberRows, 0.0);
+  std::vector< double > product(numberRows, 0.0);
+  const int *row = matrix.getIndices();
+  const double *element = matrix.getElements();
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    if (columnCopy[iColumn] >= 0) {
+      double value = x[columnCopy[iColumn]];
+      solution[iColumn] = value;
+      CoinBigIndex start = matrix.getVectorStarts()[iColumn];
+      CoinBigIndex end = start + matrix.getVectorLengths()[iColumn];
+      for (CoinBigIndex j = start; j < end; j++)
+        product[row[j]] += value * element[j];
+    }
+  }
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    if (rowCopy[iRow] >= 0) {
+      double value = x[rowCopy[iRow]];
+      solution[numberColumns + iRow] = value;
+      product[iRow] += value * factorization.slackValue();
+    }
+  }
+  residual = 0.0;
+  for (int i = 0; i < numberRows; i++)
+    residual = CoinMax(residual, fabs(product[i] - (1.0 + (i % 7))));
+  return (time2 - time1) / numberRepeats;
+}
+
+/* Times sparse factorization one pivot at a time and with batches of
+   pivots (one thread and numberThreads).  Batches should give the same
+   factors for any number of threads */
+void timeBatch(const CoinPackedMatrix &matrix,
+  const std::vector< int > &rowIsBasic, const std::vector< int > &columnIsBasic,
+  int pivotBatch, int numberThreads, int numberRepeats)
+{
+  std::vector< double > solution0;
+  std::vector< double > solution1;
+  std::vector< double > solution2;
+  int numberElements0;
+  int numberElements1;
+  int numberElements2;
+  double residual0;
+  double residual1;
+  double residual2;
+  double time0 = factorBatch(matrix, rowIsBasic, columnIsBasic, 0, 1,
+    numberRepeats, solution0, numberElements0, residual0);
+  double time1 = factorBatch(matrix, rowIsBasic, columnIsBasic, pivotBatch, 1,
+    numberRepeats, solution1, numberElements1, residual1);
+  double time2 = factorBatch(matrix, rowIsBasic, columnIsBasic, pivotBatch,
+    numberThreads, numberRepeats, solution2, numberElements2, residual2);
+  if (time0 < 0.0 || time1 < 0.0 || time2 < 0.0) {
+    printf("  batch    factorize failed\n");
+    return;
+  }
+  printf("  batch %4d threads %2d L+U %9d factor %8.4f residual %g\n",
+    0, 1, numberElements0, time0, residual0);
+  printf("  batch %4d threads %2d L+U %9d factor %8.4f residual %g\n",
+    pivotBatch, 1, numberElements1, time1, residual1);
+  bool same = numberElements1 == numberElements2 && solution1 == solution2;
+  printf("  batch %4d threads %2d L+U %9d factor %8.4f residual %g - speedup %.2f (%.2f against one at a time) %s\n",
+    pivotBatch, numberThreads, numberElements2, time2, residual2,
+    time1 / CoinMax(time2, 1.0e-9), time0 / CoinMax(time2, 1.0e-9),
+    same ? "same factors" : "FACTORS DIFFER");
+}
+
+// Factorizes CoinOtherFactorization (as CoinOslFactorization::factorize)
+int otherFactorize(CoinOtherFactorization &factorization,
+  const CoinPackedMatrix &matrix,
+  const std::vector< int > &rowIsBasic, const std::vector< int > &columnIsBasic)
+{
+  int numberRows = matrix.getNumRows();
+  int numberColumns = matrix.getNumCols();
+  const int *row = matrix.getIndices();
+  const CoinBigIndex *columnStart = matrix.getVectorStarts();
+  const int *columnLength = matrix.getVectorLengths();
+  const double *element = matrix.getElements();
+  std::vector< int > pivotTemp;
+  CoinBigIndex numberElements = 0;
+  for (int i = 0; i < numberRows; i++) {
+    if (rowIsBasic[i] >= 0)
+      pivotTemp.push_back(i + numberColumns);
+  }
+  int numberRowBasic = static_cast< int >(pivotTemp.size());
+  for (int i = 0; i < numberColumns; i++) {
+    if (columnIsBasic[i] >= 0) {
+      pivotTemp.push_back(i);
+      numberElements += columnLength[i];
+    }
+  }
+  if (static_cast< int >(pivotTemp.size()) != numberRows)
+    return -2;
+  numberElements = 3 * numberRows + 3 * numberElements + 20000;
+  factorization.setUsefulInformation(&numberRows, 0);
+  factorization.getAreas(numberRows, numberRows, numberElements,
+    2 * numberElements);
+  double *elementU = factorization.elements();
+  int *indexRowU = factorization.indices();
+  int *startColumnU = factorization.starts();
+  int *numberInRow = factorization.numberInRow();
+  int *numberInColumn = factorization.numberInColumn();
+  CoinZeroN(numberInRow, numberRows);
+  CoinZeroN(numberInColumn, numberRows);
+  for (int i = 0; i < numberRowBasic; i++) {
+    int iRow = pivotTemp[i] - numberColumns;
+    indexRowU[i] = iRow;
+    startColumnU[i] = i;
+    elementU[i] = -1.0;
+    numberInRow[iRow] = 1;
+    numberInColumn[i] = 1;
+  }
+  startColumnU[numberRowBasic] = numberRowBasic;
+  numberElements = numberRowBasic;
+  for (int i = numberRowBasic; i < numberRows; i++) {
+    int iColumn = pivotTemp[i];
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      int iRow = row[j];
+      numberInRow[iRow]++;
+      indexRowU[numberElements] = iRow;
+      elementU[numberElements++] = element[j];
+    }
+    numberInColumn[i] = columnLength[iColumn];
+    startColumnU[i + 1] = numberElements;
+  }
+  factorization.preProcess();
+  factorization.factor();
+  if (factorization.status() == 0) {
+    std::vector< int > pivotVariable(numberRows);
+    factorization.postProcess(&pivotTemp[0], &pivotVariable[0]);
+  }
+  return factorization.status();
+}
+
+// Largest difference in ftran and btran results of two factorizations
+template < class T >
+double compareSolves(const T &factorization1, const T &factorization2,
+  int numberRows, int maximumPivots = 0)
+{
+  // room for updates and one extra as CoinOslFactorization looks past end
+  int size = numberRows + maximumPivots + 1;
+  CoinIndexedVector work(size);
+  CoinIndexedVector region1(size);
+  CoinIndexedVector region2(size);
+  unsigned int seed = 24680;
+  double largest = 0.0;
+  for (int i = 0; i < 20; i++) {
+    region1.clear();
+    for (int j = 0; j < 5; j++) {
+      seed = 1664525 * seed + 1013904223;
+      region1.add(static_cast< int >((seed >> 8) % numberRows), 1.0);
+    }
+    region2 = region1;
+    if (i & 1) {
+      factorization1.updateColumnTranspose(&work, &region1);
+      factorization2.updateColumnTranspose(&work, &region2);
+    } else {
+      factorization1.updateColumn(&work, &region1);
+      factorization2.updateColumn(&work, &region2);
+    }
+    for (int j = 0; j < numberRows; j++)
+      largest = CoinMax(largest, fabs(region1[j] - region2[j]));
+  }
+  return largest;
+}
+
+// Changes one byte near end of file
+void corruptFile(const char *fileName)
+{
+  FILE *fp = fopen(fileName, "r+b");
+  if (!fp)
+    return;
+  fseek(fp, -100, SEEK_END);
+  int c = fgetc(fp);
+  fseek(fp, -100, SEEK_END);
+  fputc(c ^ 0x10, fp);
+  fclose(fp);
+}
+
+// Saves and restores factors and checks restored ones
+template < class T >
+void checkSaved(const char *name, const T &factorization, int numberRows,
+  double timeFactorize)
+{
+  const char *fileName = "factors.bin";
+  double time1 = CoinWallclockTime();
+  int returnCode = factorization.saveFactors(fileName);
+  double time2 = CoinWallclockTime();
+  T restored;
+  int returnCode2 = restored.restoreFactors(fileName);
+  double time3 = CoinWallclockTime();
+  if (returnCode || returnCode2) {
+    printf("  %-8s save %d restore %d\n", name, returnCode, returnCode2);
+    return;
+  }
+  double difference = compareSolves(factorization, restored, numberRows);
+  corruptFile(fileName);
+  T corrupt;
+  int returnCode3 = corrupt.restoreFactors(fileName);
+  remove(fileName);
+  printf("  %-8s factor %8.4f save %8.4f restore %8.4f difference %g corrupt %d\n",
+    name, timeFactorize, time2 - time1, time3 - time2, difference, returnCode3);
+}
+
+// Times saving and restoring factors
+void timeSaved(const CoinPackedMatrix &matrix,
+  const std::vector< int > &rowIsBasic, const std::vector< int > &columnIsBasic)
+{
+  int numberRows = matrix.getNumRows();
+  std::vector< int > rowCopy = rowIsBasic;
+  std::vector< int > columnCopy = columnIsBasic;
+  {
+    CoinFactorization factorization;
+    double time1 = CoinWallclockTime();
+    if (!factorization.factorize(matrix, &rowCopy[0], &columnCopy[0])) {
+      factorization.sparseThreshold(1);
+      checkSaved("coin", factorization, numberRows,
+        CoinWallclockTime() - time1);
+    }
+  }
+  {
+    rowCopy = rowIsBasic;
+    columnCopy = columnIsBasic;
+    CoinOslFactorization factorization;
+    double time1 = CoinWallclockTime();
+    if (!factorization.factorize(matrix, &rowCopy[0], &columnCopy[0]))
+      checkSaved("osl", factorization, numberRows,
+        CoinWallclockTime() - time1);
+  }
+  {
+    CoinSimpFactorization factorization;
+    double time1 = CoinWallclockTime();
+    if (!otherFactorize(factorization, matrix, rowIsBasic, columnIsBasic))
+      checkSaved("simp", factorization, numberRows,
+        CoinWallclockTime() - time1);
+  }
+}
+
+/* Replaces up to numberUpdates columns chosen at random (slacks allowed
+   as all columns may be basic).  isBasic has slacks after columns.
+   Returns number done */
+int randomUpdates(CoinFactorizationEngine *engine,
+  const CoinPackedMatrix &matrix, std::vector< char > &isBasic,
+  int numberUpdates, unsigned int &seed, CoinIndexedVector &work,
+  CoinIndexedVector &region)
+{
+  int numberColumns = matrix.getNumCols();
+  const int *row = matrix.getIndices();
+  const CoinBigIndex *columnStart = matrix.getVectorStarts();
+  const int *columnLength = matrix.getVectorLengths();
+  const double *element = matrix.getElements();
+  int numberTotal = static_cast< int >(isBasic.size());
+  int numberDone = 0;
+  for (int iTry = 0; iTry < 10 * numberUpdates && numberDone < numberUpdates;
+       iTry++) {
+    seed = 1664525 * seed + 1013904223;
+    int iColumn = static_cast< int >((seed >> 8) % numberTotal);
+    if (isBasic[iColumn])
+      continue;
+    region.clear();
+    if (iColumn >= numberColumns) {
+      region.insert(iColumn - numberColumns, -1.0);
+    } else {
+      for (CoinBigIndex k = columnStart[iColumn];
+           k < columnStart[iColumn] + columnLength[iColumn]; k++)
+        region.insert(row[k], element[k]);
+    }
+    engine->updateColumnFT(&work, &region);
+    int iPivot = -1;
+    double largest = 1.0e-2;
+    for (int i = 0; i < region.getNumElements(); i++) {
+      int iRow = region.getIndices()[i];
+      if (fabs(region.denseVector()[iRow]) > largest) {
+        largest = fabs(region.denseVector()[iRow]);
+        iPivot = iRow;
+      }
+    }
+    if (iPivot < 0)
+      continue;
+    if (engine->replaceColumn(&work, &region, iPivot,
+          region.denseVector()[iPivot])
+      > 1)
+      break;
+    isBasic[iColumn] = 1;
+    numberDone++;
+  }
+  region.clear();
+  return numberDone;
+}
+
+/* Times ftran and btran of CoinSimpFactorization (after some updates so
+   there is an eta file) with each level of CoinSimdKernels and compares
+   results with scalar ones */
+void timeSimd(const CoinPackedMatrix &matrix,
+  const std::vector< int > &rowIsBasic, const std::vector< int > &columnIsBasic,
+  int numberUpdates, int numberRepeats)
+{
+  CoinFactorizationEngine *engine = CoinFactorizationEngine::create("simp");
+  if (!engine)
+    return;
+  int numberRows = matrix.getNumRows();
+  int numberColumns = matrix.getNumCols();
+  std::vector< int > rowCopy = rowIsBasic;
+  std::vector< int > columnCopy = columnIsBasic;
+  engine->maximumPivots(numberUpdates + 10);
+  int saveLevel = CoinSimdLevelInUse();
+  CoinSimdSetLevel(CoinSimdScalar);
+  if (engine->factorize(matrix, &rowCopy[0], &columnCopy[0])) {
+    delete engine;
+    CoinSimdSetLevel(saveLevel);
+    return;
+  }
+  int size = numberRows + numberUpdates + 11;
+  CoinIndexedVector work(size);
+  CoinIndexedVector region(size);
+  // slacks after columns
+  int numberTotal = numberColumns + numberRows;
+  std::vector< char > isBasic(numberTotal);
+  for (int i = 0; i < numberColumns; i++)
+    isBasic[i] = columnCopy[i] >= 0 ? 1 : 0;
+  for (int i = 0; i < numberRows; i++)
+    isBasic[numberColumns + i] = rowCopy[i] >= 0 ? 1 : 0;
+  unsigned int seed = 13579;
+  int numberDone = randomUpdates(engine, matrix, isBasic, numberUpdates, seed,
+    work, region);
+  // right hand sides
+  int numberSolves = 40;
+  std::vector< CoinIndexedVector > rhs(numberSolves, CoinIndexedVector(size));
+  for (int i = 0; i < numberSolves; i++) {
+    for (int j = 0; j < 1 + numberRows / 20; j++) {
+      seed = 1664525 * seed + 1013904223;
+      int iRow = static_cast< int >((seed >> 8) % numberRows);
+      if (!rhs[i].denseVector()[iRow])
+        rhs[i].insert(iRow, 1.0 + j);
+    }
+  }
+  std::vector< std::vector< double > > scalar(numberSolves);
+  int numberLevels = CoinSimdLevelAvailable() + 1;
+  const char *levelName[] = { "scalar", "avx2", "avx512" };
+  for (int level = 0; level < numberLevels; level++) {
+    CoinSimdSetLevel(level);
+    double time1 = CoinWallclockTime();
+    double differenceF = 0.0;
+    double differenceB = 0.0;
+    for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++) {
+      for (int i = 0; i < numberSolves; i++) {
+        region = rhs[i];
+        if (i & 1)
+          engine->updateColumnTranspose(&work, &region);
+        else
+          engine->updateColumn(&work, &region);
+        const double *value = region.denseVector();
+        if (!level) {
+          scalar[i].assign(value, value + numberRows);
+        } else {
+          double &difference = (i & 1) ? differenceB : differenceF;
+          for (int j = 0; j < numberRows; j++)
+            difference = CoinMax(difference, fabs(value[j] - scalar[i][j])
+                / CoinMax(1.0, fabs(scalar[i][j])));
+        }
+      }
+    }
+    double time2 = CoinWallclockTime();
+    printf("  simp %-6s updates %3d solves %4d time %8.4f",
+      levelName[level], numberDone, numberSolves * numberRepeats,
+      time2 - time1);
+    if (level)
+      printf(" ftran difference %g btran difference %g", differenceF,
+        differenceB);
+    printf("\n");
+  }
+  CoinSimdSetLevel(saveLevel);
+  delete engine;
+}
+
+// Attaches statistics to factorization used by engine
+void attachStatistics(CoinFactorizationEngine *engine,
+  CoinFactorizationStatistics *statistics)
+{
+  CoinFactorizationEngineCoin *coin = dynamic_cast< CoinFactorizationEngineCoin * >(engine);
+  CoinFactorizationEngineOther *other = dynamic_cast< CoinFactorizationEngineOther * >(engine);
+  if (coin)
+    coin->factorization().setStatistics(statistics);
+  else if (other)
+    other->factorization()->setStatistics(statistics);
+}
+
+/* Factorizes numberRepeats times, each time doing updates and some
+   ftrans and btrans.  Returns time or -1.0 if factorization failed */
+double statisticsWorkload(CoinFactorizationEngine *engine,
+  const CoinPackedMatrix &matrix, const std::vector< int > &rowIsBasic,
+  const std::vector< int > &columnIsBasic, int numberUpdates,
+  int numberRepeats)
+{
+  int numberRows = matrix.getNumRows();
+  int numberColumns = matrix.getNumCols();
+  int size = numberRows + numberUpdates + 11;
+  CoinIndexedVector work(size);
+  CoinIndexedVector region(size);
+  engine->maximumPivots(numberUpdates + 10);
+  unsigned int seed = 24680;
+  double time1 = CoinWallclockTime();
+  for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++) {
+    std::vector< int > rowCopy = rowIsBasic;
+    std::vector< int > columnCopy = columnIsBasic;
+    if (engine->factorize(matrix, &rowCopy[0], &columnCopy[0]))
+      return -1.0;
+    std::vector< char > isBasic(numberColumns + numberRows);
+    for (int i = 0; i < numberColumns; i++)
+      isBasic[i] = columnCopy[i] >= 0 ? 1 : 0;
+    for (int i = 0; i < numberRows; i++)
+      isBasic[numberColumns + i] = rowCopy[i] >= 0 ? 1 : 0;
+    randomUpdates(engine, matrix, isBasic, numberUpdates, seed, work, region);
+    for (int i = 0; i < 20; i++) {
+      region.clear();
+      for (int j = 0; j < 1 + numberRows / 50; j++) {
+        seed = 1664525 * seed + 1013904223;
+        int iRow = static_cast< int >((seed >> 8) % numberRows);
+        if (!region.denseVector()[iRow])
+          region.insert(iRow, 1.0 + j);
+      }
+      if (i & 1)
+        engine->updateColumnTranspose(&work, &region);
+      else
+        engine->updateColumn(&work, &region);
+    }
+    region.clear();
+  }
+  return CoinWallclockTime() - time1;
+}
+
+/* Collects CoinFactorizationStatistics for each engine and prints them
+   as CSV (and JSON for CoinFactorization).  Also compares time with and
+   without statistics attached */
+void timeStatistics(const CoinPackedMatrix &matrix,
+  const std::vector< int > &rowIsBasic, const std::vector< int > &columnIsBasic,
+  int numberUpdates, int numberRepeats, const char *statisticsFile)
+{
+  int numberEngines = CoinFactorizationEngine::numberEngines();
+  CoinFactorizationStatistics total("total");
+  bool header = true;
+  for (int iEngine = 0; iEngine < numberEngines; iEngine++) {
+    const char *name = CoinFactorizationEngine::engineName(iEngine);
+    // dense engine is too slow on large models
+    if (!strcmp(name, "dense") && matrix.getNumRows() > 1000)
+      continue;
+    CoinFactorizationEngine *engine = CoinFactorizationEngine::create(name);
+    double timeWithout = statisticsWorkload(engine, matrix, rowIsBasic,
+      columnIsBasic, numberUpdates, numberRepeats);
+    CoinFactorizationStatistics statistics(name);
+    attachStatistics(engine, &statistics);
+    double timeWith = statisticsWorkload(engine, matrix, rowIsBasic,
+      columnIsBasic, numberUpdates, numberRepeats);
+    attachStatistics(engine, NULL);
+    delete engine;
+    if (timeWithout < 0.0 || timeWith < 0.0) {
+      printf("  %-6s factorization failed\n", name);
+      continue;
+    }
+    printf("  %-6s time %8.4f without statistics %8.4f with\n", name,
+      timeWithout, timeWith);
+    statistics.printCsv(stdout, header);
+    if (!strcmp(name, "coin"))
+      statistics.printJson(stdout);
+    if (statisticsFile)
+      statistics.writeFile(statisticsFile, !header);
+    header = false;
+    total.add(statistics);
+  }
+  total.printCsv(stdout, false);
+}
+
+// Simple unblocked LU (as in CoinDenseFactorization without LAPACK)
+int simpleLU(int n, double *a, int *ipiv)
+{
+  for (int i = 0; i < n; i++) {
+    double *column = a + i * n;
+    int iRow = -1;
+    double largest = 0.0;
+    for (int j = i; j < n; j++) {
+      if (fabs(column[j]) > largest) {
+        largest = fabs(column[j]);
+        iRow = j;
+      }
+    }
+    if (iRow < 0)
+      return i + 1;
+    ipiv[i] = iRow + 1;
+    if (iRow != i) {
+      double *columnA = a;
+      for (int k = 0; k < n; k++) {
+        double value = columnA[i];
+        columnA[i] = columnA[iRow];
+        columnA[iRow] = value;
+        columnA += n;
+      }
+    }
+    double pivotValue = 1.0 / column[i];
+    for (int j = i + 1; j < n; j++)
+      column[j] *= pivotValue;
+    double *columnA = column;
+    for (int k = i + 1; k < n; k++) {
+      columnA += n;
+      double value = columnA[i];
+      for (int j = i + 1; j < n; j++)
+        columnA[j] -= value * column[j];
+    }
+  }
+  return 0;
+}
+
+// Times dense kernels on an n by n matrix
+void timeDense(int n, int numberThreads)
+{
+  if (n < 2)
+    return;
+  std::vector< double > original(static_cast< size_t >(n) * n);
+  unsigned int seed = 98765;
+  for (size_t i = 0; i < original.size(); i++) {
+    seed = 1664525 * seed + 1013904223;
+    original[i] = static_cast< double >(seed >> 8) / 16777216.0 - 0.5;
+  }
+  std::vector< double > rhs(n);
+  for (int i = 0; i < n; i++)
+    rhs[i] = 1.0 + i % 7;
+  std::vector< double > a;
+  std::vector< int > ipiv(n);
+  const char *names[3] = { "simple", "blocked", "threads" };
+  for (int iType = 0; iType < 3; iType++) {
+    CoinThreadPool *pool = NULL;
+    if (iType == 2) {
+      if (numberThreads <= 1 || !CoinThreadPool::threadsAvailable())
+        break;
+      pool = new CoinThreadPool(numberThreads);
+    }
+    a = original;
+    double time1 = CoinWallclockTime();
+    int info;
+    if (!iType)
+      info = simpleLU(n, &a[0], &ipiv[0]);
+    else
+      info = CoinDenseLUFactor(n, &a[0], n, &ipiv[0], pool);
+    double time2 = CoinWallclockTime();
+    delete pool;
+    // check residual
+    std::vector< double > x = rhs;
+    CoinDenseLUSolve(false, n, &a[0], n, &ipiv[0], &x[0]);
+    double largest = 0.0;
+    for (int i = 0; i < n; i++) {
+      double value = -rhs[i];
+      for (int j = 0; j < n; j++)
+        value += original[i + static_cast< size_t >(j) * n] * x[j];
+      largest = CoinMax(largest, fabs(value));
+    }
+    printf("  %-8s n %5d info %d time %8.4f residual %g\n", names[iType],
+      n, info, time2 - time1, largest);
+  }
+}
+}
+
+int main(int argc, const char *argv[])
+{
+  int numberThreads = CoinThreadPool::defaultNumberThreads();
+  int numberRepeats = 3;
+  int numberStages = 20;
+  int rowsPerStage = 100;
+  int numberUpdates = 20;
+  int pivotBatch = 64;
+  const char *statisticsFile = NULL;
+  std::vector< std::string > files;
+  for (int i = 1; i < argc; i++) {
+    if (!strncmp(argv[i], "-threads=", 9))
+      numberThreads = atoi(argv[i] + 9);
+    else if (!strncmp(argv[i], "-repeat=", 8))
+      numberRepeats = CoinMax(1, atoi(argv[i] + 8));
+    else if (!strncmp(argv[i], "-stages=", 8))
+      numberStages = CoinMax(1, atoi(argv[i] + 8));
+    else if (!strncmp(argv[i], "-rows=", 6))
+      rowsPerStage = CoinMax(1, atoi(argv[i] + 6));
+    else if (!strncmp(argv[i], "-updates=", 9))
+      numberUpdates = CoinMax(0, atoi(argv[i] + 9));
+    else if (!strncmp(argv[i], "-batch=", 7))
+      pivotBatch = CoinMax(2, atoi(argv[i] + 7));
+    else if (!strncmp(argv[i], "-statistics=", 12))
+      statisticsFile = argv[i] + 12;
+    else
+      files.push_back(argv[i]);
+  }
+  if (files.empty()) {
+    makeStaircase("staircase.mps", numberStages, rowsPerStage);
+    files.push_back("staircase.mps");
+  }
+  printf("threads %d (%s)\n", numberThreads,
+    CoinThreadPool::threadsAvailable() ? "available" : "not available");
+  for (size_t iFile = 0; iFile < files.size(); iFile++) {
+    CoinMpsIO m;
+    m.messageHandler()->setLogLevel(0);
+    if (m.readMps(files[iFile].c_str(), "") < 0) {
+      printf("%s - unable to read\n", files[iFile].c_str());
+      continue;
+    }
+    const CoinPackedMatrix *matrix = m.getMatrixByCol();
+    std::vector< int > rowIsBasic;
+    std::vector< int > columnIsBasic;
+    int numberStructurals = getBasis(*matrix, rowIsBasic, columnIsBasic);
+    printf("%s - %d rows, %d columns, %d structurals in basis\n",
+      files[iFile].c_str(), m.getNumRows(), m.getNumCols(), numberStructurals);
+    timeFactorization(*matrix, rowIsBasic, columnIsBasic, false,
+      numberThreads, numberRepeats);
+    int numberDense = timeFactorization(*matrix, rowIsBasic, columnIsBasic, true,
+      numberThreads, numberRepeats);
+    timeDense(numberDense, numberThreads);
+    timeBatch(*matrix, rowIsBasic, columnIsBasic, pivotBatch, numberThreads,
+      numberRepeats);
+    timeShared(*matrix, rowIsBasic, columnIsBasic, numberThreads,
+      numberUpdates);
+    timeSaved(*matrix, rowIsBasic, columnIsBasic);
+    timeSimd(*matrix, rowIsBasic, columnIsBasic, numberUpdates, numberRepeats);
+    timeStatistics(*matrix, rowIsBasic, columnIsBasic, numberUpdates,
+      numberRepeats, statisticsFile);
+  }
+  return 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
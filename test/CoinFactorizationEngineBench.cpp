@@ -0,0 +1,507 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+// Compares factorization engines on the same basis sequence
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CoinUtilsConfig.h"
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinIndexedVector.hpp"
+#include "CoinMpsIO.hpp"
+#include "CoinFactorizationEngine.hpp"
+#include "CoinTime.hpp"
+
+//----------------------------------------------------------------
+// factorizationEngineBench [-engines=a,b,..] [-updates=N] [-maxpivots=N]
+//                          [-rows=N] [-maxdense=N] [file.mps ...]
+//
+// For each model a starting basis is found and a sequence of -updates
+// basis changes is made using the "coin" engine (entering column
+// chosen at random, leaving variable where the updated column is
+// largest).  Then every engine (or those in -engines) factorizes the
+// starting basis and replays the same sequence using updateColumnFT
+// and replaceColumn, refactorizing when it must or after -maxpivots
+// updates.  Time to factorize, time for the updates, time for solves
+// on the final basis, fill (elements in factors compared to elements
+// in basis) and largest ftran and btran residuals are reported.
+//
+// The dense engine is skipped for models with more than -maxdense rows.
+// If no files are given a random model with -rows rows is written and
+// read back using CoinMpsIO.
+//----------------------------------------------------------------
+
+namespace {
+unsigned int randomSeed = 13579;
+// Random integer in 0..n-1
+int randomInteger(int n)
+{
+  randomSeed = 1664525 * randomSeed + 1013904223;
+  return static_cast< int >((randomSeed >> 8) % static_cast< unsigned int >(n));
+}
+
+// Writes random model (each column has diagonal and a few others)
+void makeRandom(const char *fileName, int numberRows)
+{
+  int numberColumns = 2 * numberRows;
+  std::vector< int > rows;
+  std::vector< int > columns;
+  std::vector< double > elements;
+  for (int i = 0; i < numberColumns; i++) {
+    int iDiagonal = i % numberRows;
+    rows.push_back(iDiagonal);
+    columns.push_back(i);
+    elements.push_back(4.0 + randomInteger(4));
+    int n = 1 + randomInteger(4);
+    for (int k = 0; k < n; k++) {
+      int iRow = randomInteger(numberRows);
+      if (iRow == iDiagonal)
+        continue;
+      rows.push_back(iRow);
+      columns.push_back(i);
+      elements.push_back(randomInteger(2) ? 1.0 : -1.0 - randomInteger(3));
+    }
+  }
+  CoinPackedMatrix matrix(true, &rows[0], &columns[0], &elements[0],
+    static_cast< CoinBigIndex >(elements.size()));
+  std::vector< double > columnLower(numberColumns, 0.0);
+  std::vector< double > columnUpper(numberColumns, 1.0e30);
+  std::vector< double > objective(numberColumns, 1.0);
+  std::vector< double > rowLower(numberRows, 1.0);
+  std::vector< double > rowUpper(numberRows, 1.0e30);
+  CoinMpsIO m;
+  m.setMpsData(matrix, 1.0e30, &columnLower[0], &columnUpper[0],
+    &objective[0], NULL, &rowLower[0], &rowUpper[0],
+    static_cast< char ** >(NULL), static_cast< char ** >(NULL));
+  m.writeMps(fileName);
+}
+
+/* Gets a non singular basis - as many structurals as possible.
+   Arrays are 1 if basic, -1 if not */
+void getBasis(const CoinPackedMatrix &matrix, std::vector< int > &rowIsBasic,
+  std::vector< int > &columnIsBasic)
+{
+  int numberRows = matrix.getNumRows();
+  int numberColumns = matrix.getNumCols();
+  rowIsBasic.assign(numberRows, -1);
+  columnIsBasic.assign(numberColumns, -1);
+  int numberBasic = 0;
+  for (int i = 0; i < numberColumns && numberBasic < numberRows; i++) {
+    columnIsBasic[i] = 1;
+    numberBasic++;
+  }
+  for (int i = numberBasic; i < numberRows; i++)
+    rowIsBasic[i] = 1;
+  for (int iPass = 0; iPass < 10; iPass++) {
+    CoinFactorization factorization;
+    std::vector< int > rowCopy = rowIsBasic;
+    std::vector< int > columnCopy = columnIsBasic;
+    if (factorization.factorize(matrix, &rowCopy[0], &columnCopy[0]) != -1)
+      break;
+    // put in slacks for rows not covered
+    std::vector< char > covered(numberRows, 0);
+    for (int i = 0; i < numberRows; i++) {
+      if (rowCopy[i] >= 0)
+        covered[rowCopy[i]] = 1;
+    }
+    for (int i = 0; i < numberColumns; i++) {
+      if (columnIsBasic[i] >= 0) {
+        if (columnCopy[i] >= 0)
+          covered[columnCopy[i]] = 1;
+        else
+          columnIsBasic[i] = -1;
+      }
+    }
+    for (int i = 0; i < numberRows; i++) {
+      if (rowIsBasic[i] < 0 && !covered[i])
+        rowIsBasic[i] = 1;
+    }
+  }
+}
+
+// Basis and where each basic variable is
+class Basis {
+public:
+  Basis(const CoinPackedMatrix &matrix, const std::vector< int > &rowIsBasic,
+    const std::vector< int > &columnIsBasic)
+    : matrix_(&matrix)
+    , rowIsBasic_(rowIsBasic)
+    , columnIsBasic_(columnIsBasic)
+    , positionVariable_(matrix.getNumRows(), 0)
+  {
+  }
+  // Factorizes and sets positions - returns status
+  int factorize(CoinFactorizationEngine &engine)
+  {
+    std::vector< int > rowCopy = rowIsBasic_;
+    std::vector< int > columnCopy = columnIsBasic_;
+    int status = engine.factorize(*matrix_, &rowCopy[0], &columnCopy[0]);
+    if (!status) {
+      for (size_t i = 0; i < rowCopy.size(); i++) {
+        if (rowCopy[i] >= 0)
+          positionVariable_[rowCopy[i]] = -1 - static_cast< int >(i);
+      }
+      for (size_t i = 0; i < columnCopy.size(); i++) {
+        if (columnCopy[i] >= 0)
+          positionVariable_[columnCopy[i]] = static_cast< int >(i);
+      }
+    }
+    return status;
+  }
+  // Position of basic variable
+  int position(int variable) const
+  {
+    for (size_t i = 0; i < positionVariable_.size(); i++) {
+      if (positionVariable_[i] == variable)
+        return static_cast< int >(i);
+    }
+    return -1;
+  }
+  // Variable in position
+  int variable(int position) const
+  {
+    return positionVariable_[position];
+  }
+  bool isBasic(int variable) const
+  {
+    return variable >= 0 ? columnIsBasic_[variable] >= 0
+                         : rowIsBasic_[-1 - variable] >= 0;
+  }
+  // Makes variable basic in position of leaving
+  void pivot(int entering, int position)
+  {
+    int leaving = positionVariable_[position];
+    if (leaving >= 0)
+      columnIsBasic_[leaving] = -1;
+    else
+      rowIsBasic_[-1 - leaving] = -1;
+    columnIsBasic_[entering] = 1;
+    positionVariable_[position] = entering;
+  }
+  // Puts column of matrix in region
+  void column(int iColumn, CoinIndexedVector &region) const
+  {
+    const int *row = matrix_->getIndices();
+    const CoinBigIndex *columnStart = matrix_->getVectorStarts();
+    const int *columnLength = matrix_->getVectorLengths();
+    const double *element = matrix_->getElements();
+    region.clear();
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++)
+      region.insert(row[j], element[j]);
+  }
+  // Elements in basis
+  CoinBigIndex numberElements() const
+  {
+    const int *columnLength = matrix_->getVectorLengths();
+    CoinBigIndex n = 0;
+    for (size_t i = 0; i < columnIsBasic_.size(); i++) {
+      if (columnIsBasic_[i] >= 0)
+        n += columnLength[i];
+    }
+    for (size_t i = 0; i < rowIsBasic_.size(); i++) {
+      if (rowIsBasic_[i] >= 0)
+        n++;
+    }
+    return n;
+  }
+  /* Largest relative residuals of ftran (B x = b) and btran
+     (B' y = c) for a few random right hand sides */
+  void residuals(const CoinFactorizationEngine &engine,
+    double &ftranResidual, double &btranResidual, double &solveTime) const;
+
+private:
+  const CoinPackedMatrix *matrix_;
+  std::vector< int > rowIsBasic_;
+  std::vector< int > columnIsBasic_;
+  // column in each position (-1-row if slack)
+  std::vector< int > positionVariable_;
+};
+
+void Basis::residuals(const CoinFactorizationEngine &engine,
+  double &ftranResidual, double &btranResidual, double &solveTime) const
+{
+  int numberRows = matrix_->getNumRows();
+  const int *row = matrix_->getIndices();
+  const CoinBigIndex *columnStart = matrix_->getVectorStarts();
+  const int *columnLength = matrix_->getVectorLengths();
+  const double *element = matrix_->getElements();
+  int size = numberRows + engine.maximumPivots() + 1;
+  CoinIndexedVector work(size);
+  CoinIndexedVector region(size);
+  std::vector< double > rhs(numberRows);
+  std::vector< double > check(numberRows);
+  ftranResidual = 0.0;
+  btranResidual = 0.0;
+  solveTime = 0.0;
+  for (int iTry = 0; iTry < 10; iTry++) {
+    CoinZeroN(&rhs[0], numberRows);
+    region.clear();
+    for (int j = 0; j < 5; j++) {
+      int iRow = randomInteger(numberRows);
+      if (!rhs[iRow]) {
+        rhs[iRow] = 1.0 + randomInteger(9);
+        region.insert(iRow, rhs[iRow]);
+      }
+    }
+    double time1 = CoinWallclockTime();
+    engine.updateColumn(&work, &region);
+    solveTime += CoinWallclockTime() - time1;
+    // B x - b
+    const double *x = region.denseVector();
+    CoinZeroN(&check[0], numberRows);
+    for (int i = 0; i < numberRows; i++) {
+      double value = x[i];
+      if (!value)
+        continue;
+      int iColumn = positionVariable_[i];
+      if (iColumn < 0) {
+        check[-1 - iColumn] -= value;
+      } else {
+        for (CoinBigIndex j = columnStart[iColumn];
+             j < columnStart[iColumn] + columnLength[iColumn]; j++)
+          check[row[j]] += value * element[j];
+      }
+    }
+    double largest = 1.0;
+    double residual = 0.0;
+    for (int i = 0; i < numberRows; i++) {
+      largest = CoinMax(largest, fabs(x[i]));
+      residual = CoinMax(residual, fabs(check[i] - rhs[i]));
+    }
+    ftranResidual = CoinMax(ftranResidual, residual / largest);
+    // btran on positions
+    CoinZeroN(&rhs[0], numberRows);
+    region.clear();
+    for (int j = 0; j < 5; j++) {
+      int iPosition = randomInteger(numberRows);
+      if (!rhs[iPosition]) {
+        rhs[iPosition] = 1.0 + randomInteger(9);
+        region.insert(iPosition, rhs[iPosition]);
+      }
+    }
+    time1 = CoinWallclockTime();
+    engine.updateColumnTranspose(&work, &region);
+    solveTime += CoinWallclockTime() - time1;
+    const double *y = region.denseVector();
+    largest = 1.0;
+    residual = 0.0;
+    for (int i = 0; i < numberRows; i++) {
+      largest = CoinMax(largest, fabs(y[i]));
+      int iColumn = positionVariable_[i];
+      double value;
+      if (iColumn < 0) {
+        value = -y[-1 - iColumn];
+      } else {
+        value = 0.0;
+        for (CoinBigIndex j = columnStart[iColumn];
+             j < columnStart[iColumn] + columnLength[iColumn]; j++)
+          value += y[row[j]] * element[j];
+      }
+      residual = CoinMax(residual, fabs(value - rhs[i]));
+    }
+    btranResidual = CoinMax(btranResidual, residual / largest);
+  }
+}
+
+// One basis change
+typedef struct {
+  int entering;
+  int leaving; // column or -1-row
+} Change;
+
+/* Makes sequence of basis changes with "coin" engine starting from
+   rowIsBasic, columnIsBasic */
+void makeSequence(const CoinPackedMatrix &matrix,
+  const std::vector< int > &rowIsBasic, const std::vector< int > &columnIsBasic,
+  int numberUpdates, int maximumPivots, std::vector< Change > &sequence)
+{
+  int numberRows = matrix.getNumRows();
+  int numberColumns = matrix.getNumCols();
+  CoinFactorizationEngine *engine = CoinFactorizationEngine::create("coin");
+  engine->maximumPivots(maximumPivots);
+  Basis basis(matrix, rowIsBasic, columnIsBasic);
+  basis.factorize(*engine);
+  CoinIndexedVector work(numberRows + maximumPivots + 1);
+  CoinIndexedVector region(numberRows + maximumPivots + 1);
+  sequence.clear();
+  int numberTries = 0;
+  while (static_cast< int >(sequence.size()) < numberUpdates
+    && numberTries < 10 * numberUpdates + 100) {
+    numberTries++;
+    int iColumn = randomInteger(numberColumns);
+    if (basis.isBasic(iColumn))
+      continue;
+    basis.column(iColumn, region);
+    engine->updateColumnFT(&work, &region);
+    const double *alpha = region.denseVector();
+    int iPosition = -1;
+    double largest = 1.0e-3;
+    for (int i = 0; i < numberRows; i++) {
+      if (fabs(alpha[i]) > largest) {
+        largest = fabs(alpha[i]);
+        iPosition = i;
+      }
+    }
+    if (iPosition < 0) {
+      // must still be followed by replaceColumn or refactorization
+      region.clear();
+      basis.factorize(*engine);
+      continue;
+    }
+    Change change;
+    change.entering = iColumn;
+    change.leaving = basis.variable(iPosition);
+    sequence.push_back(change);
+    int returnCode = engine->replaceColumn(&work, &region, iPosition,
+      alpha[iPosition]);
+    region.clear();
+    basis.pivot(iColumn, iPosition);
+    if (returnCode >= 2 || engine->pivots() >= maximumPivots)
+      basis.factorize(*engine);
+  }
+  delete engine;
+}
+
+// Replays sequence with engine and prints results
+void timeEngine(const char *name, const CoinPackedMatrix &matrix,
+  const std::vector< int > &rowIsBasic, const std::vector< int > &columnIsBasic,
+  const std::vector< Change > &sequence, int maximumPivots)
+{
+  int numberRows = matrix.getNumRows();
+  CoinFactorizationEngine *engine = CoinFactorizationEngine::create(name);
+  if (!engine) {
+    printf("  %-6s unknown engine\n", name);
+    return;
+  }
+  engine->maximumPivots(maximumPivots);
+  Basis basis(matrix, rowIsBasic, columnIsBasic);
+  double time1 = CoinWallclockTime();
+  int status = basis.factorize(*engine);
+  double time2 = CoinWallclockTime();
+  if (status) {
+    printf("  %-6s factorize status %d\n", name, status);
+    delete engine;
+    return;
+  }
+  double fill = static_cast< double >(engine->numberElements())
+    / static_cast< double >(CoinMax< CoinBigIndex >(basis.numberElements(), 1));
+  CoinIndexedVector work(numberRows + maximumPivots + 1);
+  CoinIndexedVector region(numberRows + maximumPivots + 1);
+  int numberBad = 0;
+  for (size_t k = 0; k < sequence.size(); k++) {
+    int iPosition = basis.position(sequence[k].leaving);
+    basis.column(sequence[k].entering, region);
+    engine->updateColumnFT(&work, &region);
+    int returnCode = engine->replaceColumn(&work, &region, iPosition,
+      region.denseVector()[iPosition]);
+    region.clear();
+    basis.pivot(sequence[k].entering, iPosition);
+    if (returnCode >= 2 || engine->pivots() >= maximumPivots) {
+      if (returnCode >= 2)
+        numberBad++;
+      if (basis.factorize(*engine)) {
+        printf("  %-6s refactorization failed\n", name);
+        delete engine;
+        return;
+      }
+    }
+  }
+  double time3 = CoinWallclockTime();
+  double ftranResidual;
+  double btranResidual;
+  double solveTime;
+  basis.residuals(*engine, ftranResidual, btranResidual, solveTime);
+  printf("  %-6s factor %8.4f updates %8.4f solves %8.4f fill %6.2f"
+         " elements %9d factorizations %4d (%d forced) residuals %.1e %.1e\n",
+    name, time2 - time1, time3 - time2, solveTime, fill,
+    engine->numberElements(), engine->numberFactorizations(), numberBad,
+    ftranResidual, btranResidual);
+  delete engine;
+}
+}
+
+int main(int argc, const char *argv[])
+{
+  int numberUpdates = 200;
+  int maximumPivots = 100;
+  int numberRows = 1000;
+  int maximumDense = 2000;
+  std::vector< std::string > engines;
+  std::vector< std::string > files;
+  for (int i = 1; i < argc; i++) {
+    if (!strncmp(argv[i], "-engines=", 9)) {
+      std::string list = argv[i] + 9;
+      size_t start = 0;
+      while (start <= list.size()) {
+        size_t end = list.find(',', start);
+        if (end == std::string::npos)
+          end = list.size();
+        if (end > start)
+          engines.push_back(list.substr(start, end - start));
+        start = end + 1;
+      }
+    } else if (!strncmp(argv[i], "-updates=", 9)) {
+      numberUpdates = CoinMax(0, atoi(argv[i] + 9));
+    } else if (!strncmp(argv[i], "-maxpivots=", 11)) {
+      maximumPivots = CoinMax(1, atoi(argv[i] + 11));
+    } else if (!strncmp(argv[i], "-rows=", 6)) {
+      numberRows = CoinMax(1, atoi(argv[i] + 6));
+    } else if (!strncmp(argv[i], "-maxdense=", 10)) {
+      maximumDense = CoinMax(0, atoi(argv[i] + 10));
+    } else {
+      files.push_back(argv[i]);
+    }
+  }
+  if (engines.empty()) {
+    for (int i = 0; i < CoinFactorizationEngine::numberEngines(); i++)
+      engines.push_back(CoinFactorizationEngine::engineName(i));
+  }
+  if (files.empty()) {
+    makeRandom("engines.mps", numberRows);
+    files.push_back("engines.mps");
+  }
+  for (size_t iFile = 0; iFile < files.size(); iFile++) {
+    CoinMpsIO m;
+    m.messageHandler()->setLogLevel(0);
+    if (m.readMps(files[iFile].c_str(), "") < 0) {
+      printf("%s - unable to read\n", files[iFile].c_str());
+      continue;
+    }
+    const CoinPackedMatrix *matrix = m.getMatrixByCol();
+    if (!m.getNumRows()) {
+      printf("%s - no rows\n", files[iFile].c_str());
+      continue;
+    }
+    std::vector< int > rowIsBasic;
+    std::vector< int > columnIsBasic;
+    getBasis(*matrix, rowIsBasic, columnIsBasic);
+    std::vector< Change > sequence;
+    makeSequence(*matrix, rowIsBasic, columnIsBasic, numberUpdates,
+      maximumPivots, sequence);
+    printf("%s - %d rows, %d columns, %d basis changes\n",
+      files[iFile].c_str(), m.getNumRows(), m.getNumCols(),
+      static_cast< int >(sequence.size()));
+    for (size_t i = 0; i < engines.size(); i++) {
+      if (engines[i] == "dense" && m.getNumRows() > maximumDense) {
+        printf("  %-6s skipped (more than %d rows)\n", engines[i].c_str(),
+          maximumDense);
+        continue;
+      }
+      timeEngine(engines[i].c_str(), *matrix, rowIsBasic, columnIsBasic,
+        sequence, maximumPivots);
+    }
+  }
+  return 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,592 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinArrayFile.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinIndexedVector.hpp"
+#include "CoinFactorization.hpp"
+#include "CoinFactorizationView.hpp"
+#include "CoinFactorizationEngine.hpp"
+#include "CoinFactorizationStatistics.hpp"
+#ifdef COINUTILS_BIGINDEX_IS_INT
+#include "CoinSimpFactorization.hpp"
+#endif
+#include "CoinSimdKernels.hpp"
+#include "CoinThreadPool.hpp"
+
+namespace {
+
+/* Random sparse square matrix with a large diagonal (so all structurals
+   give a non singular basis) and a denser block at end so there is
+   something for the dense code to do */
+CoinPackedMatrix randomMatrix(int numberRows, unsigned int seed)
+{
+  CoinPackedMatrix matrix(true, 0, 0);
+  matrix.setDimensions(numberRows, 0);
+  std::vector< int > rows;
+  std::vector< double > elements;
+  int denseStart = numberRows - numberRows / 5;
+  for (int iColumn = 0; iColumn < numberRows; iColumn++) {
+    rows.clear();
+    elements.clear();
+    for (int iRow = 0; iRow < numberRows; iRow++) {
+      seed = 1664525 * seed + 1013904223;
+      // about three off diagonal per column outside dense block
+      int perThousand = (iRow >= denseStart && iColumn >= denseStart) ? 600 : 3000 / numberRows;
+      if (iRow == iColumn) {
+        rows.push_back(iRow);
+        elements.push_back(10.0 + static_cast< double >((seed >> 12) % 100) / 10.0);
+      } else if (static_cast< int >((seed >> 8) % 1000) < perThousand) {
+        rows.push_back(iRow);
+        elements.push_back(static_cast< double >((seed >> 12) % 200) / 100.0 - 1.0);
+      }
+    }
+    matrix.appendCol(static_cast< int >(rows.size()), &rows[0], &elements[0]);
+  }
+  return matrix;
+}
+
+/* Factorizes matrix with all structurals basic - returns status.
+   If position given it gets pivot position of each column */
+int factorizeAll(CoinFactorization &factorization, const CoinPackedMatrix &matrix,
+  std::vector< int > *position = NULL)
+{
+  int numberRows = matrix.getNumRows();
+  std::vector< int > rowIsBasic(numberRows, -1);
+  std::vector< int > columnIsBasic(numberRows, 1);
+  int status = factorization.factorize(matrix, &rowIsBasic[0], &columnIsBasic[0]);
+  if (position)
+    *position = columnIsBasic;
+  return status;
+}
+
+/* Solves B x = b (or B'y = c) where b is by row and x by column
+   (c by column and y by row) whatever the pivot positions are */
+void solve(const CoinFactorization &factorization,
+  const std::vector< int > &position, bool transpose,
+  const std::vector< double > &rhs, std::vector< double > &solution)
+{
+  int numberRows = static_cast< int >(rhs.size());
+  CoinIndexedVector work(numberRows);
+  CoinIndexedVector region(numberRows);
+  for (int i = 0; i < numberRows; i++) {
+    if (rhs[i])
+      region.insert(transpose ? position[i] : i, rhs[i]);
+  }
+  solution.assign(numberRows, 0.0);
+  if (transpose) {
+    factorization.updateColumnTranspose(&work, &region);
+    for (int i = 0; i < numberRows; i++)
+      solution[i] = region[i];
+  } else {
+    factorization.updateColumn(&work, &region);
+    for (int i = 0; i < numberRows; i++)
+      solution[i] = region[position[i]];
+  }
+}
+
+// Sets region to a random sparse right hand side
+void randomRegion(CoinIndexedVector &region, int numberRows, int number,
+  unsigned int &seed)
+{
+  region.clear();
+  for (int i = 0; i < number; i++) {
+    seed = 1664525 * seed + 1013904223;
+    int iRow = static_cast< int >((seed >> 8) % numberRows);
+    region.add(iRow, 1.0 + static_cast< double >((seed >> 12) % 10));
+  }
+}
+
+// Largest difference between two unpacked regions
+double maxDifference(const CoinIndexedVector &region1,
+  const CoinIndexedVector &region2, int numberRows)
+{
+  double largest = 0.0;
+  const double *value1 = region1.denseVector();
+  const double *value2 = region2.denseVector();
+  for (int i = 0; i < numberRows; i++)
+    largest = CoinMax(largest, fabs(value1[i] - value2[i]));
+  return largest;
+}
+
+/* updateColumns with threads must give exactly the serial results
+   and count the same solve paths */
+void testUpdateColumns(const CoinPackedMatrix &matrix)
+{
+  int numberRows = matrix.getNumRows();
+  const int numberColumns = 13;
+  for (int iPass = 0; iPass < 2; iPass++) {
+    bool transpose = iPass != 0;
+    CoinFactorization serial;
+    CoinFactorization threaded;
+    threaded.setNumberThreads(4);
+    assert(!factorizeAll(serial, matrix));
+    assert(!factorizeAll(threaded, matrix));
+    CoinFactorizationStatistics serialStatistics;
+    CoinFactorizationStatistics threadedStatistics;
+    threadedStatistics.setTimeSolves(true);
+    serial.setStatistics(&serialStatistics);
+    threaded.setStatistics(&threadedStatistics);
+    // so each thread needs own sparse work area
+    serial.sparseThreshold(numberRows / 6);
+    threaded.sparseThreshold(numberRows / 6);
+    std::vector< CoinIndexedVector > work(2 * numberColumns);
+    std::vector< CoinIndexedVector > regions(2 * numberColumns);
+    std::vector< CoinIndexedVector * > workPointer(2 * numberColumns);
+    std::vector< CoinIndexedVector * > regionPointer(2 * numberColumns);
+    unsigned int seed = 987;
+    for (int i = 0; i < numberColumns; i++) {
+      for (int j = 0; j < 2; j++) {
+        work[2 * i + j].reserve(numberRows);
+        regions[2 * i + j].reserve(numberRows);
+      }
+      // sparse and dense right hand sides
+      randomRegion(regions[2 * i], numberRows, (i & 1) ? numberRows / 2 : 3, seed);
+      regions[2 * i + 1] = regions[2 * i];
+    }
+    for (int i = 0; i < numberColumns; i++) {
+      workPointer[i] = &work[2 * i];
+      regionPointer[i] = &regions[2 * i];
+    }
+    int numberSerial = 0;
+    for (int i = 0; i < numberColumns; i++) {
+      if (transpose)
+        numberSerial += serial.updateColumnTranspose(&work[2 * i + 1], &regions[2 * i + 1]);
+      else
+        numberSerial += serial.updateColumn(&work[2 * i + 1], &regions[2 * i + 1]);
+    }
+    int numberThreaded;
+    if (transpose)
+      numberThreaded = threaded.updateColumnsTranspose(numberColumns,
+        &workPointer[0], &regionPointer[0]);
+    else
+      numberThreaded = threaded.updateColumns(numberColumns,
+        &workPointer[0], &regionPointer[0]);
+    assert(numberThreaded == numberSerial);
+    for (int i = 0; i < numberColumns; i++) {
+      assert(!maxDifference(regions[2 * i], regions[2 * i + 1], numberRows));
+      assert(!work[2 * i].getNumElements());
+    }
+    int firstPart = transpose ? 2 : 0;
+    for (int iPart = 0; iPart < 4; iPart++) {
+      double total = 0.0;
+      for (int mode = 0; mode < 3; mode++) {
+        assert(threadedStatistics.numberSolveMode(iPart, mode) == serialStatistics.numberSolveMode(iPart, mode));
+        total += threadedStatistics.numberSolveMode(iPart, mode);
+      }
+      assert(total == ((iPart == firstPart || iPart == firstPart + 1) ? numberColumns : 0));
+      assert(threadedStatistics.numberReachAbandoned(iPart) == serialStatistics.numberReachAbandoned(iPart));
+      assert(threadedStatistics.totalReach(iPart) == serialStatistics.totalReach(iPart));
+    }
+    assert(threadedStatistics.numberCalls(transpose ? CoinFactorizationStatistics::btranPhase : CoinFactorizationStatistics::ftranPhase) == numberColumns);
+  }
+}
+
+/* Dense part is off by default without LAPACK.  Switching it on must
+   give same solutions as sparse code (to rounding) although pivots in
+   dense part may be different */
+void testDense(const CoinPackedMatrix &matrix)
+{
+  int numberRows = matrix.getNumRows();
+  CoinFactorization sparse;
+  CoinFactorization dense;
+  sparse.setDenseThreshold(0);
+  dense.setDenseThreshold(71);
+  std::vector< int > position1;
+  std::vector< int > position2;
+  assert(!factorizeAll(sparse, matrix, &position1));
+  assert(!factorizeAll(dense, matrix, &position2));
+  assert(!sparse.numberDense());
+  assert(dense.numberDense() > 0);
+  std::vector< double > rhs(numberRows);
+  std::vector< double > solution1;
+  std::vector< double > solution2;
+  unsigned int seed = 55;
+  for (int i = 0; i < 20; i++) {
+    bool transpose = (i & 1) != 0;
+    CoinZeroN(&rhs[0], numberRows);
+    int number = (i & 2) ? numberRows / 3 : 2;
+    for (int j = 0; j < number; j++) {
+      seed = 1664525 * seed + 1013904223;
+      rhs[(seed >> 8) % numberRows] += 1.0;
+    }
+    solve(sparse, position1, transpose, rhs, solution1);
+    solve(dense, position2, transpose, rhs, solution2);
+    for (int j = 0; j < numberRows; j++)
+      assert(fabs(solution1[j] - solution2[j]) < 1.0e-9);
+  }
+}
+
+/* Sparse L and U parts of FTRAN and BTRAN try symbolic reach first.
+   Results must be as with sparse code switched off */
+void testReach(const CoinPackedMatrix &matrix)
+{
+  int numberRows = matrix.getNumRows();
+  CoinFactorization sparse;
+  CoinFactorization dense;
+  assert(!factorizeAll(sparse, matrix));
+  assert(!factorizeAll(dense, matrix));
+  // as Clp does - sets up row copies and sparse work area
+  sparse.sparseThreshold(numberRows / 6);
+  assert(!dense.sparseThreshold());
+  CoinFactorizationStatistics statistics;
+  sparse.setStatistics(&statistics);
+  CoinIndexedVector work(numberRows);
+  CoinIndexedVector region1(numberRows);
+  CoinIndexedVector region2(numberRows);
+  unsigned int seed = 123;
+  for (int i = 0; i < 100; i++) {
+    bool transpose = (i & 1) != 0;
+    randomRegion(region1, numberRows, 1 + (i % 3), seed);
+    region2 = region1;
+    if (transpose) {
+      sparse.updateColumnTranspose(&work, &region1);
+      dense.updateColumnTranspose(&work, &region2);
+    } else {
+      sparse.updateColumn(&work, &region1);
+      dense.updateColumn(&work, &region2);
+    }
+    assert(maxDifference(region1, region2, numberRows) < 1.0e-10);
+  }
+  // each part of ftran and btran must have used reach
+  for (int iPart = 0; iPart < 4; iPart++) {
+    assert(statistics.numberSolveMode(iPart, 2) > 0);
+    assert(statistics.totalReach(iPart) > 0);
+  }
+  // appended JSON is one object per line
+  const char *fileName = "CoinFactorizationTest.json";
+  assert(!statistics.writeFile(fileName));
+  assert(!statistics.writeFile(fileName, true));
+  FILE *fp = fopen(fileName, "r");
+  assert(fp);
+  char line[4096];
+  int numberLines = 0;
+  while (fgets(line, sizeof(line), fp)) {
+    size_t length = strlen(line);
+    assert(length > 2 && line[0] == '{' && !strcmp(line + length - 2, "}\n"));
+    numberLines++;
+  }
+  fclose(fp);
+  assert(numberLines == 2);
+  remove(fileName);
+}
+
+/* Does Forrest-Tomlin updates with random incoming columns and then some
+   solves.  Works on a view or on a copy of factorization */
+template < class Factorization >
+void updateAndSolve(Factorization &factorization, int numberRows,
+  unsigned int seed, std::vector< double > &solutions)
+{
+  // updates use rows after numberRows
+  int size = numberRows + factorization.maximumPivots() + 1;
+  CoinIndexedVector work(size);
+  CoinIndexedVector region(size);
+  for (int k = 0; k < 20; k++) {
+    randomRegion(region, numberRows, 4, seed);
+    factorization.updateColumnFT(&work, &region);
+    int pivotRow = -1;
+    double largest = 0.0;
+    for (int i = 0; i < region.getNumElements(); i++) {
+      int iRow = region.getIndices()[i];
+      if (fabs(region[iRow]) > largest) {
+        largest = fabs(region[iRow]);
+        pivotRow = iRow;
+      }
+    }
+    assert(pivotRow >= 0);
+    assert(factorization.replaceColumn(&work, pivotRow, region[pivotRow]) < 2);
+  }
+  solutions.clear();
+  for (int k = 0; k < 6; k++) {
+    randomRegion(region, numberRows, 1 + k, seed);
+    if ((k & 1) != 0)
+      factorization.updateColumnTranspose(&work, &region);
+    else
+      factorization.updateColumn(&work, &region);
+    solutions.insert(solutions.end(), region.denseVector(),
+      region.denseVector() + numberRows);
+  }
+}
+
+typedef struct {
+  const CoinFactorization *factorization;
+  std::vector< double > *solutions;
+} ViewInfo;
+
+// Each task has own view of shared factorization
+void viewTask(void *infoPointer, int which)
+{
+  ViewInfo *info = reinterpret_cast< ViewInfo * >(infoPointer);
+  CoinFactorizationView view(*info->factorization);
+  assert(!view.ownUpdates());
+  updateAndSolve(view, info->factorization->numberRows(), 77 + which,
+    info->solutions[which]);
+  assert(view.ownUpdates());
+  assert(view.numberPivots() == 20);
+}
+
+/* Views updated at same time in several threads must give the same
+   results as copies updated one at a time and leave factorization alone */
+void testViews(const CoinPackedMatrix &matrix)
+{
+  int numberRows = matrix.getNumRows();
+  const int numberViews = 8;
+  for (int iPass = 0; iPass < 2; iPass++) {
+    CoinFactorization factorization;
+    assert(!factorizeAll(factorization, matrix));
+    // second time with sparse work areas
+    if (iPass)
+      factorization.sparseThreshold(numberRows / 6);
+    int size = numberRows + factorization.maximumPivots() + 1;
+    CoinIndexedVector work(size);
+    CoinIndexedVector before(size);
+    unsigned int seed = 31;
+    randomRegion(before, numberRows, 3, seed);
+    CoinIndexedVector after = before;
+    factorization.updateColumn(&work, &before);
+    std::vector< std::vector< double > > solutions(numberViews);
+    ViewInfo info;
+    info.factorization = &factorization;
+    info.solutions = &solutions[0];
+    CoinThreadPool pool(4);
+    pool.run(numberViews, viewTask, &info);
+    factorization.updateColumn(&work, &after);
+    assert(!maxDifference(before, after, numberRows));
+    assert(!factorization.pivots());
+    std::vector< double > serial;
+    for (int i = 0; i < numberViews; i++) {
+      CoinFactorization copy(factorization);
+      updateAndSolve(copy, numberRows, 77 + i, serial);
+      assert(serial == solutions[i]);
+    }
+    // copy of view has same updates
+    CoinFactorizationView view(factorization);
+    std::vector< double > solutions2;
+    updateAndSolve(view, numberRows, 77, solutions2);
+    CoinFactorizationView view2(view);
+    CoinIndexedVector region1(size);
+    CoinIndexedVector region2(size);
+    randomRegion(region1, numberRows, 2, seed);
+    region2 = region1;
+    view.updateColumn(&work, &region1);
+    view2.updateColumn(&work, &region2);
+    assert(!maxDifference(region1, region2, numberRows));
+    view2.clearUpdates();
+    assert(!view2.ownUpdates() && !view2.numberPivots());
+  }
+}
+
+/* Copies saved factors changing one of the saved integers (so that
+   checksums are still good) */
+void changeSavedInteger(const char *fileName, const char *newName,
+  int which, int value)
+{
+  CoinArrayFileReader reader;
+  assert(!reader.open(fileName));
+  CoinArrayFileWriter writer(reader.kind(), reader.kindVersion());
+  CoinBigIndex n;
+  // integers are first section
+  const int *saved = reader.array< int >(1, n);
+  assert(saved && which < n);
+  std::vector< int > integers(saved, saved + n);
+  integers[which] = value;
+  writer.addArray(1, &integers[0], n);
+  for (int id = 2; id < 100; id++) {
+    for (int size = 4; size <= 8; size += 4) {
+      const void *array = reader.section(id, size, n);
+      if (array)
+        writer.addSection(id, array, size, n);
+    }
+  }
+  assert(!writer.write(newName));
+}
+
+/* Restored factors (with updates) must give the same results as the
+   originals and corrupt files must be rejected */
+void testSaveRestore(const CoinPackedMatrix &matrix)
+{
+  int numberRows = matrix.getNumRows();
+  const char *fileName = "CoinFactorizationTest.bin";
+  const char *fileName2 = "CoinFactorizationTest2.bin";
+  CoinFactorization factorization;
+  assert(!factorizeAll(factorization, matrix));
+  factorization.sparseThreshold(numberRows / 6);
+  std::vector< double > solutions1;
+  std::vector< double > solutions2;
+  updateAndSolve(factorization, numberRows, 5, solutions1);
+  assert(!factorization.saveFactors(fileName));
+  CoinFactorization restored;
+  assert(!restored.restoreFactors(fileName));
+  assert(restored.pivots() == factorization.pivots());
+  // solves and more updates must give same results
+  updateAndSolve(factorization, numberRows, 6, solutions1);
+  updateAndSolve(restored, numberRows, 6, solutions2);
+  // restored has no row copy of R so may differ by rounding
+  assert(solutions1.size() == solutions2.size());
+  for (size_t i = 0; i < solutions1.size(); i++)
+    assert(fabs(solutions1[i] - solutions2[i]) < 1.0e-12);
+  // byte changed - checksum must fail
+  FILE *fp = fopen(fileName, "r+b");
+  assert(fp);
+  fseek(fp, -100, SEEK_END);
+  int c = fgetc(fp);
+  fseek(fp, -100, SEEK_END);
+  fputc(c ^ 0x10, fp);
+  fclose(fp);
+  CoinFactorization corrupt;
+  assert(corrupt.restoreFactors(fileName) == 3);
+  fp = fopen(fileName, "r+b");
+  fseek(fp, -100, SEEK_END);
+  fputc(c, fp);
+  fclose(fp);
+  // more R starts than maximumPivots allows (integer 20)
+  changeSavedInteger(fileName, fileName2, 20, 1);
+  assert(corrupt.restoreFactors(fileName2) == 2);
+  assert(corrupt.status() == -1);
+  // and file itself is still good
+  assert(!corrupt.restoreFactors(fileName));
+  remove(fileName);
+  remove(fileName2);
+}
+
+/* Choosing pivots in batches must give same solutions (to rounding) as
+   one at a time and exactly the same factors for any number of threads */
+void testPivotBatch(const CoinPackedMatrix &matrix)
+{
+  int numberRows = matrix.getNumRows();
+  CoinFactorization serial;
+  CoinFactorization batch;
+  CoinFactorization threaded;
+  batch.setPivotBatch(8);
+  threaded.setPivotBatch(8);
+  threaded.setNumberThreads(4);
+  std::vector< int > position0;
+  std::vector< int > position1;
+  std::vector< int > position2;
+  assert(!factorizeAll(serial, matrix, &position0));
+  assert(!factorizeAll(batch, matrix, &position1));
+  assert(!factorizeAll(threaded, matrix, &position2));
+  assert(position1 == position2);
+  assert(batch.numberElementsL() == threaded.numberElementsL());
+  assert(batch.numberElementsU() == threaded.numberElementsU());
+  std::vector< double > rhs(numberRows);
+  std::vector< double > solution0;
+  std::vector< double > solution1;
+  std::vector< double > solution2;
+  unsigned int seed = 99;
+  for (int i = 0; i < 10; i++) {
+    bool transpose = (i & 1) != 0;
+    CoinZeroN(&rhs[0], numberRows);
+    for (int j = 0; j < 1 + i * 10; j++) {
+      seed = 1664525 * seed + 1013904223;
+      rhs[(seed >> 8) % numberRows] += 1.0;
+    }
+    solve(serial, position0, transpose, rhs, solution0);
+    solve(batch, position1, transpose, rhs, solution1);
+    solve(threaded, position2, transpose, rhs, solution2);
+    assert(solution1 == solution2);
+    for (int j = 0; j < numberRows; j++)
+      assert(fabs(solution0[j] - solution1[j]) < 1.0e-9);
+  }
+}
+
+#ifdef COINUTILS_BIGINDEX_IS_INT
+/* Vector scatter kernels must give exactly what the scalar one gives
+   (no fused multiply add) so ftran of CoinSimpFactorization without
+   updates (which only scatters) is the same at every level.  Btran
+   uses dot products so may differ in the last bits */
+void testSimd(const CoinPackedMatrix &matrix)
+{
+  int numberRows = matrix.getNumRows();
+  int available = CoinSimdLevelAvailable();
+  int saveLevel = CoinSimdLevelInUse();
+  // all lengths up to two blocks of eight and a remainder
+  const int length = 37;
+  std::vector< double > element(length);
+  std::vector< int > index(length);
+  unsigned int seed = 2468;
+  for (int i = 0; i < length; i++) {
+    seed = 1664525 * seed + 1013904223;
+    element[i] = static_cast< double >(seed >> 8) / 1.0e5 - 80.0;
+    index[i] = 3 * length - 2 * i;
+  }
+  std::vector< double > reference(4 * length);
+  std::vector< double > region(4 * length);
+  for (int n = 0; n <= length; n++) {
+    for (int level = CoinSimdScalar; level <= available; level++) {
+      CoinSimdSetLevel(level);
+      for (int i = 0; i < 4 * length; i++)
+        region[i] = 0.1 * i - 3.3;
+      CoinSimdScatterAxpy(n, &element[0], &index[0], 1.0 / 3.0, &region[0]);
+      if (level == CoinSimdScalar)
+        reference = region;
+      else
+        assert(region == reference);
+    }
+  }
+  std::vector< int > rowIsBasic(numberRows, -1);
+  std::vector< int > columnIsBasic(numberRows, 1);
+  // engine sets up CoinSimpFactorization from a matrix
+  CoinFactorizationEngineOther factorization("simp", new CoinSimpFactorization());
+  CoinSimdSetLevel(CoinSimdScalar);
+  assert(!factorization.factorize(matrix, &rowIsBasic[0], &columnIsBasic[0]));
+  CoinIndexedVector work(numberRows + 1);
+  CoinIndexedVector region2(numberRows + 1);
+  const int numberSolves = 10;
+  std::vector< std::vector< double > > scalar(numberSolves);
+  for (int level = CoinSimdScalar; level <= available; level++) {
+    CoinSimdSetLevel(level);
+    seed = 1357;
+    for (int i = 0; i < numberSolves; i++) {
+      bool transpose = (i & 1) != 0;
+      randomRegion(region2, numberRows, 1 + 10 * i, seed);
+      if (transpose)
+        factorization.updateColumnTranspose(&work, &region2);
+      else
+        factorization.updateColumn(&work, &region2);
+      const double *value = region2.denseVector();
+      if (level == CoinSimdScalar) {
+        scalar[i].assign(value, value + numberRows);
+      } else {
+        for (int j = 0; j < numberRows; j++) {
+          if (transpose)
+            assert(fabs(value[j] - scalar[i][j]) < 1.0e-12 * (1.0 + fabs(scalar[i][j])));
+          else
+            assert(value[j] == scalar[i][j]);
+        }
+      }
+    }
+  }
+  CoinSimdSetLevel(saveLevel);
+}
+#endif
+
+} // end file-local namespace
+
+void CoinFactorizationUnitTest()
+{
+  CoinPackedMatrix matrix = randomMatrix(600, 4321);
+  testUpdateColumns(matrix);
+  testDense(matrix);
+  testReach(matrix);
+  testViews(matrix);
+  testSaveRestore(matrix);
+  testPivotBatch(matrix);
+#ifdef COINUTILS_BIGINDEX_IS_INT
+  testSimd(matrix);
+#endif
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
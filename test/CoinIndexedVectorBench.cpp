@@ -0,0 +1,161 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+// Timings for CoinIndexedVector scan, clean, cleanAndPack and update
+// operators with each level of CoinSimdKernels
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "CoinUtilsConfig.h"
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinIndexedVector.hpp"
+#include "CoinSimdKernels.hpp"
+#include "CoinTime.hpp"
+
+//----------------------------------------------------------------
+// indexedVectorBench [-size=N] [-repeat=N]
+//
+// For densities from 0.01% to 100% a region of -size doubles is
+// filled with that fraction of nonzeros (a quarter of them below the
+// tolerance of 1.0e-12).  scan(), scan(tolerance), clean, cleanAndPack,
+// operator+= and operator*= are timed at each SIMD level available
+// (microseconds per call, speedup against scalar).  Every level must
+// give exactly the indices and region of the scalar level.
+//----------------------------------------------------------------
+
+namespace {
+const int numberOperations = 6;
+const char *operationName[numberOperations] = { "scan", "scanTol", "clean",
+  "cleanPack", "+=", "*=" };
+const double tolerance = 1.0e-12;
+
+// Region with density fraction of nonzeros
+void makeRegion(std::vector< double > &region, double density)
+{
+  unsigned int seed = 123456789;
+  for (size_t i = 0; i < region.size(); i++) {
+    seed = 1664525 * seed + 1013904223;
+    double random = static_cast< double >(seed >> 8) / 16777216.0;
+    if (random < density) {
+      double value = 1.0 + static_cast< double >(seed % 1009) / 97.0;
+      if (seed % 4 == 0)
+        value *= 1.0e-14;
+      region[i] = (seed & 16) ? value : -value;
+    } else {
+      region[i] = 0.0;
+    }
+  }
+}
+
+// Does operation on vector set up from region and returns time taken
+double doOperation(int operation, CoinIndexedVector &vector,
+  const std::vector< double > &region)
+{
+  int size = static_cast< int >(region.size());
+  vector.setNumElements(0);
+  CoinMemcpyN(&region[0], size, vector.denseVector());
+  if (operation > 1)
+    vector.scan();
+  double time1 = CoinCpuTime();
+  switch (operation) {
+  case 0:
+    vector.scan();
+    break;
+  case 1:
+    vector.scan(tolerance);
+    break;
+  case 2:
+    vector.clean(tolerance);
+    break;
+  case 3:
+    vector.cleanAndPack(tolerance);
+    break;
+  case 4:
+    vector += 1.0;
+    break;
+  default:
+    vector *= 0.5;
+    break;
+  }
+  return CoinCpuTime() - time1;
+}
+}
+
+int main(int argc, const char *argv[])
+{
+  int size = 1000000;
+  int numberRepeats = 20;
+  for (int i = 1; i < argc; i++) {
+    if (!strncmp(argv[i], "-size=", 6))
+      size = CoinMax(1, atoi(argv[i] + 6));
+    else if (!strncmp(argv[i], "-repeat=", 8))
+      numberRepeats = CoinMax(1, atoi(argv[i] + 8));
+    else
+      printf("unknown argument %s\n", argv[i]);
+  }
+  const double densities[] = { 0.0001, 0.001, 0.01, 0.1, 0.5, 1.0 };
+  const char *levelName[] = { "scalar", "avx2", "avx512" };
+  int available = CoinSimdLevelAvailable();
+  int saveLevel = CoinSimdLevelInUse();
+  printf("region of %d - best level %s\n", size, levelName[available]);
+  printf("density  level  ");
+  for (int k = 0; k < numberOperations; k++)
+    printf("%17s", operationName[k]);
+  printf("\n");
+  std::vector< double > region(size);
+  CoinIndexedVector vector(size);
+  std::vector< std::vector< double > > scalarRegion(numberOperations);
+  std::vector< std::vector< int > > scalarIndices(numberOperations);
+  bool allSame = true;
+  for (size_t iDensity = 0; iDensity < sizeof(densities) / sizeof(double); iDensity++) {
+    makeRegion(region, densities[iDensity]);
+    double scalarTime[numberOperations];
+    for (int level = CoinSimdScalar; level <= available; level++) {
+      CoinSimdSetLevel(level);
+      printf("%6.2f%% %7s ", 100.0 * densities[iDensity], levelName[level]);
+      for (int k = 0; k < numberOperations; k++) {
+        double time = 0.0;
+        for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++)
+          time += doOperation(k, vector, region);
+        time *= 1.0e6 / numberRepeats;
+        const double *dense = vector.denseVector();
+        const int *indices = vector.getIndices();
+        int number = vector.getNumElements();
+        if (level == CoinSimdScalar) {
+          scalarTime[k] = time;
+          scalarRegion[k].assign(dense, dense + size);
+          scalarIndices[k].assign(indices, indices + number);
+          printf("%9.1f        ", time);
+        } else {
+          bool same = number == static_cast< int >(scalarIndices[k].size())
+            && !memcmp(dense, &scalarRegion[k][0], size * sizeof(double))
+            && (!number
+              || !memcmp(indices, &scalarIndices[k][0], number * sizeof(int)));
+          if (!same)
+            allSame = false;
+          printf("%9.1f (%4.1fx)%s", time,
+            time > 0.0 ? scalarTime[k] / time : 0.0, same ? " " : "!");
+        }
+      }
+      printf("\n");
+    }
+  }
+  CoinSimdSetLevel(saveLevel);
+  // leave vector clear
+  vector.setNumElements(0);
+  CoinZeroN(vector.denseVector(), size);
+  if (!allSame) {
+    printf("results differ from scalar (marked !)\n");
+    return 1;
+  }
+  printf("all levels give scalar results\n");
+  return 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -14,10 +14,65 @@
 #endif
 
 #include <cassert>
+#include <cmath>
+#include <cstring>
 
 #include "CoinFinite.hpp"
 #include "CoinIndexedVector.hpp"
 #include "CoinShallowPackedVector.hpp"
+#include "CoinSimdKernels.hpp"
+#include "CoinThreadPool.hpp"
+
+//--------------------------------------------------------------------------
+// Dense region with zeros, -0.0, NaN and tiny values for kernel tests
+static void
+fillForKernels(double *region, int size)
+{
+  for (int i = 0; i < size; i++) {
+    int k = (i * 37) % 11;
+    if (k < 4)
+      region[i] = 0.0;
+    else if (k == 4)
+      region[i] = -0.0;
+    else if (k == 5)
+      region[i] = (i % 3) ? 1.0e-13 : -1.0e-13;
+    else if (k == 6 && i % 5 == 0)
+      region[i] = std::sqrt(-1.0);
+    else if (k == 6)
+      region[i] = 1.0e-30;
+    else
+      region[i] = (k - 8.5) * (i + 1);
+  }
+}
+
+// Whether two vectors have same indices and the same bits in region
+static bool
+sameForKernels(const CoinIndexedVector &a, const CoinIndexedVector &b,
+  int size)
+{
+  return a.getNumElements() == b.getNumElements()
+    && !memcmp(a.getIndices(), b.getIndices(), a.getNumElements() * sizeof(int))
+    && !memcmp(a.denseVector(), b.denseVector(), size * sizeof(double));
+}
+
+// Whether two partitioned vectors have same indices in each partition
+// and the same bits in region
+static bool
+samePartitions(const CoinPartitionedVector &a,
+  const CoinPartitionedVector &b, int size)
+{
+  if (a.getNumElements() != b.getNumElements()
+    || a.getNumPartitions() != b.getNumPartitions())
+    return false;
+  for (int k = 0; k < a.getNumPartitions(); k++) {
+    int start = a.startPartition(k);
+    if (a.getNumElements(k) != b.getNumElements(k)
+      || memcmp(a.getIndices() + start, b.getIndices() + start,
+        a.getNumElements(k) * sizeof(int)))
+      return false;
+  }
+  return !memcmp(a.denseVector(), b.denseVector(), size * sizeof(double));
+}
 
 //--------------------------------------------------------------------------
 void
@@ -533,6 +588,339 @@ CoinIndexedVectorUnitTest()
     assert( add[4] == 40.+40. );
     
   }
+
+  // Vector kernels give exactly what scalar ones give
+  {
+    const int size = 1003;
+    double *region = new double[size];
+    fillForKernels(region, size);
+    int available = CoinSimdLevelAvailable();
+    int saveLevel = CoinSimdLevelInUse();
+    CoinIndexedVector reference[6];
+    for (int k = 0; k < 6; k++)
+      reference[k].reserve(size);
+    // packed updates (as done on partitions)
+    double *packed = new double[size];
+    double *packedReference = new double[size];
+    for (int level = CoinSimdScalar; level <= available; level++) {
+      CoinSimdSetLevel(level);
+      CoinIndexedVector v[6];
+      for (int k = 0; k < 6; k++) {
+        v[k].reserve(size);
+        CoinMemcpyN(region, size, v[k].denseVector());
+      }
+      v[0].scan();
+      v[1].scan(5, size - 2, 1.0e-12);
+      v[2].scan(0, size);
+      v[2].clean(1.0e-12);
+      v[3].scan();
+      v[3].cleanAndPack(1.0e-12);
+      v[4].scan(1.0e-20);
+      v[4] *= 1.0e-9;
+      v[4] -= 3.0;
+      v[5].scan(1.0e-20);
+      v[5] += 7.5;
+      v[5] /= 1.0e11;
+      assert(v[1].getNumElements() < v[0].getNumElements());
+      CoinMemcpyN(region, size, packed);
+      for (int operation = CoinSimdAdd; operation <= CoinSimdDivide; operation++)
+        CoinSimdUpdatePacked(operation, size - 3, operation ? 1.0e-7 : 2.0,
+          1.0e-12, 1.0e-100, packed + 1);
+      if (level == CoinSimdScalar)
+        CoinMemcpyN(packed, size, packedReference);
+      else
+        assert(!memcmp(packed, packedReference, size * sizeof(double)));
+      for (int k = 0; k < 6; k++) {
+        if (level == CoinSimdScalar) {
+          CoinMemcpyN(v[k].denseVector(), size, reference[k].denseVector());
+          CoinMemcpyN(v[k].getIndices(), v[k].getNumElements(),
+            reference[k].getIndices());
+          reference[k].setNumElements(v[k].getNumElements());
+        } else {
+          assert(sameForKernels(v[k], reference[k], size));
+        }
+      }
+    }
+    CoinSimdSetLevel(saveLevel);
+    delete[] packedReference;
+    delete[] packed;
+    delete[] region;
+  }
+
+  // Scans skipping empty blocks give what full scans give
+  {
+    const int size = 1003;
+    double *region = new double[size];
+    double *copy = new double[size];
+    int *indices = new int[size];
+    int *indices2 = new int[size];
+    int available = CoinSimdLevelAvailable();
+    int saveLevel = CoinSimdLevelInUse();
+    for (int level = CoinSimdScalar; level <= available; level++) {
+      CoinSimdSetLevel(level);
+      for (int fill = 0; fill < 2; fill++) {
+        if (fill) {
+          fillForKernels(region, size);
+        } else {
+          // a few at ends of blocks and -0.0, NaN and tiny in others
+          CoinZeroN(region, size);
+          region[3] = 1.0;
+          region[34] = -2.0;
+          region[35] = 3.0;
+          region[100] = -0.0;
+          region[640] = std::sqrt(-1.0);
+          region[900] = 1.0e-13;
+          region[size - 1] = 4.0;
+        }
+        int n1 = CoinSimdScan(region, 3, size, indices);
+        int n2 = CoinSimdScanSparse(region, 3, size, indices2);
+        assert(n1 == n2 && !memcmp(indices, indices2, n1 * sizeof(int)));
+        if (!fill)
+          assert(n1 == 6);
+        CoinMemcpyN(region, size, copy);
+        n1 = CoinSimdScanTolerance(region, 0, size - 5, 1.0e-12, indices);
+        n2 = CoinSimdScanToleranceSparse(copy, 0, size - 5, 1.0e-12, indices2);
+        assert(n1 == n2 && !memcmp(indices, indices2, n1 * sizeof(int)));
+        assert(!memcmp(region, copy, size * sizeof(double)));
+      }
+    }
+    CoinSimdSetLevel(saveLevel);
+    delete[] indices2;
+    delete[] indices;
+    delete[] copy;
+    delete[] region;
+  }
+
+  // Density chooses loops of scan, append and += (results are the same)
+  {
+    const int size = 6400;
+    CoinIndexedVector v(size);
+    assert(v.density() == CoinIndexedVector::hyperSparse);
+    assert(v.scanDensity() == CoinIndexedVector::sparse);
+    double *dense = v.denseVector();
+    dense[5] = 1.0;
+    dense[4000] = -2.0;
+    dense[size - 1] = 3.0;
+    // full scan finds vector hyper sparse
+    assert(v.scan() == 3);
+    assert(v.scanDensity() == CoinIndexedVector::hyperSparse);
+    v.clear();
+    dense[5] = 1.0;
+    dense[31] = 1.0e-13;
+    dense[32] = 4.0;
+    dense[4000] = -2.0;
+    // so this one skips empty blocks
+    assert(v.scan(1.0e-12) == 3);
+    assert(v.getIndices()[0] == 5 && v.getIndices()[1] == 32);
+    assert(v.getIndices()[2] == 4000 && !dense[31]);
+    v.clear();
+    for (i = 1; i < size; i += 2)
+      dense[i] = i;
+    assert(v.scan() == size / 2);
+    for (i = 0; i < size / 2; i++)
+      assert(v.getIndices()[i] == 2 * i + 1);
+    assert(v.scanDensity() == CoinIndexedVector::dense);
+    assert(v.density() == CoinIndexedVector::dense);
+    v.clear();
+    // same elements in a dense and a hyper sparse vector
+    CoinIndexedVector small(90);
+    CoinIndexedVector big(9000);
+    for (i = 0; i < 90; i += 2) {
+      small.insert(i, i + 0.5);
+      big.insert(i, i + 0.5);
+    }
+    assert(small.density() == CoinIndexedVector::dense);
+    assert(big.density() == CoinIndexedVector::hyperSparse);
+    CoinIndexedVector separate(9000);
+    separate.insert(1, 1.0);
+    separate.insert(51, 2.0);
+    CoinIndexedVector overlap(separate);
+    overlap.insert(88, -88.5);
+    overlap.insert(30, 1.0);
+    CoinIndexedVector appended[2];
+    CoinIndexedVector added[2];
+    for (int k = 0; k < 2; k++) {
+      const CoinIndexedVector &caboose = k ? big : small;
+      appended[k] = separate;
+      appended[k].append(caboose);
+      added[k] = overlap;
+      added[k] += caboose;
+      bool thrown = false;
+      CoinIndexedVector copy(overlap);
+      try {
+        copy.append(caboose);
+      } catch (CoinError &) {
+        thrown = true;
+      }
+      assert(thrown);
+    }
+    assert(appended[0].getNumElements() == 47);
+    // 88 vanishes
+    assert(added[0].getNumElements() == 46 && !added[0][88]);
+    assert(added[0][30] == 31.5);
+    for (int k = 0; k < 2; k++) {
+      assert(appended[k].getNumElements() == appended[0].getNumElements());
+      assert(added[k].getNumElements() == added[0].getNumElements());
+      for (i = 0; i < 9000; i++) {
+        assert(appended[k][i] == appended[0][i]);
+        assert(added[k][i] == added[0][i]);
+      }
+    }
+  }
+
+  // In place operators (dense ones sweep)
+  {
+    const int size = 600;
+    CoinIndexedVector few(size);
+    CoinIndexedVector some(size);
+    CoinIndexedVector many(size);
+    few.insert(7, 2.0);
+    few.insert(300, -1.5);
+    few.insert(301, 0.5);
+    for (i = 0; i < size; i += 20)
+      some.insert(i, 0.25 * i + 1.0);
+    for (i = 0; i < size; i++) {
+      if (i % 3)
+        many.insert(i, (i % 7) - 3.5);
+    }
+    many.insert(300, 1.5);
+    // many is dense (a third or more full) and few and some are not
+    assert(3 * many.getNumElements() >= size);
+    assert(3 * some.getNumElements() < size);
+    CoinIndexedVector *vectors[3] = { &few, &some, &many };
+    for (int j = 0; j < 3; j++) {
+      for (int k = 0; k < 3; k++) {
+        for (int operation = 0; operation < 3; operation++) {
+          CoinIndexedVector result(*vectors[j]);
+          CoinIndexedVector expected;
+          if (operation == 0) {
+            expected = *vectors[j] + *vectors[k];
+            result += *vectors[k];
+          } else if (operation == 1) {
+            expected = *vectors[j] - *vectors[k];
+            result -= *vectors[k];
+          } else {
+            expected = *vectors[j] * *vectors[k];
+            result *= *vectors[k];
+          }
+          // same elements (order of indices may differ)
+          assert(result.getNumElements() == expected.getNumElements());
+          for (i = 0; i < size; i++)
+            assert(result[i] == expected[i]);
+          for (i = 0; i < result.getNumElements(); i++)
+            assert(result[result.getIndices()[i]]);
+        }
+      }
+    }
+    // 1.5 - 1.5 vanishes
+    CoinIndexedVector result(few);
+    result += many;
+    assert(!result[300]);
+    result.clear();
+    assert(!result.getNumElements());
+    for (i = 0; i < size; i++)
+      assert(!result.denseVector()[i]);
+  }
+
+  // Allocation policies for arrays
+  {
+    const int policies[] = { CoinArrayWithLength::allocateNormal,
+      CoinArrayWithLength::allocateAligned,
+      CoinArrayWithLength::allocateHugePages,
+      CoinArrayWithLength::allocateExplicitHugePages
+        | CoinArrayWithLength::allocateAligned,
+      CoinArrayWithLength::allocateInterleaved,
+      CoinArrayWithLength::allocateFirstTouch,
+      CoinArrayWithLength::allocateHugePages
+        | CoinArrayWithLength::allocateInterleaved };
+    int saveDefault = CoinArrayWithLength::defaultAllocationPolicy();
+    for (int k = 0; k < 7; k++) {
+      for (int big = 0; big < 2; big++) {
+        int n = big ? 300000 : 100;
+        CoinArrayWithLength::clearAllocationCounters();
+        CoinArrayWithLength::setDefaultAllocationPolicy(policies[k]);
+        CoinDoubleArrayWithLength array;
+        assert(array.allocationPolicy() == policies[k]);
+        array.switchOn();
+        double *values = array.conditionalNew(n);
+        if (policies[k] & CoinArrayWithLength::allocateAligned)
+          assert(!(reinterpret_cast< size_t >(values) & 63));
+        for (i = 0; i < n; i++)
+          values[i] = i;
+        CoinInt64 total = 0;
+        for (int j = 0; j < CoinArrayWithLength::numberAllocationCounters; j++)
+          total += CoinArrayWithLength::bytesAllocated(j);
+        assert(total >= static_cast< CoinInt64 >(n * sizeof(double)));
+        // copy and extend keep values
+        CoinDoubleArrayWithLength copy(array);
+        assert(copy.allocationPolicy() == policies[k]);
+        copy.extend(2 * array.capacity());
+        for (i = 0; i < n; i++)
+          assert(copy.array()[i] == i);
+        array.conditionalDelete();
+        assert(!array.array());
+        values = array.conditionalNew(n / 2);
+        assert(values[n / 2 - 1] == n / 2 - 1);
+      }
+    }
+    CoinArrayWithLength::setDefaultAllocationPolicy(saveDefault);
+    CoinArrayWithLength::clearAllocationCounters();
+  }
+
+  // Operations on all partitions with a pool give same as one at a time
+  {
+    const int size = 1000;
+    const int numberPartitions = 5;
+    const int starts[numberPartitions + 1] = { 0, 10, 10, 400, 777, size };
+    CoinThreadPool pool(4);
+    CoinPartitionedVector serial;
+    CoinPartitionedVector parallel;
+    serial.reserve(size);
+    parallel.reserve(size);
+    serial.setPartitions(numberPartitions, starts);
+    parallel.setPartitions(numberPartitions, starts);
+    for (int pass = 0; pass < 2; pass++) {
+      double tolerance = pass ? 1.0e-12 : 0.0;
+      fillForKernels(serial.denseVector(), size);
+      fillForKernels(parallel.denseVector(), size);
+      int n = 0;
+      for (int k = 0; k < numberPartitions; k++)
+        n += serial.scan(k, tolerance);
+      serial.computeNumberElements();
+      assert(parallel.scan(&pool, tolerance) == n);
+      assert(samePartitions(serial, parallel, size));
+      for (int operation = CoinSimdAdd; operation <= CoinSimdDivide; operation++) {
+        double value = operation == CoinSimdAdd ? 1.0e-13 : 0.5;
+        for (int k = 0; k < numberPartitions; k++)
+          serial.updatePartition(k, operation, value);
+        parallel.update(&pool, operation, value);
+        assert(samePartitions(serial, parallel, size));
+      }
+      n = 0;
+      for (int k = 0; k < numberPartitions; k++) {
+        n += serial.cleanPartition(k, 1.0e-10);
+        assert(serial.getNumElements(k) == parallel.getNumElements(k));
+      }
+      serial.computeNumberElements();
+      assert(parallel.clean(&pool, 1.0e-10) == n);
+      assert(samePartitions(serial, parallel, size));
+      if (!pass) {
+        serial.clearAndKeep();
+        parallel.clearAndKeep(&pool);
+        assert(!parallel.getNumElements());
+        for (i = 0; i < size; i++)
+          assert(!parallel.denseVector()[i]);
+      } else {
+        // compact gets rid of partitions
+        serial.compact();
+        parallel.compact(&pool);
+        assert(!parallel.getNumPartitions());
+        assert(sameForKernels(serial, parallel, size));
+        for (i = 0; i < size; i++)
+          assert(!parallel.denseVector()[i] == (i >= n));
+      }
+    }
+  }
   
 }
     
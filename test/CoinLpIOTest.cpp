@@ -56,26 +56,26 @@ CoinLpIOUnitTest(const std::string& lpDir)
             assert( imC1.getNumCols() == im.getNumCols() );
             assert( imC1.getNumRows() == im.getNumRows() );
 
-            for (int i = 0; i < im.numberHash_[0]; i++) {
+            for (int i = 0; i < im.names_[0].numberStrings(); i++) {
                // check the row name
-               assert(!strcmp(im.names_[0][i], imC1.names_[0][i]));
+               assert(!strcmp(im.names_[0].string(i), imC1.names_[0].string(i)));
             }
 
-            for (int i = 0; i < im.numberHash_[1]; i++) {
+            for (int i = 0; i < im.names_[1].numberStrings(); i++) {
                // check the column name
-               assert(!strcmp(im.names_[1][i], imC1.names_[1][i]));
+               assert(!strcmp(im.names_[1].string(i), imC1.names_[1].string(i)));
             }
 
-            for (int i = 0; i < im.maxHash_[0]; i++) {
-               // check hash value for row name
-               assert(im.hash_[0][i].next  == imC1.hash_[0][i].next);
-               assert(im.hash_[0][i].index == imC1.hash_[0][i].index);
+            assert(im.hash_[0].numberEntries() == imC1.hash_[0].numberEntries());
+            for (int i = 0; i < im.names_[0].numberStrings(); i++) {
+               // check hash lookup of row name
+               assert(imC1.findHash(im.names_[0].string(i), 0) == i);
             }
 
-            for (int i = 0; i < im.maxHash_[1]; i++) {
-               // check hash value for column name
-               assert(im.hash_[1][i].next == imC1.hash_[1][i].next);
-               assert(im.hash_[1][i].index == imC1.hash_[1][i].index);
+            assert(im.hash_[1].numberEntries() == imC1.hash_[1].numberEntries());
+            for (int i = 0; i < im.names_[1].numberStrings(); i++) {
+               // check hash lookup of column name
+               assert(imC1.findHash(im.names_[1].string(i), 1) == i);
             }
 
             CoinLpIO imC2(im);
@@ -85,26 +85,26 @@ CoinLpIOUnitTest(const std::string& lpDir)
             assert( lhs.getNumCols() == imC2.getNumCols() );
             assert( lhs.getNumRows() == imC2.getNumRows() );
 
-            for (int i = 0; i < imC2.numberHash_[0]; i++) {
+            for (int i = 0; i < imC2.names_[0].numberStrings(); i++) {
                // check the row name
-               assert(!strcmp(lhs.names_[0][i], imC2.names_[0][i]));
+               assert(!strcmp(lhs.names_[0].string(i), imC2.names_[0].string(i)));
             }
 
-            for (int i = 0; i < imC2.numberHash_[1]; i++) {
+            for (int i = 0; i < imC2.names_[1].numberStrings(); i++) {
                // check the column name
-               assert(!strcmp(lhs.names_[1][i], imC2.names_[1][i]));
+               assert(!strcmp(lhs.names_[1].string(i), imC2.names_[1].string(i)));
             }
 
-            for (int i = 0; i < imC2.maxHash_[0]; i++) {
-               // check hash value for row name
-               assert(lhs.hash_[0][i].next  == imC2.hash_[0][i].next);
-               assert(lhs.hash_[0][i].index == imC2.hash_[0][i].index);
+            assert(lhs.hash_[0].numberEntries() == imC2.hash_[0].numberEntries());
+            for (int i = 0; i < imC2.names_[0].numberStrings(); i++) {
+               // check hash lookup of row name
+               assert(lhs.findHash(imC2.names_[0].string(i), 0) == i);
             }
 
-            for (int i = 0; i < im.maxHash_[1]; i++) {
-               // check hash value for column name
-               assert(lhs.hash_[1][i].next == imC2.hash_[1][i].next);
-               assert(lhs.hash_[1][i].index == imC2.hash_[1][i].index);
+            assert(lhs.hash_[1].numberEntries() == imC2.hash_[1].numberEntries());
+            for (int i = 0; i < imC2.names_[1].numberStrings(); i++) {
+               // check hash lookup of column name
+               assert(lhs.findHash(imC2.names_[1].string(i), 1) == i);
             }
          }
          // Test that lhs has correct values even though rhs has gone out of scope
@@ -0,0 +1,203 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+// Timings for reading the COLUMNS section of MPS files in chunks
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "CoinUtilsConfig.h"
+
+#include "CoinPragma.hpp"
+#include "CoinFinite.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinMpsIO.hpp"
+#include "CoinThreadPool.hpp"
+#include "CoinTime.hpp"
+
+//----------------------------------------------------------------
+// mpsIOBench [-rows=N] [-columns=N] [-elements=N] [-threads=N]
+//            [-repeat=N] [-file=name]
+//
+// A random model with -elements elements per column (a tenth of the
+// columns integer) is written to mpsIOBench.mps and read without a
+// pool and with pools of 1, 2, 4 ... -threads threads (or -file is
+// read instead).  Times are best of -repeat reads, with speedup against
+// serial reading and MB/s of file.  Every pool must give exactly the
+// model read serially.
+//----------------------------------------------------------------
+
+namespace {
+// Writes random model to fileName
+void makeFile(const char *fileName, int numberRows, int numberColumns,
+  int elementsPerColumn)
+{
+  std::vector< CoinBigIndex > start(numberColumns + 1);
+  std::vector< int > row;
+  std::vector< double > element;
+  std::vector< char > used(numberRows, 0);
+  unsigned int seed = 987654321;
+  start[0] = 0;
+  for (int j = 0; j < numberColumns; j++) {
+    seed = 1664525 * seed + 1013904223;
+    int n = 1 + static_cast< int >((seed >> 8) % (2 * elementsPerColumn));
+    n = CoinMin(n, numberRows);
+    CoinBigIndex first = static_cast< CoinBigIndex >(row.size());
+    while (static_cast< CoinBigIndex >(row.size()) - first < n) {
+      seed = 1664525 * seed + 1013904223;
+      int iRow = static_cast< int >((seed >> 8) % numberRows);
+      if (used[iRow])
+        continue;
+      used[iRow] = 1;
+      row.push_back(iRow);
+      element.push_back(1.0 + static_cast< double >(seed % 10007) / 1013.0);
+    }
+    for (size_t k = first; k < row.size(); k++)
+      used[row[k]] = 0;
+    start[j + 1] = static_cast< CoinBigIndex >(row.size());
+  }
+  std::vector< int > length(numberColumns);
+  for (int j = 0; j < numberColumns; j++)
+    length[j] = static_cast< int >(start[j + 1] - start[j]);
+  CoinPackedMatrix matrix(true, numberRows, numberColumns, start[numberColumns],
+    &element[0], &row[0], &start[0], &length[0]);
+  std::vector< double > columnLower(numberColumns, 0.0);
+  std::vector< double > columnUpper(numberColumns, 10.0);
+  std::vector< double > objective(numberColumns);
+  std::vector< char > integer(numberColumns);
+  for (int j = 0; j < numberColumns; j++) {
+    objective[j] = (j % 3) ? 0.0 : 1.0 + j % 7;
+    integer[j] = (j % 10) == 0;
+  }
+  std::vector< double > rowLower(numberRows, 1.0);
+  std::vector< double > rowUpper(numberRows, COIN_DBL_MAX);
+  CoinMpsIO writer;
+  writer.setMpsData(matrix, COIN_DBL_MAX, &columnLower[0], &columnUpper[0],
+    &objective[0], &integer[0], &rowLower[0], &rowUpper[0],
+    static_cast< char ** >(NULL), static_cast< char ** >(NULL));
+  writer.writeMps(fileName);
+}
+
+// Whether two readers have exactly the same model
+bool sameModel(const CoinMpsIO &a, const CoinMpsIO &b)
+{
+  int numberRows = a.getNumRows();
+  int numberColumns = a.getNumCols();
+  if (numberRows != b.getNumRows() || numberColumns != b.getNumCols())
+    return false;
+  const CoinPackedMatrix *matrixA = a.getMatrixByCol();
+  const CoinPackedMatrix *matrixB = b.getMatrixByCol();
+  CoinBigIndex numberElements = matrixA->getNumElements();
+  if (numberElements != matrixB->getNumElements()
+    || memcmp(matrixA->getVectorStarts(), matrixB->getVectorStarts(),
+         (numberColumns + 1) * sizeof(CoinBigIndex))
+    || memcmp(matrixA->getIndices(), matrixB->getIndices(),
+         numberElements * sizeof(int))
+    || memcmp(matrixA->getElements(), matrixB->getElements(),
+         numberElements * sizeof(double))
+    || memcmp(a.getObjCoefficients(), b.getObjCoefficients(),
+         numberColumns * sizeof(double))
+    || memcmp(a.getColLower(), b.getColLower(), numberColumns * sizeof(double))
+    || memcmp(a.getColUpper(), b.getColUpper(), numberColumns * sizeof(double))
+    || memcmp(a.getRowLower(), b.getRowLower(), numberRows * sizeof(double))
+    || memcmp(a.getRowUpper(), b.getRowUpper(), numberRows * sizeof(double)))
+    return false;
+  for (int j = 0; j < numberColumns; j++) {
+    if (a.isInteger(j) != b.isInteger(j)
+      || strcmp(a.columnName(j), b.columnName(j)))
+      return false;
+  }
+  return true;
+}
+
+// Best time to read file with pool (NULL for serial)
+double timeRead(const char *fileName, CoinThreadPool *pool,
+  int numberRepeats, CoinMpsIO &reader)
+{
+  double best = COIN_DBL_MAX;
+  for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++) {
+    CoinMpsIO model;
+    model.messageHandler()->setLogLevel(0);
+    model.setThreadPool(pool);
+    double time1 = CoinWallclockTime();
+    model.readMps(fileName, "");
+    best = CoinMin(best, CoinWallclockTime() - time1);
+    if (!iRepeat)
+      reader = model;
+  }
+  return best;
+}
+}
+
+int main(int argc, const char *argv[])
+{
+  int numberRows = 100000;
+  int numberColumns = 1000000;
+  int elementsPerColumn = 10;
+  int maximumThreads = CoinThreadPool::defaultNumberThreads();
+  int numberRepeats = 3;
+  const char *fileName = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (!strncmp(argv[i], "-rows=", 6))
+      numberRows = CoinMax(1, atoi(argv[i] + 6));
+    else if (!strncmp(argv[i], "-columns=", 9))
+      numberColumns = CoinMax(1, atoi(argv[i] + 9));
+    else if (!strncmp(argv[i], "-elements=", 10))
+      elementsPerColumn = CoinMax(1, atoi(argv[i] + 10));
+    else if (!strncmp(argv[i], "-threads=", 9))
+      maximumThreads = CoinMax(1, atoi(argv[i] + 9));
+    else if (!strncmp(argv[i], "-repeat=", 8))
+      numberRepeats = CoinMax(1, atoi(argv[i] + 8));
+    else if (!strncmp(argv[i], "-file=", 6))
+      fileName = argv[i] + 6;
+    else
+      printf("unknown argument %s\n", argv[i]);
+  }
+  bool made = !fileName;
+  if (made) {
+    fileName = "mpsIOBench.mps";
+    double time1 = CoinWallclockTime();
+    makeFile(fileName, numberRows, numberColumns, elementsPerColumn);
+    printf("%s written in %.3f seconds\n", fileName, CoinWallclockTime() - time1);
+  }
+  FILE *fp = fopen(fileName, "rb");
+  if (!fp) {
+    printf("unable to open %s\n", fileName);
+    return 1;
+  }
+  fseek(fp, 0, SEEK_END);
+  double megabytes = static_cast< double >(ftell(fp)) / 1.0e6;
+  fclose(fp);
+  CoinMpsIO serial;
+  double timeSerial = timeRead(fileName, NULL, numberRepeats, serial);
+  printf("threads %s - %.1f MB, %d rows, %d columns, %d elements\n",
+    CoinThreadPool::threadsAvailable() ? "available" : "not available",
+    megabytes, serial.getNumRows(), serial.getNumCols(),
+    static_cast< int >(serial.getNumElements()));
+  printf("serial      %9.4f seconds %8.1f MB/s\n", timeSerial,
+    megabytes / CoinMax(timeSerial, 1.0e-9));
+  bool allSame = true;
+  for (int numberThreads = 1;; numberThreads *= 2) {
+    numberThreads = CoinMin(numberThreads, maximumThreads);
+    CoinThreadPool pool(numberThreads);
+    CoinMpsIO reader;
+    double time = timeRead(fileName, &pool, numberRepeats, reader);
+    bool same = sameModel(reader, serial);
+    if (!same)
+      allSame = false;
+    printf("threads %3d %9.4f seconds %8.1f MB/s (speedup %5.2f, %s)\n",
+      numberThreads, time, megabytes / CoinMax(time, 1.0e-9),
+      timeSerial / CoinMax(time, 1.0e-9),
+      same ? "same as serial" : "DIFFERENT FROM SERIAL");
+    if (numberThreads == maximumThreads)
+      break;
+  }
+  if (made)
+    remove(fileName);
+  return allSame ? 0 : 1;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
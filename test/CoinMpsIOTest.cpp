@@ -12,12 +12,44 @@
 #endif
 
 #include <cassert>
+#include <cstring>
 
 #include "CoinMpsIO.hpp"
+#include "CoinFileIO.hpp"
+#include "CoinThreadPool.hpp"
 #include "CoinFloatEqual.hpp"
 
 //#############################################################################
 
+// Whether two readers have the same model
+static bool
+sameModel(const CoinMpsIO &a, const CoinMpsIO &b)
+{
+  int nr = a.getNumRows();
+  int nc = a.getNumCols();
+  if (nr != b.getNumRows() || nc != b.getNumCols()
+    || a.getNumElements() != b.getNumElements())
+    return false;
+  if (memcmp(a.getRowLower(), b.getRowLower(), nr * sizeof(double))
+    || memcmp(a.getRowUpper(), b.getRowUpper(), nr * sizeof(double))
+    || memcmp(a.getColLower(), b.getColLower(), nc * sizeof(double))
+    || memcmp(a.getColUpper(), b.getColUpper(), nc * sizeof(double))
+    || memcmp(a.getObjCoefficients(), b.getObjCoefficients(), nc * sizeof(double)))
+    return false;
+  if (!a.getMatrixByCol()->isEquivalent(*b.getMatrixByCol()))
+    return false;
+  for (int i = 0; i < nr; i++) {
+    if (strcmp(a.rowName(i), b.rowName(i)))
+      return false;
+  }
+  for (int i = 0; i < nc; i++) {
+    if (strcmp(a.columnName(i), b.columnName(i))
+      || a.isContinuous(i) != b.isContinuous(i))
+      return false;
+  }
+  return true;
+}
+
 //--------------------------------------------------------------------------
 // test import methods
 void
@@ -158,6 +190,69 @@ CoinMpsIOUnitTest(const std::string & mpsDir)
       assert( eq( dumSi.getObjCoefficients()[6],  0.0) );
       assert( eq( dumSi.getObjCoefficients()[7], -1.0) );
     }
+
+    // Mapped and streamed reading give same model
+    {
+      CoinMpsIO mapped;
+      assert( mapped.mappedFiles() );
+      assert( !mapped.readMps("CoinMpsIoTest.mps","") );
+      CoinMpsIO streamed;
+      streamed.setMappedFiles(false);
+      assert( !streamed.readMps("CoinMpsIoTest.mps","") );
+      assert( sameModel(mapped, streamed) );
+      if (CoinFileOutput::compressionSupported(CoinFileOutput::COMPRESS_GZIP)) {
+        // compressed files are streamed anyway
+        mapped.writeMps("CoinMpsIoTestGz.mps", 1);
+        CoinMpsIO compressed;
+        assert( !compressed.readMps("CoinMpsIoTestGz.mps.gz","") );
+        assert( sameModel(compressed, streamed) );
+      }
+    }
+
+    // Reading COLUMNS in chunks on a pool gives same model
+    {
+      // big enough for several chunks, with integer markers
+      int numberRows = 300;
+      int numberColumns = 6000;
+      CoinPackedMatrix big(true, 0, 0);
+      big.setDimensions(numberRows, 0);
+      double columnLower[6000], columnUpper[6000], objective[6000];
+      char integer[6000];
+      double rowLower[300], rowUpper[300];
+      int index[5];
+      double value[5];
+      for (int i = 0; i < numberColumns; i++) {
+        for (int k = 0; k < 5; k++) {
+          index[k] = (i + 61 * k) % numberRows;
+          value[k] = 1.0 + 0.25 * k + 0.001 * (i % 97);
+        }
+        big.appendCol(5, index, value);
+        columnLower[i] = 0.0;
+        columnUpper[i] = (i % 7) ? 1.0e30 : 5.0;
+        objective[i] = 1.0 + (i % 13);
+        integer[i] = (i % 7) == 0;
+      }
+      for (int i = 0; i < numberRows; i++) {
+        rowLower[i] = 1.0;
+        rowUpper[i] = 1.0e30;
+      }
+      CoinMpsIO writer;
+      writer.setMpsData(big, 1.0e30, columnLower, columnUpper, objective,
+        integer, rowLower, rowUpper, static_cast<char **>(NULL),
+        static_cast<char **>(NULL));
+      writer.writeMps("CoinMpsIoTestBig.mps");
+      CoinMpsIO serial;
+      assert( !serial.readMps("CoinMpsIoTestBig.mps","") );
+      CoinThreadPool pool(4);
+      CoinMpsIO chunked;
+      chunked.setThreadPool(&pool);
+      assert( chunked.threadPool() == &pool );
+      assert( !chunked.readMps("CoinMpsIoTestBig.mps","") );
+      assert( chunked.getNumCols() == numberColumns );
+      assert( sameModel(chunked, serial) );
+      for (int i = 0; i < numberColumns; i++)
+        assert( chunked.isInteger(i) == ((i % 7) == 0) );
+    }
     
     // Test matrixByRow method
     { 
@@ -0,0 +1,239 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+// Name lookup with CoinNameHash against the chained hash the readers had
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "CoinUtilsConfig.h"
+
+#include "CoinPragma.hpp"
+#include "CoinFinite.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinNameHash.hpp"
+#include "CoinTime.hpp"
+
+//----------------------------------------------------------------
+// nameHashBench [-names=N] [-repeat=N]
+//
+// For several sets of -names names (R0000001 style as written by
+// modelling systems, indexed x_i_j, long names with a common prefix and
+// random names) a table is built from an array of names and every name
+// is looked up in a scattered order, as are as many names which are not
+// there.  Names looked up are one after another in memory as when a file
+// is read.  The old
+// table is the one CoinMpsIO, CoinLpIO and CoinModelHash used (sum of
+// characters times a multiplier, 4*N slots with chained overflow).
+// Times are best of -repeat passes in milliseconds.  "chain" is the
+// average number of names compared to find a name in the old table.
+//----------------------------------------------------------------
+
+namespace {
+const int numberSets = 4;
+const char *setName[numberSets] = { "R0000001", "x_i_j", "long prefix",
+  "random" };
+
+// Name i of set (j > 0 gives names not in set)
+void makeName(char *name, int set, int i, int j)
+{
+  switch (set) {
+  case 0:
+    sprintf(name, "%c%07d", j ? 'C' : 'R', i);
+    break;
+  case 1:
+    sprintf(name, "x%s_%d_%d", j ? "x" : "", i / 1000, i % 1000);
+    break;
+  case 2:
+    sprintf(name, "flow_from_node_%06d_to_node_%06d%s", i / 7, i, j ? "a" : "");
+    break;
+  default: {
+    unsigned int seed = 2654435761u * static_cast< unsigned int >(i + 1) + j;
+    for (int k = 0; k < 8; k++) {
+      seed = 1664525 * seed + 1013904223;
+      name[k] = static_cast< char >('A' + (seed >> 24) % 26);
+    }
+    name[8] = j ? '#' : '\0';
+    name[9] = '\0';
+  } break;
+  }
+}
+
+const int mmult[] = {
+  262139, 259459, 256889, 254291, 251701, 249133, 246709, 244247,
+  241667, 239179, 236609, 233983, 231289, 228859, 226357, 223829,
+  221281, 218849, 216319, 213721, 211093, 208673, 206263, 203773,
+  201233, 198637, 196159, 193603, 191161, 188701, 186149, 183761,
+  181303, 178873, 176389, 173897, 171469, 169049, 166471, 163871,
+  161387, 158941, 156437, 153949, 151531, 149159, 146749, 144299,
+  141709, 139369, 136889, 134591, 132169, 129641, 127343, 124853,
+  122477, 120163, 117757, 115361, 112979, 110567, 108179, 105727,
+  103387, 101021, 98639, 96179, 93911, 91583, 89317, 86939, 84521,
+  82183, 79939, 77587, 75307, 72959, 70793, 68447, 66103
+};
+
+int oldHash(const char *name, int maxsiz, int length)
+{
+  int n = 0;
+  for (int j = 0; j < length; ++j)
+    n += mmult[j % (sizeof(mmult) / sizeof(int))] * name[j];
+  return abs(n) % maxsiz;
+}
+
+// Chained table as in CoinMpsIO::startHash
+struct OldTable {
+  std::vector< int > index;
+  std::vector< int > next;
+  const char *const *names;
+  int maxhash;
+
+  void build(const char *const *theNames, int number)
+  {
+    names = theNames;
+    maxhash = 4 * number;
+    index.assign(maxhash, -1);
+    next.assign(maxhash, -1);
+    for (int i = 0; i < number; ++i) {
+      int ipos = oldHash(names[i], maxhash, static_cast< int >(strlen(names[i])));
+      if (index[ipos] == -1)
+        index[ipos] = i;
+    }
+    int iput = -1;
+    for (int i = 0; i < number; ++i) {
+      int ipos = oldHash(names[i], maxhash, static_cast< int >(strlen(names[i])));
+      while (true) {
+        int j1 = index[ipos];
+        if (j1 == i || !strcmp(names[i], names[j1]))
+          break;
+        if (next[ipos] == -1) {
+          while (index[++iput] != -1) {
+          }
+          next[ipos] = iput;
+          index[iput] = i;
+          break;
+        }
+        ipos = next[ipos];
+      }
+    }
+  }
+  int find(const char *name, int &compares) const
+  {
+    int ipos = oldHash(name, maxhash, static_cast< int >(strlen(name)));
+    while (true) {
+      int j1 = index[ipos];
+      if (j1 < 0)
+        return -1;
+      compares++;
+      if (!strcmp(names[j1], name))
+        return j1;
+      ipos = next[ipos];
+      if (ipos < 0)
+        return -1;
+    }
+  }
+};
+}
+
+int main(int argc, const char *argv[])
+{
+  int numberNames = 1000000;
+  int numberRepeats = 3;
+  for (int i = 1; i < argc; i++) {
+    if (!strncmp(argv[i], "-names=", 7))
+      numberNames = CoinMax(1, atoi(argv[i] + 7));
+    else if (!strncmp(argv[i], "-repeat=", 8))
+      numberRepeats = CoinMax(1, atoi(argv[i] + 8));
+    else
+      printf("unknown argument %s\n", argv[i]);
+  }
+  printf("%d names in each set, times in ms\n", numberNames);
+  printf("%-12s %8s %8s %8s %7s %8s %8s %8s %8s\n", "names", "old build",
+    "old find", "old miss", "chain", "new build", "new find", "new miss",
+    "speedup");
+  bool allOk = true;
+  char name[80];
+  for (int set = 0; set < numberSets; set++) {
+    // names in table then, as a reader would see them, the names looked
+    // up (scattered order) and as many names which are not there
+    std::vector< char > characters;
+    std::vector< size_t > offset;
+    for (int j = 0; j < 3; j++) {
+      for (int i = 0; i < numberNames; i++) {
+        int k = j ? static_cast< int >((static_cast< CoinUInt64 >(i) * 7919) % numberNames) : i;
+        makeName(name, set, k, j / 2);
+        offset.push_back(characters.size());
+        characters.insert(characters.end(), name, name + strlen(name) + 1);
+      }
+    }
+    std::vector< const char * > names(3 * numberNames);
+    for (int i = 0; i < 3 * numberNames; i++)
+      names[i] = &characters[offset[i]];
+    const char *const *lookup = &names[numberNames];
+    const char *const *missing = &names[2 * numberNames];
+    std::vector< int > order(numberNames);
+    for (int i = 0; i < numberNames; i++)
+      order[i] = static_cast< int >((static_cast< CoinUInt64 >(i) * 7919) % numberNames);
+    double times[6];
+    for (int k = 0; k < 6; k++)
+      times[k] = COIN_DBL_MAX;
+    double chain = 0.0;
+    for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++) {
+      OldTable old;
+      double time1 = CoinWallclockTime();
+      old.build(&names[0], numberNames);
+      double time2 = CoinWallclockTime();
+      int compares = 0;
+      for (int i = 0; i < numberNames; i++) {
+        if (old.find(lookup[i], compares) != order[i])
+          allOk = false;
+      }
+      double time3 = CoinWallclockTime();
+      int dummy = 0;
+      for (int i = 0; i < numberNames; i++) {
+        if (old.find(missing[i], dummy) >= 0)
+          allOk = false;
+      }
+      double time4 = CoinWallclockTime();
+      chain = static_cast< double >(compares) / numberNames;
+      // new - pool (names hashed once) then table
+      CoinStringPool pool;
+      CoinNameHash hash;
+      double time5 = CoinWallclockTime();
+      pool.reserve(numberNames, offset[numberNames]);
+      for (int i = 0; i < numberNames; i++)
+        pool.addString(names[i]);
+      hash.insertAll(pool);
+      double time6 = CoinWallclockTime();
+      for (int i = 0; i < numberNames; i++) {
+        if (hash.find(pool, lookup[i]) != order[i])
+          allOk = false;
+      }
+      double time7 = CoinWallclockTime();
+      for (int i = 0; i < numberNames; i++) {
+        if (hash.find(pool, missing[i]) >= 0)
+          allOk = false;
+      }
+      double time8 = CoinWallclockTime();
+      double now[6] = { time2 - time1, time3 - time2, time4 - time3,
+        time6 - time5, time7 - time6, time8 - time7 };
+      for (int k = 0; k < 6; k++)
+        times[k] = CoinMin(times[k], 1000.0 * now[k]);
+    }
+    double oldTotal = times[0] + times[1] + times[2];
+    double newTotal = times[3] + times[4] + times[5];
+    printf("%-12s %8.1f %8.1f %8.1f %7.2f %8.1f %8.1f %8.1f %8.2f\n",
+      setName[set], times[0], times[1], times[2], chain, times[3], times[4],
+      times[5], oldTotal / CoinMax(newTotal, 1.0e-6));
+  }
+  if (!allOk) {
+    printf("WRONG INDEX FOUND\n");
+    return 1;
+  }
+  printf("all names found\n");
+  return 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
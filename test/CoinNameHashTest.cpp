@@ -0,0 +1,112 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+#include "CoinNameHash.hpp"
+
+void CoinNameHashUnitTest()
+{
+  // Empty table
+  {
+    CoinStringPool names;
+    CoinNameHash hash;
+    assert(!hash.numberEntries() && !hash.numberSlots());
+    assert(hash.find(names, "R0000001") == -1);
+    CoinNameHash copy(hash);
+    assert(copy.find(names, "") == -1);
+  }
+  // Sequential names inserted one at a time (table grows)
+  {
+    const int number = 50000;
+    CoinStringPool names;
+    CoinNameHash hash;
+    char name[20];
+    for (int i = 0; i < number; i++) {
+      sprintf(name, "R%07d", i);
+      assert(hash.insert(names, names.addString(name)) == i);
+    }
+    assert(hash.numberEntries() == number);
+    assert(8 * number <= 7 * hash.numberSlots());
+    for (int i = 0; i < number; i++) {
+      sprintf(name, "R%07d", i);
+      assert(hash.find(names, name) == i);
+      sprintf(name, "C%07d", i);
+      assert(hash.find(names, name) == -1);
+    }
+    assert(hash.find(names, "R000000") == -1);
+    assert(hash.find(names, "R00000001") == -1);
+    // Duplicate is not inserted
+    int k = names.addString("R0000123");
+    assert(hash.insert(names, k) == 123);
+    assert(hash.numberEntries() == number);
+    // Remove half and put them back with new indices
+    for (int i = 0; i < number; i += 2)
+      hash.remove(names, i);
+    assert(hash.numberEntries() == number / 2);
+    for (int i = 0; i < number; i++) {
+      sprintf(name, "R%07d", i);
+      assert(hash.find(names, name) == ((i & 1) ? i : -1));
+    }
+    for (int i = 0; i < number; i += 2) {
+      sprintf(name, "R%07d", i);
+      int j = names.addString(name);
+      assert(hash.insert(names, j) == j);
+      assert(hash.find(names, name) == j);
+    }
+    assert(hash.numberEntries() == number);
+    // Copy and swap
+    CoinNameHash copy(hash);
+    CoinNameHash other;
+    other.swap(copy);
+    assert(!copy.numberEntries());
+    assert(other.find(names, "R0049999") == 49999);
+    copy = other;
+    assert(copy.find(names, "R0000001") == 1);
+    hash.clear();
+    assert(!hash.numberSlots() && hash.find(names, "R0000001") == -1);
+    assert(copy.find(names, "R0000001") == 1);
+  }
+  // Many insertions and removals with few entries at a time
+  {
+    CoinStringPool names;
+    CoinNameHash hash;
+    char name[20];
+    for (int i = 0; i < 100000; i++) {
+      sprintf(name, "x%d", i);
+      int j = names.addString(name);
+      assert(hash.insert(names, j) == j);
+      if (i >= 10)
+        hash.remove(names, j - 10);
+    }
+    assert(hash.numberEntries() == 10);
+    assert(hash.numberSlots() <= 64);
+    assert(hash.find(names, "x99990") == 99990);
+    assert(hash.find(names, "x99989") == -1);
+  }
+  // Building from a pool with duplicates and unset entries
+  {
+    CoinStringPool names;
+    names.addString("obj");
+    names.addString("c1");
+    names.setString(3, "c2");
+    names.addString("c1");
+    names.addString("");
+    CoinNameHash hash;
+    assert(hash.insertAll(names) == 1);
+    assert(hash.numberEntries() == 4);
+    assert(hash.find(names, "c1") == 1);
+    assert(hash.find(names, "c2") == 3);
+    assert(hash.find(names, "") == 5);
+    assert(hash.find(names, "c1x", 2, CoinStringPool::hashString("c1", 2)) == 1);
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,264 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+// Timings for threaded CoinPackedMatrix times, transposeTimes and
+// reverseOrderedCopyOf, for CoinSellMatrix and for CoinCompactPackedMatrix
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "CoinUtilsConfig.h"
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinCompactPackedMatrix.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinSellMatrix.hpp"
+#include "CoinThreadPool.hpp"
+#include "CoinTime.hpp"
+
+//----------------------------------------------------------------
+// packedMatrixBench [-rows=N] [-columns=N] [-elements=N] [-threads=N]
+//                   [-repeat=N] [-window=N]
+//
+// A random column ordered matrix with -elements elements per column
+// (lengths vary from 1 to twice that) is generated.  times (scatter,
+// timesMajor) and transposeTimes (gather, timesMinor) are timed with
+// no pool and with pools of 1, 2, 4 ... -threads threads.  Speedup is
+// against the serial code.  transposeTimes must give exactly the serial
+// results; times must give the same results on every repeat and
+// the largest relative difference from serial results is printed.
+// reverseOrderedCopyOf (making a row copy) is timed in the same way and
+// must give exactly the serial row copy.  Then a CoinSellMatrix copy
+// (-window= is its sort window) is timed and must give exactly the
+// serial products.  Last the elements are rounded to floats and to
+// small integers and CoinCompactPackedMatrix copies with float and 16
+// bit elements are timed against the rounded CoinPackedMatrix.
+//----------------------------------------------------------------
+
+namespace {
+// Random column ordered matrix
+void makeMatrix(CoinPackedMatrix &matrix, int numberRows, int numberColumns,
+  int elementsPerColumn)
+{
+  std::vector< CoinBigIndex > start(numberColumns + 1);
+  std::vector< int > row;
+  std::vector< double > element;
+  std::vector< char > used(numberRows, 0);
+  unsigned int seed = 987654321;
+  start[0] = 0;
+  for (int j = 0; j < numberColumns; j++) {
+    seed = 1664525 * seed + 1013904223;
+    int n = 1 + static_cast< int >((seed >> 8) % (2 * elementsPerColumn));
+    n = CoinMin(n, numberRows);
+    CoinBigIndex first = static_cast< CoinBigIndex >(row.size());
+    while (static_cast< CoinBigIndex >(row.size()) - first < n) {
+      seed = 1664525 * seed + 1013904223;
+      int iRow = static_cast< int >((seed >> 8) % numberRows);
+      if (used[iRow])
+        continue;
+      used[iRow] = 1;
+      row.push_back(iRow);
+      element.push_back(1.0 + static_cast< double >(seed % 10007) / 1013.0);
+    }
+    for (size_t k = first; k < row.size(); k++)
+      used[row[k]] = 0;
+    start[j + 1] = static_cast< CoinBigIndex >(row.size());
+  }
+  std::vector< int > length(numberColumns);
+  for (int j = 0; j < numberColumns; j++)
+    length[j] = static_cast< int >(start[j + 1] - start[j]);
+  CoinPackedMatrix made(true, numberRows, numberColumns, start[numberColumns],
+    &element[0], &row[0], &start[0], &length[0]);
+  matrix.swap(made);
+}
+
+// Times both directions with pool (NULL for serial)
+void timeProducts(const CoinPackedMatrix &matrix, CoinThreadPool *pool,
+  int numberRepeats, const std::vector< double > &x,
+  const std::vector< double > &xTranspose, std::vector< double > &y,
+  std::vector< double > &yTranspose, double &timeTimes,
+  double &timeTranspose, bool &sameEachTime)
+{
+  int numberRows = matrix.getNumRows();
+  std::vector< double > first;
+  sameEachTime = true;
+  double time1 = CoinWallclockTime();
+  for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++) {
+    if (pool)
+      matrix.times(&x[0], &y[0], pool);
+    else
+      matrix.times(&x[0], &y[0]);
+    if (!iRepeat)
+      first = y;
+    else if (memcmp(&first[0], &y[0], numberRows * sizeof(double)))
+      sameEachTime = false;
+  }
+  double time2 = CoinWallclockTime();
+  for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++) {
+    if (pool)
+      matrix.transposeTimes(&xTranspose[0], &yTranspose[0], pool);
+    else
+      matrix.transposeTimes(&xTranspose[0], &yTranspose[0]);
+  }
+  double time3 = CoinWallclockTime();
+  timeTimes = (time2 - time1) / numberRepeats;
+  timeTranspose = (time3 - time2) / numberRepeats;
+}
+}
+
+int main(int argc, const char *argv[])
+{
+  int numberRows = 200000;
+  int numberColumns = 400000;
+  int elementsPerColumn = 10;
+  int maximumThreads = CoinThreadPool::defaultNumberThreads();
+  int numberRepeats = 5;
+  int sortWindow = 256;
+  for (int i = 1; i < argc; i++) {
+    if (!strncmp(argv[i], "-rows=", 6))
+      numberRows = CoinMax(1, atoi(argv[i] + 6));
+    else if (!strncmp(argv[i], "-columns=", 9))
+      numberColumns = CoinMax(1, atoi(argv[i] + 9));
+    else if (!strncmp(argv[i], "-elements=", 10))
+      elementsPerColumn = CoinMax(1, atoi(argv[i] + 10));
+    else if (!strncmp(argv[i], "-threads=", 9))
+      maximumThreads = CoinMax(1, atoi(argv[i] + 9));
+    else if (!strncmp(argv[i], "-repeat=", 8))
+      numberRepeats = CoinMax(1, atoi(argv[i] + 8));
+    else if (!strncmp(argv[i], "-window=", 8))
+      sortWindow = CoinMax(1, atoi(argv[i] + 8));
+    else
+      printf("unknown argument %s\n", argv[i]);
+  }
+  CoinPackedMatrix matrix;
+  double time1 = CoinWallclockTime();
+  makeMatrix(matrix, numberRows, numberColumns, elementsPerColumn);
+  printf("threads %s - matrix %d rows, %d columns, %d elements made in %.3f seconds\n",
+    CoinThreadPool::threadsAvailable() ? "available" : "not available",
+    numberRows, numberColumns, static_cast< int >(matrix.getNumElements()),
+    CoinWallclockTime() - time1);
+  std::vector< double > x(numberColumns);
+  std::vector< double > xTranspose(numberRows);
+  for (int j = 0; j < numberColumns; j++)
+    x[j] = (j % 11) ? 1.0 / (j + 1) : 0.0;
+  for (int i = 0; i < numberRows; i++)
+    xTranspose[i] = 0.5 - (i % 3);
+  std::vector< double > ySerial(numberRows);
+  std::vector< double > yTransposeSerial(numberColumns);
+  double timeTimesSerial;
+  double timeTransposeSerial;
+  bool sameEachTime;
+  timeProducts(matrix, NULL, numberRepeats, x, xTranspose, ySerial,
+    yTransposeSerial, timeTimesSerial, timeTransposeSerial, sameEachTime);
+  time1 = CoinWallclockTime();
+  CoinPackedMatrix rowSerial;
+  for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++)
+    rowSerial.reverseOrderedCopyOf(matrix);
+  double timeReverseSerial = (CoinWallclockTime() - time1) / numberRepeats;
+  printf("serial      times %9.5f transposeTimes %9.5f reverseOrderedCopyOf %9.5f\n",
+    timeTimesSerial, timeTransposeSerial, timeReverseSerial);
+  std::vector< double > y(numberRows);
+  std::vector< double > yTranspose(numberColumns);
+  for (int numberThreads = 1;; numberThreads *= 2) {
+    numberThreads = CoinMin(numberThreads, maximumThreads);
+    CoinThreadPool pool(numberThreads);
+    double timeTimes;
+    double timeTranspose;
+    timeProducts(matrix, &pool, numberRepeats, x, xTranspose, y, yTranspose,
+      timeTimes, timeTranspose, sameEachTime);
+    double difference = 0.0;
+    for (int i = 0; i < numberRows; i++)
+      difference = CoinMax(difference, fabs(y[i] - ySerial[i])
+          / CoinMax(1.0, fabs(ySerial[i])));
+    bool sameTranspose = !memcmp(&yTranspose[0], &yTransposeSerial[0],
+      numberColumns * sizeof(double));
+    time1 = CoinWallclockTime();
+    CoinPackedMatrix row;
+    for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++)
+      row.reverseOrderedCopyOf(matrix, &pool);
+    double timeReverse = (CoinWallclockTime() - time1) / numberRepeats;
+    bool sameReverse = !memcmp(row.getVectorStarts(), rowSerial.getVectorStarts(),
+                         (numberRows + 1) * sizeof(CoinBigIndex))
+      && !memcmp(row.getIndices(), rowSerial.getIndices(),
+        row.getNumElements() * sizeof(int))
+      && !memcmp(row.getElements(), rowSerial.getElements(),
+        row.getNumElements() * sizeof(double));
+    printf("threads %3d times %9.5f (speedup %5.2f, %s, difference %g) transposeTimes %9.5f (speedup %5.2f, %s)"
+           " reverseOrderedCopyOf %9.5f (speedup %5.2f, %s)\n",
+      numberThreads, timeTimes, timeTimesSerial / CoinMax(timeTimes, 1.0e-9),
+      sameEachTime ? "repeatable" : "NOT REPEATABLE", difference,
+      timeTranspose, timeTransposeSerial / CoinMax(timeTranspose, 1.0e-9),
+      sameTranspose ? "same as serial" : "DIFFERENT FROM SERIAL",
+      timeReverse, timeReverseSerial / CoinMax(timeReverse, 1.0e-9),
+      sameReverse ? "same as serial" : "DIFFERENT FROM SERIAL");
+    if (numberThreads == maximumThreads)
+      break;
+  }
+  time1 = CoinWallclockTime();
+  CoinSellMatrix sell(matrix, sortWindow);
+  double timeSell = CoinWallclockTime() - time1;
+  time1 = CoinWallclockTime();
+  for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++)
+    sell.times(&x[0], &y[0]);
+  double time2 = CoinWallclockTime();
+  for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++)
+    sell.transposeTimes(&xTranspose[0], &yTranspose[0]);
+  double time3 = CoinWallclockTime();
+  double timeTimes = (time2 - time1) / numberRepeats;
+  double timeTranspose = (time3 - time2) / numberRepeats;
+  bool same = !memcmp(&y[0], &ySerial[0], numberRows * sizeof(double));
+  bool sameTranspose = !memcmp(&yTranspose[0], &yTransposeSerial[0],
+    numberColumns * sizeof(double));
+  printf("sliced (window %d, padding %.1f%% and %.1f%%, made in %.3f seconds) times %9.5f (speedup %5.2f, %s) transposeTimes %9.5f (speedup %5.2f, %s)\n",
+    sell.getSortWindow(),
+    100.0 * (sell.getPaddedSize(0) - matrix.getNumElements()) / CoinMax(1.0, static_cast< double >(matrix.getNumElements())),
+    100.0 * (sell.getPaddedSize(1) - matrix.getNumElements()) / CoinMax(1.0, static_cast< double >(matrix.getNumElements())),
+    timeSell, timeTimes, timeTimesSerial / CoinMax(timeTimes, 1.0e-9),
+    same ? "same as serial" : "DIFFERENT FROM SERIAL",
+    timeTranspose, timeTransposeSerial / CoinMax(timeTranspose, 1.0e-9),
+    sameTranspose ? "same as serial" : "DIFFERENT FROM SERIAL");
+  for (int storage = CoinCompactPackedMatrix::storeInt16;
+       storage <= CoinCompactPackedMatrix::storeFloat; storage++) {
+    CoinPackedMatrix rounded(matrix);
+    double *element = rounded.getMutableElements();
+    for (CoinBigIndex j = 0; j < rounded.getNumElements(); j++) {
+      if (storage == CoinCompactPackedMatrix::storeInt16)
+        element[j] = floor(10.0 * element[j]);
+      else
+        element[j] = static_cast< float >(element[j]);
+    }
+    double timeRounded[2];
+    timeProducts(rounded, NULL, numberRepeats, x, xTranspose, ySerial,
+      yTransposeSerial, timeRounded[0], timeRounded[1], sameEachTime);
+    time1 = CoinWallclockTime();
+    CoinCompactPackedMatrix compact(rounded, storage);
+    double timeCompact = CoinWallclockTime() - time1;
+    time1 = CoinWallclockTime();
+    for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++)
+      compact.times(&x[0], &y[0]);
+    time2 = CoinWallclockTime();
+    for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++)
+      compact.transposeTimes(&xTranspose[0], &yTranspose[0]);
+    time3 = CoinWallclockTime();
+    timeTimes = (time2 - time1) / numberRepeats;
+    timeTranspose = (time3 - time2) / numberRepeats;
+    same = !memcmp(&y[0], &ySerial[0], numberRows * sizeof(double));
+    sameTranspose = !memcmp(&yTranspose[0], &yTransposeSerial[0],
+      numberColumns * sizeof(double));
+    printf("%s elements (%d bytes, made in %.3f seconds) times %9.5f (speedup %5.2f, %s) transposeTimes %9.5f (speedup %5.2f, %s)\n",
+      storage == CoinCompactPackedMatrix::storeInt16 ? "int16" : "float",
+      compact.elementSize(), timeCompact,
+      timeTimes, timeRounded[0] / CoinMax(timeTimes, 1.0e-9),
+      same ? "same as serial" : "DIFFERENT FROM SERIAL",
+      timeTranspose, timeRounded[1] / CoinMax(timeTranspose, 1.0e-9),
+      sameTranspose ? "same as serial" : "DIFFERENT FROM SERIAL");
+  }
+  return 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -12,10 +12,20 @@
 #endif
 
 #include <cassert>
+#include <cmath>
+#include <cstring>
 
+#include "CoinCompactPackedMatrix.hpp"
 #include "CoinFloatEqual.hpp"
+#include "CoinHelperFunctions.hpp"
 #include "CoinPackedVector.hpp"
 #include "CoinPackedMatrix.hpp"
+#include "CoinSellMatrix.hpp"
+#include "CoinSimdKernels.hpp"
+#include "CoinThreadPool.hpp"
+#include "CoinWidePackedMatrix.hpp"
+#include "CoinModel.hpp"
+#include "CoinError.hpp"
 
 //#############################################################################
 
@@ -632,6 +642,254 @@ CoinPackedMatrixUnitTest()
     
     delete globalP;
   }
+
+  {
+    // Threaded times and transposeTimes must match serial ones
+    const int numberRows = 50;
+    const int numberColumns = 200;
+    CoinPackedMatrix m(true, 0, 0);
+    m.setDimensions(numberRows, 0);
+    unsigned int seed = 12345;
+    for (int j = 0; j < numberColumns; j++) {
+      CoinPackedVector column;
+      // uneven lengths so chunks differ in number of columns
+      int n = 1 + (j % 7) * 3;
+      for (int k = 0; k < n; k++) {
+        seed = 1664525 * seed + 1013904223;
+        int iRow = static_cast< int >((seed >> 8) % numberRows);
+        if (!column.isExistingIndex(iRow))
+          column.insert(iRow, 1.0 + static_cast< double >(seed % 1000) / 7.0);
+      }
+      m.appendCol(column);
+    }
+    double x[numberColumns];
+    double xr[numberRows];
+    double y1[numberColumns];
+    double y2[numberColumns];
+    for (int j = 0; j < numberColumns; j++)
+      x[j] = (j % 5) ? 1.0 / (j + 1) : 0.0;
+    for (int i = 0; i < numberRows; i++)
+      xr[i] = 0.5 - i % 3;
+    CoinThreadPool pool(4);
+    // gather direction is identical
+    m.transposeTimes(xr, y1);
+    m.transposeTimes(xr, y2, &pool);
+    for (int j = 0; j < numberColumns; j++)
+      assert(y1[j] == y2[j]);
+    // scatter direction is close and same every time
+    double y3[numberRows];
+    m.times(x, y1);
+    m.times(x, y2, &pool);
+    m.times(x, y3, &pool);
+    for (int i = 0; i < numberRows; i++) {
+      assert(eq(y1[i], y2[i]));
+      assert(y2[i] == y3[i]);
+    }
+    // and for row ordered copy
+    CoinPackedMatrix r;
+    r.reverseOrderedCopyOf(m);
+    r.times(x, y2, &pool);
+    for (int i = 0; i < numberRows; i++)
+      assert(eq(y1[i], y2[i]));
+    r.transposeTimes(xr, y2, &pool);
+    m.transposeTimes(xr, y1);
+    for (int j = 0; j < numberColumns; j++)
+      assert(eq(y1[j], y2[j]));
+    // threaded reverse ordered copies are exactly the same
+    // (leave out last element of longer columns to make gaps)
+    CoinBigIndex size = m.getVectorStarts()[numberColumns];
+    double *gapElement = CoinCopyOfArray(m.getElements(), size);
+    int *gapIndex = CoinCopyOfArray(m.getIndices(), size);
+    CoinBigIndex *gapStart = CoinCopyOfArray(m.getVectorStarts(), numberColumns + 1);
+    int *gapLength = CoinCopyOfArray(m.getVectorLengths(), numberColumns);
+    CoinBigIndex numberGapElements = 0;
+    for (int j = 0; j < numberColumns; j++) {
+      if (gapLength[j] > 1)
+        gapLength[j]--;
+      numberGapElements += gapLength[j];
+    }
+    CoinPackedMatrix withGaps;
+    withGaps.assignMatrix(true, numberRows, numberColumns, numberGapElements,
+      gapElement, gapIndex, gapStart, gapLength);
+    assert(withGaps.getNumElements() < withGaps.getVectorStarts()[numberColumns]);
+    for (int pass = 0; pass < 3; pass++) {
+      const CoinPackedMatrix &from = pass == 0 ? m : (pass == 1 ? withGaps : r);
+      CoinPackedMatrix serial;
+      CoinPackedMatrix threaded;
+      if (pass == 1) {
+        serial.setExtraGap(0.5);
+        threaded.setExtraGap(0.5);
+      }
+      serial.reverseOrderedCopyOf(from);
+      threaded.reverseOrderedCopyOf(from, &pool);
+      assert(serial.isColOrdered() == threaded.isColOrdered());
+      int majorDim = serial.getMajorDim();
+      assert(majorDim == threaded.getMajorDim());
+      assert(serial.getMinorDim() == threaded.getMinorDim());
+      assert(serial.getNumElements() == threaded.getNumElements());
+      assert(!memcmp(serial.getVectorStarts(), threaded.getVectorStarts(),
+        (majorDim + 1) * sizeof(CoinBigIndex)));
+      assert(!memcmp(serial.getVectorLengths(), threaded.getVectorLengths(),
+        majorDim * sizeof(int)));
+      for (int i = 0; i < majorDim; i++) {
+        CoinBigIndex k = serial.getVectorStarts()[i];
+        int n = serial.getVectorLengths()[i];
+        assert(!memcmp(serial.getIndices() + k, threaded.getIndices() + k,
+          n * sizeof(int)));
+        assert(!memcmp(serial.getElements() + k, threaded.getElements() + k,
+          n * sizeof(double)));
+      }
+    }
+    CoinPackedMatrix reversed(m);
+    reversed.reverseOrdering(&pool);
+    assert(reversed.isEquivalent2(r));
+    // sliced copies give exactly the same products at every level
+    int level = CoinSimdLevelInUse();
+    for (int pass = 0; pass < 6; pass++) {
+      const CoinPackedMatrix &from = pass % 3 == 0 ? m : (pass % 3 == 1 ? withGaps : r);
+      CoinSellMatrix sell(from, pass < 3 ? 256 : 1);
+      assert(sell.getNumRows() == from.getNumRows());
+      assert(sell.getNumCols() == from.getNumCols());
+      assert(sell.getNumElements() == from.getNumElements());
+      for (int iLevel = CoinSimdScalar; iLevel <= CoinSimdAvx512; iLevel++) {
+        CoinSimdSetLevel(iLevel);
+        from.times(x, y1);
+        CoinFillN(y2, numberColumns, -1.0);
+        sell.times(x, y2);
+        for (int i = 0; i < numberRows; i++)
+          assert(y1[i] == y2[i]);
+        from.transposeTimes(xr, y1);
+        CoinFillN(y2, numberColumns, -1.0);
+        sell.transposeTimes(xr, y2);
+        for (int j = 0; j < numberColumns; j++)
+          assert(y1[j] == y2[j]);
+      }
+    }
+    CoinSimdSetLevel(level);
+    // compact copies give exactly the same products
+    for (int pass = 0; pass < 3; pass++) {
+      const CoinPackedMatrix &from = pass == 0 ? m : (pass == 1 ? withGaps : r);
+      // elements are not all floats so anything narrower falls back
+      assert(CoinCompactPackedMatrix::exactStorage(from) == CoinCompactPackedMatrix::storeDouble);
+      CoinCompactPackedMatrix compact(from, CoinCompactPackedMatrix::storeFloat);
+      assert(compact.storage() == CoinCompactPackedMatrix::storeDouble);
+      assert(compact.fellBack());
+      assert(compact.getNumElements() == from.getNumElements());
+      from.times(x, y1);
+      compact.times(x, y2);
+      for (int i = 0; i < numberRows; i++)
+        assert(y1[i] == y2[i]);
+      from.transposeTimes(xr, y1);
+      compact.transposeTimes(xr, y2);
+      for (int j = 0; j < numberColumns; j++)
+        assert(y1[j] == y2[j]);
+    }
+    CoinPackedMatrix narrow(m);
+    double *element = narrow.getMutableElements();
+    for (CoinBigIndex k = 0; k < narrow.getVectorStarts()[numberColumns]; k++)
+      element[k] = floor(element[k]) - 100.0;
+    assert(CoinCompactPackedMatrix::exactStorage(narrow) == CoinCompactPackedMatrix::storeInt16);
+    for (int storage = CoinCompactPackedMatrix::storeNarrowest;
+         storage <= CoinCompactPackedMatrix::storeDouble; storage++) {
+      CoinCompactPackedMatrix compact(narrow, storage);
+      assert(compact.storage() == CoinMax(storage, static_cast< int >(CoinCompactPackedMatrix::storeInt16)));
+      assert(!compact.fellBack());
+      CoinCompactPackedMatrix copy(compact);
+      narrow.times(x, y1);
+      copy.times(x, y2);
+      for (int i = 0; i < numberRows; i++)
+        assert(y1[i] == y2[i]);
+      narrow.transposeTimes(xr, y1);
+      copy.transposeTimes(xr, y2);
+      for (int j = 0; j < numberColumns; j++)
+        assert(y1[j] == y2[j]);
+    }
+    // a value which is a float but not a 16 bit integer
+    element[0] = 0.5;
+    assert(CoinCompactPackedMatrix::exactStorage(narrow) == CoinCompactPackedMatrix::storeFloat);
+    element[0] = -0.0;
+    assert(CoinCompactPackedMatrix::exactStorage(narrow) == CoinCompactPackedMatrix::storeFloat);
+    element[0] = 40000.0;
+    assert(CoinCompactPackedMatrix::exactStorage(narrow) == CoinCompactPackedMatrix::storeFloat);
+  }
+
+  {
+    // Matrices with 64 bit starts and indices
+    const int numberRows = 30;
+    const int numberColumns = 70;
+    const int numberElements = 400;
+    CoinInt64 row64[numberElements];
+    CoinInt64 column64[numberElements];
+    int row[numberElements];
+    int column[numberElements];
+    double element[numberElements];
+    for (int k = 0; k < numberElements; k++) {
+      // distinct positions in no particular order
+      int position = (k * 7919) % (numberRows * numberColumns);
+      row[k] = position % numberRows;
+      column[k] = position / numberRows;
+      row64[k] = row[k];
+      column64[k] = column[k];
+      element[k] = 1.0 + k % 17;
+    }
+    CoinPackedMatrix m(true, row, column, element, numberElements);
+    CoinWidePackedMatrix64x64 wide;
+    wide.fromTriples(true, numberRows, numberColumns, numberElements,
+      row64, column64, element);
+    assert(wide.getNumElements() == numberElements);
+    assert(wide.getNumRows() == numberRows);
+    assert(wide.fitsPackedMatrix());
+    CoinPackedMatrix back;
+    wide.toPackedMatrix(back);
+    assert(back.isEquivalent2(m));
+    CoinWidePackedMatrix64 wide64(m);
+    assert(wide64.getNumElements() == m.getNumElements());
+    double x[numberColumns];
+    double xr[numberRows];
+    double y1[numberColumns];
+    double y2[numberColumns];
+    for (int j = 0; j < numberColumns; j++)
+      x[j] = (j % 5) ? 1.0 / (j + 1) : 0.0;
+    for (int i = 0; i < numberRows; i++)
+      xr[i] = 0.5 - i % 3;
+    m.times(x, y1);
+    wide64.times(x, y2);
+    for (int i = 0; i < numberRows; i++)
+      assert(y1[i] == y2[i]);
+    m.transposeTimes(xr, y1);
+    wide64.transposeTimes(xr, y2);
+    for (int j = 0; j < numberColumns; j++)
+      assert(y1[j] == y2[j]);
+    // row copy
+    CoinPackedMatrix r;
+    r.reverseOrderedCopyOf(m);
+    CoinWidePackedMatrix64 wideRow;
+    wideRow.reverseOrderedCopyOf(wide64);
+    assert(!wideRow.isColOrdered());
+    wideRow.toPackedMatrix(back);
+    assert(back.isEquivalent2(r));
+    r.times(x, y1);
+    wideRow.times(x, y2);
+    for (int i = 0; i < numberRows; i++)
+      assert(y1[i] == y2[i]);
+    // through CoinModel
+    CoinModel model;
+    wide.toModel(model);
+    CoinWidePackedMatrix32 fromModel;
+    fromModel.fromModel(model);
+    fromModel.toPackedMatrix(back);
+    assert(back.isEquivalent2(m));
+    // bad index
+    bool caught = false;
+    row64[7] = numberRows;
+    try {
+      wide.fromTriples(true, numberRows, numberColumns, numberElements,
+        row64, column64, element);
+    } catch (CoinError &) {
+      caught = true;
+    }
+    assert(caught);
+  }
   
 #if 0
   {
@@ -13,6 +13,7 @@
 #include "CoinFinite.hpp"
 #include "CoinPackedVector.hpp"
 #include "CoinShallowPackedVector.hpp"
+#include "CoinIndexHash.hpp"
 
 //--------------------------------------------------------------------------
 void
@@ -1048,5 +1049,69 @@ CoinPackedVectorUnitTest()
 
   } 
 
+  // Index hash table, duplicate checks and finding many indices
+  {
+    CoinIndexHash hash;
+    assert(hash.find(3) == -1);
+    for (i = 0; i < 1000; i++)
+      assert(hash.insert(7 * i - 3000, i));
+    assert(!hash.insert(-3000, 5));
+    assert(hash.size() == 1000);
+    assert(hash.minimumKey() == -3000 && hash.maximumKey() == 7 * 999 - 3000);
+    for (i = 0; i < 1000; i++) {
+      assert(hash.find(7 * i - 3000) == i);
+      assert(!hash.contains(7 * i - 2999));
+    }
+    CoinIndexHash copy(hash);
+    hash.clear();
+    assert(!hash.size() && !hash.contains(-3000));
+    assert(copy.size() == 1000 && copy.find(1004) == 572);
+    const int dup[] = { 5, 9, 2, 9 };
+    assert(hash.build(4, dup) == 3);
+
+    // vector with duplicate found on insert and append
+    CoinPackedVector v;
+    for (i = 0; i < 200; i++)
+      v.insert(3 * i, i + 1.0);
+    bool errorThrown = false;
+    try {
+      v.insert(30, 1.0);
+    } catch (CoinError &) {
+      errorThrown = true;
+    }
+    assert(errorThrown);
+    assert(v.getNumElements() == 200);
+    assert(v.isExistingIndex(597) && !v.isExistingIndex(598));
+    assert(v[9] == 4.0 && v[10] == 0.0);
+    assert(v.getMaxIndex() == 597 && v.getMinIndex() == 0);
+    const int more[] = { 1000, 1001, 6 };
+    errorThrown = false;
+    try {
+      v.append(CoinShallowPackedVector(3, more, v.getElements()));
+    } catch (CoinError &) {
+      errorThrown = true;
+    }
+    assert(errorThrown);
+
+    // bulk findIndex gives what findIndex gives (dense and hashed)
+    CoinPackedVector w(false);
+    for (i = 0; i < 50; i++)
+      w.insert(i % 2 ? 5 * i : 1000000 * i, 1.0);
+    w.insert(5, 2.0); // duplicate (first position found)
+    const int wanted = 200;
+    int which[wanted];
+    int positions[wanted];
+    for (int k = 0; k < 2; k++) {
+      for (i = 0; i < wanted; i++)
+        which[i] = k ? (i * 37) % 260 - 10 : 1000000 * (i % 60) + (i % 3);
+      w.findIndex(wanted, which, positions);
+      for (i = 0; i < wanted; i++)
+        assert(positions[i] == w.findIndex(which[i]));
+      v.findIndex(wanted, which, positions);
+      for (i = 0; i < wanted; i++)
+        assert(positions[i] == v.findIndex(which[i]));
+    }
+  }
+
 }
 
@@ -0,0 +1,133 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+// Throughput of CoinParseDouble against strtod
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CoinUtilsConfig.h"
+
+#include "CoinPragma.hpp"
+#include "CoinFinite.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinParseNumber.hpp"
+#include "CoinTime.hpp"
+
+//----------------------------------------------------------------
+// parseNumberBench [-numbers=N] [-repeat=N]
+//
+// For each style of number found in model files (small integers,
+// values written by CoinMpsIO with 12 significant digits, full %.17g
+// precision and long exponents) a buffer of -numbers blank separated
+// numbers is converted by strtod and by CoinParseDouble.  MB/s is best
+// of -repeat passes.  Every value must be the one strtod gives.
+//----------------------------------------------------------------
+
+namespace {
+const int numberStyles = 4;
+const char *styleName[numberStyles] = { "integers", "mps %.12g",
+  "%.17g", "%.15e" };
+
+// Buffer of numbers of one style
+void makeNumbers(std::string &text, int style, int numberNumbers)
+{
+  unsigned int seed = 123456789;
+  char temp[40];
+  text.clear();
+  for (int i = 0; i < numberNumbers; i++) {
+    seed = 1664525 * seed + 1013904223;
+    double value = static_cast< double >(seed >> 4) / 1048576.0;
+    if (seed & 1)
+      value = -value;
+    switch (style) {
+    case 0:
+      sprintf(temp, "%d", static_cast< int >(seed % 2000) - 1000);
+      break;
+    case 1:
+      sprintf(temp, "%.12g", value);
+      break;
+    case 2:
+      sprintf(temp, "%.17g", value * 1.0e-3);
+      break;
+    default:
+      sprintf(temp, "%.15e", value * 1.0e-100);
+      break;
+    }
+    text += temp;
+    text += ' ';
+  }
+}
+
+// Best time to convert all numbers in text
+double timeConvert(const std::string &text, bool useStrtod, int numberRepeats,
+  std::vector< double > &values)
+{
+  double best = COIN_DBL_MAX;
+  for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++) {
+    values.clear();
+    const char *p = text.c_str();
+    const char *last = p + text.size();
+    double time1 = CoinWallclockTime();
+    if (useStrtod) {
+      while (p < last) {
+        char *end;
+        values.push_back(strtod(p, &end));
+        p = end + 1;
+      }
+    } else {
+      while (p < last) {
+        double value;
+        p = CoinParseDouble(p, last, value) + 1;
+        values.push_back(value);
+      }
+    }
+    best = CoinMin(best, CoinWallclockTime() - time1);
+  }
+  return best;
+}
+}
+
+int main(int argc, const char *argv[])
+{
+  int numberNumbers = 1000000;
+  int numberRepeats = 5;
+  for (int i = 1; i < argc; i++) {
+    if (!strncmp(argv[i], "-numbers=", 9))
+      numberNumbers = CoinMax(1, atoi(argv[i] + 9));
+    else if (!strncmp(argv[i], "-repeat=", 8))
+      numberRepeats = CoinMax(1, atoi(argv[i] + 8));
+    else
+      printf("unknown argument %s\n", argv[i]);
+  }
+  printf("%d numbers of each style\n", numberNumbers);
+  printf("%-10s %8s %12s %12s %8s\n", "style", "MB", "strtod MB/s",
+    "Coin MB/s", "speedup");
+  std::string text;
+  std::vector< double > values1;
+  std::vector< double > values2;
+  bool allSame = true;
+  for (int style = 0; style < numberStyles; style++) {
+    makeNumbers(text, style, numberNumbers);
+    double megabytes = static_cast< double >(text.size()) / 1.0e6;
+    double time1 = timeConvert(text, true, numberRepeats, values1);
+    double time2 = timeConvert(text, false, numberRepeats, values2);
+    bool same = values1.size() == values2.size()
+      && !memcmp(&values1[0], &values2[0], values1.size() * sizeof(double));
+    if (!same)
+      allSame = false;
+    printf("%-10s %8.1f %12.1f %12.1f %8.2f%s\n", styleName[style], megabytes,
+      megabytes / CoinMax(time1, 1.0e-9), megabytes / CoinMax(time2, 1.0e-9),
+      time1 / CoinMax(time2, 1.0e-9), same ? "" : " DIFFERENT FROM STRTOD");
+  }
+  if (!allSame)
+    return 1;
+  printf("all values same as strtod\n");
+  return 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
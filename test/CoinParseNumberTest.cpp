@@ -0,0 +1,148 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "CoinParseNumber.hpp"
+
+namespace {
+
+unsigned long long randomState = 88172645463325252ULL;
+
+unsigned long long randomWord()
+{
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 7;
+  randomState ^= randomState << 17;
+  return randomState;
+}
+
+// Random double (not nan) from random bits
+double randomDouble()
+{
+  double value;
+  do {
+    unsigned long long bits = randomWord();
+    memcpy(&value, &bits, sizeof(double));
+  } while (value != value);
+  return value;
+}
+
+// Whether CoinStrtod gives same bits and end as strtod
+bool sameAsStrtod(const char *string)
+{
+  char *end1;
+  char *end2;
+  double value1 = strtod(string, &end1);
+  double value2 = CoinStrtod(string, &end2);
+  if (memcmp(&value1, &value2, sizeof(double)) || end1 != end2) {
+    printf("CoinStrtod(\"%s\") %.17g (%d characters) strtod %.17g (%d)\n",
+      string, value2, static_cast< int >(end2 - string), value1,
+      static_cast< int >(end1 - string));
+    return false;
+  }
+  return true;
+}
+
+} // end file-local namespace
+
+void CoinParseNumberUnitTest()
+{
+  // Awkward cases
+  {
+    const char *cases[] = { "0", "-0", "+1", "1.", ".5", "-.5", ".", "-",
+      "e5", "1e", "1e+", "1.5e-3x", " \t 12", "12 34", "1,5", "3.0E+5",
+      "inf", "-Infinity", "nan", "0x1p3", "1e400", "-1e400", "1e-400",
+      "4.9406564584124654e-324", "2.4703282292062327e-324",
+      "2.4703282292062328e-324", "2.2250738585072011e-308",
+      "1.7976931348623157e308", "1.7976931348623159e308",
+      "9007199254740993", "9007199254740992.5", "7.1e-10",
+      "123456789012345678901234567890",
+      "00000000000000000000000000000.5",
+      "0.000000000000000000000000000000000000000000001e300",
+      "1.00000000000000011102230246251565404236316680908203125",
+      "1.00000000000000011102230246251565404236316680908203124",
+      "1.00000000000000011102230246251565404236316680908203126",
+      "1e99999999999", "1e-99999999999", "0e99999999999" };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(char *); i++)
+      assert(sameAsStrtod(cases[i]));
+  }
+  // Range need not be null terminated
+  {
+    const char text[] = "12345678.25e3xyz";
+    double value;
+    assert(CoinParseDouble(text, text + 8, value) == text + 8);
+    assert(value == 12345678.0);
+    assert(CoinParseDouble(text, text + 12, value) == text + 11);
+    assert(value == 12345678.25);
+    assert(CoinParseDouble(text, text + 14, value) == text + 13);
+    assert(value == 12345678250.0);
+    assert(CoinParseDouble(text + 13, text + 16, value) == text + 13);
+    assert(value == 0.0);
+  }
+  // Random numbers in the forms writers produce and random digit strings
+  {
+    char buffer[1200];
+    for (int i = 0; i < 200000; i++) {
+      switch (i % 5) {
+      case 0:
+        sprintf(buffer, "%.*g", static_cast< int >(randomWord() % 20) + 1,
+          randomDouble());
+        break;
+      case 1:
+        sprintf(buffer, "%.17e", randomDouble());
+        break;
+      case 2: {
+        // up to 40 digits with a point somewhere and maybe an exponent
+        int numberDigits = 1 + static_cast< int >(randomWord() % 40);
+        int point = static_cast< int >(randomWord() % (numberDigits + 1));
+        int k = 0;
+        if (randomWord() & 1)
+          buffer[k++] = '-';
+        for (int j = 0; j < numberDigits; j++) {
+          if (j == point)
+            buffer[k++] = '.';
+          buffer[k++] = static_cast< char >('0' + randomWord() % 10);
+        }
+        if (randomWord() & 1)
+          k += sprintf(buffer + k, "e%d", static_cast< int >(randomWord() % 700) - 350);
+        buffer[k] = '\0';
+      } break;
+      case 3:
+        sprintf(buffer, "%d.%d", static_cast< int >(randomWord() % 100000),
+          static_cast< int >(randomWord() % 1000000));
+        break;
+      default:
+#if LDBL_MANT_DIG > DBL_MANT_DIG
+      {
+        // exactly half way between two doubles - all digits or not quite
+        double value = fabs(randomDouble());
+        if (value > DBL_MAX / 2.0)
+          value *= 0.25;
+        long double half = (static_cast< long double >(value)
+                             + nextafter(value, 2.0 * value + 1.0))
+          / 2.0L;
+        sprintf(buffer, "%.*Le", (i & 8) ? 1100 : 15 + static_cast< int >(randomWord() % 20),
+          half);
+      }
+#else
+        sprintf(buffer, "%.25e", randomDouble());
+#endif
+        break;
+      }
+      assert(sameAsStrtod(buffer));
+    }
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
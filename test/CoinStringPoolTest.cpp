@@ -0,0 +1,192 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved. This code is published under the Eclipse Public License.
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+#include "CoinStringPool.hpp"
+#include "CoinModelUseful.hpp"
+
+namespace {
+
+// Whether entry which of pool is string (NULL for unset)
+bool isString(const CoinStringPool &pool, int which, const char *string)
+{
+  const char *value = pool.string(which);
+  if (!string)
+    return value == NULL && pool.stringLength(which) < 0;
+  int length = static_cast< int >(strlen(string));
+  return value && !strcmp(value, string)
+    && pool.stringLength(which) == length
+    && pool.sameString(which, string, length)
+    && pool.stringHash(which) == CoinStringPool::hashString(string, length);
+}
+
+} // end file-local namespace
+
+void CoinStringPoolUnitTest()
+{
+  // Adding, setting and removing
+  {
+    CoinStringPool pool;
+    assert(!pool.numberStrings());
+    assert(!pool.string(0));
+    assert(pool.addString("R0000001") == 0);
+    assert(pool.addString("C12345678xyz", 9) == 1);
+    assert(pool.addString("") == 2);
+    assert(isString(pool, 0, "R0000001"));
+    assert(isString(pool, 1, "C12345678"));
+    assert(isString(pool, 2, ""));
+    assert(!pool.string(-1) && !pool.string(3));
+    pool.setString(5, "far");
+    assert(pool.numberStrings() == 6);
+    assert(isString(pool, 3, NULL) && isString(pool, 4, NULL));
+    pool.setString(0, "replaced");
+    assert(isString(pool, 0, "replaced"));
+    pool.removeString(1);
+    assert(isString(pool, 1, NULL));
+    size_t before = pool.numberCharacters();
+    pool.compact();
+    assert(pool.numberCharacters() == before - strlen("C12345678") - 1 - strlen("R0000001") - 1);
+    assert(isString(pool, 0, "replaced"));
+    assert(isString(pool, 5, "far"));
+    // Setting from a string already in the pool while it grows
+    for (int i = 0; i < 2000; i++)
+      pool.setString(6 + i, pool.string(5));
+    for (int i = 0; i < 2000; i++)
+      assert(isString(pool, 6 + i, "far"));
+    pool.resize(3);
+    assert(pool.numberStrings() == 3);
+    assert(isString(pool, 2, ""));
+    // array has every entry set
+    const char *const *array = pool.stringArray();
+    for (int i = 3; i < 2006; i++)
+      assert(!array[i]);
+    pool.clear();
+    assert(!pool.numberStrings() && !pool.numberCharacters());
+  }
+  // Strings stay where they are while others are added and replaced
+  {
+    CoinStringPool pool;
+    pool.addString("R0000000");
+    pool.addString("kept");
+    const char *first = pool.string(0);
+    const char *kept = pool.string(1);
+    char name[20];
+    for (int i = 2; i < 100000; i++) {
+      sprintf(name, "R%07d", i);
+      pool.addString(name);
+      if (i % 3 == 0)
+        pool.setString(i - 1, "replaced name");
+    }
+    pool.reserve(200000, 10 * pool.numberCharacters());
+    int which[] = { 5, 7 };
+    pool.deleteStrings(2, which);
+    assert(pool.string(0) == first && !strcmp(first, "R0000000"));
+    assert(pool.string(1) == kept && !strcmp(kept, "kept"));
+    assert(pool.stringArray()[1] == kept);
+  }
+  // Names given out by CoinModelHash stay valid
+  {
+    CoinModelHash hash;
+    char name[20];
+    hash.addHash(0, "row0");
+    const char *row0 = hash.name(0);
+    for (int i = 1; i < 50000; i++) {
+      sprintf(name, "row%d", i);
+      hash.addHash(i, name);
+    }
+    assert(!strcmp(row0, "row0") && hash.getName(0) == row0);
+    // move a name down as packing does
+    hash.deleteHash(0);
+    hash.setName(0, hash.getName(49999));
+    hash.setName(49999, NULL);
+    assert(!strcmp(hash.name(0), "row49999") && !hash.name(49999));
+  }
+  // Blocks whose strings have all been replaced are freed
+  {
+    CoinStringPool pool;
+    char name[20];
+    for (int i = 0; i < 100; i++) {
+      sprintf(name, "C%07d", i);
+      pool.addString(name);
+    }
+    for (int pass = 0; pass < 100; pass++) {
+      for (int i = 0; i < 100; i++) {
+        sprintf(name, "X%07d_%d", i, pass);
+        pool.setString(i, name);
+      }
+    }
+    assert(pool.numberCharacters() < 100 * 100 * 10);
+    for (int i = 0; i < 100; i++) {
+      sprintf(name, "X%07d_%d", i, 99);
+      assert(isString(pool, i, name));
+    }
+  }
+  // Deleting, appending, copying and swapping
+  {
+    CoinStringPool pool;
+    char name[20];
+    for (int i = 0; i < 10; i++) {
+      sprintf(name, "R%d", i);
+      pool.addString(name);
+    }
+    int which[] = { 7, 0, 3, 3, 12 };
+    pool.deleteStrings(5, which);
+    assert(pool.numberStrings() == 7);
+    const char *left[] = { "R1", "R2", "R4", "R5", "R6", "R8", "R9" };
+    for (int i = 0; i < 7; i++)
+      assert(isString(pool, i, left[i]));
+    CoinStringPool other;
+    other.addString("obj");
+    other.setString(2, "free");
+    pool.append(other);
+    assert(pool.numberStrings() == 10);
+    assert(isString(pool, 7, "obj"));
+    assert(isString(pool, 8, NULL));
+    assert(isString(pool, 9, "free"));
+    assert(other.addString(pool, 0) == 3);
+    assert(isString(other, 3, "R1"));
+    CoinStringPool copy(pool);
+    assert(copy.numberStrings() == 10);
+    for (int i = 0; i < 10; i++)
+      assert(isString(copy, i, pool.string(i)));
+    copy = other;
+    assert(copy.numberStrings() == 4);
+    assert(isString(copy, 3, "R1"));
+    copy.swap(pool);
+    assert(copy.numberStrings() == 10 && pool.numberStrings() == 4);
+    assert(isString(copy, 9, "free"));
+    const char *const *array = copy.stringArray();
+    for (int i = 0; i < 10; i++) {
+      if (i == 8)
+        assert(array[i] == NULL);
+      else
+        assert(!strcmp(array[i], copy.string(i)));
+    }
+  }
+  // Equal strings hash equally and names like R0000001 spread out
+  {
+    char name1[] = "R0000001 long tail";
+    char name2[] = "xR0000001 long tail";
+    assert(CoinStringPool::hashString(name1, 17) == CoinStringPool::hashString(name2 + 1, 17));
+    const int numberBuckets = 1024;
+    int count[numberBuckets];
+    memset(count, 0, sizeof(count));
+    char name[20];
+    for (int i = 0; i < 16 * numberBuckets; i++) {
+      sprintf(name, "R%07d", i);
+      count[CoinStringPool::hashString(name, 8) % numberBuckets]++;
+    }
+    for (int i = 0; i < numberBuckets; i++)
+      assert(count[i] > 0 && count[i] < 64);
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
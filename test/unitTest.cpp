@@ -28,11 +28,16 @@
 #include "CoinLpIO.hpp"
 #include "CoinMessageHandler.hpp"
 #include "CoinKnapsackRow.hpp"
+#include "CoinParseNumber.hpp"
 
 void CoinKnapsackRowUnitTest();
 void CoinModelUnitTest(const std::string & mpsDir,
                        const std::string & netlibDir, const std::string & testModel);
 void CoinStaticConflictGraphUnitTest();
+void CoinParseNumberUnitTest();
+void CoinStringPoolUnitTest();
+void CoinNameHashUnitTest();
+void CoinFactorizationUnitTest();
 // Function Prototypes. Function definitions is in this file.
 void testingMessage( const char * const msg );
 
@@ -218,6 +223,18 @@ int main (int argc, const char *argv[])
   testingMessage( "Testing CoinKnapsackRow\n" );
   CoinKnapsackRowUnitTest();
 
+  testingMessage( "Testing CoinParseNumber\n" );
+  CoinParseNumberUnitTest();
+
+  testingMessage( "Testing CoinStringPool\n" );
+  CoinStringPoolUnitTest();
+
+  testingMessage( "Testing CoinNameHash\n" );
+  CoinNameHashUnitTest();
+
+  testingMessage( "Testing CoinFactorization\n" );
+  CoinFactorizationUnitTest();
+
 // At moment CoinDenseVector is not compiling with MS V C++ V6
 #if 1
   testingMessage( "Testing CoinDenseVector\n" );